@@ -1,15 +1,22 @@
 #include "software/ai/ai.h"
 
+#include <algorithm>
 #include <chrono>
+#include <optional>
 
 #include "software/ai/hl/stp/play/halt_play.h"
 #include "software/ai/hl/stp/stp.h"
 #include "software/ai/navigator/path_manager/velocity_obstacle_path_manager.h"
 #include "software/ai/navigator/path_planner/theta_star_path_planner.h"
+#include "software/ai/passing/pass_generation_deadline.h"
+#include "software/ai/profiler/allocation_tracker.h"
+#include "software/util/memory/protobuf_arena_options.h"
 
-AI::AI(std::shared_ptr<const AiConfig> ai_config,
-       std::shared_ptr<const AiControlConfig> control_config,
-       std::shared_ptr<const PlayConfig> play_config)
+AI::AI(
+    std::shared_ptr<const AiConfig> ai_config,
+    std::shared_ptr<const AiControlConfig> control_config,
+    std::shared_ptr<const PlayConfig> play_config,
+    std::shared_ptr<const ThreadedPassGenerator<EighteenZoneId>> threaded_pass_generator)
     : navigator(std::make_shared<Navigator>(
           std::make_unique<VelocityObstaclePathManager>(
               std::make_unique<ThetaStarPathPlanner>(),
@@ -21,15 +28,104 @@ AI::AI(std::shared_ptr<const AiConfig> ai_config,
       high_level(std::make_unique<STP>(
           [play_config]() { return std::make_unique<HaltPlay>(play_config); },
           control_config, play_config,
-          std::chrono::system_clock::now().time_since_epoch().count()))
+          std::chrono::system_clock::now().time_since_epoch().count(),
+          threaded_pass_generator)),
+      control_config(control_config),
+      profiler(),
+      ai_profile(),
+      primitive_set_arena_initial_block(PRIMITIVE_SET_ARENA_INITIAL_BLOCK_SIZE),
+      primitive_set_arena(createProtobufArenaOptions(primitive_set_arena_initial_block)),
+      primitive_set(google::protobuf::Arena::CreateMessage<TbotsProto::PrimitiveSet>(
+          &primitive_set_arena)),
+      tick_arena(TICK_ARENA_INITIAL_BLOCK_SIZE),
+      friendly_spatial_partition(),
+      enemy_spatial_partition(),
+      last_navigator_duration(0),
+      last_non_pass_generation_hl_duration(0),
+      last_num_pass_generations(1)
 {
 }
 
-std::unique_ptr<TbotsProto::PrimitiveSet> AI::getPrimitives(const World &world) const
+const TbotsProto::PrimitiveSet &AI::getPrimitives(const World &world)
 {
-    std::vector<std::unique_ptr<Intent>> assigned_intents = high_level->getIntents(world);
+    auto tick_start_time = std::chrono::steady_clock::now();
 
-    return navigator->getAssignedPrimitives(world, assigned_intents);
+    AIProfiler::setEnabled(control_config->getProfileAi()->value());
+    AllocationTracker::setEnabled(control_config->getTrackAiAllocations()->value());
+    profiler.startTick();
+
+    // Nothing allocated from the tick arena during the previous tick is still alive,
+    // so its memory is reused for this tick
+    tick_arena.release();
+    ScopedCurrentArena scoped_tick_arena(tick_arena);
+
+    {
+        PROFILE_SCOPE("SpatialPartition::update");
+        friendly_spatial_partition.update(world.friendlyTeam().getAllRobots());
+        enemy_spatial_partition.update(world.enemyTeam().getAllRobots());
+    }
+
+    // A new cache is created every tick so that evaluations of the World are shared by
+    // all the plays and tactics that run this tick, but never reused once the World
+    // has changed
+    auto evaluation_cache = std::make_shared<EvaluationCache>(
+        world, friendly_spatial_partition, enemy_spatial_partition);
+    std::vector<std::unique_ptr<Intent>> assigned_intents;
+    {
+        // Pass generation can use whatever time is left in the tick, as long as it
+        // leaves enough time for the rest of HL and the navigator, which we estimate
+        // from how long they took last tick. The time is shared between as many pass
+        // generations as there were last tick, since some plays generate passes more
+        // than once per tick
+        std::optional<ScopedPassGenerationDeadline> pass_generation_deadline;
+        double tick_time_budget_ms = control_config->getTickTimeBudgetMs()->value();
+        if (tick_time_budget_ms > 0)
+        {
+            pass_generation_deadline.emplace(
+                tick_start_time +
+                    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                        std::chrono::duration<double, std::milli>(tick_time_budget_ms)) -
+                    last_navigator_duration - last_non_pass_generation_hl_duration,
+                last_num_pass_generations);
+        }
+
+        auto high_level_start_time = std::chrono::steady_clock::now();
+        {
+            PROFILE_SCOPE("HL::getIntents");
+            assigned_intents = high_level->getIntents(world, evaluation_cache);
+        }
+
+        if (pass_generation_deadline)
+        {
+            last_non_pass_generation_hl_duration =
+                std::chrono::steady_clock::now() - high_level_start_time -
+                pass_generation_deadline->getPassGenerationDuration();
+            last_num_pass_generations =
+                std::max(1u, pass_generation_deadline->getNumPassGenerations());
+        }
+    }
+
+    // The previous PrimitiveSet is no longer used, so its memory is reused for the new
+    // one
+    primitive_set_arena.Reset();
+    primitive_set = google::protobuf::Arena::CreateMessage<TbotsProto::PrimitiveSet>(
+        &primitive_set_arena);
+    auto navigator_start_time = std::chrono::steady_clock::now();
+    navigator->getAssignedPrimitives(world, assigned_intents, *primitive_set);
+    last_navigator_duration = std::chrono::steady_clock::now() - navigator_start_time;
+    primitive_set->set_trace_id(world.getTraceId());
+
+    ai_profile                                  = *profiler.endTick();
+    EvaluationCacheStats evaluation_cache_stats = evaluation_cache->getTotalStats();
+    ai_profile.set_evaluation_cache_hits(evaluation_cache_stats.hits);
+    ai_profile.set_evaluation_cache_misses(evaluation_cache_stats.misses);
+
+    return *primitive_set;
+}
+
+const TbotsProto::AiProfile &AI::getAiProfile() const
+{
+    return ai_profile;
 }
 
 PlayInfo AI::getPlayInfo() const
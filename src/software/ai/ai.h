@@ -1,9 +1,19 @@
 #pragma once
 
+#include <google/protobuf/arena.h>
+
+#include <chrono>
+
+#include "software/ai/evaluation/evaluation_cache.h"
+#include "software/ai/evaluation/spatial_partition.h"
 #include "software/ai/hl/hl.h"
 #include "software/ai/hl/stp/play_info.h"
 #include "software/ai/navigator/navigator.h"
+#include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/ai/passing/threaded_pass_generator.h"
+#include "software/ai/profiler/ai_profiler.h"
 #include "software/time/timestamp.h"
+#include "software/util/memory/monotonic_arena.h"
 #include "software/world/world.h"
 
 /**
@@ -19,10 +29,15 @@ class AI final
      * @param ai_config The AI configuration
      * @param control_config The AI Control configuration
      * @param play_config The Play configuration
+     * @param threaded_pass_generator The pass generator that is searching for passes
+     * in the background, which plays can use instead of generating passes during the
+     * tick. If this is nullptr, plays generate all their passes during the tick
      */
     explicit AI(std::shared_ptr<const AiConfig> ai_config,
                 std::shared_ptr<const AiControlConfig> control_config,
-                std::shared_ptr<const PlayConfig> play_config);
+                std::shared_ptr<const PlayConfig> play_config,
+                std::shared_ptr<const ThreadedPassGenerator<EighteenZoneId>>
+                    threaded_pass_generator = nullptr);
 
     /**
      * Calculates the Primitives that should be run by our Robots given the current
@@ -31,9 +46,18 @@ class AI final
      * @param world The state of the World with which to make the decisions
      *
      * @return the Primitives that should be run by our Robots given the current
-     * state of the world.
+     * state of the world. The PrimitiveSet is owned by the AI and is only valid until
+     * the next call to getPrimitives
+     */
+    const TbotsProto::PrimitiveSet& getPrimitives(const World& world);
+
+    /**
+     * Returns how long each stage of the AI took during the most recent call to
+     * getPrimitives
+     *
+     * @return the profile of the most recent call to getPrimitives
      */
-    std::unique_ptr<TbotsProto::PrimitiveSet> getPrimitives(const World& world) const;
+    const TbotsProto::AiProfile& getAiProfile() const;
 
     /**
      * Returns information about the currently running plays and tactics, including the
@@ -48,4 +72,48 @@ class AI final
    private:
     std::shared_ptr<Navigator> navigator;
     std::unique_ptr<HL> high_level;
+    std::shared_ptr<const AiControlConfig> control_config;
+    AIProfiler profiler;
+    TbotsProto::AiProfile ai_profile;
+
+    // The size of the block of memory reserved for the PrimitiveSet arena. This is
+    // much more than a PrimitiveSet for a full team needs, so the arena never has to
+    // allocate more memory
+    static constexpr std::size_t PRIMITIVE_SET_ARENA_INITIAL_BLOCK_SIZE = 64 * 1024;
+
+    // The PrimitiveSet is rebuilt on the arena every tick, and the arena is reset
+    // rather than freed, so building the PrimitiveSet doesn't allocate any memory
+    std::vector<char> primitive_set_arena_initial_block;
+    google::protobuf::Arena primitive_set_arena;
+    // The PrimitiveSet from the most recent call to getPrimitives, owned by the arena
+    TbotsProto::PrimitiveSet* primitive_set;
+
+    // The initial size of the arena for temporary data that only lives for one tick.
+    // The arena grows to fit the largest tick it has seen, so this only has to be
+    // large enough for a typical tick
+    static constexpr std::size_t TICK_ARENA_INITIAL_BLOCK_SIZE = 4 * 1024 * 1024;
+
+    // The current arena while the AI is ticking, which temporary data that is
+    // destroyed before the end of the tick (ex. path planning search state) is
+    // allocated from. It is released at the start of every tick
+    MonotonicArena tick_arena;
+
+    // Partitions of each team's robots, which are given to the EvaluationCache every
+    // tick. They are kept across ticks and updated to each World, so that they only
+    // have to be rebuilt when the robots move enough to change the partition
+    SpatialPartition friendly_spatial_partition;
+    SpatialPartition enemy_spatial_partition;
+
+    // How long the navigator took during the most recent call to getPrimitives. This
+    // is kept free at the end of the tick when giving pass generation a deadline
+    std::chrono::steady_clock::duration last_navigator_duration;
+
+    // How long HL took during the most recent call to getPrimitives, not counting the
+    // time spent generating passes. This is also kept free when giving pass generation
+    // a deadline, so that the rest of HL can run after it
+    std::chrono::steady_clock::duration last_non_pass_generation_hl_duration;
+
+    // How many times passes were generated during the most recent call to
+    // getPrimitives, which the pass generation deadline is shared between
+    unsigned int last_num_pass_generations;
 };
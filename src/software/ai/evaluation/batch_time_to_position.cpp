@@ -0,0 +1,226 @@
+#include "software/ai/evaluation/batch_time_to_position.h"
+
+#include <stdexcept>
+
+#include "software/ai/evaluation/pass.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define BATCH_TIME_TO_POSITION_X86
+#endif
+
+// See batch_geometry.cpp for why each SIMD function has its own target attribute. Each
+// SIMD implementation calculates both the peak velocity and the cruising travel time
+// for every robot, and then picks the one getTravelTimeSeconds would have used, so the
+// results are exactly the same as the scalar function.
+
+namespace
+{
+    void batchTimeToPositionPortable(const PointBuffer& starts,
+                                     const PointBuffer& initial_velocities,
+                                     const Point& dest, double max_velocity,
+                                     double max_acceleration, double tolerance_meters,
+                                     std::size_t begin, double* times_seconds)
+    {
+        for (std::size_t k = begin; k < starts.size(); k++)
+        {
+            const Point velocity = initial_velocities[k];
+            times_seconds[k]     = getTimeToPositionForRobot(
+                                   starts[k], Vector(velocity.x(), velocity.y()), dest,
+                                   max_velocity, max_acceleration, tolerance_meters)
+                                   .toSeconds();
+        }
+    }
+
+#ifdef BATCH_TIME_TO_POSITION_X86
+    __attribute__((target("sse2"))) void batchTimeToPositionSse2(
+        const PointBuffer& starts, const PointBuffer& initial_velocities,
+        const Point& dest, double max_velocity, double max_acceleration,
+        double tolerance_meters, double* times_seconds)
+    {
+        // See getTimeToPositionForRobot and getTravelTimeSeconds for the scalar version
+        const __m128d dest_x            = _mm_set1_pd(dest.x());
+        const __m128d dest_y            = _mm_set1_pd(dest.y());
+        const __m128d tolerance         = _mm_set1_pd(tolerance_meters);
+        const __m128d v_max             = _mm_set1_pd(max_velocity);
+        const __m128d negative_v_max    = _mm_set1_pd(-max_velocity);
+        const __m128d a_max             = _mm_set1_pd(max_acceleration);
+        const __m128d two_a_max         = _mm_set1_pd(2 * max_acceleration);
+        const __m128d two_v_max         = _mm_set1_pd(2 * max_velocity);
+        const __m128d two_v_max_squared = _mm_set1_pd(2 * max_velocity * max_velocity);
+        const __m128d two               = _mm_set1_pd(2);
+        const __m128d half              = _mm_set1_pd(0.5);
+        const __m128d zero              = _mm_setzero_pd();
+        const __m128d sign_bit          = _mm_set1_pd(-0.0);
+
+        std::size_t k = 0;
+        for (; k + 2 <= starts.size(); k += 2)
+        {
+            const __m128d dx = _mm_sub_pd(dest_x, _mm_loadu_pd(starts.xData() + k));
+            const __m128d dy = _mm_sub_pd(dest_y, _mm_loadu_pd(starts.yData() + k));
+            const __m128d vx = _mm_loadu_pd(initial_velocities.xData() + k);
+            const __m128d vy = _mm_loadu_pd(initial_velocities.yData() + k);
+
+            const __m128d length =
+                _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)));
+            const __m128d dist = _mm_max_pd(_mm_sub_pd(length, tolerance), zero);
+            const __m128d velocity_towards_dest = _mm_and_pd(
+                _mm_cmpgt_pd(length, zero),
+                _mm_div_pd(_mm_add_pd(_mm_mul_pd(vx, dx), _mm_mul_pd(vy, dy)), length));
+
+            const __m128d u =
+                _mm_max_pd(_mm_min_pd(velocity_towards_dest, v_max), negative_v_max);
+            const __m128d abs_u         = _mm_andnot_pd(sign_bit, u);
+            const __m128d stopping_dist = _mm_div_pd(_mm_mul_pd(u, abs_u), two_a_max);
+
+            const __m128d must_stop_first =
+                _mm_or_pd(_mm_cmplt_pd(u, zero), _mm_cmpgt_pd(stopping_dist, dist));
+            const __m128d time_to_stop =
+                _mm_and_pd(must_stop_first, _mm_div_pd(abs_u, a_max));
+            const __m128d remaining_dist = _mm_or_pd(
+                _mm_and_pd(must_stop_first,
+                           _mm_andnot_pd(sign_bit, _mm_sub_pd(dist, stopping_dist))),
+                _mm_andnot_pd(must_stop_first, dist));
+            const __m128d velocity         = _mm_andnot_pd(must_stop_first, u);
+            const __m128d velocity_squared = _mm_mul_pd(velocity, velocity);
+
+            const __m128d peak_velocity = _mm_sqrt_pd(_mm_add_pd(
+                _mm_mul_pd(a_max, remaining_dist), _mm_mul_pd(velocity_squared, half)));
+            const __m128d peak_travel_time =
+                _mm_div_pd(_mm_sub_pd(_mm_mul_pd(two, peak_velocity), velocity), a_max);
+            const __m128d cruise_travel_time = _mm_add_pd(
+                _mm_div_pd(_mm_sub_pd(two_v_max, velocity), a_max),
+                _mm_div_pd(
+                    _mm_sub_pd(remaining_dist,
+                               _mm_div_pd(_mm_sub_pd(two_v_max_squared, velocity_squared),
+                                          two_a_max)),
+                    v_max));
+            const __m128d reaches_peak_velocity = _mm_cmple_pd(peak_velocity, v_max);
+            const __m128d travel_time =
+                _mm_or_pd(_mm_and_pd(reaches_peak_velocity, peak_travel_time),
+                          _mm_andnot_pd(reaches_peak_velocity, cruise_travel_time));
+
+            _mm_storeu_pd(times_seconds + k,
+                          _mm_and_pd(_mm_cmpgt_pd(dist, zero),
+                                     _mm_add_pd(time_to_stop, travel_time)));
+        }
+        batchTimeToPositionPortable(starts, initial_velocities, dest, max_velocity,
+                                    max_acceleration, tolerance_meters, k, times_seconds);
+    }
+
+    __attribute__((target("avx2"))) void batchTimeToPositionAvx2(
+        const PointBuffer& starts, const PointBuffer& initial_velocities,
+        const Point& dest, double max_velocity, double max_acceleration,
+        double tolerance_meters, double* times_seconds)
+    {
+        const __m256d dest_x            = _mm256_set1_pd(dest.x());
+        const __m256d dest_y            = _mm256_set1_pd(dest.y());
+        const __m256d tolerance         = _mm256_set1_pd(tolerance_meters);
+        const __m256d v_max             = _mm256_set1_pd(max_velocity);
+        const __m256d negative_v_max    = _mm256_set1_pd(-max_velocity);
+        const __m256d a_max             = _mm256_set1_pd(max_acceleration);
+        const __m256d two_a_max         = _mm256_set1_pd(2 * max_acceleration);
+        const __m256d two_v_max         = _mm256_set1_pd(2 * max_velocity);
+        const __m256d two_v_max_squared = _mm256_set1_pd(2 * max_velocity * max_velocity);
+        const __m256d two               = _mm256_set1_pd(2);
+        const __m256d half              = _mm256_set1_pd(0.5);
+        const __m256d zero              = _mm256_setzero_pd();
+        const __m256d sign_bit          = _mm256_set1_pd(-0.0);
+
+        std::size_t k = 0;
+        for (; k + 4 <= starts.size(); k += 4)
+        {
+            const __m256d dx = _mm256_sub_pd(dest_x, _mm256_loadu_pd(starts.xData() + k));
+            const __m256d dy = _mm256_sub_pd(dest_y, _mm256_loadu_pd(starts.yData() + k));
+            const __m256d vx = _mm256_loadu_pd(initial_velocities.xData() + k);
+            const __m256d vy = _mm256_loadu_pd(initial_velocities.yData() + k);
+
+            const __m256d length = _mm256_sqrt_pd(
+                _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)));
+            const __m256d dist = _mm256_max_pd(_mm256_sub_pd(length, tolerance), zero);
+            const __m256d velocity_towards_dest = _mm256_and_pd(
+                _mm256_cmp_pd(length, zero, _CMP_GT_OQ),
+                _mm256_div_pd(_mm256_add_pd(_mm256_mul_pd(vx, dx), _mm256_mul_pd(vy, dy)),
+                              length));
+
+            const __m256d u = _mm256_max_pd(_mm256_min_pd(velocity_towards_dest, v_max),
+                                            negative_v_max);
+            const __m256d abs_u = _mm256_andnot_pd(sign_bit, u);
+            const __m256d stopping_dist =
+                _mm256_div_pd(_mm256_mul_pd(u, abs_u), two_a_max);
+
+            const __m256d must_stop_first =
+                _mm256_or_pd(_mm256_cmp_pd(u, zero, _CMP_LT_OQ),
+                             _mm256_cmp_pd(stopping_dist, dist, _CMP_GT_OQ));
+            const __m256d time_to_stop =
+                _mm256_and_pd(must_stop_first, _mm256_div_pd(abs_u, a_max));
+            const __m256d remaining_dist = _mm256_blendv_pd(
+                dist, _mm256_andnot_pd(sign_bit, _mm256_sub_pd(dist, stopping_dist)),
+                must_stop_first);
+            const __m256d velocity         = _mm256_andnot_pd(must_stop_first, u);
+            const __m256d velocity_squared = _mm256_mul_pd(velocity, velocity);
+
+            const __m256d peak_velocity =
+                _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(a_max, remaining_dist),
+                                             _mm256_mul_pd(velocity_squared, half)));
+            const __m256d peak_travel_time = _mm256_div_pd(
+                _mm256_sub_pd(_mm256_mul_pd(two, peak_velocity), velocity), a_max);
+            const __m256d cruise_travel_time = _mm256_add_pd(
+                _mm256_div_pd(_mm256_sub_pd(two_v_max, velocity), a_max),
+                _mm256_div_pd(_mm256_sub_pd(remaining_dist,
+                                            _mm256_div_pd(_mm256_sub_pd(two_v_max_squared,
+                                                                        velocity_squared),
+                                                          two_a_max)),
+                              v_max));
+            const __m256d travel_time =
+                _mm256_blendv_pd(cruise_travel_time, peak_travel_time,
+                                 _mm256_cmp_pd(peak_velocity, v_max, _CMP_LE_OQ));
+
+            _mm256_storeu_pd(times_seconds + k,
+                             _mm256_and_pd(_mm256_cmp_pd(dist, zero, _CMP_GT_OQ),
+                                           _mm256_add_pd(time_to_stop, travel_time)));
+        }
+        batchTimeToPositionPortable(starts, initial_velocities, dest, max_velocity,
+                                    max_acceleration, tolerance_meters, k, times_seconds);
+    }
+#endif
+}  // namespace
+
+void batchTimeToPosition(const PointBuffer& starts, const PointBuffer& initial_velocities,
+                         const Point& dest, double max_velocity, double max_acceleration,
+                         double tolerance_meters, std::vector<double>& times_seconds,
+                         BatchGeometryImplementation implementation)
+{
+    if (starts.size() != initial_velocities.size())
+    {
+        throw std::invalid_argument(
+            "There must be the same number of robot positions and velocities");
+    }
+    if (!isBatchGeometryImplementationSupported(implementation))
+    {
+        throw std::invalid_argument(
+            "Batch geometry implementation is not supported by this CPU");
+    }
+    times_seconds.resize(starts.size());
+
+    switch (implementation)
+    {
+#ifdef BATCH_TIME_TO_POSITION_X86
+        case BatchGeometryImplementation::AVX2:
+            batchTimeToPositionAvx2(starts, initial_velocities, dest, max_velocity,
+                                    max_acceleration, tolerance_meters,
+                                    times_seconds.data());
+            return;
+        case BatchGeometryImplementation::SSE2:
+            batchTimeToPositionSse2(starts, initial_velocities, dest, max_velocity,
+                                    max_acceleration, tolerance_meters,
+                                    times_seconds.data());
+            return;
+#endif
+        default:
+            batchTimeToPositionPortable(starts, initial_velocities, dest, max_velocity,
+                                        max_acceleration, tolerance_meters, 0,
+                                        times_seconds.data());
+            return;
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+
+#include "software/geom/algorithms/batch_geometry.h"
+#include "software/geom/point.h"
+#include "software/geom/point_buffer.h"
+
+/**
+ * Calculates the minimum time it would take each of the given robots to reach the
+ * destination, the same way as getTimeToPositionForRobot(const Point&, const Vector&,
+ * const Point&, double, double, double)
+ *
+ * This is meant for rating a destination against every robot on a team at once. Like
+ * the batch geometry functions, the SSE2 and AVX2 implementations give exactly the
+ * same results as calling the scalar function on each robot.
+ *
+ * @param starts The positions of the robots
+ * @param initial_velocities The velocities of the robots, with the x and y components
+ * of velocity i stored as the x and y coordinates of point i
+ * @param dest The destination that the robots are going to
+ * @param max_velocity The maximum linear velocity the robots can travel at (m/s)
+ * @param max_acceleration The maximum acceleration of the robots (m/s^2)
+ * @param tolerance_meters The radius around the destination at which a robot will be
+ * considered "at" the destination
+ * @param times_seconds Resized to the number of robots, with element i set to the time
+ * it would take robot i to reach the destination, in seconds. Passing the same vector
+ * to every call avoids allocating
+ * @param implementation The implementation to use
+ *
+ * @throws std::invalid_argument if the number of starts and velocities are different,
+ * or the implementation can't run on this CPU
+ */
+void batchTimeToPosition(
+    const PointBuffer& starts, const PointBuffer& initial_velocities, const Point& dest,
+    double max_velocity, double max_acceleration, double tolerance_meters,
+    std::vector<double>& times_seconds,
+    BatchGeometryImplementation implementation = getFastestBatchGeometryImplementation());
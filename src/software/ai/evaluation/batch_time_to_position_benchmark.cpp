@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <random>
+
+#include "software/ai/evaluation/batch_time_to_position.h"
+#include "software/ai/evaluation/pass.h"
+
+/**
+ * Benchmarks for the time to position estimates, comparing the estimate from rest, the
+ * velocity aware estimate, and batchTimeToPosition.
+ *
+ * The batch benchmark takes the BatchGeometryImplementation to use as an argument
+ * (0 = PORTABLE, 1 = SSE2, 2 = AVX2). Each iteration estimates the time for NUM_ROBOTS
+ * robots with random positions on the field and random velocities to reach the same
+ * destination.
+ *
+ * Run with: bazel run -c opt //software/ai/evaluation:batch_time_to_position_benchmark
+ */
+
+namespace
+{
+    const std::size_t NUM_ROBOTS  = 1024;
+    const double MAX_VELOCITY     = 3.0;
+    const double MAX_ACCELERATION = 3.0;
+    const double TOLERANCE_METERS = 0.09;
+    const Point DEST              = Point(1.5, -0.5);
+
+    /**
+     * Creates random robot positions on the field and random velocities
+     *
+     * @return the positions and velocities
+     */
+    std::pair<std::vector<Point>, std::vector<Vector>> createRandomRobots()
+    {
+        std::mt19937 random_generator(1);
+        std::uniform_real_distribution<double> x_distribution(-4.5, 4.5);
+        std::uniform_real_distribution<double> y_distribution(-3, 3);
+        std::uniform_real_distribution<double> velocity_distribution(-2, 2);
+        std::vector<Point> positions;
+        std::vector<Vector> velocities;
+        for (std::size_t i = 0; i < NUM_ROBOTS; i++)
+        {
+            positions.emplace_back(x_distribution(random_generator),
+                                   y_distribution(random_generator));
+            velocities.emplace_back(velocity_distribution(random_generator),
+                                    velocity_distribution(random_generator));
+        }
+        return {positions, velocities};
+    }
+
+    void benchmarkTimeToPositionFromRest(benchmark::State& state)
+    {
+        const auto [positions, velocities] = createRandomRobots();
+        std::vector<double> times_seconds(positions.size());
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < positions.size(); i++)
+            {
+                times_seconds[i] =
+                    getTimeToPositionForRobot(positions[i], DEST, MAX_VELOCITY,
+                                              MAX_ACCELERATION, TOLERANCE_METERS)
+                        .toSeconds();
+            }
+            benchmark::DoNotOptimize(times_seconds.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_ROBOTS));
+    }
+
+    void benchmarkTimeToPositionWithVelocity(benchmark::State& state)
+    {
+        const auto [positions, velocities] = createRandomRobots();
+        std::vector<double> times_seconds(positions.size());
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < positions.size(); i++)
+            {
+                times_seconds[i] = getTimeToPositionForRobot(
+                                       positions[i], velocities[i], DEST, MAX_VELOCITY,
+                                       MAX_ACCELERATION, TOLERANCE_METERS)
+                                       .toSeconds();
+            }
+            benchmark::DoNotOptimize(times_seconds.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_ROBOTS));
+    }
+
+    void benchmarkBatchTimeToPosition(benchmark::State& state)
+    {
+        auto implementation = static_cast<BatchGeometryImplementation>(state.range(0));
+        if (!isBatchGeometryImplementationSupported(implementation))
+        {
+            state.SkipWithError("Implementation is not supported by this CPU");
+            return;
+        }
+        state.SetLabel(allStringValuesBatchGeometryImplementation().at(
+            static_cast<std::size_t>(state.range(0))));
+
+        const auto [positions, velocities] = createRandomRobots();
+        std::vector<Point> velocity_points;
+        for (const Vector& velocity : velocities)
+        {
+            velocity_points.emplace_back(velocity.x(), velocity.y());
+        }
+        const PointBuffer starts(positions);
+        const PointBuffer initial_velocities(velocity_points);
+        std::vector<double> times_seconds;
+        for (auto _ : state)
+        {
+            batchTimeToPosition(starts, initial_velocities, DEST, MAX_VELOCITY,
+                                MAX_ACCELERATION, TOLERANCE_METERS, times_seconds,
+                                implementation);
+            benchmark::DoNotOptimize(times_seconds.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_ROBOTS));
+    }
+}  // namespace
+
+BENCHMARK(benchmarkTimeToPositionFromRest);
+BENCHMARK(benchmarkTimeToPositionWithVelocity);
+BENCHMARK(benchmarkBatchTimeToPosition)->DenseRange(0, 2);
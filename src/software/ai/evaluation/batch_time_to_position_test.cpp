@@ -0,0 +1,138 @@
+#include "software/ai/evaluation/batch_time_to_position.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/ai/evaluation/pass.h"
+
+// Each implementation is checked against the scalar function, on robots that cover
+// every case of the motion profile: already at the destination, moving towards it
+// slowly and at full speed, moving away from it, and moving too fast to stop at it.
+// The number of robots is not a multiple of the SIMD width, so that the robots left
+// over at the end are checked too.
+class BatchTimeToPositionTest
+    : public ::testing::TestWithParam<BatchGeometryImplementation>
+{
+   protected:
+    /**
+     * Checks that batchTimeToPosition gives exactly the same times as the scalar
+     * function
+     *
+     * @param starts The positions of the robots
+     * @param velocities The velocities of the robots
+     * @param dest The destination
+     * @param tolerance_meters The tolerance around the destination
+     */
+    void checkSameAsScalar(const std::vector<Point>& starts,
+                           const std::vector<Vector>& velocities, const Point& dest,
+                           double tolerance_meters)
+    {
+        std::vector<Point> velocity_points;
+        for (const Vector& velocity : velocities)
+        {
+            velocity_points.emplace_back(velocity.x(), velocity.y());
+        }
+
+        std::vector<double> times_seconds;
+        batchTimeToPosition(PointBuffer(starts), PointBuffer(velocity_points), dest,
+                            MAX_VELOCITY, MAX_ACCELERATION, tolerance_meters,
+                            times_seconds, GetParam());
+
+        ASSERT_EQ(starts.size(), times_seconds.size());
+        for (std::size_t i = 0; i < starts.size(); i++)
+        {
+            EXPECT_EQ(
+                getTimeToPositionForRobot(starts[i], velocities[i], dest, MAX_VELOCITY,
+                                          MAX_ACCELERATION, tolerance_meters)
+                    .toSeconds(),
+                times_seconds[i])
+                << "Robot at " << starts[i] << " with velocity " << velocities[i];
+        }
+    }
+
+    static constexpr double MAX_VELOCITY     = 2.0;
+    static constexpr double MAX_ACCELERATION = 3.0;
+};
+
+TEST_P(BatchTimeToPositionTest, every_case_of_the_motion_profile)
+{
+    Point dest(1, -0.5);
+    std::vector<Point> starts      = {dest,
+                                 dest,
+                                 Point(-3, -0.5),
+                                 Point(-3, -0.5),
+                                 Point(1, 0.5),
+                                 Point(0.9, -0.5),
+                                 Point(4, 2),
+                                 Point(-4, 3),
+                                 Point(1, 2),
+                                 Point(0, 0),
+                                 Point(1.5, -0.5)};
+    std::vector<Vector> velocities = {Vector(),       Vector(1, 1),    Vector(),
+                                      Vector(2, 0),   Vector(0, -0.5), Vector(3, 0),
+                                      Vector(1, 1),   Vector(-1, 0.5), Vector(0, 5),
+                                      Vector(0.5, 0), Vector(-0.2, 0)};
+
+    checkSameAsScalar(starts, velocities, dest, 0);
+    checkSameAsScalar(starts, velocities, dest, 0.09);
+}
+
+TEST_P(BatchTimeToPositionTest, random_robots)
+{
+    std::mt19937 random_generator(1);
+    std::uniform_real_distribution<double> coordinate_distribution(-5, 5);
+    std::uniform_real_distribution<double> velocity_distribution(-3, 3);
+
+    std::vector<Point> starts;
+    std::vector<Vector> velocities;
+    for (std::size_t i = 0; i < 103; i++)
+    {
+        starts.emplace_back(coordinate_distribution(random_generator),
+                            coordinate_distribution(random_generator));
+        velocities.emplace_back(velocity_distribution(random_generator),
+                                velocity_distribution(random_generator));
+    }
+
+    checkSameAsScalar(starts, velocities, Point(0.5, 0.25), 0.09);
+}
+
+TEST_P(BatchTimeToPositionTest, no_robots)
+{
+    std::vector<double> times_seconds = {1, 2, 3};
+    batchTimeToPosition(PointBuffer(), PointBuffer(), Point(), 2, 3, 0, times_seconds,
+                        GetParam());
+    EXPECT_TRUE(times_seconds.empty());
+}
+
+TEST_P(BatchTimeToPositionTest, different_number_of_starts_and_velocities)
+{
+    std::vector<double> times_seconds;
+    EXPECT_THROW(
+        batchTimeToPosition(PointBuffer({Point(), Point(1, 1)}), PointBuffer({Point()}),
+                            Point(), 2, 3, 0, times_seconds, GetParam()),
+        std::invalid_argument);
+}
+
+/**
+ * Returns the implementations that can run on this CPU, so that the tests are only
+ * instantiated for those
+ *
+ * @return the implementations that can run on this CPU
+ */
+std::vector<BatchGeometryImplementation> getSupportedImplementations()
+{
+    std::vector<BatchGeometryImplementation> implementations;
+    for (BatchGeometryImplementation implementation :
+         allValuesBatchGeometryImplementation())
+    {
+        if (isBatchGeometryImplementationSupported(implementation))
+        {
+            implementations.push_back(implementation);
+        }
+    }
+    return implementations;
+}
+
+INSTANTIATE_TEST_CASE_P(AllImplementations, BatchTimeToPositionTest,
+                        ::testing::ValuesIn(getSupportedImplementations()));
@@ -1,5 +1,7 @@
 #include "software/ai/evaluation/calc_best_shot.h"
 
+#include "software/util/memory/arena_allocator.h"
+
 std::optional<Shot> calcBestShotOnGoal(const Segment &goal_post, const Point &shot_origin,
                                        const std::vector<Robot> &robot_obstacles,
                                        TeamType goal, double radius)
@@ -9,7 +11,9 @@ std::optional<Shot> calcBestShotOnGoal(const Segment &goal_post, const Point &sh
     Angle pos_post_angle = (goal_post.getStart() - shot_origin).orientation();
     Angle neg_post_angle = (goal_post.getEnd() - shot_origin).orientation();
 
-    std::vector<AngleSegment> obstacles;
+    // This is called many times per tick, so the obstacles are allocated from the
+    // current arena if there is one
+    ArenaVector<AngleSegment> obstacles;
     obstacles.reserve(max_num_obstacles);
 
     if (goal == TeamType::FRIENDLY)
@@ -96,7 +100,7 @@ std::optional<Shot> calcBestShotOnGoal(const Field &field, const Team &friendly_
                                        double radius)
 {
     std::vector<Robot> obstacles;
-    std::vector<Robot> all_robots;
+    ArenaVector<Robot> all_robots;
 
     size_t max_num_robots = enemy_team.numRobots() + friendly_team.numRobots();
     all_robots.reserve(max_num_robots);
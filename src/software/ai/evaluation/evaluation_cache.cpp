@@ -0,0 +1,162 @@
+#include "software/ai/evaluation/evaluation_cache.h"
+
+#include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/evaluation/intercept.h"
+#include "software/ai/evaluation/possession.h"
+
+EvaluationCache::EvaluationCache(const World &world)
+    : world(world),
+      best_shot_cache(),
+      ball_possession_cache(),
+      intercept_cache(),
+      nearest_robot_cache(),
+      spatial_partition_cache(),
+      external_spatial_partitions(),
+      stats()
+{
+}
+
+EvaluationCache::EvaluationCache(const World &world,
+                                 const SpatialPartition &friendly_spatial_partition,
+                                 const SpatialPartition &enemy_spatial_partition)
+    : EvaluationCache(world)
+{
+    external_spatial_partitions.emplace(TeamType::FRIENDLY, &friendly_spatial_partition);
+    external_spatial_partitions.emplace(TeamType::ENEMY, &enemy_spatial_partition);
+}
+
+template <typename Key, typename Value, typename ComputeFunction>
+Value EvaluationCache::memoize(EvaluationCacheFunction function,
+                               std::map<Key, Value> &cache, const Key &key,
+                               ComputeFunction compute)
+{
+    EvaluationCacheStats &function_stats =
+        stats.try_emplace(function, EvaluationCacheStats{0, 0}).first->second;
+
+    auto iter = cache.find(key);
+    if (iter != cache.end())
+    {
+        function_stats.hits++;
+        return iter->second;
+    }
+
+    function_stats.misses++;
+    return cache.emplace(key, compute()).first->second;
+}
+
+const World &EvaluationCache::getWorld() const
+{
+    return world;
+}
+
+std::optional<Shot> EvaluationCache::calcBestShotOnGoal(
+    const Point &shot_origin, TeamType goal, const std::vector<Robot> &robots_to_ignore,
+    double radius)
+{
+    std::vector<RobotKey> robot_keys_to_ignore;
+    for (const Robot &robot : robots_to_ignore)
+    {
+        robot_keys_to_ignore.emplace_back(createRobotKey(robot));
+    }
+
+    return memoize(EvaluationCacheFunction::CALC_BEST_SHOT_ON_GOAL, best_shot_cache,
+                   std::make_tuple(shot_origin.x(), shot_origin.y(), goal,
+                                   robot_keys_to_ignore, radius),
+                   [&]() {
+                       return ::calcBestShotOnGoal(world.field(), world.friendlyTeam(),
+                                                   world.enemyTeam(), shot_origin, goal,
+                                                   robots_to_ignore, radius);
+                   });
+}
+
+std::optional<Robot> EvaluationCache::getRobotWithEffectiveBallPossession(TeamType team)
+{
+    return memoize(EvaluationCacheFunction::ROBOT_WITH_EFFECTIVE_BALL_POSSESSION,
+                   ball_possession_cache, team, [&]() {
+                       return ::getRobotWithEffectiveBallPossession(
+                           getTeam(team), world.ball(), world.field());
+                   });
+}
+
+std::optional<std::pair<Point, Duration>> EvaluationCache::findBestInterceptForBall(
+    const Robot &robot)
+{
+    return memoize(
+        EvaluationCacheFunction::BEST_INTERCEPT_FOR_BALL, intercept_cache,
+        createRobotKey(robot),
+        [&]() { return ::findBestInterceptForBall(world.ball(), world.field(), robot); });
+}
+
+std::optional<Robot> EvaluationCache::getNearestRobot(TeamType team, const Point &point)
+{
+    return memoize(EvaluationCacheFunction::NEAREST_ROBOT, nearest_robot_cache,
+                   std::make_tuple(team, point.x(), point.y()),
+                   [&]() { return getTeam(team).getNearestRobot(point); });
+}
+
+const SpatialPartition &EvaluationCache::getSpatialPartition(TeamType team)
+{
+    // The partition is returned by reference rather than through memoize, since
+    // copying it would be as expensive as building it
+    EvaluationCacheStats &function_stats =
+        stats
+            .try_emplace(EvaluationCacheFunction::SPATIAL_PARTITION,
+                         EvaluationCacheStats{0, 0})
+            .first->second;
+
+    auto external_iter = external_spatial_partitions.find(team);
+    if (external_iter != external_spatial_partitions.end())
+    {
+        function_stats.hits++;
+        return *external_iter->second;
+    }
+
+    auto iter = spatial_partition_cache.find(team);
+    if (iter != spatial_partition_cache.end())
+    {
+        function_stats.hits++;
+        return iter->second;
+    }
+
+    function_stats.misses++;
+    return spatial_partition_cache
+        .emplace(team, SpatialPartition(getTeam(team).getAllRobots()))
+        .first->second;
+}
+
+EvaluationCacheStats EvaluationCache::getStats(EvaluationCacheFunction function) const
+{
+    auto iter = stats.find(function);
+    if (iter == stats.end())
+    {
+        return EvaluationCacheStats{0, 0};
+    }
+    return iter->second;
+}
+
+EvaluationCacheStats EvaluationCache::getTotalStats() const
+{
+    EvaluationCacheStats total_stats{0, 0};
+    for (const auto &[function, function_stats] : stats)
+    {
+        total_stats.hits += function_stats.hits;
+        total_stats.misses += function_stats.misses;
+    }
+    return total_stats;
+}
+
+EvaluationCache::RobotKey EvaluationCache::createRobotKey(const Robot &robot)
+{
+    return std::make_tuple(robot.id(), robot.position().x(), robot.position().y(),
+                           robot.velocity().x(), robot.velocity().y(),
+                           robot.orientation().toRadians());
+}
+
+const Team &EvaluationCache::getTeam(TeamType team) const
+{
+    if (team == TeamType::FRIENDLY)
+    {
+        return world.friendlyTeam();
+    }
+    return world.enemyTeam();
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "shared/constants.h"
+#include "software/ai/evaluation/shot.h"
+#include "software/ai/evaluation/spatial_partition.h"
+#include "software/geom/point.h"
+#include "software/time/duration.h"
+#include "software/util/make_enum/make_enum.h"
+#include "software/world/world.h"
+
+/**
+ * The evaluation functions that are memoized by the EvaluationCache
+ */
+MAKE_ENUM(EvaluationCacheFunction, CALC_BEST_SHOT_ON_GOAL,
+          ROBOT_WITH_EFFECTIVE_BALL_POSSESSION, BEST_INTERCEPT_FOR_BALL, NEAREST_ROBOT,
+          SPATIAL_PARTITION);
+
+/**
+ * How many calls to a memoized function were answered from the cache (hits) and how
+ * many had to be computed (misses)
+ */
+struct EvaluationCacheStats
+{
+    unsigned int hits;
+    unsigned int misses;
+};
+
+/**
+ * Memoizes the results of evaluation functions for a single World.
+ *
+ * Within one AI tick, the same evaluations are often done several times by different
+ * plays and tactics (eg. every tactic that wants to shoot the ball computes the best
+ * shot on goal from the ball). An EvaluationCache is created from the World at the
+ * start of each tick and shared by everything that runs during that tick, so each
+ * evaluation is only computed once per set of arguments. The field, teams and ball
+ * used by the evaluations always come from the World the cache was created with.
+ *
+ * Building a SpatialPartition from scratch every tick is wasteful when the robots have
+ * only moved a little, so the owner of the cache can keep partitions of each team
+ * across ticks, update them to the World, and give them to the cache to use instead
+ * of building new ones.
+ *
+ * NOTE: The cache is meant to be short-lived and is never invalidated, so it must not
+ * be kept around once the World it was created from is out of date. It only keeps a
+ * reference to the World, so the World must outlive the cache. It is also not thread
+ * safe.
+ */
+class EvaluationCache
+{
+   public:
+    EvaluationCache() = delete;
+
+    /**
+     * Creates an empty EvaluationCache for the given World
+     *
+     * @param world The World to evaluate
+     */
+    explicit EvaluationCache(const World &world);
+
+    /**
+     * Creates an empty EvaluationCache for the given World, which returns the given
+     * partitions from getSpatialPartition rather than building new ones. The cache
+     * keeps references to the partitions, so they must be up to date with the World
+     * and outlive the cache
+     *
+     * @param world The World to evaluate
+     * @param friendly_spatial_partition A SpatialPartition over all the robots on the
+     * friendly team of the World
+     * @param enemy_spatial_partition A SpatialPartition over all the robots on the
+     * enemy team of the World
+     */
+    explicit EvaluationCache(const World &world,
+                             const SpatialPartition &friendly_spatial_partition,
+                             const SpatialPartition &enemy_spatial_partition);
+
+    // The cache keeps a reference to the World, so it can't be created from a temporary
+    explicit EvaluationCache(World &&world)                                   = delete;
+    explicit EvaluationCache(World &&world,
+                             const SpatialPartition &friendly_spatial_partition,
+                             const SpatialPartition &enemy_spatial_partition) = delete;
+
+    /**
+     * Returns the World this cache evaluates
+     *
+     * @return the World this cache evaluates
+     */
+    const World &getWorld() const;
+
+    /**
+     * Memoized version of calcBestShotOnGoal, using the field and teams from the World
+     * See calc_best_shot.h for details
+     *
+     * @param shot_origin The point that the shot will be taken from
+     * @param goal The goal to shoot at
+     * @param robots_to_ignore The robots to ignore
+     * @param radius The radius for the robot obstacles
+     *
+     * @return the best shot on the given goal, or std::nullopt if no shot can be found
+     */
+    std::optional<Shot> calcBestShotOnGoal(
+        const Point &shot_origin, TeamType goal,
+        const std::vector<Robot> &robots_to_ignore = {},
+        double radius                              = ROBOT_MAX_RADIUS_METERS);
+
+    /**
+     * Memoized version of getRobotWithEffectiveBallPossession, using the ball and field
+     * from the World. See possession.h for details
+     *
+     * @param team The team to check for possession
+     *
+     * @return the robot on the given team that either has the ball, or is the closest to
+     * having it. If the team has no robots, std::nullopt is returned
+     */
+    std::optional<Robot> getRobotWithEffectiveBallPossession(TeamType team);
+
+    /**
+     * Memoized version of findBestInterceptForBall, using the ball and field from the
+     * World. See intercept.h for details
+     *
+     * @param robot The robot that will intercept the ball
+     *
+     * @return A pair holding the best place that the robot can move to in order to
+     * intercept the ball, and the duration into the future at which the pass would
+     * occur. If no possible intercept could be found, returns std::nullopt
+     */
+    std::optional<std::pair<Point, Duration>> findBestInterceptForBall(
+        const Robot &robot);
+
+    /**
+     * Memoized version of Team::getNearestRobot for the given team of the World
+     *
+     * @param team The team to search
+     * @param point The point to find the nearest robot to
+     *
+     * @return the robot on the given team nearest to the point, or std::nullopt if the
+     * team has no robots
+     */
+    std::optional<Robot> getNearestRobot(TeamType team, const Point &point);
+
+    /**
+     * Returns a SpatialPartition built over all the robots on the given team of the
+     * World, so every evaluation done this tick can query it for open areas and nearest
+     * robots. If the cache was created with partitions, they are returned. Otherwise the
+     * partition is only built the first time it is requested for each team
+     *
+     * @param team The team whose robots the partition is built over
+     *
+     * @return the SpatialPartition of the given team. It is only valid for as long as
+     * the cache is
+     */
+    const SpatialPartition &getSpatialPartition(TeamType team);
+
+    /**
+     * Returns the number of hits and misses for the given function
+     *
+     * @param function The memoized function to get the stats of
+     *
+     * @return the number of hits and misses for the given function
+     */
+    EvaluationCacheStats getStats(EvaluationCacheFunction function) const;
+
+    /**
+     * Returns the total number of hits and misses across all functions
+     *
+     * @return the total number of hits and misses across all functions
+     */
+    EvaluationCacheStats getTotalStats() const;
+
+   private:
+    // Robots are identified in the cache keys by their id and state, since callers may
+    // pass robots that are not the same as the ones in the World
+    using RobotKey = std::tuple<RobotId, double, double, double, double, double>;
+
+    /**
+     * Creates the key used to identify the given robot in the cache
+     *
+     * @param robot The robot
+     *
+     * @return the key of the robot
+     */
+    static RobotKey createRobotKey(const Robot &robot);
+
+    /**
+     * Returns the team of the World with the given type
+     *
+     * @param team The type of the team
+     *
+     * @return the team of the World with the given type
+     */
+    const Team &getTeam(TeamType team) const;
+
+    /**
+     * Returns the cached value for the given key, or computes, caches and returns it if
+     * it has not been computed yet
+     *
+     * @param function The function being memoized, used to keep track of hits and misses
+     * @param cache The cache for the function
+     * @param key The arguments to the function
+     * @param compute Computes the value of the function if it is not in the cache
+     *
+     * @return the value of the function for the given key
+     */
+    template <typename Key, typename Value, typename ComputeFunction>
+    Value memoize(EvaluationCacheFunction function, std::map<Key, Value> &cache,
+                  const Key &key, ComputeFunction compute);
+
+    const World &world;
+
+    std::map<std::tuple<double, double, TeamType, std::vector<RobotKey>, double>,
+             std::optional<Shot>>
+        best_shot_cache;
+    std::map<TeamType, std::optional<Robot>> ball_possession_cache;
+    std::map<RobotKey, std::optional<std::pair<Point, Duration>>> intercept_cache;
+    std::map<std::tuple<TeamType, double, double>, std::optional<Robot>>
+        nearest_robot_cache;
+    std::map<TeamType, SpatialPartition> spatial_partition_cache;
+    // The partitions given to the cache when it was created, if any
+    std::map<TeamType, const SpatialPartition *> external_spatial_partitions;
+
+    std::map<EvaluationCacheFunction, EvaluationCacheStats> stats;
+};
@@ -0,0 +1,196 @@
+#include "software/ai/evaluation/evaluation_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/evaluation/intercept.h"
+#include "software/ai/evaluation/possession.h"
+#include "software/test_util/test_util.h"
+
+class EvaluationCacheTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        world = ::TestUtil::createBlankTestingWorld();
+        world = ::TestUtil::setFriendlyRobotPositions(
+            world, {Point(-2, 0), Point(0, 1), Point(1, -1)}, Timestamp::fromSeconds(0));
+        world = ::TestUtil::setEnemyRobotPositions(
+            world, {Point(2, 0.2), Point(3, -0.5), Point(-1, 2)},
+            Timestamp::fromSeconds(0));
+        world.updateBall(Ball(Point(0.5, 0), Vector(-1, 0.5), Timestamp::fromSeconds(0)));
+    }
+
+    World world = ::TestUtil::createBlankTestingWorld();
+};
+
+TEST_F(EvaluationCacheTest, empty_cache_has_no_hits_or_misses)
+{
+    EvaluationCache cache(world);
+
+    EvaluationCacheStats stats = cache.getTotalStats();
+    EXPECT_EQ(0, stats.hits);
+    EXPECT_EQ(0, stats.misses);
+}
+
+TEST_F(EvaluationCacheTest, calc_best_shot_on_goal_matches_uncached_result)
+{
+    EvaluationCache cache(world);
+    Robot shooter = *world.friendlyTeam().getRobotById(1);
+
+    std::optional<Shot> expected =
+        calcBestShotOnGoal(world.field(), world.friendlyTeam(), world.enemyTeam(),
+                           world.ball().position(), TeamType::ENEMY, {shooter});
+    std::optional<Shot> first_shot =
+        cache.calcBestShotOnGoal(world.ball().position(), TeamType::ENEMY, {shooter});
+    std::optional<Shot> second_shot =
+        cache.calcBestShotOnGoal(world.ball().position(), TeamType::ENEMY, {shooter});
+
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(first_shot);
+    ASSERT_TRUE(second_shot);
+    EXPECT_EQ(expected->getPointToShootAt(), first_shot->getPointToShootAt());
+    EXPECT_EQ(expected->getOpenAngle(), first_shot->getOpenAngle());
+    EXPECT_EQ(first_shot->getPointToShootAt(), second_shot->getPointToShootAt());
+
+    EvaluationCacheStats stats =
+        cache.getStats(EvaluationCacheFunction::CALC_BEST_SHOT_ON_GOAL);
+    EXPECT_EQ(1, stats.hits);
+    EXPECT_EQ(1, stats.misses);
+}
+
+TEST_F(EvaluationCacheTest, calc_best_shot_on_goal_with_different_arguments_misses)
+{
+    EvaluationCache cache(world);
+    Robot shooter = *world.friendlyTeam().getRobotById(1);
+
+    cache.calcBestShotOnGoal(world.ball().position(), TeamType::ENEMY, {shooter});
+    cache.calcBestShotOnGoal(world.ball().position(), TeamType::ENEMY);
+    cache.calcBestShotOnGoal(world.ball().position(), TeamType::FRIENDLY, {shooter});
+    cache.calcBestShotOnGoal(Point(0, 0), TeamType::ENEMY, {shooter});
+
+    EvaluationCacheStats stats =
+        cache.getStats(EvaluationCacheFunction::CALC_BEST_SHOT_ON_GOAL);
+    EXPECT_EQ(0, stats.hits);
+    EXPECT_EQ(4, stats.misses);
+}
+
+TEST_F(EvaluationCacheTest, get_robot_with_effective_ball_possession)
+{
+    EvaluationCache cache(world);
+
+    std::optional<Robot> expected = getRobotWithEffectiveBallPossession(
+        world.enemyTeam(), world.ball(), world.field());
+    std::optional<Robot> robot =
+        cache.getRobotWithEffectiveBallPossession(TeamType::ENEMY);
+    cache.getRobotWithEffectiveBallPossession(TeamType::ENEMY);
+    cache.getRobotWithEffectiveBallPossession(TeamType::FRIENDLY);
+
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(robot);
+    EXPECT_EQ(expected->id(), robot->id());
+
+    EvaluationCacheStats stats =
+        cache.getStats(EvaluationCacheFunction::ROBOT_WITH_EFFECTIVE_BALL_POSSESSION);
+    EXPECT_EQ(1, stats.hits);
+    EXPECT_EQ(2, stats.misses);
+}
+
+TEST_F(EvaluationCacheTest, find_best_intercept_for_ball_per_robot)
+{
+    EvaluationCache cache(world);
+
+    for (const Robot &robot : world.friendlyTeam().getAllRobots())
+    {
+        auto expected  = findBestInterceptForBall(world.ball(), world.field(), robot);
+        auto intercept = cache.findBestInterceptForBall(robot);
+        ASSERT_EQ(expected.has_value(), intercept.has_value());
+        if (expected)
+        {
+            EXPECT_EQ(expected->first, intercept->first);
+            EXPECT_EQ(expected->second, intercept->second);
+        }
+    }
+    for (const Robot &robot : world.friendlyTeam().getAllRobots())
+    {
+        cache.findBestInterceptForBall(robot);
+    }
+
+    EvaluationCacheStats stats =
+        cache.getStats(EvaluationCacheFunction::BEST_INTERCEPT_FOR_BALL);
+    EXPECT_EQ(3, stats.hits);
+    EXPECT_EQ(3, stats.misses);
+}
+
+TEST_F(EvaluationCacheTest, moved_robot_is_not_a_hit)
+{
+    EvaluationCache cache(world);
+    Robot robot = *world.friendlyTeam().getRobotById(0);
+    Robot moved_robot(robot.id(), robot.position() + Vector(0.1, 0), robot.velocity(),
+                      robot.orientation(), robot.angularVelocity(), robot.timestamp());
+
+    cache.findBestInterceptForBall(robot);
+    cache.findBestInterceptForBall(moved_robot);
+
+    EvaluationCacheStats stats =
+        cache.getStats(EvaluationCacheFunction::BEST_INTERCEPT_FOR_BALL);
+    EXPECT_EQ(0, stats.hits);
+    EXPECT_EQ(2, stats.misses);
+}
+
+TEST_F(EvaluationCacheTest, get_nearest_robot_and_total_stats)
+{
+    EvaluationCache cache(world);
+
+    std::optional<Robot> nearest = cache.getNearestRobot(TeamType::ENEMY, Point(2, 0));
+    cache.getNearestRobot(TeamType::ENEMY, Point(2, 0));
+    cache.getNearestRobot(TeamType::FRIENDLY, Point(2, 0));
+    cache.getRobotWithEffectiveBallPossession(TeamType::FRIENDLY);
+
+    ASSERT_TRUE(nearest);
+    EXPECT_EQ(0, nearest->id());
+
+    EvaluationCacheStats stats = cache.getTotalStats();
+    EXPECT_EQ(1, stats.hits);
+    EXPECT_EQ(3, stats.misses);
+}
+
+TEST_F(EvaluationCacheTest, get_spatial_partition_is_built_once_per_team)
+{
+    EvaluationCache cache(world);
+
+    const SpatialPartition &enemy_partition = cache.getSpatialPartition(TeamType::ENEMY);
+    const SpatialPartition &enemy_partition_again =
+        cache.getSpatialPartition(TeamType::ENEMY);
+    const SpatialPartition &friendly_partition =
+        cache.getSpatialPartition(TeamType::FRIENDLY);
+
+    EXPECT_EQ(&enemy_partition, &enemy_partition_again);
+    EXPECT_EQ(world.enemyTeam().getAllRobots().size(),
+              enemy_partition.getRobots().size());
+    EXPECT_EQ(world.friendlyTeam().getAllRobots().size(),
+              friendly_partition.getRobots().size());
+    EXPECT_EQ(world.enemyTeam().getNearestRobot(Point(2, 0))->id(),
+              enemy_partition.getNearestRobot(Point(2, 0))->id());
+
+    EvaluationCacheStats stats =
+        cache.getStats(EvaluationCacheFunction::SPATIAL_PARTITION);
+    EXPECT_EQ(1, stats.hits);
+    EXPECT_EQ(2, stats.misses);
+}
+
+TEST_F(EvaluationCacheTest, get_spatial_partition_returns_given_partitions)
+{
+    SpatialPartition friendly_partition(world.friendlyTeam().getAllRobots());
+    SpatialPartition enemy_partition(world.enemyTeam().getAllRobots());
+    EvaluationCache cache(world, friendly_partition, enemy_partition);
+
+    EXPECT_EQ(&friendly_partition, &cache.getSpatialPartition(TeamType::FRIENDLY));
+    EXPECT_EQ(&enemy_partition, &cache.getSpatialPartition(TeamType::ENEMY));
+
+    // Nothing had to be built
+    EvaluationCacheStats stats =
+        cache.getStats(EvaluationCacheFunction::SPATIAL_PARTITION);
+    EXPECT_EQ(2, stats.hits);
+    EXPECT_EQ(0, stats.misses);
+}
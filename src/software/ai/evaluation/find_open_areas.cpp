@@ -1,9 +1,9 @@
 #include "software/ai/evaluation/find_open_areas.h"
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
-#include "software/geom/algorithms/find_open_circles.h"
 
-std::vector<Circle> findGoodChipTargets(const World& world)
+std::vector<Circle> findGoodChipTargets(const World& world,
+                                        const SpatialPartition& enemy_partition)
 {
     double inset     = 0.3;  // Determined experimentally to be a reasonable value
     double ballX     = world.ball().position().x();
@@ -16,11 +16,5 @@ std::vector<Circle> findGoodChipTargets(const World& world)
     Rectangle target_area_rectangle =
         Rectangle(Point(ballX, negFieldY), Point(fieldX, posFieldY));
 
-    std::vector<Point> enemy_locations;
-    for (Robot robot : world.enemyTeam().getAllRobots())
-    {
-        enemy_locations.emplace_back(robot.position());
-    }
-
-    return findOpenCircles(target_area_rectangle, enemy_locations);
+    return enemy_partition.findOpenCircles(target_area_rectangle);
 }
@@ -1,15 +1,19 @@
 #pragma once
 
+#include "software/ai/evaluation/spatial_partition.h"
 #include "software/geom/circle.h"
 #include "software/world/world.h"
 
 /**
- * Finds good points to chip the ball to
+ * Finds good points to chip the ball to, using a partition of the enemy robots that is
+ * kept up to date across ticks (see EvaluationCache::getSpatialPartition)
  *
  * @param world The world. We assume the ball is being chipped from its current
  * position
+ * @param enemy_partition A SpatialPartition built over the enemy team's robots
  *
  * @return a vector of circles where the center is a good point to chip to, and the
  *         radius is the distance to the nearest enemy
  */
-std::vector<Circle> findGoodChipTargets(const World& world);
+std::vector<Circle> findGoodChipTargets(const World& world,
+                                        const SpatialPartition& enemy_partition);
@@ -34,9 +34,10 @@ std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &b
             ball.estimateFutureState(Duration::fromSeconds(duration)).position();
 
         // Figure out how long it will take the robot to get to the new ball position
-        Duration time_to_ball_pos = getTimeToPositionForRobot(
-            robot.position(), new_ball_pos, ROBOT_MAX_SPEED_METERS_PER_SECOND,
-            ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED);
+        Duration time_to_ball_pos =
+            getTimeToPositionForRobot(robot.position(), robot.velocity(), new_ball_pos,
+                                      ROBOT_MAX_SPEED_METERS_PER_SECOND,
+                                      ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED);
 
         // Figure out when the robot will reach the new ball position relative to the
         // time that the ball will get there (ie. will we get there in time?)
@@ -71,7 +72,8 @@ std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &b
 
     // Check that we can get to the best position in time
     Duration time_to_ball_pos = getTimeToPositionForRobot(
-        robot.position(), best_ball_intercept_pos, ROBOT_MAX_SPEED_METERS_PER_SECOND,
+        robot.position(), robot.velocity(), best_ball_intercept_pos,
+        ROBOT_MAX_SPEED_METERS_PER_SECOND,
         ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED);
     Duration ball_robot_time_diff = time_to_ball_pos - best_ball_travel_duration;
     // NOTE: if ball velocity is 0 then ball travel duration is infinite, so this
@@ -1,45 +1,36 @@
 #include "software/ai/evaluation/pass.h"
 
+#include <algorithm>
+#include <cmath>
+
 Duration getTimeToOrientationForRobot(const Angle& current_orientation,
                                       const Angle& desired_orientation,
                                       const double& max_velocity,
                                       const double& max_acceleration)
 {
-    // We assume a linear acceleration profile:
-    // (1) velocity = MAX_ACCELERATION*time
-    // we integrate (1) to get:
-    // (2) displacement = MAX_ACCELERATION/2 * time^2
-    // we rearrange to get:
-    // (3) time = sqrt(2 * displacement / MAX_ACCELERATION)
-    // we sub. (3) into (1) to get:
-    // (4) velocity = MAX_ACCELERATION*sqrt(2 * displacement / MAX_ACCELERATION)
-    // and rearrange to get:
-    // (5) displacement = (velocity / MAX_ACCELERATION)^2 * MAX_ACCELERATION/2
-    // We re-arrange (3) to get:
-    // (6) displacement = time^2 * MAX_ACCELERATION/2
+    return getTimeToOrientationForRobot(current_orientation, AngularVelocity::zero(),
+                                        desired_orientation, max_velocity,
+                                        max_acceleration);
+}
 
+Duration getTimeToOrientationForRobot(const Angle& current_orientation,
+                                      const AngularVelocity& current_angular_velocity,
+                                      const Angle& desired_orientation,
+                                      const double max_velocity,
+                                      const double max_acceleration)
+{
     double dist = current_orientation.minDiff(desired_orientation).toRadians();
 
-    // Calculate the distance required to reach max possible velocity of the robot
-    // using (5)
-    double dist_to_max_possible_vel =
-        std::pow(max_velocity / max_acceleration, 2) * max_acceleration / 2;
-
-    // Calculate how long we'll accelerate for using (3), taking into account that we
-    // might not actually reach the max velocity if it will take too much distance
-    double acceleration_time =
-        std::sqrt(2 * std::min(dist / 2, dist_to_max_possible_vel) / max_acceleration);
-
-    // Calculate how long we'll be at the max possible velocity (if any time at all)
-    double time_at_max_velocity =
-        std::max(0.0, dist - 2 * dist_to_max_possible_vel) / max_velocity;
+    // We turn in the direction of the smallest rotation, so the initial velocity
+    // towards the desired orientation is positive if we are already turning that way
+    double initial_velocity = current_angular_velocity.toRadians();
+    if ((desired_orientation - current_orientation).clamp() < Angle::zero())
+    {
+        initial_velocity = -initial_velocity;
+    }
 
-    // The time taken to get to the target angle is:
-    // time to accelerate + time at the max velocity + time to de-accelerate
-    // Note that the acceleration time is the same as a de-acceleration time
-    double travel_time = 2 * acceleration_time + time_at_max_velocity;
-
-    return Duration::fromSeconds(travel_time);
+    return Duration::fromSeconds(
+        getTravelTimeSeconds(dist, initial_velocity, max_velocity, max_acceleration));
 }
 
 Duration getTimeToPositionForRobot(const Point& start, const Point& dest,
@@ -47,39 +38,91 @@ Duration getTimeToPositionForRobot(const Point& start, const Point& dest,
                                    const double max_acceleration,
                                    const double tolerance_meters)
 {
-    // We assume a linear acceleration profile:
-    // (1) velocity = MAX_ACCELERATION*time
-    // we integrate (1) to get:
-    // (2) displacement = MAX_ACCELERATION/2 * time^2
-    // we rearrange to get:
-    // (3) time = sqrt(2 * displacement / MAX_ACCELERATION)
-    // we sub. (3) into (1) to get:
-    // (4) velocity = MAX_ACCELERATION*sqrt(2 * displacement / MAX_ACCELERATION)
-    // and rearrange to get:
-    // (5) displacement = (velocity / MAX_ACCELERATION)^2 * MAX_ACCELERATION/2
-    // We re-arrange (3) to get:
-    // (6) displacement = time^2 * MAX_ACCELERATION/2
-
-    double dist = std::max(0.0, (start - dest).length() - tolerance_meters);
-
-    // Calculate the distance required to reach max possible velocity of the robot
-    // using (5)
-    double dist_to_max_possible_vel =
-        std::pow(max_velocity / max_acceleration, 2) * max_acceleration / 2;
-
-    // Calculate how long we'll accelerate for using (3), taking into account that we
-    // might not actually reach the max velocity if it will take too much distance
-    double acceleration_time =
-        std::sqrt(2 * std::min(dist / 2, dist_to_max_possible_vel) / max_acceleration);
-
-    // Calculate how long we'll be at the max possible velocity (if any time at all)
-    double time_at_max_velocity =
-        std::max(0.0, dist - 2 * dist_to_max_possible_vel) / max_velocity;
-
-    // The time taken to get to the receiver point is:
-    // time to accelerate + time at the max velocity + time to de-accelerate
-    // Note that the acceleration time is the same as a de-acceleration time
-    double travel_time = 2 * acceleration_time + time_at_max_velocity;
-
-    return Duration::fromSeconds(travel_time);
+    return getTimeToPositionForRobot(start, Vector(), dest, max_velocity,
+                                     max_acceleration, tolerance_meters);
+}
+
+Duration getTimeToPositionForRobot(const Point& start, const Vector& initial_velocity,
+                                   const Point& dest, const double max_velocity,
+                                   const double max_acceleration,
+                                   const double tolerance_meters)
+{
+    // NOTE: batchTimeToPosition does exactly the same floating point operations as
+    // this function, so any change here must be made there too
+    double dx = dest.x() - start.x();
+    double dy = dest.y() - start.y();
+
+    double length = std::sqrt(dx * dx + dy * dy);
+    double dist   = std::max(0.0, length - tolerance_meters);
+
+    // The component of the velocity towards the destination
+    double velocity_towards_dest = 0;
+    if (length > 0)
+    {
+        velocity_towards_dest =
+            (initial_velocity.x() * dx + initial_velocity.y() * dy) / length;
+    }
+
+    return Duration::fromSeconds(getTravelTimeSeconds(dist, velocity_towards_dest,
+                                                      max_velocity, max_acceleration));
+}
+
+double getTravelTimeSeconds(double distance, double initial_velocity, double max_velocity,
+                            double max_acceleration)
+{
+    // We assume a trapezoidal velocity profile, where we accelerate at the max
+    // acceleration from the initial velocity u to a peak velocity v, and then
+    // decelerate at the max acceleration to a stop at the end of the distance:
+    // (1) displacement while accelerating = (v^2 - u^2) / (2 * MAX_ACCELERATION)
+    // (2) displacement while decelerating = v^2 / (2 * MAX_ACCELERATION)
+    // Setting the sum of (1) and (2) to the distance and rearranging gives:
+    // (3) v = sqrt(MAX_ACCELERATION * distance + u^2 / 2)
+    // If v is more than MAX_VELOCITY, we instead accelerate to MAX_VELOCITY, cruise
+    // for the rest of the distance, and then decelerate.
+    //
+    // This only works if we can stop before the end of the distance. If we can't, or
+    // we're moving away from it, we first decelerate to a stop, and then travel the
+    // distance that's left from rest.
+    //
+    // NOTE: batchTimeToPosition does exactly the same floating point operations as
+    // this function, so any change here must be made there too
+
+    if (distance <= 0)
+    {
+        return 0;
+    }
+
+    double u = std::clamp(initial_velocity, -max_velocity, max_velocity);
+
+    // The displacement towards the end of the distance while stopping
+    double stopping_dist = u * std::abs(u) / (2 * max_acceleration);
+
+    bool must_stop_first = u < 0 || stopping_dist > distance;
+    double time_to_stop  = must_stop_first ? std::abs(u) / max_acceleration : 0;
+    double remaining_dist =
+        must_stop_first ? std::abs(distance - stopping_dist) : distance;
+    double velocity = must_stop_first ? 0 : u;
+
+    // Calculate the peak velocity using (3)
+    double peak_velocity =
+        std::sqrt(max_acceleration * remaining_dist + velocity * velocity * 0.5);
+
+    double travel_time;
+    if (peak_velocity <= max_velocity)
+    {
+        travel_time = (2 * peak_velocity - velocity) / max_acceleration;
+    }
+    else
+    {
+        double time_accelerating_and_decelerating =
+            (2 * max_velocity - velocity) / max_acceleration;
+        double dist_accelerating_and_decelerating =
+            (2 * max_velocity * max_velocity - velocity * velocity) /
+            (2 * max_acceleration);
+        travel_time =
+            time_accelerating_and_decelerating +
+            (remaining_dist - dist_accelerating_and_decelerating) / max_velocity;
+    }
+
+    return time_to_stop + travel_time;
 }
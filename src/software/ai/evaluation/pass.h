@@ -25,6 +25,29 @@ Duration getTimeToOrientationForRobot(const Angle& current_orientation,
                                       const double& max_velocity,
                                       const double& max_acceleration);
 
+/**
+ * Calculate how long it would take the given robot to turn to the given orientation,
+ * starting from its current angular velocity
+ *
+ * The robot is assumed to turn in the direction of the smallest rotation, stopping
+ * first if it is turning the other way, and to stop at the desired orientation.
+ * Angular velocities faster than max_velocity are treated as max_velocity.
+ *
+ * @param current_orientation The current orientation of the robot
+ * @param current_angular_velocity The current angular velocity of the robot
+ * @param desired_orientation The orientation which we want the robot to be at
+ * @param max_velocity The maximum angular velocity that robot can turn at (rad/s)
+ * @param max_acceleration The maximum angular rate at which the robot can
+ *                             accelerate (rad/s^2)
+ *
+ * @return The time required for the given robot to rotate to the given orientation
+ */
+Duration getTimeToOrientationForRobot(const Angle& current_orientation,
+                                      const AngularVelocity& current_angular_velocity,
+                                      const Angle& desired_orientation,
+                                      const double max_velocity,
+                                      const double max_acceleration);
+
 /**
  * Calculate minimum time it would take for the given robot to reach the given point
  *
@@ -44,3 +67,50 @@ Duration getTimeToPositionForRobot(const Point& start, const Point& dest,
                                    const double max_velocity,
                                    const double max_acceleration,
                                    const double tolerance_meters = 0);
+
+/**
+ * Calculate minimum time it would take for the given robot to reach the given point,
+ * starting from its current velocity
+ *
+ * The robot is assumed to move in a straight line to the destination and to stop
+ * there, accelerating and decelerating as hard as it can. If it is moving away from
+ * the destination, or too fast to stop before passing it, it stops first and then
+ * moves back. Only the component of the velocity towards the destination is
+ * considered, and speeds faster than max_velocity are treated as max_velocity.
+ *
+ * This is exact for that motion profile, and with a zero initial velocity gives the
+ * same time as the overload above.
+ *
+ * @param start The starting point of robot
+ * @param initial_velocity The current velocity of the robot
+ * @param dest The destination that the robot is going to
+ * @param max_velocity The maximum linear velocity the robot can travel at (m/s)
+ * @param max_acceleration The maximum acceleration of the robot (m/s^2)
+ * @param tolerance_meters The radius around the target at which we will be considered
+ *                         "at" the target.
+ *
+ * @return The minimum theoretical time it would take the robot to reach the dest
+ * point
+ */
+Duration getTimeToPositionForRobot(const Point& start, const Vector& initial_velocity,
+                                   const Point& dest, const double max_velocity,
+                                   const double max_acceleration,
+                                   const double tolerance_meters = 0);
+
+/**
+ * Calculate how long it would take a robot to travel the given distance in a straight
+ * line and stop, starting from the given velocity towards the end of the distance.
+ *
+ * This is the one dimensional motion profile used by getTimeToPositionForRobot and
+ * getTimeToOrientationForRobot, and works for both linear and angular motion.
+ *
+ * @param distance The distance to travel. The time is 0 if this is not positive
+ * @param initial_velocity The initial velocity towards the end of the distance.
+ *                         Negative if moving away from it
+ * @param max_velocity The maximum velocity
+ * @param max_acceleration The maximum acceleration
+ *
+ * @return The time it would take to travel the distance, in seconds
+ */
+double getTravelTimeSeconds(double distance, double initial_velocity, double max_velocity,
+                            double max_acceleration);
@@ -108,3 +108,131 @@ TEST(PassingEvaluationTest, getTimeToPositionForRobot_reaches_max_velocity_with_
     EXPECT_EQ(Duration::fromSeconds(travel_time),
               getTimeToPositionForRobot(robot_location, target_location, 2.0, 3.0, 0.5));
 }
+
+TEST(PassingEvaluationTest,
+     getTimeToPositionForRobot_with_zero_velocity_same_as_from_rest)
+{
+    Point dest(1, 1);
+    for (double distance : {0.01, 0.3, 1.0, 2.5, 10.0})
+    {
+        Point start = dest + Vector(distance, 0).rotate(Angle::fromDegrees(30));
+        EXPECT_EQ(getTimeToPositionForRobot(start, dest, 2.0, 3.0, 0.1),
+                  getTimeToPositionForRobot(start, Vector(), dest, 2.0, 3.0, 0.1))
+            << "distance " << distance;
+    }
+}
+
+TEST(PassingEvaluationTest, getTimeToPositionForRobot_already_moving_at_max_velocity)
+{
+    // The robot only has to cruise and then decelerate to a stop
+    Point start(0, 0);
+    Point dest(10, 0);
+    double deceleration_time     = 2.0 / 3.0;
+    double deceleration_distance = 0.5 * 3.0 * std::pow(deceleration_time, 2);
+    double travel_time           = (10 - deceleration_distance) / 2.0 + deceleration_time;
+
+    EXPECT_EQ(Duration::fromSeconds(travel_time),
+              getTimeToPositionForRobot(start, Vector(2, 0), dest, 2.0, 3.0));
+}
+
+TEST(PassingEvaluationTest,
+     getTimeToPositionForRobot_moving_towards_dest_without_reaching_max_velocity)
+{
+    // Accelerating from 1 m/s to a peak velocity of 1.5 m/s and then decelerating to a
+    // stop covers (1.5^2 - 1) / 6 + 1.5^2 / 6 = 7/12 meters, and takes
+    // 0.5 / 3 + 1.5 / 3 = 2/3 seconds
+    Point start(0, 0);
+    Point dest(0, 7.0 / 12.0);
+
+    EXPECT_EQ(Duration::fromSeconds(2.0 / 3.0),
+              getTimeToPositionForRobot(start, Vector(0, 1), dest, 2.0, 3.0));
+}
+
+TEST(PassingEvaluationTest, getTimeToPositionForRobot_moving_away_from_dest)
+{
+    // The robot has to stop first, which takes it 1/6 meters further away, and then
+    // travel 1 + 1/6 meters from rest
+    Point start(0, 0);
+    Point dest(1, 0);
+    double distance_after_stopping = 1 + 1.0 / 6.0;
+    double travel_time = 1.0 / 3.0 + 2 * std::sqrt(distance_after_stopping / 3.0);
+
+    EXPECT_EQ(Duration::fromSeconds(travel_time),
+              getTimeToPositionForRobot(start, Vector(-1, 0), dest, 2.0, 3.0));
+    EXPECT_LT(getTimeToPositionForRobot(start, Vector(), dest, 2.0, 3.0),
+              getTimeToPositionForRobot(start, Vector(-1, 0), dest, 2.0, 3.0));
+}
+
+TEST(PassingEvaluationTest, getTimeToPositionForRobot_too_fast_to_stop_at_dest)
+{
+    // The robot takes 2/3 meters to stop, so it overshoots by 0.5 meters and has to
+    // come back
+    Point start(0, 0);
+    Point dest(1.0 / 6.0, 0);
+    double travel_time = 2.0 / 3.0 + 2 * std::sqrt(0.5 / 3.0);
+
+    EXPECT_EQ(Duration::fromSeconds(travel_time),
+              getTimeToPositionForRobot(start, Vector(2, 0), dest, 2.0, 3.0));
+}
+
+TEST(PassingEvaluationTest, getTimeToPositionForRobot_ignores_perpendicular_velocity)
+{
+    Point start(0, 0);
+    Point dest(1, 0);
+
+    EXPECT_EQ(getTimeToPositionForRobot(start, Vector(1, 0), dest, 2.0, 3.0),
+              getTimeToPositionForRobot(start, Vector(1, 1.5), dest, 2.0, 3.0));
+}
+
+TEST(PassingEvaluationTest, getTimeToPositionForRobot_moving_within_tolerance)
+{
+    Point dest(1, 1);
+    EXPECT_EQ(
+        Duration::fromSeconds(0),
+        getTimeToPositionForRobot(Point(1, 1.2), Vector(0, 2), dest, 2.0, 3.0, 0.5));
+}
+
+TEST(PassingEvaluationTest, getTimeToPositionForRobot_faster_when_moving_towards_dest)
+{
+    Point start(0, 0);
+    Point dest(3, 0);
+    Duration previous_time =
+        getTimeToPositionForRobot(start, Vector(-2, 0), dest, 2.0, 3.0);
+    for (double velocity : {-1.0, 0.0, 0.5, 1.0, 1.5, 2.0})
+    {
+        Duration time =
+            getTimeToPositionForRobot(start, Vector(velocity, 0), dest, 2.0, 3.0);
+        EXPECT_LT(time, previous_time) << "velocity " << velocity;
+        previous_time = time;
+    }
+}
+
+TEST(PassingEvaluationTest,
+     getTimeToOrientationForRobot_with_zero_velocity_same_as_from_rest)
+{
+    for (Angle angle :
+         {Angle::fromDegrees(10), Angle::quarter(), Angle::fromDegrees(-170)})
+    {
+        EXPECT_EQ(getTimeToOrientationForRobot(Angle::zero(), angle, 4 * M_PI, 10),
+                  getTimeToOrientationForRobot(Angle::zero(), AngularVelocity::zero(),
+                                               angle, 4 * M_PI, 10))
+            << "angle " << angle;
+    }
+}
+
+TEST(PassingEvaluationTest, getTimeToOrientationForRobot_turning_towards_desired_angle)
+{
+    // The smallest rotation from 170 to -170 degrees is counterclockwise through 180
+    Angle current = Angle::fromDegrees(170);
+    Angle desired = Angle::fromDegrees(-170);
+
+    Duration from_rest = getTimeToOrientationForRobot(current, AngularVelocity::zero(),
+                                                      desired, 4 * M_PI, 10);
+    Duration turning_towards = getTimeToOrientationForRobot(
+        current, AngularVelocity::fromDegrees(90), desired, 4 * M_PI, 10);
+    Duration turning_away = getTimeToOrientationForRobot(
+        current, AngularVelocity::fromDegrees(-90), desired, 4 * M_PI, 10);
+
+    EXPECT_LT(turning_towards, from_rest);
+    EXPECT_GT(turning_away, from_rest);
+}
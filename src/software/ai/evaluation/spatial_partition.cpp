@@ -0,0 +1,360 @@
+#include "software/ai/evaluation/spatial_partition.h"
+
+#include <algorithm>
+#include <boost/polygon/voronoi.hpp>
+#include <cmath>
+#include <unordered_map>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/furthest_point.h"
+#include "software/geom/algorithms/intersection.h"
+#include "software/world/team.h"
+
+namespace
+{
+    // boost::polygon only builds Voronoi diagrams over integer coordinates, so we scale
+    // robot positions to micrometres before handing them to boost. The topology of the
+    // diagram is all we take from boost, the vertex positions are always computed from
+    // the real robot positions
+    constexpr double VORONOI_COORDINATE_SCALE = 1e6;
+
+    // How far (in metres) a robot may be inside the circumcircle of a Delaunay triangle,
+    // or across the convex hull, before we consider the triangulation invalid. This
+    // absorbs floating point error for robots that lie exactly on a circumcircle
+    constexpr double DELAUNAY_TOLERANCE = 1e-9;
+
+    /**
+     * Returns the circumcenter of the triangle with the given vertices
+     *
+     * @param a, b, c The vertices of the triangle
+     *
+     * @return the circumcenter of the triangle, or std::nullopt if the triangle is
+     * degenerate
+     */
+    std::optional<Point> circumcenter(const Point &a, const Point &b, const Point &c)
+    {
+        Vector ab = b - a;
+        Vector ac = c - a;
+        double d  = 2 * ab.cross(ac);
+        if (std::abs(d) < DELAUNAY_TOLERANCE)
+        {
+            return std::nullopt;
+        }
+        double x = (ac.y() * ab.lengthSquared() - ab.y() * ac.lengthSquared()) / d;
+        double y = (ab.x() * ac.lengthSquared() - ac.x() * ab.lengthSquared()) / d;
+        return a + Vector(x, y);
+    }
+}  // namespace
+
+SpatialPartition::SpatialPartition() : robots(), triangles(), vertices(), edges() {}
+
+SpatialPartition::SpatialPartition(const std::vector<Robot> &robots)
+    : robots(robots), triangles(), vertices(), edges()
+{
+    rebuild();
+}
+
+bool SpatialPartition::update(const std::vector<Robot> &new_robots)
+{
+    bool same_robots =
+        new_robots.size() == robots.size() &&
+        std::equal(new_robots.begin(), new_robots.end(), robots.begin(),
+                   [](const Robot &a, const Robot &b) { return a.id() == b.id(); });
+    robots = new_robots;
+
+    if (same_robots && moveVertices())
+    {
+        return false;
+    }
+
+    rebuild();
+    return true;
+}
+
+const std::vector<Robot> &SpatialPartition::getRobots() const
+{
+    return robots;
+}
+
+std::optional<Robot> SpatialPartition::getNearestRobot(const Point &point) const
+{
+    return Team::getNearestRobot(robots, point);
+}
+
+std::optional<double> SpatialPartition::distanceToNearestRobot(const Point &point) const
+{
+    if (robots.empty())
+    {
+        return std::nullopt;
+    }
+
+    double min_distance_squared = distanceSquared(robots.front().position(), point);
+    for (const Robot &robot : robots)
+    {
+        min_distance_squared =
+            std::min(min_distance_squared, distanceSquared(robot.position(), point));
+    }
+    return std::sqrt(min_distance_squared);
+}
+
+std::vector<Circle> SpatialPartition::findOpenCircles(const Rectangle &bounding_box) const
+{
+    // The largest empty circle with its origin inside a convex region is centered on
+    // either a vertex of the Voronoi diagram, an intersection of a Voronoi edge with the
+    // boundary of the region, or a corner of the region. We find all of these points
+    // and make each one the center of a circle whose radius is the distance to the
+    // closest robot.
+    // Reference: https://www.cs.swarthmore.edu/~adanner/cs97/s08/papers/schuster.pdf
+    std::vector<Circle> open_circles;
+    if (robots.empty())
+    {
+        return open_circles;
+    }
+
+    std::vector<Point> origins = bounding_box.getPoints();
+
+    for (const Point &vertex : vertices)
+    {
+        if (contains(bounding_box, vertex))
+        {
+            origins.emplace_back(vertex);
+        }
+    }
+
+    for (const VoronoiEdge &edge : edges)
+    {
+        std::unordered_set<Point> edge_intersections =
+            intersection(bounding_box, edgeSegment(edge, bounding_box));
+        origins.insert(origins.end(), edge_intersections.begin(),
+                       edge_intersections.end());
+    }
+
+    for (const Point &origin : origins)
+    {
+        open_circles.emplace_back(origin, distanceToNearestRobot(origin).value());
+    }
+
+    // Sort the circles in descending order of radius
+    std::sort(
+        open_circles.begin(), open_circles.end(),
+        [](const Circle &c1, const Circle &c2) { return c1.radius() > c2.radius(); });
+
+    return open_circles;
+}
+
+std::optional<Circle> SpatialPartition::findLargestOpenCircle(
+    const Rectangle &bounding_box) const
+{
+    std::vector<Circle> open_circles = findOpenCircles(bounding_box);
+    if (open_circles.empty())
+    {
+        return std::nullopt;
+    }
+    return open_circles.front();
+}
+
+void SpatialPartition::rebuild()
+{
+    triangles.clear();
+    vertices.clear();
+    edges.clear();
+
+    if (robots.size() < 2)
+    {
+        return;
+    }
+
+    std::vector<boost::polygon::point_data<int>> scaled_points;
+    scaled_points.reserve(robots.size());
+    for (const Robot &robot : robots)
+    {
+        scaled_points.emplace_back(
+            static_cast<int>(std::round(robot.position().x() * VORONOI_COORDINATE_SCALE)),
+            static_cast<int>(
+                std::round(robot.position().y() * VORONOI_COORDINATE_SCALE)));
+    }
+
+    boost::polygon::voronoi_diagram<double> diagram;
+    boost::polygon::construct_voronoi(scaled_points.begin(), scaled_points.end(),
+                                      &diagram);
+
+    // Each Voronoi vertex is the circumcenter of a Delaunay triangle formed by the
+    // robots whose cells meet at the vertex. We store the triangle so that the vertex
+    // can be moved when the robots move.
+    // NOTE: Degenerate vertices (more than 3 cocircular robots) have more than 3 cells
+    // meeting at them, any 3 of the cells have the same circumcenter so we just take
+    // the first 3
+    std::unordered_map<const boost::polygon::voronoi_vertex<double> *, size_t>
+        vertex_indices;
+    for (const auto &vertex : diagram.vertices())
+    {
+        DelaunayTriangle triangle;
+        size_t num_cells = 0;
+        auto edge        = vertex.incident_edge();
+        do
+        {
+            triangle[num_cells++] = edge->cell()->source_index();
+            edge                  = edge->rot_next();
+        } while (edge != vertex.incident_edge() && num_cells < triangle.size());
+
+        // Orient every triangle counter-clockwise so that moveVertices can detect
+        // triangles that have been flipped
+        const Point &a = robots[triangle[0]].position();
+        const Point &b = robots[triangle[1]].position();
+        const Point &c = robots[triangle[2]].position();
+        if ((b - a).cross(c - a) < 0)
+        {
+            std::swap(triangle[1], triangle[2]);
+        }
+
+        vertex_indices.emplace(&vertex, triangles.size());
+        triangles.emplace_back(triangle);
+        vertices.emplace_back(
+            circumcenter(a, b, c).value_or(Point(vertex.x() / VORONOI_COORDINATE_SCALE,
+                                                 vertex.y() / VORONOI_COORDINATE_SCALE)));
+    }
+
+    for (const auto &edge : diagram.edges())
+    {
+        size_t left_robot_index  = edge.cell()->source_index();
+        size_t right_robot_index = edge.twin()->cell()->source_index();
+
+        // Every edge is stored twice by boost, once as each of its two half-edges,
+        // so we only keep one of them. Two Voronoi cells share at most one edge since
+        // they are convex
+        if (!edge.is_primary() || left_robot_index > right_robot_index)
+        {
+            continue;
+        }
+
+        VoronoiEdge voronoi_edge = {left_robot_index, right_robot_index, std::nullopt,
+                                    std::nullopt};
+        if (edge.vertex0())
+        {
+            voronoi_edge.vertex0 = vertex_indices.at(edge.vertex0());
+        }
+        if (edge.vertex1())
+        {
+            voronoi_edge.vertex1 = vertex_indices.at(edge.vertex1());
+        }
+        edges.emplace_back(voronoi_edge);
+    }
+}
+
+bool SpatialPartition::moveVertices()
+{
+    // A triangulation without triangles only happens when all the robots are
+    // collinear, in which case rebuilding is trivial anyways
+    if (triangles.empty())
+    {
+        return false;
+    }
+
+    // The triangulation is still a Delaunay triangulation as long as none of the
+    // triangles have flipped and no robot is inside the circumcircle of any triangle
+    for (size_t i = 0; i < triangles.size(); i++)
+    {
+        const DelaunayTriangle &triangle = triangles[i];
+        const Point &a                   = robots[triangle[0]].position();
+        const Point &b                   = robots[triangle[1]].position();
+        const Point &c                   = robots[triangle[2]].position();
+        if ((b - a).cross(c - a) <= 0)
+        {
+            return false;
+        }
+
+        std::optional<Point> center = circumcenter(a, b, c);
+        if (!center)
+        {
+            return false;
+        }
+
+        double radius = distance(*center, a);
+        for (const Robot &robot : robots)
+        {
+            if (distance(*center, robot.position()) < radius - DELAUNAY_TOLERANCE)
+            {
+                return false;
+            }
+        }
+        vertices[i] = *center;
+    }
+
+    // The triangulation must also still cover the convex hull of the robots. The edges
+    // of the hull are the Delaunay edges dual to the infinite Voronoi edges, and every
+    // robot must still be on the same side of each of them as the rest of the triangle
+    // it belongs to
+    for (const VoronoiEdge &edge : edges)
+    {
+        if (edge.vertex0.has_value() == edge.vertex1.has_value())
+        {
+            continue;
+        }
+
+        const DelaunayTriangle &triangle =
+            triangles[edge.vertex0 ? *edge.vertex0 : *edge.vertex1];
+        size_t inner_robot_index =
+            *std::find_if(triangle.begin(), triangle.end(), [&edge](size_t robot_index) {
+                return robot_index != edge.left_robot_index &&
+                       robot_index != edge.right_robot_index;
+            });
+
+        const Point &hull_start = robots[edge.left_robot_index].position();
+        Vector hull_edge        = robots[edge.right_robot_index].position() - hull_start;
+        double inner_side =
+            hull_edge.cross(robots[inner_robot_index].position() - hull_start);
+        for (size_t i = 0; i < robots.size(); i++)
+        {
+            if (i == edge.left_robot_index || i == edge.right_robot_index)
+            {
+                continue;
+            }
+            double side = hull_edge.cross(robots[i].position() - hull_start);
+            if (side * inner_side <= DELAUNAY_TOLERANCE)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+Segment SpatialPartition::edgeSegment(const VoronoiEdge &edge,
+                                      const Rectangle &bounding_box) const
+{
+    const Point &left  = robots[edge.left_robot_index].position();
+    const Point &right = robots[edge.right_robot_index].position();
+
+    // The edge runs perpendicular to the vector between the two robots, with the left
+    // robot on its left hand side
+    Vector direction = Vector(left.y() - right.y(), right.x() - left.x()).normalize();
+
+    if (edge.vertex0 && edge.vertex1)
+    {
+        return Segment(vertices[*edge.vertex0], vertices[*edge.vertex1]);
+    }
+
+    // Infinite edges are extended so that they are guaranteed to cross the bounding
+    // box if they intersect it at all. Every point in the bounding box is at most as far
+    // away as the furthest corner
+    if (edge.vertex0)
+    {
+        const Point &start = vertices[*edge.vertex0];
+        double length      = distance(furthestPoint(bounding_box, start), start);
+        return Segment(start, start + direction * length);
+    }
+    if (edge.vertex1)
+    {
+        const Point &end = vertices[*edge.vertex1];
+        double length    = distance(furthestPoint(bounding_box, end), end);
+        return Segment(end - direction * length, end);
+    }
+
+    // Edges with no vertices are the lines that bisect two robots, which only happens
+    // when all the robots are collinear
+    Point midpoint = left + (right - left) / 2;
+    double length  = distance(furthestPoint(bounding_box, midpoint), midpoint);
+    return Segment(midpoint - direction * length, midpoint + direction * length);
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "software/geom/circle.h"
+#include "software/geom/point.h"
+#include "software/geom/rectangle.h"
+#include "software/geom/segment.h"
+#include "software/world/robot.h"
+
+/**
+ * A Voronoi diagram (and its dual, the Delaunay triangulation) built over a set of
+ * robots, used to answer open-area queries such as "where is the largest circle that
+ * does not contain a robot" or "which robot is closest to this point".
+ *
+ * The partition is meant to be kept around and updated every tick rather than
+ * re-created. When the same robots are given to update() and the existing Delaunay
+ * triangulation is still valid for their new positions (no robot has moved into the
+ * circumcircle of a triangle and the convex hull is unchanged), the topology of the
+ * diagram is reused and only the positions of the Voronoi vertices are recomputed.
+ * The diagram is only rebuilt from scratch when the triangulation is invalidated.
+ */
+class SpatialPartition
+{
+   public:
+    /**
+     * Creates an empty SpatialPartition that contains no robots
+     */
+    explicit SpatialPartition();
+
+    /**
+     * Creates a SpatialPartition over the given robots
+     *
+     * @param robots The robots to partition the field with
+     */
+    explicit SpatialPartition(const std::vector<Robot> &robots);
+
+    /**
+     * Updates the partition with the new state of the robots. If the robots have only
+     * moved a small amount the existing diagram is moved along with them, otherwise
+     * the diagram is rebuilt.
+     *
+     * @param robots The new state of the robots to partition the field with
+     *
+     * @return true if the diagram had to be rebuilt, false if it was updated in place
+     */
+    bool update(const std::vector<Robot> &robots);
+
+    /**
+     * Returns the robots used to build this partition
+     *
+     * @return the robots used to build this partition
+     */
+    const std::vector<Robot> &getRobots() const;
+
+    /**
+     * Finds the robot closest to the given point
+     *
+     * @param point The point to find the closest robot to
+     *
+     * @return The robot closest to the given point, or std::nullopt if the partition
+     * contains no robots
+     */
+    std::optional<Robot> getNearestRobot(const Point &point) const;
+
+    /**
+     * Finds the distance from the given point to the closest robot
+     *
+     * @param point The point to measure from
+     *
+     * @return The distance to the closest robot, or std::nullopt if the partition
+     * contains no robots
+     */
+    std::optional<double> distanceToNearestRobot(const Point &point) const;
+
+    /**
+     * Finds all circles whose origin lies within the given rectangle and which do not
+     * contain any of the robots in this partition. Unlike findOpenCircles, robots
+     * outside the bounding box still limit the size of the circles.
+     *
+     * NOTE: this only guarantees that the center of each circle is within the
+     *       rectangle, some portion of the circle may extend outside the rectangle
+     *
+     * @param bounding_box The rectangle in which to look for open circles
+     *
+     * @return A list of circles, sorted in descending order of radius. If the partition
+     * contains no robots, returns an empty list.
+     */
+    std::vector<Circle> findOpenCircles(const Rectangle &bounding_box) const;
+
+    /**
+     * Finds the largest circle whose origin lies within the given rectangle and which
+     * does not contain any of the robots in this partition
+     *
+     * @param bounding_box The rectangle in which to look for the open circle
+     *
+     * @return The largest open circle, or std::nullopt if the partition contains no
+     * robots
+     */
+    std::optional<Circle> findLargestOpenCircle(const Rectangle &bounding_box) const;
+
+   private:
+    // An edge of the Voronoi diagram, separating the cells of two robots. A vertex of
+    // std::nullopt means the edge extends infinitely in that direction. The cell of
+    // robot `left_robot_index` is on the left of the edge when travelling from
+    // vertex0 to vertex1
+    struct VoronoiEdge
+    {
+        size_t left_robot_index;
+        size_t right_robot_index;
+        std::optional<size_t> vertex0;
+        std::optional<size_t> vertex1;
+    };
+
+    // A triangle of the Delaunay triangulation, stored as indices into the robots.
+    // Each triangle corresponds to the Voronoi vertex at its circumcenter
+    using DelaunayTriangle = std::array<size_t, 3>;
+
+    /**
+     * Rebuilds the Voronoi diagram from scratch from the current robot positions
+     */
+    void rebuild();
+
+    /**
+     * Recomputes the Voronoi vertices from the current robot positions, keeping the
+     * existing topology
+     *
+     * @return true if the existing triangulation is still a valid Delaunay
+     * triangulation of the current robot positions, false otherwise
+     */
+    bool moveVertices();
+
+    /**
+     * Returns the segment of the given edge that is long enough to cross the entire
+     * bounding box, if the edge is infinite
+     *
+     * @param edge The edge to get the segment of
+     * @param bounding_box The bounding box the segment must span
+     *
+     * @return The segment of the given edge
+     */
+    Segment edgeSegment(const VoronoiEdge &edge, const Rectangle &bounding_box) const;
+
+    std::vector<Robot> robots;
+    std::vector<DelaunayTriangle> triangles;
+    // The Voronoi vertices, where vertices[i] is the circumcenter of triangles[i]
+    std::vector<Point> vertices;
+    std::vector<VoronoiEdge> edges;
+};
@@ -0,0 +1,185 @@
+#include "software/ai/evaluation/spatial_partition.h"
+
+#include <gtest/gtest.h>
+
+#include "software/test_util/test_util.h"
+
+class SpatialPartitionTest : public ::testing::Test
+{
+   protected:
+    static Robot createRobot(RobotId id, const Point &position)
+    {
+        return Robot(id, position, Vector(), Angle::zero(), AngularVelocity::zero(),
+                     Timestamp::fromSeconds(0));
+    }
+
+    static std::vector<Robot> createRobots(const std::vector<Point> &positions)
+    {
+        std::vector<Robot> robots;
+        for (RobotId id = 0; id < positions.size(); id++)
+        {
+            robots.emplace_back(createRobot(id, positions[id]));
+        }
+        return robots;
+    }
+
+    static void expectCirclesEqual(const std::vector<Circle> &expected,
+                                   const std::vector<Circle> &actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            EXPECT_NEAR(expected[i].radius(), actual[i].radius(), 1e-6);
+        }
+    }
+
+    const Rectangle bounding_box = Rectangle(Point(-1, -1), Point(1, 1));
+};
+
+TEST_F(SpatialPartitionTest, empty_partition_has_no_open_circles)
+{
+    SpatialPartition partition;
+
+    EXPECT_TRUE(partition.findOpenCircles(bounding_box).empty());
+    EXPECT_FALSE(partition.findLargestOpenCircle(bounding_box));
+    EXPECT_FALSE(partition.getNearestRobot(Point(0, 0)));
+    EXPECT_FALSE(partition.distanceToNearestRobot(Point(0, 0)));
+}
+
+TEST_F(SpatialPartitionTest, single_robot_open_circles_are_at_corners)
+{
+    SpatialPartition partition(createRobots({Point(0.9, 0.9)}));
+
+    std::vector<Circle> open_circles = partition.findOpenCircles(bounding_box);
+
+    ASSERT_EQ(4, open_circles.size());
+    EXPECT_EQ(Point(-1, -1), open_circles[0].origin());
+    EXPECT_DOUBLE_EQ(std::sqrt(2 * std::pow(1.9, 2)), open_circles[0].radius());
+}
+
+TEST_F(SpatialPartitionTest, two_robots_largest_circle_on_bisector)
+{
+    SpatialPartition partition(createRobots({Point(-0.9, 0.6), Point(0.9, 0.6)}));
+
+    std::optional<Circle> largest = partition.findLargestOpenCircle(bounding_box);
+
+    ASSERT_TRUE(largest);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Point(0, -1), largest->origin(), 1e-6));
+    EXPECT_NEAR(std::hypot(0.9, 1.6), largest->radius(), 1e-9);
+}
+
+TEST_F(SpatialPartitionTest, three_robots_open_circles_include_voronoi_vertex)
+{
+    // The circumcenter of these robots is (0, -0.15), with a circumradius of 0.75
+    SpatialPartition partition(
+        createRobots({Point(0, 0.6), Point(0.6, -0.6), Point(-0.6, -0.6)}));
+
+    std::vector<Circle> open_circles = partition.findOpenCircles(bounding_box);
+
+    EXPECT_TRUE(
+        std::any_of(open_circles.begin(), open_circles.end(), [](const Circle &circle) {
+            return TestUtil::equalWithinTolerance(Point(0, -0.15), circle.origin(),
+                                                  1e-6) &&
+                   std::abs(circle.radius() - 0.75) < 1e-9;
+        }));
+}
+
+TEST_F(SpatialPartitionTest, robots_outside_bounding_box_limit_circle_size)
+{
+    // The robot just outside the bottom left corner of the bounding box keeps the
+    // corner from being the largest open area
+    SpatialPartition partition(
+        createRobots({Point(0.9, 0.9), Point(0.8, -0.9), Point(-1.1, -1.1)}));
+
+    std::optional<Circle> largest = partition.findLargestOpenCircle(bounding_box);
+
+    ASSERT_TRUE(largest);
+    EXPECT_NE(Point(-1, -1), largest->origin());
+    for (const Robot &robot : partition.getRobots())
+    {
+        EXPECT_GE((robot.position() - largest->origin()).length(),
+                  largest->radius() - 1e-9);
+    }
+}
+
+TEST_F(SpatialPartitionTest, collinear_robots)
+{
+    SpatialPartition partition(createRobots({Point(-1, 0), Point(0, 0), Point(1, 0)}));
+
+    std::optional<Circle> largest = partition.findLargestOpenCircle(bounding_box);
+
+    ASSERT_TRUE(largest);
+    EXPECT_NEAR(std::hypot(0.5, 1), largest->radius(), 1e-9);
+}
+
+TEST_F(SpatialPartitionTest, get_nearest_robot)
+{
+    SpatialPartition partition(
+        createRobots({Point(0.9, 0.9), Point(0.8, -0.9), Point(-0.5, 0.2)}));
+
+    std::optional<Robot> nearest = partition.getNearestRobot(Point(-1, 0));
+
+    ASSERT_TRUE(nearest);
+    EXPECT_EQ(2, nearest->id());
+    EXPECT_DOUBLE_EQ(std::hypot(0.5, 0.2),
+                     partition.distanceToNearestRobot(Point(-1, 0)).value());
+}
+
+TEST_F(SpatialPartitionTest, small_robot_movement_updates_in_place)
+{
+    std::vector<Point> positions = {Point(0.9, 0.9), Point(0.8, -0.9), Point(-0.5, 0.2),
+                                    Point(0.1, 0.1)};
+    SpatialPartition partition(createRobots(positions));
+
+    for (Point &position : positions)
+    {
+        position += Vector(0.01, -0.01);
+    }
+    std::vector<Robot> moved_robots = createRobots(positions);
+
+    EXPECT_FALSE(partition.update(moved_robots));
+    expectCirclesEqual(SpatialPartition(moved_robots).findOpenCircles(bounding_box),
+                       partition.findOpenCircles(bounding_box));
+}
+
+TEST_F(SpatialPartitionTest, robot_moving_into_circumcircle_rebuilds_diagram)
+{
+    std::vector<Point> positions = {Point(0, 0.6), Point(0.6, -0.6), Point(-0.6, -0.6),
+                                    Point(0, -0.9)};
+    SpatialPartition partition(createRobots(positions));
+
+    // Move the last robot into the circumcircle of the first three
+    positions[3]                    = Point(0, -0.4);
+    std::vector<Robot> moved_robots = createRobots(positions);
+
+    EXPECT_TRUE(partition.update(moved_robots));
+    expectCirclesEqual(SpatialPartition(moved_robots).findOpenCircles(bounding_box),
+                       partition.findOpenCircles(bounding_box));
+}
+
+TEST_F(SpatialPartitionTest, robot_crossing_triangulation_rebuilds_diagram)
+{
+    std::vector<Point> positions = {Point(-0.5, -0.5), Point(0.5, -0.5), Point(0.5, 0.5),
+                                    Point(-0.5, 0.5), Point(0, 0)};
+    SpatialPartition partition(createRobots(positions));
+
+    positions[4]                    = Point(0, -2);
+    std::vector<Robot> moved_robots = createRobots(positions);
+
+    EXPECT_TRUE(partition.update(moved_robots));
+    expectCirclesEqual(SpatialPartition(moved_robots).findOpenCircles(bounding_box),
+                       partition.findOpenCircles(bounding_box));
+}
+
+TEST_F(SpatialPartitionTest, different_robots_rebuilds_diagram)
+{
+    SpatialPartition partition(
+        createRobots({Point(0.9, 0.9), Point(0.8, -0.9), Point(-0.5, 0.2)}));
+
+    std::vector<Robot> robots = {createRobot(0, Point(0.9, 0.9)),
+                                 createRobot(1, Point(0.8, -0.9)),
+                                 createRobot(5, Point(-0.5, 0.2))};
+
+    EXPECT_TRUE(partition.update(robots));
+    EXPECT_EQ(5, partition.getRobots()[2].id());
+}
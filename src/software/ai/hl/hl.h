@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+#include "software/ai/evaluation/evaluation_cache.h"
 #include "software/ai/hl/stp/play_info.h"
 #include "software/ai/intent/intent.h"
 #include "software/world/world.h"
@@ -25,11 +26,14 @@ class HL
      * be running.
      *
      * @param world The current state of the world
+     * @param evaluation_cache The cache of evaluations of the current state of the world,
+     * shared by everything that runs this tick
      *
      * @return A vector of unique pointers to the Intents our friendly robots should be
      * running
      */
-    virtual std::vector<std::unique_ptr<Intent>> getIntents(const World &world) = 0;
+    virtual std::vector<std::unique_ptr<Intent>> getIntents(
+        const World &world, std::shared_ptr<EvaluationCache> evaluation_cache) = 0;
 
     /**
      * Returns information about the currently running plays and tactics, including the
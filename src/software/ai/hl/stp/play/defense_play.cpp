@@ -115,8 +115,8 @@ void DefensePlay::getNextTactics(TacticCoroutine::push_type &yield, const World
             }
             else
             {
-                auto nearest_enemy_robot =
-                    world.enemyTeam().getNearestRobot(world.ball().position());
+                auto nearest_enemy_robot = evaluation_cache->getNearestRobot(
+                    TeamType::ENEMY, world.ball().position());
                 if (nearest_enemy_robot)
                 {
                     // Blocks in front of where the closest enemy robot is
@@ -1,7 +1,11 @@
 #include "software/ai/hl/stp/play/play.h"
 
+#include "software/ai/profiler/ai_profiler.h"
+
 Play::Play(std::shared_ptr<const PlayConfig> play_config, bool requires_goalie)
     : play_config(play_config),
+      threaded_pass_generator(nullptr),
+      evaluation_cache(nullptr),
       requires_goalie(requires_goalie),
       tactic_sequence(boost::bind(&Play::getNextTacticsWrapper, this, _1)),
       world(std::nullopt)
@@ -15,18 +19,23 @@ bool Play::done() const
     return !static_cast<bool>(tactic_sequence);
 }
 
-PriorityTacticVector Play::getTactics(const World &world)
+PriorityTacticVector Play::getTactics(const World &world,
+                                      std::shared_ptr<EvaluationCache> evaluation_cache)
 {
     // Update the member variable that stores the world. This will be used by the
     // getNextTacticsWrapper function (inside the coroutine) to pass the World data to
     // the getNextTactics function. This is easier than directly passing the World data
     // into the coroutine
-    this->world = world;
+    this->world            = world;
+    this->evaluation_cache = evaluation_cache;
     // Check the coroutine status to see if it has any more work to do.
     if (tactic_sequence)
     {
         // Run the coroutine. This will call the bound getNextTactics function
-        tactic_sequence();
+        {
+            PROFILE_SCOPE("Play::getNextTactics");
+            tactic_sequence();
+        }
 
         // Check if the coroutine is still valid before getting the result. This makes
         // sure we don't try get the result after "running out the bottom" of the
@@ -47,10 +56,13 @@ PriorityTacticVector Play::getTactics(const World &world)
 
 std::vector<std::unique_ptr<Intent>> Play::get(
     RobotToTacticAssignmentFunction robot_to_tactic_assignment_algorithm,
-    MotionConstraintBuildFunction motion_constraint_builder, const World &new_world)
+    MotionConstraintBuildFunction motion_constraint_builder, const World &new_world,
+    std::shared_ptr<EvaluationCache> evaluation_cache)
 {
+    PROFILE_OBJECT_SCOPE(*this);
+
     std::vector<std::unique_ptr<Intent>> intents;
-    PriorityTacticVector priority_tactics = getTactics(new_world);
+    PriorityTacticVector priority_tactics = getTactics(new_world, evaluation_cache);
     ConstPriorityTacticVector const_priority_tactics;
 
     // convert pointers to const pointers
@@ -71,15 +83,25 @@ std::vector<std::unique_ptr<Intent>> Play::get(
             auto iter = robot_tactic_assignment.find(tactic);
             if (iter != robot_tactic_assignment.end())
             {
-                auto intent = tactic->get(iter->second, new_world);
+                auto intent = tactic->get(iter->second, new_world, evaluation_cache);
                 intent->setMotionConstraints(motion_constraint_builder(*tactic));
                 intents.push_back(std::move(intent));
             }
         }
     }
+
+    // The cache only holds a reference to this tick's World, so it must not be kept
+    // once the tick is over
+    this->evaluation_cache = nullptr;
     return intents;
 }
 
+void Play::setThreadedPassGenerator(
+    std::shared_ptr<const ThreadedPassGenerator<EighteenZoneId>> threaded_pass_generator)
+{
+    this->threaded_pass_generator = threaded_pass_generator;
+}
+
 void Play::getNextTacticsWrapper(TacticCoroutine::push_type &yield)
 {
     // Yield an empty vector the very first time the function is called. This value will
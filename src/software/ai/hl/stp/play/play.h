@@ -7,6 +7,8 @@
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/ai/hl/stp/tactic/tactic.h"
+#include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/ai/passing/threaded_pass_generator.h"
 
 using TacticVector              = std::vector<std::shared_ptr<Tactic>>;
 using PriorityTacticVector      = std::vector<TacticVector>;
@@ -95,12 +97,27 @@ class Play
      * tactics
      * @param motion_constraint_builder Builds motion constraints from tactics
      * @param world The updated world
+     * @param evaluation_cache The cache of evaluations of the updated world, which is
+     * shared with the Play's tactics
      *
      * @return the vector of intents to execute
      */
     std::vector<std::unique_ptr<Intent>> get(
         RobotToTacticAssignmentFunction robot_to_tactic_assignment_algorithm,
-        MotionConstraintBuildFunction motion_constraint_builder, const World& new_world);
+        MotionConstraintBuildFunction motion_constraint_builder, const World& new_world,
+        std::shared_ptr<EvaluationCache> evaluation_cache);
+
+    /**
+     * Sets the pass generator that is searching for passes in the background, which
+     * the Play can use instead of generating passes during the tick
+     *
+     * @param threaded_pass_generator The pass generator that is searching for passes
+     * in the background, or nullptr if the Play should generate all its passes during
+     * the tick
+     */
+    void setThreadedPassGenerator(
+        std::shared_ptr<const ThreadedPassGenerator<EighteenZoneId>>
+            threaded_pass_generator);
 
     virtual ~Play() = default;
 
@@ -108,6 +125,15 @@ class Play
     // The Play configuration
     std::shared_ptr<const PlayConfig> play_config;
 
+    // The pass generator that is searching for passes in the background, or nullptr if
+    // there is none. It may be searching on a newer or older World than the Play's
+    std::shared_ptr<const ThreadedPassGenerator<EighteenZoneId>> threaded_pass_generator;
+
+    // The cache of evaluations of the most up-to-date World. This is updated along
+    // with the World that is passed to getNextTactics, and is only set while the Play
+    // is being run by get
+    std::shared_ptr<EvaluationCache> evaluation_cache;
+
    private:
     /**
      * Returns a list of shared_ptrs to the Tactics the Play wants to run at this time, in
@@ -121,10 +147,13 @@ class Play
      * time the function is called.
      *
      * @param world The current state of the world
+     * @param evaluation_cache The cache of evaluations of the current state of the world
+     *
      * @return A list of shared_ptrs to the Tactics the Play wants to run at this time, in
      * order of priority
      */
-    PriorityTacticVector getTactics(const World& world);
+    PriorityTacticVector getTactics(const World& world,
+                                    std::shared_ptr<EvaluationCache> evaluation_cache);
 
     /**
      * A wrapper function for the getNextTactics function.
@@ -2,6 +2,7 @@
 
 #include "shared/constants.h"
 #include "software/ai/evaluation/enemy_threat.h"
+#include "software/ai/evaluation/evaluation_cache.h"
 #include "software/ai/evaluation/find_open_areas.h"
 #include "software/ai/evaluation/possession.h"
 #include "software/ai/hl/stp/tactic/attacker/attacker_tactic.h"
@@ -81,12 +82,8 @@ void ShootOrChipPlay::getNextTactics(TacticCoroutine::push_type &yield,
         result[0].emplace_back(std::get<1>(crease_defender_tactics));
 
         // Update tactics moving to open areas
-        std::vector<Point> enemy_robot_points;
-        for (auto const &robot : world.enemyTeam().getAllRobots())
-        {
-            enemy_robot_points.emplace_back(robot.position());
-        }
-        std::vector<Circle> chip_targets = findGoodChipTargets(world);
+        std::vector<Circle> chip_targets = findGoodChipTargets(
+            world, evaluation_cache->getSpatialPartition(TeamType::ENEMY));
         for (unsigned i = 0;
              i < chip_targets.size() && i < move_to_open_area_tactics.size(); i++)
         {
@@ -84,7 +84,7 @@ void ShootOrPassPlay::getNextTactics(TacticCoroutine::push_type &yield,
             world.field(), world.friendlyTeam(), world.enemyTeam(), pass, world.ball(),
             false);
 
-        auto pass_eval = pass_generator.generatePassEvaluation(world);
+        auto pass_eval = getPassEvaluation(pass_generator, world);
 
         auto ranked_zones = pass_eval.rankZonesForReceiving(
             world, best_pass_and_score_so_far.pass.receiverPoint());
@@ -150,7 +150,7 @@ PassWithRating ShootOrPassPlay::attemptToShootWhileLookingForAPass(
     PassGenerator<EighteenZoneId> pass_generator(pitch_division,
                                                  play_config->getPassingConfig());
 
-    auto pass_eval    = pass_generator.generatePassEvaluation(world);
+    auto pass_eval    = getPassEvaluation(pass_generator, world);
     auto ranked_zones = pass_eval.rankZonesForReceiving(world, world.ball().position());
     Zones cherry_pick_region_1 = {ranked_zones[0]};
     Zones cherry_pick_region_2 = {ranked_zones[1]};
@@ -183,7 +183,7 @@ PassWithRating ShootOrPassPlay::attemptToShootWhileLookingForAPass(
         std::get<1>(crease_defender_tactics)
             ->updateControlParams(world.ball().position(),
                                   CreaseDefenderAlignment::RIGHT);
-        pass_eval                  = pass_generator.generatePassEvaluation(world);
+        pass_eval                  = getPassEvaluation(pass_generator, world);
         best_pass_and_score_so_far = pass_eval.getBestPassOnField();
 
         auto pass1 = pass_eval.getBestPassInZones(cherry_pick_region_1).pass;
@@ -217,5 +217,23 @@ PassWithRating ShootOrPassPlay::attemptToShootWhileLookingForAPass(
     return best_pass_and_score_so_far;
 }
 
+PassEvaluation<EighteenZoneId> ShootOrPassPlay::getPassEvaluation(
+    PassGenerator<EighteenZoneId> &pass_generator, const World &world) const
+{
+    if (threaded_pass_generator)
+    {
+        auto pass_evaluation = threaded_pass_generator->getPassEvaluation(
+            world.getMostRecentTimestamp(),
+            Duration::fromSeconds(play_config->getPassingConfig()
+                                      ->getMaxThreadedPassEvaluationAgeSeconds()
+                                      ->value()));
+        if (pass_evaluation)
+        {
+            return *pass_evaluation;
+        }
+    }
+    return pass_generator.generatePassEvaluation(world);
+}
+
 // Register this play in the genericFactory
 static TGenericFactory<std::string, Play, ShootOrPassPlay, PlayConfig> factory;
@@ -5,6 +5,7 @@
 #include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
 #include "software/ai/hl/stp/tactic/move/move_tactic.h"
 #include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/ai/passing/pass_evaluation.h"
 #include "software/ai/passing/pass_generator.h"
 
 /**
@@ -29,6 +30,20 @@ class ShootOrPassPlay : public Play
     // The speed each patrolling robot should be moving through its control point
     static constexpr double SPEED_AT_PATROL_POINTS = 0.0;
 
+    /**
+     * Returns the passes found on the given World. The passes found by the threaded pass
+     * generator are used if they are recent enough, otherwise they are generated with
+     * the given pass generator during the tick
+     *
+     * @param pass_generator The pass generator to use if the threaded pass generator's
+     * passes can't be used
+     * @param world The current state of the world
+     *
+     * @return the passes found on the given World
+     */
+    PassEvaluation<EighteenZoneId> getPassEvaluation(
+        PassGenerator<EighteenZoneId> &pass_generator, const World &world) const;
+
     /**
      * Sets up the pass for the corner kick: aligns the passer and positions the cherry
      * pickers
@@ -1,7 +1,5 @@
 #include "software/ai/hl/stp/stp.h"
 
-#include <munkres/munkres.h>
-
 #include <algorithm>
 #include <boost/bind.hpp>
 #include <chrono>
@@ -15,26 +13,32 @@
 #include "software/ai/hl/stp/tactic/tactic.h"
 #include "software/ai/intent/stop_intent.h"
 #include "software/ai/motion_constraint/motion_constraint_set_builder.h"
+#include "software/ai/profiler/ai_profiler.h"
 #include "software/logger/logger.h"
 #include "software/util/design_patterns/generic_factory.h"
 #include "software/util/typename/typename.h"
 
-STP::STP(std::function<std::unique_ptr<Play>()> default_play_constructor,
-         std::shared_ptr<const AiControlConfig> control_config,
-         std::shared_ptr<const PlayConfig> play_config, long random_seed)
+STP::STP(
+    std::function<std::unique_ptr<Play>()> default_play_constructor,
+    std::shared_ptr<const AiControlConfig> control_config,
+    std::shared_ptr<const PlayConfig> play_config, long random_seed,
+    std::shared_ptr<const ThreadedPassGenerator<EighteenZoneId>> threaded_pass_generator)
     : default_play_constructor(default_play_constructor),
       current_play(nullptr),
       robot_tactic_assignment(),
       random_number_generator(random_seed),
       control_config(control_config),
       play_config(play_config),
+      threaded_pass_generator(threaded_pass_generator),
       override_play_name(""),
       previous_override_play_name(""),
       override_play(false),
       previous_override_play(false),
       current_game_state(),
       goalie_tactic(std::make_shared<GoalieTactic>(play_config->getGoalieTacticConfig())),
-      stop_tactics()
+      stop_tactics(),
+      tactic_assignment_solvers(),
+      tactic_assignment_stats({0.0, Duration::fromSeconds(0), 0, 0})
 {
     for (unsigned int i = 0; i < MAX_ROBOT_IDS; i++)
     {
@@ -55,6 +59,8 @@ void STP::updateGameState(const World& world)
 
 void STP::updateAIPlay(const World& world)
 {
+    PROFILE_SCOPE("STP::updateAIPlay");
+
     bool play_overridden = overrideAIPlayIfApplicable();
     if (!play_overridden)
     {
@@ -63,7 +69,7 @@ void STP::updateAIPlay(const World& world)
         {
             try
             {
-                current_play = calculateNewPlay(world);
+                setCurrentPlay(calculateNewPlay(world));
             }
             catch (const std::runtime_error& e)
             {
@@ -72,13 +78,14 @@ void STP::updateAIPlay(const World& world)
                              << std::endl;
                 LOG(WARNING) << "Falling back to the default Play - "
                              << objectTypeName(*default_play) << std::endl;
-                current_play = std::move(default_play);
+                setCurrentPlay(std::move(default_play));
             }
         }
     }
 }
 
-std::vector<std::unique_ptr<Intent>> STP::getIntentsFromCurrentPlay(const World& world)
+std::vector<std::unique_ptr<Intent>> STP::getIntentsFromCurrentPlay(
+    const World& world, std::shared_ptr<EvaluationCache> evaluation_cache)
 {
     return current_play->get(
         [this](const ConstPriorityTacticVector& tactics, const World& world,
@@ -88,13 +95,14 @@ std::vector<std::unique_ptr<Intent>> STP::getIntentsFromCurrentPlay(const World&
         [this](const Tactic& tactic) {
             return buildMotionConstraintSet(current_game_state, tactic);
         },
-        world);
+        world, evaluation_cache);
 }
 
-std::vector<std::unique_ptr<Intent>> STP::getIntents(const World& world)
+std::vector<std::unique_ptr<Intent>> STP::getIntents(
+    const World& world, std::shared_ptr<EvaluationCache> evaluation_cache)
 {
     updateSTPState(world);
-    auto intents = getIntentsFromCurrentPlay(world);
+    auto intents = getIntentsFromCurrentPlay(world, evaluation_cache);
 
     auto all_tactics = stop_tactics;
     all_tactics.push_back(goalie_tactic);
@@ -103,7 +111,7 @@ std::vector<std::unique_ptr<Intent>> STP::getIntents(const World& world)
         auto iter = robot_tactic_assignment.find(tactic);
         if (iter != robot_tactic_assignment.end())
         {
-            auto intent = tactic->get(iter->second, world);
+            auto intent = tactic->get(iter->second, world, evaluation_cache);
             intent->setMotionConstraints(
                 buildMotionConstraintSet(current_game_state, *tactic));
             intents.push_back(std::move(intent));
@@ -187,8 +195,8 @@ bool STP::overrideAIPlayIfApplicable()
         {
             try
             {
-                current_play = GenericFactory<std::string, Play, PlayConfig>::create(
-                    override_play_name, play_config);
+                setCurrentPlay(GenericFactory<std::string, Play, PlayConfig>::create(
+                    override_play_name, play_config));
             }
             catch (std::invalid_argument&)
             {
@@ -197,19 +205,36 @@ bool STP::overrideAIPlayIfApplicable()
                              << "\" specified in the override is not valid." << std::endl;
                 LOG(WARNING) << "Falling back to the default Play - "
                              << objectTypeName(*default_play) << std::endl;
-                current_play = std::move(default_play);
+                setCurrentPlay(std::move(default_play));
             }
         }
     }
     return override_play;
 }
 
+void STP::setCurrentPlay(std::unique_ptr<Play> play)
+{
+    play->setThreadedPassGenerator(threaded_pass_generator);
+    current_play = std::move(play);
+}
+
 
 std::map<std::shared_ptr<const Tactic>, Robot> STP::assignRobotsToTactics(
     ConstPriorityTacticVector tactics, const World& world,
     bool automatically_assign_goalie)
 {
-    robot_tactic_assignment.clear();
+    PROFILE_SCOPE("STP::assignRobotsToTactics");
+
+    auto assignment_start_time = std::chrono::steady_clock::now();
+    tactic_assignment_stats    = {0.0, Duration::fromSeconds(0), 0, 0};
+
+    // We keep the previous assignment around to apply hysteresis, so that robots do not
+    // switch back and forth between tactics with similar costs
+    std::map<std::shared_ptr<const Tactic>, Robot> previous_robot_tactic_assignment;
+    std::swap(previous_robot_tactic_assignment, robot_tactic_assignment);
+    const double hysteresis = control_config->getTacticAssignmentHysteresis()->value();
+    const double skip_threshold =
+        control_config->getTacticAssignmentSkipThreshold()->value();
 
     std::optional<Robot> goalie_robot = world.friendlyTeam().goalie();
     std::vector<Robot> robots         = world.friendlyTeam().getAllRobots();
@@ -222,16 +247,22 @@ std::map<std::shared_ptr<const Tactic>, Robot> STP::assignRobotsToTactics(
                      robots.end());
     }
 
+    if (tactic_assignment_solvers.size() < tactics.size())
+    {
+        tactic_assignment_solvers.resize(tactics.size());
+    }
+
     // This functions optimizes the assignment of robots to tactics by minimizing
     // the total cost of assignment using the Hungarian algorithm
-    // (also known as the Munkres algorithm)
     // https://en.wikipedia.org/wiki/Hungarian_algorithm
     //
-    // https://github.com/saebyn/munkres-cpp is the implementation of the Hungarian
-    // algorithm that we use here
-    for (auto tactic_vector : tactics)
+    // Each priority tier keeps its own solver between calls, so that the solution from
+    // the previous tick can be used to warm start the solver. See
+    // hungarian_assignment_solver.h for details
+    for (size_t tier = 0; tier < tactics.size(); tier++)
     {
-        size_t num_tactics = tactic_vector.size();
+        ConstTacticVector tactic_vector = tactics.at(tier);
+        size_t num_tactics              = tactic_vector.size();
 
         if (robots.size() < tactic_vector.size())
         {
@@ -250,90 +281,87 @@ std::map<std::shared_ptr<const Tactic>, Robot> STP::assignRobotsToTactics(
             }
         }
 
-        size_t num_rows = robots.size();
-        size_t num_cols = tactic_vector.size();
-
-        // The Matrix constructor will assert if the rows and columns of the matrix are
-        // not >= 1, so we perform that check first and skip over this tactic_vector if
-        // it is empty. This represents the cases where there are either no tactics or no
-        // robots
-        if (num_rows == 0 || num_cols == 0)
+        // There are either no tactics or no robots to assign
+        if (robots.empty())
         {
             continue;
         }
 
         // The rows of the matrix are the "workers" (the robots) and the columns are the
-        // "jobs" (the Tactics).
-        Matrix<double> matrix(num_rows, num_cols);
+        // "jobs" (the Tactics). Padding the tactics with StopTactics ensures the matrix
+        // is square
+        HungarianAssignmentSolver& solver = tactic_assignment_solvers.at(tier);
+        solver.resize(robots.size());
 
         // Initialize the matrix with the cost of assigning each Robot to each Tactic
-        for (size_t row = 0; row < num_rows; row++)
+        for (size_t row = 0; row < robots.size(); row++)
         {
-            for (size_t col = 0; col < num_cols; col++)
+            for (size_t col = 0; col < tactic_vector.size(); col++)
             {
-                Robot robot                           = robots.at(row);
-                std::shared_ptr<const Tactic>& tactic = tactic_vector.at(col);
+                const Robot& robot                          = robots.at(row);
+                const std::shared_ptr<const Tactic>& tactic = tactic_vector.at(col);
                 double robot_cost_for_tactic = tactic->calculateRobotCost(robot, world);
 
                 std::set<RobotCapability> required_capabilities =
                     tactic->robotCapabilityRequirements();
                 std::set<RobotCapability> robot_capabilities =
                     robot.getAvailableCapabilities();
-                std::set<RobotCapability> missing_capabilities;
-                std::set_difference(
-                    required_capabilities.begin(), required_capabilities.end(),
-                    robot_capabilities.begin(), robot_capabilities.end(),
-                    std::inserter(missing_capabilities, missing_capabilities.begin()));
-
-                if (missing_capabilities.size() > 0)
+                if (!std::includes(robot_capabilities.begin(), robot_capabilities.end(),
+                                   required_capabilities.begin(),
+                                   required_capabilities.end()))
                 {
-                    matrix(row, col) = robot_cost_for_tactic + 10.0f;
+                    robot_cost_for_tactic += 10.0;
                 }
-                else
+
+                auto previous_assignment = previous_robot_tactic_assignment.find(tactic);
+                if (previous_assignment != previous_robot_tactic_assignment.end() &&
+                    previous_assignment->second.id() == robot.id())
                 {
-                    // capability requirements are satisfied, use real cost
-                    matrix(row, col) = robot_cost_for_tactic;
+                    robot_cost_for_tactic -= hysteresis;
                 }
+
+                solver.setCost(row, col, robot_cost_for_tactic);
             }
         }
 
-        // Apply the Munkres/Hungarian algorithm to the matrix.
-        Munkres<double> m;
-        m.solve(matrix);
-
-        // The Munkres matrix gets solved such that there will be exactly one 0 in every
-        // row and exactly one 0 in every column. All other values will be -1. The 0's
-        // indicate the "workers" and "jobs" (robots and tactics for us) that are most
-        // optimally paired together
-        //
-        // Example matrices:
-        //        -1, 0,-1,         and            0,-1,
-        //         0,-1,-1,                       -1, 0,
-        //        -1,-1, 0,
-        auto remaining_robots = robots;
-
-        for (size_t row = 0; row < num_rows; row++)
+        if (solver.solve(skip_threshold))
         {
-            for (size_t col = 0; col < num_tactics; col++)
+            tactic_assignment_stats.num_tiers_solved++;
+        }
+        else
+        {
+            tactic_assignment_stats.num_tiers_skipped++;
+        }
+        tactic_assignment_stats.total_cost += solver.getTotalCost();
+
+        // Only the tactics that were requested are assigned, the rest of the columns
+        // are the StopTactics that were used for padding
+        std::vector<Robot> remaining_robots;
+        for (size_t row = 0; row < robots.size(); row++)
+        {
+            size_t col = solver.getAssignedColumn(row);
+            if (col < num_tactics)
             {
-                auto val = matrix(row, col);
-                if (val == 0)
-                {
-                    robot_tactic_assignment.emplace(tactic_vector.at(col),
-                                                    robots.at(row));
-                    remaining_robots.erase(
-                        std::remove_if(remaining_robots.begin(), remaining_robots.end(),
-                                       [robots, row](const Robot& robot) {
-                                           return robot.id() == robots.at(row).id();
-                                       }),
-                        remaining_robots.end());
-                    break;
-                }
+                robot_tactic_assignment.emplace(tactic_vector.at(col), robots.at(row));
+            }
+            else
+            {
+                remaining_robots.emplace_back(robots.at(row));
             }
         }
 
         robots = remaining_robots;
     }
 
+    tactic_assignment_stats.assignment_time = Duration::fromSeconds(
+        std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      assignment_start_time)
+            .count());
+
     return robot_tactic_assignment;
 }
+
+TacticAssignmentStats STP::getTacticAssignmentStats() const
+{
+    return tactic_assignment_stats;
+}
@@ -8,6 +8,24 @@
 #include "software/ai/hl/hl.h"
 #include "software/ai/hl/stp/play/play.h"
 #include "software/ai/intent/intent.h"
+#include "software/optimization/hungarian_assignment_solver.h"
+#include "software/time/duration.h"
+
+/**
+ * Statistics about the most recent call to STP::assignRobotsToTactics
+ */
+struct TacticAssignmentStats
+{
+    // The sum of the costs of all the robot-tactic pairs chosen by the solver, including
+    // the robots assigned StopTactics and any hysteresis applied
+    double total_cost;
+    // The wall-clock time it took to assign all the tactics
+    Duration assignment_time;
+    // The number of priority tiers that were solved, and the number that reused the
+    // previous tick's assignment because their costs barely changed
+    unsigned int num_tiers_solved;
+    unsigned int num_tiers_skipped;
+};
 
 /**
  * The STP module is an implementation of the high-level logic Abstract class, that
@@ -87,12 +105,18 @@ class STP : public HL
      * @param play_config The Play configuration
      * @param random_seed The random seed used for STP's internal random number generator.
      * The default value is 0
+     * @param threaded_pass_generator The pass generator that is searching for passes
+     * in the background, which is given to every Play that is run. If this is nullptr,
+     * Plays generate all their passes during the tick
      */
     explicit STP(std::function<std::unique_ptr<Play>()> default_play_constructor,
                  std::shared_ptr<const AiControlConfig> control_config,
-                 std::shared_ptr<const PlayConfig> play_config, long random_seed);
+                 std::shared_ptr<const PlayConfig> play_config, long random_seed,
+                 std::shared_ptr<const ThreadedPassGenerator<EighteenZoneId>>
+                     threaded_pass_generator = nullptr);
 
-    std::vector<std::unique_ptr<Intent>> getIntents(const World &world) override;
+    std::vector<std::unique_ptr<Intent>> getIntents(
+        const World &world, std::shared_ptr<EvaluationCache> evaluation_cache) override;
 
     /**
      * Given the state of the world, returns a unique_ptr to the Play that should be run
@@ -159,12 +183,25 @@ class STP : public HL
      * @param automatically_assign_goalie whether or not to automatically assign a goalie
      * tactic
      *
+     * To keep robots from switching back and forth between tactics with similar costs,
+     * the cost of keeping a robot on the tactic it was assigned to by the previous call
+     * is lowered by the tactic_assignment_hysteresis parameter. If no cost in a tier has
+     * changed by more than the tactic_assignment_skip_threshold parameter since the tier
+     * was last solved, the previous assignment for that tier is reused
+     *
      * @return map from assigned tactics to robot
      */
     std::map<std::shared_ptr<const Tactic>, Robot> assignRobotsToTactics(
         ConstPriorityTacticVector tactics, const World &world,
         bool automatically_assign_goalie);
 
+    /**
+     * Returns statistics about the most recent call to assignRobotsToTactics
+     *
+     * @return statistics about the most recent call to assignRobotsToTactics
+     */
+    TacticAssignmentStats getTacticAssignmentStats() const;
+
    private:
     /**
      * Updates the current STP state based on the state of the world
@@ -190,9 +227,13 @@ class STP : public HL
     /**
      * Gets the intents the current play wants to run
      *
+     * @param world The current state of the world
+     * @param evaluation_cache The cache of evaluations of the current state of the world
+     *
      * @return The vector of intents that should be run right now to execute the play
      */
-    std::vector<std::unique_ptr<Intent>> getIntentsFromCurrentPlay(const World &world);
+    std::vector<std::unique_ptr<Intent>> getIntentsFromCurrentPlay(
+        const World &world, std::shared_ptr<EvaluationCache> evaluation_cache);
 
     /**
      * Overrides the AI Play if override is true
@@ -201,6 +242,13 @@ class STP : public HL
      */
     bool overrideAIPlayIfApplicable();
 
+    /**
+     * Makes the given Play the current Play, giving it the threaded pass generator
+     *
+     * @param play The Play to run
+     */
+    void setCurrentPlay(std::unique_ptr<Play> play);
+
     // A function that constructs a Play that will be used if no other Plays are
     // applicable
     std::function<std::unique_ptr<Play>()> default_play_constructor;
@@ -211,6 +259,7 @@ class STP : public HL
     std::mt19937 random_number_generator;
     std::shared_ptr<const AiControlConfig> control_config;
     std::shared_ptr<const PlayConfig> play_config;
+    std::shared_ptr<const ThreadedPassGenerator<EighteenZoneId>> threaded_pass_generator;
     std::string override_play_name;
     std::string previous_override_play_name;
     bool override_play;
@@ -220,4 +269,8 @@ class STP : public HL
     std::shared_ptr<GoalieTactic> goalie_tactic;
     // Stop tactic common to all plays for robots that don't have tactics assigned
     TacticVector stop_tactics;
+    // The solver used for each priority tier of tactic assignment, kept between calls
+    // so they can be warm started from the previous assignment
+    std::vector<HungarianAssignmentSolver> tactic_assignment_solvers;
+    TacticAssignmentStats tactic_assignment_stats;
 };
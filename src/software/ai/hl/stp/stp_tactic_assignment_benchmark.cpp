@@ -0,0 +1,183 @@
+#include <benchmark/benchmark.h>
+
+#include "software/ai/hl/stp/play/halt_play.h"
+#include "software/ai/hl/stp/stp.h"
+#include "software/ai/hl/stp/tactic/all_tactics.h"
+#include "software/ai/hl/stp/tactic/test_tactics/move_test_tactic.h"
+#include "software/test_util/test_util.h"
+
+/**
+ * Benchmarks for STP::assignRobotsToTactics, using the same scenarios as
+ * stp_tactic_assignment_test.cpp
+ *
+ * Run with: bazel run -c opt //software/ai/hl/stp:stp_tactic_assignment_benchmark
+ */
+
+namespace
+{
+    std::shared_ptr<const ThunderbotsConfig> thunderbots_config =
+        std::make_shared<const ThunderbotsConfig>();
+
+    STP createSTP()
+    {
+        return STP(
+            []() {
+                return std::make_unique<HaltPlay>(thunderbots_config->getPlayConfig());
+            },
+            thunderbots_config->getAiControlConfig(), thunderbots_config->getPlayConfig(),
+            0);
+    }
+
+    World createWorld(const std::vector<Point>& robot_positions)
+    {
+        World world = ::TestUtil::createBlankTestingWorld();
+        Team friendly_team =
+            TestUtil::setRobotPositionsHelper(Team(), robot_positions, Timestamp());
+        friendly_team.assignGoalie(0);
+        world.updateFriendlyTeamState(friendly_team);
+        return world;
+    }
+
+    std::vector<std::shared_ptr<MoveTestTactic>> createMoveTactics(
+        const std::vector<Point>& destinations)
+    {
+        std::vector<std::shared_ptr<MoveTestTactic>> tactics;
+        for (const Point& destination : destinations)
+        {
+            auto tactic = std::make_shared<MoveTestTactic>();
+            tactic->updateControlParams(destination);
+            tactics.emplace_back(tactic);
+        }
+        return tactics;
+    }
+
+    void reportStats(benchmark::State& state, const STP& stp)
+    {
+        TacticAssignmentStats stats       = stp.getTacticAssignmentStats();
+        state.counters["total_cost"]      = stats.total_cost;
+        state.counters["tiers_solved"]    = stats.num_tiers_solved;
+        state.counters["tiers_skipped"]   = stats.num_tiers_skipped;
+        state.counters["assignment_time"] = stats.assignment_time.toMilliseconds();
+    }
+
+    const std::vector<Point> SIX_ROBOT_POSITIONS = {Point(-4, -2),   Point(-3, -3),
+                                                    Point(-3.5, 2),  Point(2.2, 3),
+                                                    Point(0.6, 0.3), Point(4.5, 3)};
+}  // namespace
+
+static void BM_assignEqualNumberOfRobotsAndTactics(benchmark::State& state)
+{
+    STP stp      = createSTP();
+    World world  = createWorld(SIX_ROBOT_POSITIONS);
+    auto tactics = createMoveTactics({Point(-1, 0), Point(1, 0), Point(0, 1),
+                                      Point(0, -1), Point(2, 2), Point(-2, -2)});
+    ConstPriorityTacticVector request = {
+        ConstTacticVector(tactics.begin(), tactics.end())};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(stp.assignRobotsToTactics(request, world, false));
+    }
+    reportStats(state, stp);
+}
+BENCHMARK(BM_assignEqualNumberOfRobotsAndTactics);
+
+static void BM_assignMoreRobotsThanTactics(benchmark::State& state)
+{
+    STP stp                           = createSTP();
+    World world                       = createWorld(SIX_ROBOT_POSITIONS);
+    auto tactics                      = createMoveTactics({Point(-1, 0), Point(1, 0)});
+    ConstPriorityTacticVector request = {
+        ConstTacticVector(tactics.begin(), tactics.end())};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(stp.assignRobotsToTactics(request, world, true));
+    }
+    reportStats(state, stp);
+}
+BENCHMARK(BM_assignMoreRobotsThanTactics);
+
+static void BM_assignTieredTactics(benchmark::State& state)
+{
+    STP stp     = createSTP();
+    World world = createWorld(SIX_ROBOT_POSITIONS);
+    auto tactics =
+        createMoveTactics({Point(-1, 0), Point(1, 0), Point(0, 1), Point(0, -1)});
+    ConstPriorityTacticVector request = {
+        {tactics[0]}, {tactics[1], tactics[2]}, {tactics[3]}};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(stp.assignRobotsToTactics(request, world, true));
+    }
+    reportStats(state, stp);
+}
+BENCHMARK(BM_assignTieredTactics);
+
+static void BM_assignMultiTierGameplayTactics(benchmark::State& state)
+{
+    STP stp     = createSTP();
+    World world = createWorld(SIX_ROBOT_POSITIONS);
+
+    auto crease_defender_1 = std::make_shared<CreaseDefenderTactic>(
+        thunderbots_config->getPlayConfig()->getRobotNavigationObstacleConfig());
+    auto crease_defender_2 = std::make_shared<CreaseDefenderTactic>(
+        thunderbots_config->getPlayConfig()->getRobotNavigationObstacleConfig());
+    Pass passer_pass(Point(2, 3), Point(0.5, 0.3), 2);
+    auto attacker =
+        std::make_shared<AttackerTactic>(std::make_shared<const AttackerTacticConfig>());
+    attacker->updateControlParams(passer_pass);
+    auto receiver = std::make_shared<ReceiverTactic>(world.field(), world.friendlyTeam(),
+                                                     world.enemyTeam(), passer_pass,
+                                                     world.ball(), false);
+    auto move_tactic = std::make_shared<MoveTestTactic>();
+
+    ConstPriorityTacticVector request = {
+        {attacker, receiver}, {move_tactic, crease_defender_1, crease_defender_2}};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(stp.assignRobotsToTactics(request, world, true));
+    }
+    reportStats(state, stp);
+}
+BENCHMARK(BM_assignMultiTierGameplayTactics);
+
+/**
+ * Assigns tactics while the robots move a small amount every tick, which is the common
+ * case during gameplay. The argument is the distance in mm the robots move each tick,
+ * which determines how often the assignment can be reused or warm started
+ */
+static void BM_assignWithMovingRobots(benchmark::State& state)
+{
+    STP stp      = createSTP();
+    auto tactics = createMoveTactics(
+        {Point(-1, 0), Point(1, 0), Point(0, 1), Point(0, -1), Point(2, 2)});
+    ConstPriorityTacticVector request = {
+        ConstTacticVector(tactics.begin(), tactics.end())};
+
+    const double step = static_cast<double>(state.range(0)) / 1000.0;
+    std::vector<World> worlds;
+    for (unsigned int tick = 0; tick < 100; tick++)
+    {
+        std::vector<Point> positions;
+        for (size_t i = 0; i < SIX_ROBOT_POSITIONS.size(); i++)
+        {
+            positions.emplace_back(SIX_ROBOT_POSITIONS[i] +
+                                   Vector::createFromAngle(Angle::fromDegrees(60.0 * i))
+                                       .normalize(step * tick));
+        }
+        worlds.emplace_back(createWorld(positions));
+    }
+
+    size_t tick = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            stp.assignRobotsToTactics(request, worlds[tick % worlds.size()], true));
+        tick++;
+    }
+    reportStats(state, stp);
+}
+BENCHMARK(BM_assignWithMovingRobots)->Arg(0)->Arg(1)->Arg(10)->Arg(100);
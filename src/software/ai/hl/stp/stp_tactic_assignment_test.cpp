@@ -22,7 +22,7 @@ class STPTacticAssignmentTest : public ::testing::Test
 {
    public:
     STPTacticAssignmentTest()
-        : thunderbots_config(std::make_shared<const ThunderbotsConfig>()),
+        : thunderbots_config(std::make_shared<ThunderbotsConfig>()),
           stp([]() { return nullptr; }, thunderbots_config->getAiControlConfig(),
               thunderbots_config->getPlayConfig(), 0)
     {
@@ -31,7 +31,13 @@ class STPTacticAssignmentTest : public ::testing::Test
    protected:
     void SetUp() override
     {
-        thunderbots_config            = std::make_shared<const ThunderbotsConfig>();
+        thunderbots_config = std::make_shared<ThunderbotsConfig>();
+        // Most tests make several assignments with the same STP and expect each of them
+        // to be the lowest cost assignment, so the previous assignment isn't favoured
+        // unless a test turns hysteresis back on
+        thunderbots_config->getMutableAiControlConfig()
+            ->getMutableTacticAssignmentHysteresis()
+            ->setValue(0.0);
         auto default_play_constructor = [this]() -> std::unique_ptr<Play> {
             return std::make_unique<HaltPlay>(thunderbots_config->getPlayConfig());
         };
@@ -66,7 +72,7 @@ class STPTacticAssignmentTest : public ::testing::Test
         return all_tactics_have_robot_assigned;
     }
 
-    std::shared_ptr<const ThunderbotsConfig> thunderbots_config;
+    std::shared_ptr<ThunderbotsConfig> thunderbots_config;
     STP stp;
     World world = ::TestUtil::createBlankTestingWorld();
 };
@@ -671,3 +677,89 @@ TEST_F(STPTacticAssignmentTest, test_multi_tier_assignment_with_tiered_assignmen
          std::get<1>(crease_defender_tactics)},
         asst));
 }
+
+TEST_F(STPTacticAssignmentTest, test_hysteresis_keeps_previous_assignment_for_near_tie)
+{
+    thunderbots_config->getMutableAiControlConfig()
+        ->getMutableTacticAssignmentHysteresis()
+        ->setValue(0.05);
+
+    auto move_tactic_0 = std::make_shared<MoveTestTactic>();
+    auto move_tactic_1 = std::make_shared<MoveTestTactic>();
+    move_tactic_0->updateControlParams(Point(0, 0));
+    move_tactic_1->updateControlParams(Point(1, 0));
+    ConstPriorityTacticVector tactics = {{move_tactic_0, move_tactic_1}};
+
+    Team friendly_team(Duration::fromSeconds(10));
+    friendly_team.updateRobots(
+        {Robot(0, Point(0, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(0)),
+         Robot(1, Point(1, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(0))});
+    world.updateFriendlyTeamState(friendly_team);
+
+    auto asst = stp.assignRobotsToTactics(tactics, world, false);
+    ASSERT_TRUE(asst.find(move_tactic_0) != asst.end());
+    ASSERT_TRUE(asst.find(move_tactic_1) != asst.end());
+    EXPECT_EQ(0, asst.find(move_tactic_0)->second.id());
+    EXPECT_EQ(1, asst.find(move_tactic_1)->second.id());
+
+    // The robots have moved past each other, so swapping their tactics is now slightly
+    // cheaper (a total cost of 0.08 instead of 0.12), but not by enough to overcome the
+    // hysteresis of keeping both robots on their tactics
+    friendly_team.updateRobots(
+        {Robot(0, Point(0.6, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(1)),
+         Robot(1, Point(0.4, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(1))});
+    world.updateFriendlyTeamState(friendly_team);
+
+    asst = stp.assignRobotsToTactics(tactics, world, false);
+    ASSERT_TRUE(asst.find(move_tactic_0) != asst.end());
+    ASSERT_TRUE(asst.find(move_tactic_1) != asst.end());
+    EXPECT_EQ(0, asst.find(move_tactic_0)->second.id());
+    EXPECT_EQ(1, asst.find(move_tactic_1)->second.id());
+}
+
+TEST_F(STPTacticAssignmentTest,
+       test_hysteresis_is_overridden_by_clearly_better_assignment)
+{
+    thunderbots_config->getMutableAiControlConfig()
+        ->getMutableTacticAssignmentHysteresis()
+        ->setValue(0.05);
+
+    auto move_tactic_0 = std::make_shared<MoveTestTactic>();
+    auto move_tactic_1 = std::make_shared<MoveTestTactic>();
+    move_tactic_0->updateControlParams(Point(0, 0));
+    move_tactic_1->updateControlParams(Point(1, 0));
+    ConstPriorityTacticVector tactics = {{move_tactic_0, move_tactic_1}};
+
+    Team friendly_team(Duration::fromSeconds(10));
+    friendly_team.updateRobots(
+        {Robot(0, Point(0, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(0)),
+         Robot(1, Point(1, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(0))});
+    world.updateFriendlyTeamState(friendly_team);
+
+    auto asst = stp.assignRobotsToTactics(tactics, world, false);
+    ASSERT_TRUE(asst.find(move_tactic_0) != asst.end());
+    ASSERT_TRUE(asst.find(move_tactic_1) != asst.end());
+    EXPECT_EQ(0, asst.find(move_tactic_0)->second.id());
+    EXPECT_EQ(1, asst.find(move_tactic_1)->second.id());
+
+    // The robots have swapped places, so swapping their tactics is much cheaper (a
+    // total cost of 0 instead of 0.2), which outweighs the hysteresis
+    friendly_team.updateRobots(
+        {Robot(0, Point(1, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(1)),
+         Robot(1, Point(0, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(1))});
+    world.updateFriendlyTeamState(friendly_team);
+
+    asst = stp.assignRobotsToTactics(tactics, world, false);
+    ASSERT_TRUE(asst.find(move_tactic_0) != asst.end());
+    ASSERT_TRUE(asst.find(move_tactic_1) != asst.end());
+    EXPECT_EQ(1, asst.find(move_tactic_0)->second.id());
+    EXPECT_EQ(0, asst.find(move_tactic_1)->second.id());
+}
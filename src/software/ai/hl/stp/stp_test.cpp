@@ -108,7 +108,7 @@ TEST_F(STPTest, test_play_assignment_transition_from_unassigned_to_assigned)
 {
     // Only the HaltTestPlay should be applicable
     world = ::TestUtil::setBallPosition(world, Point(-1, 1), Timestamp::fromSeconds(0));
-    stp.getIntents(world);
+    stp.getIntents(world, std::make_shared<EvaluationCache>(world));
     EXPECT_EQ(*(stp.getCurrentPlayName()), TYPENAME(HaltTestPlay));
 }
 
@@ -118,14 +118,14 @@ TEST_F(
 {
     // Only the HaltTestPlay should be applicable
     world = ::TestUtil::setBallPosition(world, Point(-1, 1), Timestamp::fromSeconds(0));
-    stp.getIntents(world);
+    stp.getIntents(world, std::make_shared<EvaluationCache>(world));
     EXPECT_EQ(*(stp.getCurrentPlayName()), TYPENAME(HaltTestPlay));
 
     // The HaltTestPlays invariant should no longer hold, and the MoveTestPlay should now
     // be applicable
     world = ::TestUtil::setBallPosition(
         world, world.field().enemyCornerNeg() + Vector(1, 0), Timestamp::fromSeconds(0));
-    stp.getIntents(world);
+    stp.getIntents(world, std::make_shared<EvaluationCache>(world));
     EXPECT_EQ(*(stp.getCurrentPlayName()), TYPENAME(MoveTestPlay));
 }
 
@@ -133,13 +133,13 @@ TEST_F(STPTest, test_play_assignment_from_one_play_to_another_when_current_play_
 {
     // Only the MoveTestPlay should be applicable
     world = ::TestUtil::setBallPosition(world, Point(1, -1), Timestamp::fromSeconds(0));
-    stp.getIntents(world);
+    stp.getIntents(world, std::make_shared<EvaluationCache>(world));
     EXPECT_EQ(*(stp.getCurrentPlayName()), TYPENAME(MoveTestPlay));
 
     // Now only the HaltTestPlay should be applicable, and the MoveTestPlay's invariant
     // no longer holds, so we expect the current play to become the HaltTestPlay
     world = ::TestUtil::setBallPosition(world, Point(-1, 1), Timestamp::fromSeconds(0));
-    stp.getIntents(world);
+    stp.getIntents(world, std::make_shared<EvaluationCache>(world));
     EXPECT_EQ(*(stp.getCurrentPlayName()), TYPENAME(HaltTestPlay));
 }
 
@@ -150,13 +150,13 @@ TEST_F(STPTest, test_fallback_play_assigned_when_no_new_plays_are_applicable)
 
     // Only the HaltTestPlay should be applicable
     world = ::TestUtil::setBallPosition(world, Point(-1, 1), Timestamp::fromSeconds(0));
-    stp.getIntents(world);
+    stp.getIntents(world, std::make_shared<EvaluationCache>(world));
     EXPECT_EQ(*(stp.getCurrentPlayName()), TYPENAME(HaltTestPlay));
 
     // Put the ball where both its x and y coordinates are negative. Neither test Play
     // is applicable in this case
     world = ::TestUtil::setBallPosition(world, Point(-1, -1), Timestamp::fromSeconds(0));
-    stp.getIntents(world);
+    stp.getIntents(world, std::make_shared<EvaluationCache>(world));
     EXPECT_EQ(*(stp.getCurrentPlayName()), TYPENAME(HaltTestPlay));
 }
 
@@ -167,7 +167,7 @@ TEST_F(STPTest, test_get_play_info)
     world = ::TestUtil::setFriendlyRobotPositions(world, {Point(0, 0), Point(1, 0)},
                                                   Timestamp::fromSeconds(0));
     world.updateRefereeCommand(RefereeCommand::HALT);
-    stp.getIntents(world);
+    stp.getIntents(world, std::make_shared<EvaluationCache>(world));
     EXPECT_EQ(*(stp.getCurrentPlayName()), TYPENAME(HaltTestPlay));
 
     auto play_info = stp.getPlayInfo();
@@ -1,7 +1,7 @@
 #include "software/ai/hl/stp/tactic/attacker/attacker_tactic.h"
 
 #include "shared/constants.h"
-#include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/evaluation/evaluation_cache.h"
 #include "software/ai/hl/stp/action/stop_action.h"
 #include "software/logger/logger.h"
 #include "software/world/ball.h"
@@ -32,10 +32,8 @@ void AttackerTactic::updateControlParams(std::optional<Point> chip_target)
 
 void AttackerTactic::updateIntent(const TacticUpdate& tactic_update)
 {
-    std::optional<Shot> shot = calcBestShotOnGoal(
-        tactic_update.world.field(), tactic_update.world.friendlyTeam(),
-        tactic_update.world.enemyTeam(), tactic_update.world.ball().position(),
-        TeamType::ENEMY, {tactic_update.robot});
+    std::optional<Shot> shot = tactic_update.evaluation_cache->calcBestShotOnGoal(
+        tactic_update.world.ball().position(), TeamType::ENEMY, {tactic_update.robot});
     if (shot && shot->getOpenAngle() <
                     Angle::fromDegrees(
                         attacker_tactic_config->getMinOpenAngleForShotDeg()->value()))
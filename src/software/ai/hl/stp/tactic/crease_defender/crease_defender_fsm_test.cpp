@@ -147,7 +147,9 @@ TEST(CreaseDefenderFSMTest, test_transitions)
 
     // robot far from destination, ball in friendly half
     fsm.process_event(CreaseDefenderFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<MoveFSM>));
 
     auto block_point = CreaseDefenderFSM::findBlockThreatPoint(
@@ -163,11 +165,15 @@ TEST(CreaseDefenderFSMTest, test_transitions)
         Timestamp::fromSeconds(123));
     // Set robot to the correct position to block the ball
     fsm.process_event(CreaseDefenderFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::X));
     // Check that the FSM stays done
     fsm.process_event(CreaseDefenderFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::X));
 
     robot.updateState(
@@ -179,6 +185,8 @@ TEST(CreaseDefenderFSMTest, test_transitions)
         Timestamp::fromSeconds(123));
     // change orientation to make the FSM not done
     fsm.process_event(CreaseDefenderFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<MoveFSM>));
 }
@@ -98,7 +98,8 @@ TEST(GoalieFSMTest, test_transitions)
 
     // goalie should remain in PositionToBlockState
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<GoalieFSM::PositionToBlockState>));
 
     // ball is now moving quickly towards the friendly goal
@@ -107,7 +108,8 @@ TEST(GoalieFSMTest, test_transitions)
 
     // goalie should transition to PanicState
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<GoalieFSM::PanicState>));
 
     // ball is now out of danger
@@ -115,12 +117,14 @@ TEST(GoalieFSMTest, test_transitions)
 
     // tactic is done
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::X));
 
     // process event again to reset goalie to PositionToBlockState
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<GoalieFSM::PositionToBlockState>));
 
     // ball is now stationary in the "no-chip" rectangle
@@ -130,7 +134,8 @@ TEST(GoalieFSMTest, test_transitions)
 
     // goalie should transition to DribbleFSM
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<DribbleFSM>));
 
     // goalie has ball, at the correct position and orientation to clear the ball
@@ -142,7 +147,8 @@ TEST(GoalieFSMTest, test_transitions)
 
     // goalie should transition to ChipFSM
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<ChipFSM>));
 
     goalie = ::TestUtil::createRobotAtPos(clear_ball_origin + Vector(-0.2, 0));
@@ -154,17 +160,20 @@ TEST(GoalieFSMTest, test_transitions)
 
     // process event once to fall through the ChipFSM
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<ChipFSM>));
 
     // tactic is done
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::X));
 
     // process event once to reset goalie to PositionToBlockState
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<GoalieFSM::PositionToBlockState>));
 
     // ball is now moving slowly inside the friendly defense area
@@ -175,7 +184,8 @@ TEST(GoalieFSMTest, test_transitions)
 
     // goalie should transition to ChipFSM
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<ChipFSM>));
 
     // ball is now moving quickly towards the friendly goal
@@ -186,14 +196,16 @@ TEST(GoalieFSMTest, test_transitions)
 
     // goalie should transition to PanicState
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<GoalieFSM::PanicState>));
 
     // ball is now out of danger
     world = ::TestUtil::setBallPosition(world, Point(2, 0), Timestamp::fromSeconds(124));
     world = ::TestUtil::setBallVelocity(world, Vector(0, 0), Timestamp::fromSeconds(124));
     fsm.process_event(GoalieFSM::Update(
-        {}, TacticUpdate(goalie, world, [](std::unique_ptr<Intent>) {})));
+        {}, TacticUpdate(goalie, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     // tactic is done
     EXPECT_TRUE(fsm.is(boost::sml::X));
 }
@@ -21,7 +21,9 @@ TEST(KickFSMTest, test_transitions)
 
     // Transition to GetBehindBallFSM state's GetBehindBallState
     fsm.process_event(KickFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<GetBehindBallFSM>));
     EXPECT_TRUE(fsm.is<decltype(boost::sml::state<GetBehindBallFSM>)>(
         boost::sml::state<GetBehindBallFSM::GetBehindBallState>));
@@ -32,7 +34,9 @@ TEST(KickFSMTest, test_transitions)
                              AngularVelocity::zero()),
                   Timestamp::fromSeconds(123));
     fsm.process_event(KickFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     // Transition to KickState
     EXPECT_TRUE(fsm.is(boost::sml::state<KickFSM::KickState>));
 
@@ -44,6 +48,8 @@ TEST(KickFSMTest, test_transitions)
 
     // Tactic is done
     fsm.process_event(KickFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::X));
 }
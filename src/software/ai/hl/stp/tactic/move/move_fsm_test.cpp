@@ -23,13 +23,17 @@ TEST(MoveFSMTest, test_transitions)
 
     // robot far from destination
     fsm.process_event(MoveFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<MoveFSM::MoveState>));
 
     // robot close to destination
     robot = ::TestUtil::createRobotAtPos(Point(2, 2));
     fsm.process_event(MoveFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<MoveFSM::MoveState>));
 
     // robot at destination and facing the right way
@@ -37,7 +41,9 @@ TEST(MoveFSMTest, test_transitions)
         RobotState(Point(2, 3), Vector(), Angle::half(), AngularVelocity::zero()),
         Timestamp::fromSeconds(0));
     fsm.process_event(MoveFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::X));
 
     // destination updated so robot needs to move to new destination
@@ -51,6 +57,8 @@ TEST(MoveFSMTest, test_transitions)
         .max_allowed_speed_mode = MaxAllowedSpeedMode::PHYSICAL_LIMIT,
         .target_spin_rev_per_s  = 0.0};
     fsm.process_event(MoveFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<MoveFSM::MoveState>));
 }
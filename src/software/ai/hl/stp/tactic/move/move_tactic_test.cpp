@@ -39,8 +39,8 @@ TEST(MoveTacticTest, robot_at_destination)
     tactic.updateControlParams(Point(0, 0), Angle::zero(), 0.0);
     // We call the Action twice. The first time the Tactic is starting up so it's not
     // done. In all future calls, the action will be done
-    EXPECT_TRUE(tactic.get(robot, world));
-    EXPECT_TRUE(tactic.get(robot, world));
+    EXPECT_TRUE(tactic.get(robot, world, std::make_shared<EvaluationCache>(world)));
+    EXPECT_TRUE(tactic.get(robot, world, std::make_shared<EvaluationCache>(world)));
 
     EXPECT_TRUE(tactic.done());
 }
@@ -18,7 +18,9 @@ TEST(MoveGoalieToGoalLineFSMTest, test_transitions)
 
     // robot far from goal center
     fsm.process_event(MoveGoalieToGoalLineFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<MoveFSM>));
 
     // robot close to goal center
@@ -26,7 +28,9 @@ TEST(MoveGoalieToGoalLineFSMTest, test_transitions)
         ::TestUtil::createRobotAtPos(Point(world.field().friendlyGoalCenter().x() + 0.5,
                                            world.field().friendlyGoalCenter().y() + 0.5));
     fsm.process_event(MoveGoalieToGoalLineFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<MoveFSM>));
 
     // robot at goal center and facing the right way
@@ -34,6 +38,8 @@ TEST(MoveGoalieToGoalLineFSMTest, test_transitions)
                                  Angle::zero(), AngularVelocity::zero()),
                       Timestamp::fromSeconds(0));
     fsm.process_event(MoveGoalieToGoalLineFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::X));
 }
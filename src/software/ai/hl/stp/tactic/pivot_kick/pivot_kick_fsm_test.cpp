@@ -19,7 +19,9 @@ TEST(PivotKickFSMTest, test_transitions)
     EXPECT_TRUE(fsm.is(boost::sml::state<PivotKickFSM::StartState>));
 
     fsm.process_event(PivotKickFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<DribbleFSM>));
 
     // Robot now has the ball at the right location and is pointing in the right direction
@@ -31,9 +33,13 @@ TEST(PivotKickFSMTest, test_transitions)
     EXPECT_TRUE(robot.isNearDribbler(world.ball().position()));
     // it takes two ticks for the fsm to realize that it's in the kick state
     fsm.process_event(PivotKickFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     fsm.process_event(PivotKickFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     // Transition to KickState
     EXPECT_TRUE(fsm.is(boost::sml::state<PivotKickFSM::KickState>));
 
@@ -45,6 +51,8 @@ TEST(PivotKickFSMTest, test_transitions)
 
     // Tactic is done
     fsm.process_event(PivotKickFSM::Update(
-        control_params, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+        control_params,
+        TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::X));
 }
@@ -1,7 +1,7 @@
 #include "software/ai/hl/stp/tactic/receiver_tactic.h"
 
 #include "shared/constants.h"
-#include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/evaluation/evaluation_cache.h"
 #include "software/ai/hl/stp/action/move_action.h"
 #include "software/geom/algorithms/acute_angle.h"
 #include "software/geom/algorithms/closest_point.h"
@@ -170,9 +170,8 @@ Angle ReceiverTactic::getOneTimeShotDirection(const Ray& shot, const Ball& ball)
 std::optional<Shot> ReceiverTactic::findFeasibleShot()
 {
     // Check if we can shoot on the enemy goal from the receiver position
-    std::optional<Shot> best_shot_opt =
-        calcBestShotOnGoal(field, friendly_team, enemy_team, robot_->position(),
-                           TeamType::ENEMY, {*this->getAssignedRobot()});
+    std::optional<Shot> best_shot_opt = evaluation_cache->calcBestShotOnGoal(
+        robot_->position(), TeamType::ENEMY, {*this->getAssignedRobot()});
 
     // Vector from the ball to the robot
     Vector robot_to_ball = ball.position() - robot_->position();
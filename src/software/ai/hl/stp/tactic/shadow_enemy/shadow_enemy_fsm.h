@@ -2,6 +2,7 @@
 
 #include "software/ai/evaluation/calc_best_shot.h"
 #include "software/ai/evaluation/enemy_threat.h"
+#include "software/ai/evaluation/evaluation_cache.h"
 #include "software/ai/hl/stp/tactic/move/move_fsm.h"
 #include "software/ai/hl/stp/tactic/tactic.h"
 #include "software/ai/intent/move_intent.h"
@@ -67,23 +68,31 @@ struct ShadowEnemyFSM
                                     const Team &friendlyTeam, const Team &enemyTeam,
                                     const Robot &shadowee, const double &shadow_distance)
     {
-        std::vector<Robot> robots_to_ignore = {robot};
-        if (friendlyTeam.goalie().has_value())
-        {
-            robots_to_ignore.emplace_back(friendlyTeam.goalie().value());
-        }
-
-        auto best_enemy_shot_opt =
-            calcBestShotOnGoal(field, friendlyTeam, enemyTeam, shadowee.position(),
-                               TeamType::FRIENDLY, robots_to_ignore);
+        auto best_enemy_shot_opt = calcBestShotOnGoal(
+            field, friendlyTeam, enemyTeam, shadowee.position(), TeamType::FRIENDLY,
+            getRobotsToIgnoreForBlockShot(robot, friendlyTeam));
+        return getBlockShotPoint(field, shadowee, best_enemy_shot_opt, shadow_distance);
+    }
 
-        Vector enemy_shot_vector = field.friendlyGoalCenter() - shadowee.position();
-        if (best_enemy_shot_opt)
-        {
-            enemy_shot_vector =
-                best_enemy_shot_opt->getPointToShootAt() - shadowee.position();
-        }
-        return shadowee.position() + enemy_shot_vector.normalize(shadow_distance);
+    /**
+     * Calculates the point to block the shot from the robot we are shadowing, using the
+     * given cache to evaluate the shot
+     *
+     * @param robot The robot that is shadowing
+     * @param evaluation_cache The cache of evaluations of the current world
+     * @param shadowee The enemy robot we are shadowing
+     * @param shadow_distance The distance our friendly robot will position itself away
+     * from the shadowee
+     */
+    static Point findBlockShotPoint(const Robot &robot, EvaluationCache &evaluation_cache,
+                                    const Robot &shadowee, const double &shadow_distance)
+    {
+        const World &world       = evaluation_cache.getWorld();
+        auto best_enemy_shot_opt = evaluation_cache.calcBestShotOnGoal(
+            shadowee.position(), TeamType::FRIENDLY,
+            getRobotsToIgnoreForBlockShot(robot, world.friendlyTeam()));
+        return getBlockShotPoint(world.field(), shadowee, best_enemy_shot_opt,
+                                 shadow_distance);
     }
 
     auto operator()()
@@ -173,8 +182,7 @@ struct ShadowEnemyFSM
             if (enemy_threat_opt.has_value())
             {
                 position_to_block = findBlockShotPoint(
-                    event.common.robot, event.common.world.field(),
-                    event.common.world.friendlyTeam(), event.common.world.enemyTeam(),
+                    event.common.robot, *event.common.evaluation_cache,
                     enemy_threat_opt.value().robot, event.control_params.shadow_distance);
             };
 
@@ -221,4 +229,48 @@ struct ShadowEnemyFSM
             X + update_e[!enemy_threat_has_ball] / block_pass = block_pass_s,
             X + update_e[enemy_threat_has_ball] / block_shot  = block_shot_s);
     }
+
+   private:
+    /**
+     * Returns the robots that shouldn't block the enemy's shot when looking for the
+     * shot to block: the shadowing robot itself and our goalie
+     *
+     * @param robot The robot that is shadowing
+     * @param friendlyTeam The friendly team
+     *
+     * @return the robots to ignore
+     */
+    static std::vector<Robot> getRobotsToIgnoreForBlockShot(const Robot &robot,
+                                                            const Team &friendlyTeam)
+    {
+        std::vector<Robot> robots_to_ignore = {robot};
+        if (friendlyTeam.goalie().has_value())
+        {
+            robots_to_ignore.emplace_back(friendlyTeam.goalie().value());
+        }
+        return robots_to_ignore;
+    }
+
+    /**
+     * Calculates the point in front of the shadowee that blocks the given shot, or the
+     * shot to the center of our goal if there is none
+     *
+     * @param field The field to shadow on
+     * @param shadowee The enemy robot we are shadowing
+     * @param best_enemy_shot_opt The best shot the shadowee has on our goal
+     * @param shadow_distance The distance our friendly robot will position itself away
+     * from the shadowee
+     */
+    static Point getBlockShotPoint(const Field &field, const Robot &shadowee,
+                                   const std::optional<Shot> &best_enemy_shot_opt,
+                                   const double &shadow_distance)
+    {
+        Vector enemy_shot_vector = field.friendlyGoalCenter() - shadowee.position();
+        if (best_enemy_shot_opt)
+        {
+            enemy_shot_vector =
+                best_enemy_shot_opt->getPointToShootAt() - shadowee.position();
+        }
+        return shadowee.position() + enemy_shot_vector.normalize(shadow_distance);
+    }
 };
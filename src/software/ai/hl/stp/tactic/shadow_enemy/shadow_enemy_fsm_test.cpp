@@ -83,7 +83,8 @@ TEST(ShadowEnemyFSMTest, test_transitions)
     // Robot should be trying to block possible pass to the shadowee
     fsm.process_event(ShadowEnemyFSM::Update(
         {enemy_threat, 0.5},
-        TacticUpdate(shadower, world, [](std::unique_ptr<Intent>) {})));
+        TacticUpdate(shadower, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<ShadowEnemyFSM::BlockPassState>));
 
     // Shadowee now has the ball, our robot should move to block the shot
@@ -92,7 +93,8 @@ TEST(ShadowEnemyFSMTest, test_transitions)
     world = ::TestUtil::setBallPosition(world, Point(0, -2), Timestamp::fromSeconds(0));
     fsm.process_event(ShadowEnemyFSM::Update(
         {enemy_threat, 0.5},
-        TacticUpdate(shadower, world, [](std::unique_ptr<Intent>) {})));
+        TacticUpdate(shadower, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<MoveFSM>));
 
     // Shadowee now has the ball
@@ -100,7 +102,8 @@ TEST(ShadowEnemyFSMTest, test_transitions)
     // shot block position
     fsm.process_event(ShadowEnemyFSM::Update(
         {enemy_threat, 0.5},
-        TacticUpdate(shadower, world, [](std::unique_ptr<Intent>) {})));
+        TacticUpdate(shadower, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<MoveFSM>));
 
     // Shadowee still has possession of the ball and robot has arrived at block shot
@@ -114,14 +117,16 @@ TEST(ShadowEnemyFSMTest, test_transitions)
         Timestamp::fromSeconds(0));
     fsm.process_event(ShadowEnemyFSM::Update(
         {enemy_threat, 0.5},
-        TacticUpdate(shadower, world, [](std::unique_ptr<Intent>) {})));
+        TacticUpdate(shadower, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<ShadowEnemyFSM::StealAndChipState>));
 
     // Shadowee still has possession of the ball
     // Robot should continue to try and steal and chip the ball
     fsm.process_event(ShadowEnemyFSM::Update(
         {enemy_threat, 0.5},
-        TacticUpdate(shadower, world, [](std::unique_ptr<Intent>) {})));
+        TacticUpdate(shadower, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<ShadowEnemyFSM::StealAndChipState>));
 
     // Either the ball has been stolen and chipped by our robot or the
@@ -131,13 +136,15 @@ TEST(ShadowEnemyFSMTest, test_transitions)
     world = ::TestUtil::setBallPosition(world, Point(0, 2), Timestamp::fromSeconds(0));
     fsm.process_event(ShadowEnemyFSM::Update(
         {enemy_threat, 0.5},
-        TacticUpdate(shadower, world, [](std::unique_ptr<Intent>) {})));
+        TacticUpdate(shadower, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::X));
 
     // Enemy has the ball but not the shadowee (same as first transition)
     // Robot should be trying to block possible pass to the shadowee
     fsm.process_event(ShadowEnemyFSM::Update(
         {enemy_threat, 0.5},
-        TacticUpdate(shadower, world, [](std::unique_ptr<Intent>) {})));
+        TacticUpdate(shadower, world, std::make_shared<EvaluationCache>(world),
+                     [](std::unique_ptr<Intent>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<ShadowEnemyFSM::BlockPassState>));
 }
@@ -4,7 +4,7 @@
 
 #include "shared/constants.h"
 #include "shared/parameter/cpp_dynamic_parameters.h"
-#include "software/ai/evaluation/possession.h"
+#include "software/ai/evaluation/evaluation_cache.h"
 
 ShadowFreekickerTactic::ShadowFreekickerTactic(FreekickShadower free_kick_shadower,
                                                Team enemy_team, Ball ball, Field field,
@@ -40,7 +40,7 @@ void ShadowFreekickerTactic::calculateNextAction(ActionCoroutine::push_type &yie
     do
     {
         std::optional<Robot> enemy_with_ball =
-            getRobotWithEffectiveBallPossession(enemy_team, ball, field);
+            evaluation_cache->getRobotWithEffectiveBallPossession(TeamType::ENEMY);
 
         if (enemy_with_ball.has_value())
         {
@@ -42,6 +42,7 @@ class ShadowFreekickerTacticTest : public testing::Test
         ShadowFreekickerTactic tactic = ShadowFreekickerTactic(
             left_or_right, world.enemyTeam(), world.ball(), world.field(), false);
         tactic.updateRobot(friendly_robot);
+        tactic.updateEvaluationCache(std::make_shared<EvaluationCache>(world));
 
         auto action_ptr = tactic.getNextAction();
         ASSERT_TRUE(action_ptr);
@@ -96,6 +97,7 @@ class ShadowFreekickerTacticTest : public testing::Test
         EXPECT_EQ(tactic.getBall().position(), world.ball().position());
 
         tactic.updateRobot(friendly_robot);
+        tactic.updateEvaluationCache(std::make_shared<EvaluationCache>(world));
         auto action_ptr = tactic.getNextAction();
         ASSERT_TRUE(action_ptr);
         auto move_action = std::dynamic_pointer_cast<MoveAction>(action_ptr);
@@ -14,21 +14,24 @@ TEST(StopFSMTest, test_transitions)
 
     FSM<StopFSM> fsm(StopFSM(false));
     EXPECT_TRUE(fsm.is(boost::sml::state<StopFSM::StopState>));
-    fsm.process_event(
-        StopFSM::Update({}, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+    fsm.process_event(StopFSM::Update(
+        {}, TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     // robot is still moving
     EXPECT_TRUE(fsm.is(boost::sml::state<StopFSM::StopState>));
     robot = Robot(0,
                   RobotState(Point(1, -3), Vector(1.1, 2.1), Angle::half(),
                              AngularVelocity::zero()),
                   Timestamp::fromSeconds(123));
-    fsm.process_event(
-        StopFSM::Update({}, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+    fsm.process_event(StopFSM::Update(
+        {}, TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     // robot is still moving
     EXPECT_TRUE(fsm.is(boost::sml::state<StopFSM::StopState>));
     robot = TestUtil::createRobotAtPos(Point(1, -3));
-    fsm.process_event(
-        StopFSM::Update({}, TacticUpdate(robot, world, [](std::unique_ptr<Intent>) {})));
+    fsm.process_event(StopFSM::Update(
+        {}, TacticUpdate(robot, world, std::make_shared<EvaluationCache>(world),
+                         [](std::unique_ptr<Intent>) {})));
     // robot stopped
     EXPECT_TRUE(fsm.is(boost::sml::X));
 }
@@ -1,6 +1,7 @@
 #include "software/ai/hl/stp/tactic/tactic.h"
 
 #include "software/ai/intent/stop_intent.h"
+#include "software/ai/profiler/ai_profiler.h"
 #include "software/logger/logger.h"
 #include "software/util/typename/typename.h"
 
@@ -28,6 +29,11 @@ void Tactic::updateRobot(const Robot &robot)
     this->robot_ = robot;
 }
 
+void Tactic::updateEvaluationCache(std::shared_ptr<EvaluationCache> evaluation_cache)
+{
+    this->evaluation_cache = evaluation_cache;
+}
+
 bool Tactic::isGoalieTactic() const
 {
     return false;
@@ -111,15 +117,23 @@ std::set<RobotCapability> &Tactic::mutableRobotCapabilityRequirements()
     return capability_reqs;
 }
 
-std::unique_ptr<Intent> Tactic::get(const Robot &robot, const World &world)
+std::unique_ptr<Intent> Tactic::get(const Robot &robot, const World &world,
+                                    std::shared_ptr<EvaluationCache> evaluation_cache)
 {
+    PROFILE_OBJECT_SCOPE(*this);
+
     // TODO (#1888): remove updateWorldParams and updateRobot
     updateWorldParams(world);
     updateRobot(robot);
+    updateEvaluationCache(evaluation_cache);
+
+    updateIntent(TacticUpdate(
+        robot, world, evaluation_cache,
+        [this](std::unique_ptr<Intent> new_intent) { intent = std::move(new_intent); }));
 
-    updateIntent(TacticUpdate(robot, world, [this](std::unique_ptr<Intent> new_intent) {
-        intent = std::move(new_intent);
-    }));
+    // The cache only holds a reference to this tick's World, so it must not be kept
+    // once the tick is over
+    updateEvaluationCache(nullptr);
 
     if (intent)
     {
@@ -77,6 +77,14 @@ class Tactic
      */
     virtual void updateWorldParams(const World &world) = 0;
 
+    // TODO (#1888): remove this function
+    /**
+     * Updates the cache of evaluations used by this tactic's calculateNextAction
+     *
+     * @param evaluation_cache The cache of evaluations of the current state of the world
+     */
+    void updateEvaluationCache(std::shared_ptr<EvaluationCache> evaluation_cache);
+
     /**
      * robot hardware capability requirements of the tactic.
      */
@@ -127,10 +135,12 @@ class Tactic
      *
      * @param robot The robot this tactic is being assigned
      * @param world The updated world
+     * @param evaluation_cache The cache of evaluations of the updated world
      *
      * @return the next intent
      */
-    std::unique_ptr<Intent> get(const Robot &robot, const World &world);
+    std::unique_ptr<Intent> get(const Robot &robot, const World &world,
+                                std::shared_ptr<EvaluationCache> evaluation_cache);
 
     /**
      * Accepts a Tactic Visitor and calls the visit function on itself
@@ -146,6 +156,11 @@ class Tactic
     // The robot performing this Tactic
     std::optional<Robot> robot_;
 
+    // TODO (#1888): remove this field
+    // The cache of evaluations of the current state of the world, for tactics that
+    // don't get a TacticUpdate. get clears it once the Tactic has been run
+    std::shared_ptr<EvaluationCache> evaluation_cache;
+
    private:
     // TODO (#1888): remove this function
     /**
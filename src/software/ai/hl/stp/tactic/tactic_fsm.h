@@ -4,6 +4,7 @@
 #include <include/boost/sml.hpp>
 #include <queue>
 
+#include "software/ai/evaluation/evaluation_cache.h"
 #include "software/ai/intent/intent.h"
 #include "software/world/world.h"
 
@@ -24,14 +25,20 @@ using SetIntentCallback = std::function<void(std::unique_ptr<Intent>)>;
 struct TacticUpdate
 {
     TacticUpdate(const Robot &robot, const World &world,
+                 std::shared_ptr<EvaluationCache> evaluation_cache,
                  const SetIntentCallback &set_intent_fun)
-        : robot(robot), world(world), set_intent(set_intent_fun)
+        : robot(robot),
+          world(world),
+          evaluation_cache(evaluation_cache),
+          set_intent(set_intent_fun)
     {
     }
     // updated robot that tactic is assigned to
     Robot robot;
     // updated world
     World world;
+    // cache of evaluations of the updated world, shared with other tactics
+    std::shared_ptr<EvaluationCache> evaluation_cache;
     // callback to return the next intent
     SetIntentCallback set_intent;
 };
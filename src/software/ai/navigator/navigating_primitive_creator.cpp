@@ -3,43 +3,55 @@
 #include "software/geom/algorithms/distance.h"
 #include "software/logger/logger.h"
 #include "software/proto/message_translation/tbots_protobuf.h"
+#include "software/proto/primitive/primitive_msg_factory.h"
 
 NavigatingPrimitiveCreator::NavigatingPrimitiveCreator(
     std::shared_ptr<const NavigatorConfig> config)
-    : config(config)
+    : config(config), current_primitive(nullptr)
 {
 }
 
 TbotsProto::Primitive NavigatingPrimitiveCreator::createNavigatingPrimitive(
     const NavigatingIntent &intent, const Path &path,
-    const std::vector<ObstaclePtr> &enemy_robot_obstacles)
+    const ObstacleSet &enemy_robot_obstacles)
 {
-    current_primitive = std::nullopt;
-    auto result       = calculateDestinationAndFinalSpeed(intent.getFinalSpeed(), path,
+    TbotsProto::Primitive primitive;
+    createNavigatingPrimitive(intent, path, enemy_robot_obstacles, primitive);
+    return primitive;
+}
+
+void NavigatingPrimitiveCreator::createNavigatingPrimitive(
+    const NavigatingIntent &intent, const Path &path,
+    const ObstacleSet &enemy_robot_obstacles, TbotsProto::Primitive &primitive)
+{
+    auto result     = calculateDestinationAndFinalSpeed(intent.getFinalSpeed(), path,
                                                     enemy_robot_obstacles);
-    new_destination   = result.first;
-    new_final_speed   = result.second;
+    new_destination = result.first;
+    new_final_speed = result.second;
+
+    current_primitive = &primitive;
     intent.accept(*this);
-    return *current_primitive;
+    current_primitive = nullptr;
 }
 
 void NavigatingPrimitiveCreator::visit(const MoveIntent &intent)
 {
-    current_primitive = *createMovePrimitive(
-        new_destination, new_final_speed, intent.getFinalAngle(),
-        intent.getDribblerMode(), intent.getAutoChipOrKick(),
-        intent.getMaxAllowedSpeedMode(), intent.getTargetSpinRevPerS());
+    setMovePrimitive(*current_primitive, new_destination, new_final_speed,
+                     intent.getFinalAngle(), intent.getDribblerMode(),
+                     intent.getAutoChipOrKick(), intent.getMaxAllowedSpeedMode(),
+                     intent.getTargetSpinRevPerS());
 }
 
 std::pair<Point, double> NavigatingPrimitiveCreator::calculateDestinationAndFinalSpeed(
-    double final_speed, Path path,
-    const std::vector<ObstaclePtr> &enemy_robot_obstacles) const
+    double final_speed, const Path &path, const ObstacleSet &enemy_robot_obstacles) const
 {
     double desired_final_speed;
     Point final_dest;
-    std::vector<Point> path_points = path.getKnots();
+    // The knots are accessed individually so they don't have to be copied every time a
+    // primitive is created
+    size_t num_path_points = path.getNumKnots();
 
-    if (path_points.size() <= 2)
+    if (num_path_points <= 2)
     {
         // we are going to destination
         desired_final_speed = final_speed;
@@ -52,33 +64,27 @@ std::pair<Point, double> NavigatingPrimitiveCreator::calculateDestinationAndFina
                                         config->getTransitionSpeedFactor()->value();
 
         desired_final_speed = calculateTransitionSpeedBetweenSegments(
-            path_points[0], path_points[1], path_points[2], transition_final_speed);
+            path.getKnot(0), path.getKnot(1), path.getKnot(2), transition_final_speed);
 
-        final_dest = path_points[1];
+        final_dest = path.getKnot(1);
     }
 
+    const Point &next_path_point =
+        num_path_points > 1 ? path.getKnot(1) : path.getEndPoint();
     return std::make_pair<>(
         Point(final_dest),
         // slow down around enemy robots
         desired_final_speed *
-            getEnemyObstacleProximityFactor(path_points[1], enemy_robot_obstacles));
+            getEnemyObstacleProximityFactor(next_path_point, enemy_robot_obstacles));
 }
 
 double NavigatingPrimitiveCreator::getEnemyObstacleProximityFactor(
-    const Point &p, const std::vector<ObstaclePtr> &enemy_robot_obstacles) const
+    const Point &p, const ObstacleSet &enemy_robot_obstacles) const
 {
     double robot_proximity_limit = config->getEnemyRobotProximityLimit()->value();
 
     // find min dist between p and any robot
-    double closest_dist = std::numeric_limits<double>::max();
-    for (const auto &obstacle : enemy_robot_obstacles)
-    {
-        double current_dist = obstacle->distance(p);
-        if (current_dist < closest_dist)
-        {
-            closest_dist = current_dist;
-        }
-    }
+    double closest_dist = enemy_robot_obstacles.minDistance(p);
 
     // clamp ratio between 0 and 1
     return std::clamp(closest_dist / robot_proximity_limit, 0.0, 1.0);
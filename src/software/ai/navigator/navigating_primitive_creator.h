@@ -4,7 +4,7 @@
 #include "shared/proto/primitive.pb.h"
 #include "software/ai/intent/all_intents.h"
 #include "software/ai/intent/navigating_intent.h"
-#include "software/ai/navigator/obstacle/obstacle.h"
+#include "software/ai/navigator/obstacle/obstacle_set.h"
 #include "software/ai/navigator/path_planner/path_planner.h"
 #include "software/world/world.h"
 
@@ -29,13 +29,26 @@ class NavigatingPrimitiveCreator : public NavigatingIntentVisitor
      *
      * @param intent The NavigatingIntent to make primitive from
      * @param path path to make primitive for
-     * @param enemy_robot_obstacles list of enemy robot obstacles to watch out for
+     * @param enemy_robot_obstacles enemy robot obstacles to watch out for
      *
      * @return Primitive
      */
     TbotsProto::Primitive createNavigatingPrimitive(
         const NavigatingIntent &intent, const Path &path,
-        const std::vector<ObstaclePtr> &enemy_robot_obstacles);
+        const ObstacleSet &enemy_robot_obstacles);
+
+    /**
+     * Creates a primitive for a given path and navigating intent in place, reusing the
+     * messages already allocated by the given primitive
+     *
+     * @param intent The NavigatingIntent to make primitive from
+     * @param path path to make primitive for
+     * @param enemy_robot_obstacles enemy robot obstacles to watch out for
+     * @param primitive The primitive to set
+     */
+    void createNavigatingPrimitive(const NavigatingIntent &intent, const Path &path,
+                                   const ObstacleSet &enemy_robot_obstacles,
+                                   TbotsProto::Primitive &primitive);
 
     /**
      * Converts the given NavigatingIntent into a Primitive
@@ -72,28 +85,30 @@ class NavigatingPrimitiveCreator : public NavigatingIntentVisitor
      * scaled linearly between these values
      *
      * @param p point to evaluate
-     * @param enemy_robot_obstacles list of enemy robot obstacles to watch out for
+     * @param enemy_robot_obstacles enemy robot obstacles to watch out for
      *
      * @return A factor from 0 to 1 for how close p is to an enemy obstacle
      */
     double getEnemyObstacleProximityFactor(
-        const Point &p, const std::vector<ObstaclePtr> &enemy_robot_obstacles) const;
+        const Point &p, const ObstacleSet &enemy_robot_obstacles) const;
 
     /**
      * Creates the final speed and destination given the final speed and the path
      *
      * @param final_speed The final speed
      * @param path path to make primitive for
-     * @param enemy_robot_obstacles list of enemy robot obstacles to watch out for
+     * @param enemy_robot_obstacles enemy robot obstacles to watch out for
      *
      * @return the final destination and speed
      */
     std::pair<Point, double> calculateDestinationAndFinalSpeed(
-        double final_speed, Path path,
-        const std::vector<ObstaclePtr> &enemy_robot_obstacles) const;
+        double final_speed, const Path &path,
+        const ObstacleSet &enemy_robot_obstacles) const;
 
     std::shared_ptr<const NavigatorConfig> config;
-    std::optional<TbotsProto::Primitive> current_primitive;
+    // The primitive being created, which is only set while a primitive is being
+    // created
+    TbotsProto::Primitive *current_primitive;
     Point new_destination;
     double new_final_speed;
 };
@@ -1,6 +1,8 @@
 #include "software/ai/navigator/navigator.h"
 
 #include "software/ai/navigator/navigating_primitive_creator.h"
+#include "software/ai/navigator/obstacle/obstacle_set.h"
+#include "software/ai/profiler/ai_profiler.h"
 #include "software/geom/algorithms/distance.h"
 #include "software/logger/logger.h"
 #include "software/proto/message_translation/tbots_protobuf.h"
@@ -11,7 +13,8 @@ Navigator::Navigator(std::unique_ptr<PathManager> path_manager,
                      std::shared_ptr<const NavigatorConfig> config)
     : config(config),
       robot_navigation_obstacle_factory(std::move(robot_navigation_obstacle_factory)),
-      path_manager(std::move(path_manager))
+      path_manager(std::move(path_manager)),
+      primitive_set_msg(nullptr)
 {
 }
 
@@ -30,12 +33,23 @@ void Navigator::visit(const MoveIntent &intent)
 std::unique_ptr<TbotsProto::PrimitiveSet> Navigator::getAssignedPrimitives(
     const World &world, const std::vector<std::unique_ptr<Intent>> &intents)
 {
+    auto primitive_set = std::make_unique<TbotsProto::PrimitiveSet>();
+    getAssignedPrimitives(world, intents, *primitive_set);
+    return primitive_set;
+}
+
+void Navigator::getAssignedPrimitives(const World &world,
+                                      const std::vector<std::unique_ptr<Intent>> &intents,
+                                      TbotsProto::PrimitiveSet &primitive_set)
+{
+    PROFILE_SCOPE("Navigator::getAssignedPrimitives");
+
     // Initialize variables
     navigating_intents.clear();
     planned_paths.clear();
     direct_primitive_intent_robots.clear();
-    primitive_set_msg = std::make_unique<TbotsProto::PrimitiveSet>();
-    *(primitive_set_msg->mutable_time_sent()) = *createCurrentTimestamp();
+    primitive_set_msg = &primitive_set;
+    setCurrentTimestamp(*primitive_set_msg->mutable_time_sent());
 
     // Register all intents
     for (const auto &intent : intents)
@@ -46,10 +60,16 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Navigator::getAssignedPrimitives(
     // Plan paths
     Rectangle navigable_area = world.field().fieldBoundary();
     auto path_objectives     = createPathObjectives(world);
-    auto robot_id_to_path =
-        path_manager->getManagedPaths(path_objectives, navigable_area);
+    std::map<RobotId, std::optional<Path>> robot_id_to_path;
+    {
+        PROFILE_SCOPE("PathManager::getManagedPaths");
+        robot_id_to_path = path_manager->getManagedPaths(path_objectives, navigable_area);
+    }
 
     // Add primitives from navigating intents
+    ObstacleSet enemy_robot_obstacles(
+        robot_navigation_obstacle_factory.createFromTeam(world.enemyTeam()));
+    NavigatingPrimitiveCreator navigating_primitive_creator(config);
     auto &robot_primitives_map = *primitive_set_msg->mutable_robot_primitives();
     for (const auto &intent : navigating_intents)
     {
@@ -59,21 +79,20 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Navigator::getAssignedPrimitives(
             robot_id_to_path_iter->second)
         {
             planned_paths.push_back(robot_id_to_path_iter->second->getKnots());
-            robot_primitives_map[robot_id] =
-                NavigatingPrimitiveCreator(config).createNavigatingPrimitive(
-                    *intent, *(robot_id_to_path_iter->second),
-                    robot_navigation_obstacle_factory.createFromTeam(world.enemyTeam()));
+            navigating_primitive_creator.createNavigatingPrimitive(
+                *intent, *(robot_id_to_path_iter->second), enemy_robot_obstacles,
+                robot_primitives_map[robot_id]);
         }
         else
         {
             LOG(WARNING)
                 << "Navigator's path manager could not find a path for RobotId = "
                 << robot_id;
-            robot_primitives_map[robot_id] = *createStopPrimitive(false);
+            setStopPrimitive(robot_primitives_map[robot_id], false);
         }
     }
 
-    return std::move(primitive_set_msg);
+    primitive_set_msg = nullptr;
 }
 
 std::unordered_set<PathObjective> Navigator::createPathObjectives(
@@ -81,8 +100,7 @@ std::unordered_set<PathObjective> Navigator::createPathObjectives(
 {
     std::unordered_set<PathObjective> path_objectives;
     std::vector<ObstaclePtr> direct_primitive_intent_obstacles;
-    auto ball_obstacle =
-        robot_navigation_obstacle_factory.createFromBallPosition(world.ball().position());
+    auto ball_obstacle = robot_navigation_obstacle_factory.createFromBall(world.ball());
 
     for (const auto &robot_id : direct_primitive_intent_robots)
     {
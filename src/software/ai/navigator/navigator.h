@@ -41,6 +41,19 @@ class Navigator : public IntentVisitor
     std::unique_ptr<TbotsProto::PrimitiveSet> getAssignedPrimitives(
         const World &world, const std::vector<std::unique_ptr<Intent>> &intents);
 
+    /**
+     * Builds the Primitives for the given assigned intents directly into the given
+     * PrimitiveSet, so no Primitives have to be allocated separately and copied in.
+     * This allows the PrimitiveSet to be allocated on a reused Arena.
+     *
+     * @param world The World to navigate around
+     * @param intents The intents to process into primitives
+     * @param primitive_set The empty PrimitiveSet to build the Primitives into
+     */
+    void getAssignedPrimitives(const World &world,
+                               const std::vector<std::unique_ptr<Intent>> &intents,
+                               TbotsProto::PrimitiveSet &primitive_set);
+
     /**
      * Get the planned paths for navigation
      *
@@ -83,5 +96,7 @@ class Navigator : public IntentVisitor
     // When navigating intents are processed to path plan, we can avoid these
     // non-navigating robots
     std::vector<RobotId> direct_primitive_intent_robots;
-    std::unique_ptr<TbotsProto::PrimitiveSet> primitive_set_msg;
+    // The PrimitiveSet being built, which is only set while primitives are being
+    // assigned
+    TbotsProto::PrimitiveSet *primitive_set_msg;
 };
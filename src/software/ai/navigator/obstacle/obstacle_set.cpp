@@ -0,0 +1,299 @@
+#include "software/ai/navigator/obstacle/obstacle_set.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "software/ai/navigator/obstacle/obstacle_visitor.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersects.h"
+
+namespace
+{
+    /**
+     * Adds the shape of every obstacle it visits to an ObstacleSet
+     */
+    class ObstacleSetBuilder : public ObstacleVisitor
+    {
+       public:
+        explicit ObstacleSetBuilder(ObstacleSet& obstacle_set)
+            : obstacle_set(obstacle_set)
+        {
+        }
+
+        void visit(const GeomObstacle<Circle>& geom_obstacle) override
+        {
+            obstacle_set.add(geom_obstacle.getGeom());
+        }
+
+        void visit(const GeomObstacle<Polygon>& geom_obstacle) override
+        {
+            obstacle_set.add(geom_obstacle.getGeom());
+        }
+
+        void visit(const TrajectoryObstacle& trajectory_obstacle) override
+        {
+            obstacle_set.add(trajectory_obstacle);
+        }
+
+       private:
+        ObstacleSet& obstacle_set;
+    };
+}  // namespace
+
+ObstacleSet::ObstacleSet(const std::vector<ObstaclePtr>& obstacles)
+{
+    add(obstacles);
+}
+
+void ObstacleSet::add(const ObstaclePtr& obstacle)
+{
+    ObstacleSetBuilder builder(*this);
+    obstacle->accept(builder);
+}
+
+void ObstacleSet::add(const std::vector<ObstaclePtr>& obstacles)
+{
+    ObstacleSetBuilder builder(*this);
+    for (const auto& obstacle : obstacles)
+    {
+        obstacle->accept(builder);
+    }
+}
+
+void ObstacleSet::add(const Circle& circle)
+{
+    circle_xs.push_back(circle.origin().x());
+    circle_ys.push_back(circle.origin().y());
+    circle_radii.push_back(circle.radius());
+}
+
+void ObstacleSet::add(const Polygon& polygon)
+{
+    double min_x = std::numeric_limits<double>::max();
+    double max_x = std::numeric_limits<double>::lowest();
+    double min_y = std::numeric_limits<double>::max();
+    double max_y = std::numeric_limits<double>::lowest();
+    for (const Point& point : polygon.getPoints())
+    {
+        polygon_vertex_xs.push_back(point.x());
+        polygon_vertex_ys.push_back(point.y());
+        min_x = std::min(min_x, point.x());
+        max_x = std::max(max_x, point.x());
+        min_y = std::min(min_y, point.y());
+        max_y = std::max(max_y, point.y());
+    }
+    polygon_vertex_offsets.push_back(polygon_vertex_xs.size());
+    polygon_min_xs.push_back(min_x);
+    polygon_max_xs.push_back(max_x);
+    polygon_min_ys.push_back(min_y);
+    polygon_max_ys.push_back(max_y);
+}
+
+void ObstacleSet::add(const TrajectoryObstacle& trajectory_obstacle)
+{
+    trajectory_obstacles.push_back(trajectory_obstacle);
+}
+
+void ObstacleSet::clear()
+{
+    circle_xs.clear();
+    circle_ys.clear();
+    circle_radii.clear();
+    polygon_vertex_xs.clear();
+    polygon_vertex_ys.clear();
+    polygon_vertex_offsets.resize(1);
+    polygon_min_xs.clear();
+    polygon_max_xs.clear();
+    polygon_min_ys.clear();
+    polygon_max_ys.clear();
+    trajectory_obstacles.clear();
+}
+
+std::size_t ObstacleSet::size() const
+{
+    return circle_radii.size() + polygon_min_xs.size() + trajectory_obstacles.size();
+}
+
+bool ObstacleSet::empty() const
+{
+    return size() == 0;
+}
+
+bool ObstacleSet::anyContains(const Point& point) const
+{
+    const double x = point.x();
+    const double y = point.y();
+
+    for (std::size_t i = 0; i < circle_radii.size(); i++)
+    {
+        if (std::hypot(x - circle_xs[i], y - circle_ys[i]) <= circle_radii[i])
+        {
+            return true;
+        }
+    }
+
+    for (std::size_t i = 0; i < polygon_min_xs.size(); i++)
+    {
+        // A point outside the bounding box can't cross an odd number of edges
+        if (x >= polygon_min_xs[i] && x <= polygon_max_xs[i] && y >= polygon_min_ys[i] &&
+            y <= polygon_max_ys[i] && polygonContains(i, x, y))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool ObstacleSet::anyContains(const std::vector<Point>& points) const
+{
+    return std::any_of(points.begin(), points.end(),
+                       [this](const Point& point) { return anyContains(point); });
+}
+
+double ObstacleSet::minDistance(const Point& point) const
+{
+    const double x = point.x();
+    const double y = point.y();
+
+    double min_distance = std::numeric_limits<double>::max();
+    for (std::size_t i = 0; i < circle_radii.size(); i++)
+    {
+        double distance_from_edge =
+            std::hypot(x - circle_xs[i], y - circle_ys[i]) - circle_radii[i];
+        min_distance = std::min(min_distance, std::max(distance_from_edge, 0.0));
+    }
+
+    for (std::size_t i = 0; i < polygon_min_xs.size(); i++)
+    {
+        if (polygonContains(i, x, y))
+        {
+            return 0;
+        }
+
+        const std::size_t begin = polygon_vertex_offsets[i];
+        const std::size_t end   = polygon_vertex_offsets[i + 1];
+        for (std::size_t j = begin; j < end; j++)
+        {
+            const std::size_t next = j + 1 < end ? j + 1 : begin;
+            Segment edge(Point(polygon_vertex_xs[j], polygon_vertex_ys[j]),
+                         Point(polygon_vertex_xs[next], polygon_vertex_ys[next]));
+            min_distance = std::min(min_distance, distance(point, edge));
+        }
+    }
+
+    return min_distance;
+}
+
+bool ObstacleSet::anyIntersects(const Segment& segment) const
+{
+    const double segment_min_x = std::min(segment.getStart().x(), segment.getEnd().x());
+    const double segment_max_x = std::max(segment.getStart().x(), segment.getEnd().x());
+    const double segment_min_y = std::min(segment.getStart().y(), segment.getEnd().y());
+    const double segment_max_y = std::max(segment.getStart().y(), segment.getEnd().y());
+
+    for (std::size_t i = 0; i < circle_radii.size(); i++)
+    {
+        const double radius = circle_radii[i];
+        if (circle_xs[i] < segment_min_x - radius ||
+            circle_xs[i] > segment_max_x + radius ||
+            circle_ys[i] < segment_min_y - radius ||
+            circle_ys[i] > segment_max_y + radius)
+        {
+            continue;
+        }
+        if (distance(segment, Point(circle_xs[i], circle_ys[i])) <= radius)
+        {
+            return true;
+        }
+    }
+
+    for (std::size_t i = 0; i < polygon_min_xs.size(); i++)
+    {
+        if (polygon_max_xs[i] < segment_min_x || polygon_min_xs[i] > segment_max_x ||
+            polygon_max_ys[i] < segment_min_y || polygon_min_ys[i] > segment_max_y)
+        {
+            continue;
+        }
+
+        const std::size_t begin = polygon_vertex_offsets[i];
+        const std::size_t end   = polygon_vertex_offsets[i + 1];
+        for (std::size_t j = begin; j < end; j++)
+        {
+            const std::size_t next = j + 1 < end ? j + 1 : begin;
+            Segment edge(Point(polygon_vertex_xs[j], polygon_vertex_ys[j]),
+                         Point(polygon_vertex_xs[next], polygon_vertex_ys[next]));
+            if (intersects(edge, segment))
+            {
+                return true;
+            }
+        }
+        if (polygonContains(i, segment.getStart().x(), segment.getStart().y()))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool ObstacleSet::anyIntersects(const std::vector<Segment>& segments) const
+{
+    return std::any_of(segments.begin(), segments.end(),
+                       [this](const Segment& segment) { return anyIntersects(segment); });
+}
+
+bool ObstacleSet::anyTrajectoryIntersects(const Segment& segment,
+                                          const Duration& start_time,
+                                          const Duration& end_time) const
+{
+    return std::any_of(trajectory_obstacles.begin(), trajectory_obstacles.end(),
+                       [&](const TrajectoryObstacle& trajectory_obstacle) {
+                           return trajectory_obstacle.intersects(segment, start_time,
+                                                                 end_time);
+                       });
+}
+
+void ObstacleSet::removeTrajectoryObstaclesContaining(const Point& point)
+{
+    trajectory_obstacles.erase(
+        std::remove_if(trajectory_obstacles.begin(), trajectory_obstacles.end(),
+                       [&](const TrajectoryObstacle& trajectory_obstacle) {
+                           return trajectory_obstacle.contains(point);
+                       }),
+        trajectory_obstacles.end());
+}
+
+bool ObstacleSet::polygonContains(std::size_t polygon_index, double x, double y) const
+{
+    // This is the same ray casting algorithm as contains(Polygon, Point), so points on
+    // the boundary are treated the same way
+    const std::size_t begin = polygon_vertex_offsets[polygon_index];
+    const std::size_t end   = polygon_vertex_offsets[polygon_index + 1];
+    if (begin == end)
+    {
+        return false;
+    }
+
+    bool point_is_contained = false;
+    std::size_t j           = end - 1;
+    for (std::size_t i = begin; i < end; j = i++)
+    {
+        const double pix                 = polygon_vertex_xs[i];
+        const double piy                 = polygon_vertex_ys[i];
+        const double pjx                 = polygon_vertex_xs[j];
+        const double pjy                 = polygon_vertex_ys[j];
+        const bool p_within_edge_y_range = (piy > y) != (pjy > y);
+        // check for pjy == piy to shortcircuit division by zero
+        const bool p_in_half_plane_to_left_of_extended_edge =
+            (pjy == piy) || (x < (pjx - pix) * (y - piy) / (pjy - piy) + pix);
+
+        if (p_within_edge_y_range && p_in_half_plane_to_left_of_extended_edge)
+        {
+            point_is_contained = !point_is_contained;
+        }
+    }
+
+    return point_is_contained;
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <vector>
+
+#include "software/ai/navigator/obstacle/obstacle.h"
+#include "software/ai/navigator/obstacle/trajectory_obstacle.h"
+#include "software/geom/circle.h"
+#include "software/geom/polygon.h"
+
+/**
+ * An ObstacleSet answers collision queries against many obstacles at once. Obstacles
+ * are stored by shape in contiguous arrays (ex. circle centres and radii, polygon
+ * vertices and bounding boxes) rather than as ObstaclePtrs, so a query loops over plain
+ * data without virtual calls, and most polygons are rejected by their bounding box.
+ *
+ * For circle and polygon obstacles, the queries give the same results as calling
+ * contains, distance and intersects on each of the ObstaclePtrs the set was created
+ * from. ObstaclePtrs are still used to create and visualize obstacles, and an
+ * ObstacleSet is built from them before running many queries (ex. once per path
+ * planning search).
+ *
+ * TrajectoryObstacles are kept separately, since where they are depends on time. Unlike
+ * calling contains, distance or intersects on a TrajectoryObstacle directly, which
+ * check where it is now, the queries that don't take a time ignore them. They are only
+ * checked by the trajectory queries.
+ */
+class ObstacleSet
+{
+   public:
+    /**
+     * Creates an empty ObstacleSet
+     */
+    ObstacleSet() = default;
+
+    /**
+     * Creates an ObstacleSet containing the given obstacles
+     *
+     * @param obstacles The obstacles to add
+     */
+    explicit ObstacleSet(const std::vector<ObstaclePtr>& obstacles);
+
+    /**
+     * Adds obstacles to the set
+     *
+     * @param obstacle The obstacle or obstacles to add
+     */
+    void add(const ObstaclePtr& obstacle);
+    void add(const std::vector<ObstaclePtr>& obstacles);
+    void add(const Circle& circle);
+    void add(const Polygon& polygon);
+    void add(const TrajectoryObstacle& trajectory_obstacle);
+
+    /**
+     * Removes all the obstacles from the set, keeping the memory allocated for them
+     * so that the set can be refilled without allocating
+     */
+    void clear();
+
+    /**
+     * Returns the number of obstacles in the set
+     *
+     * @return the number of obstacles in the set
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns whether the set has no obstacles
+     *
+     * @return whether the set has no obstacles
+     */
+    bool empty() const;
+
+    /**
+     * Determines whether any obstacle contains the given point
+     *
+     * @param point The point to check
+     *
+     * @return whether any obstacle contains the point
+     */
+    bool anyContains(const Point& point) const;
+
+    /**
+     * Determines whether any obstacle contains any of the given points
+     *
+     * @param points The points to check
+     *
+     * @return whether any obstacle contains any of the points
+     */
+    bool anyContains(const std::vector<Point>& points) const;
+
+    /**
+     * Gets the minimum distance from any obstacle to the given point
+     *
+     * @param point The point to get the distance to
+     *
+     * @return the minimum distance to the point, or std::numeric_limits<double>::max()
+     * if the set is empty
+     */
+    double minDistance(const Point& point) const;
+
+    /**
+     * Determines whether the given segment intersects any obstacle
+     *
+     * @param segment The segment to check
+     *
+     * @return whether the segment intersects any obstacle
+     */
+    bool anyIntersects(const Segment& segment) const;
+
+    /**
+     * Determines whether any of the given segments intersects any obstacle
+     *
+     * @param segments The segments to check
+     *
+     * @return whether any of the segments intersects any obstacle
+     */
+    bool anyIntersects(const std::vector<Segment>& segments) const;
+
+    /**
+     * Determines whether moving along the given segment collides with any
+     * TrajectoryObstacle, if the start of the segment is reached at start_time and the
+     * end of the segment is reached at end_time
+     *
+     * @param segment The segment travelled along
+     * @param start_time The time from now the start of the segment is at
+     * @param end_time The time from now the end of the segment is reached
+     *
+     * @return whether moving along the segment collides with any TrajectoryObstacle
+     */
+    bool anyTrajectoryIntersects(const Segment& segment, const Duration& start_time,
+                                 const Duration& end_time) const;
+
+    /**
+     * Removes the TrajectoryObstacles that currently contain the given point. Nothing
+     * starting at that point could avoid them, so they would block every path from it
+     *
+     * @param point The point to check
+     */
+    void removeTrajectoryObstaclesContaining(const Point& point);
+
+   private:
+    /**
+     * Determines whether the polygon at the given index contains the given point
+     *
+     * @param polygon_index The index of the polygon
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     *
+     * @return whether the polygon contains the point
+     */
+    bool polygonContains(std::size_t polygon_index, double x, double y) const;
+
+    // Circles
+    std::vector<double> circle_xs;
+    std::vector<double> circle_ys;
+    std::vector<double> circle_radii;
+
+    // Polygons. The vertices of polygon i are at indices
+    // [polygon_vertex_offsets[i], polygon_vertex_offsets[i + 1])
+    std::vector<double> polygon_vertex_xs;
+    std::vector<double> polygon_vertex_ys;
+    std::vector<std::size_t> polygon_vertex_offsets = {0};
+    std::vector<double> polygon_min_xs;
+    std::vector<double> polygon_max_xs;
+    std::vector<double> polygon_min_ys;
+    std::vector<double> polygon_max_ys;
+
+    std::vector<TrajectoryObstacle> trajectory_obstacles;
+};
@@ -0,0 +1,164 @@
+#include "software/ai/navigator/obstacle/obstacle_set.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+
+#include "software/geom/rectangle.h"
+
+class ObstacleSetTest : public ::testing::Test
+{
+   protected:
+    ObstacleSetTest()
+        : obstacles({
+              std::make_shared<GeomObstacle<Circle>>(Circle({-2, 1}, 0.5)),
+              std::make_shared<GeomObstacle<Circle>>(Circle({3, -1}, 1)),
+              std::make_shared<GeomObstacle<Polygon>>(Rectangle({-1, -1}, {1, 1})),
+              std::make_shared<GeomObstacle<Polygon>>(
+                  Polygon({{2, 2}, {4, 2.5}, {3, 4}, {2.5, 3}})),
+          }),
+          obstacle_set(obstacles)
+    {
+    }
+
+    std::vector<ObstaclePtr> obstacles;
+    ObstacleSet obstacle_set;
+};
+
+TEST_F(ObstacleSetTest, empty_set)
+{
+    ObstacleSet empty_set;
+
+    EXPECT_TRUE(empty_set.empty());
+    EXPECT_EQ(0, empty_set.size());
+    EXPECT_FALSE(empty_set.anyContains(Point(0, 0)));
+    EXPECT_FALSE(empty_set.anyIntersects(Segment({-10, -10}, {10, 10})));
+    EXPECT_EQ(std::numeric_limits<double>::max(), empty_set.minDistance(Point(0, 0)));
+}
+
+TEST_F(ObstacleSetTest, size_counts_all_shapes)
+{
+    EXPECT_FALSE(obstacle_set.empty());
+    EXPECT_EQ(4, obstacle_set.size());
+}
+
+TEST_F(ObstacleSetTest, clear_removes_all_obstacles)
+{
+    obstacle_set.clear();
+
+    EXPECT_TRUE(obstacle_set.empty());
+    EXPECT_FALSE(obstacle_set.anyContains(Point(0, 0)));
+
+    obstacle_set.add(Circle({5, 5}, 1));
+    EXPECT_EQ(1, obstacle_set.size());
+    EXPECT_TRUE(obstacle_set.anyContains(Point(5, 5.5)));
+    EXPECT_FALSE(obstacle_set.anyContains(Point(0, 0)));
+}
+
+TEST_F(ObstacleSetTest, any_contains)
+{
+    EXPECT_TRUE(obstacle_set.anyContains(Point(0, 0)));
+    EXPECT_TRUE(obstacle_set.anyContains(Point(-2, 1.4)));
+    EXPECT_TRUE(obstacle_set.anyContains(Point(3, 3)));
+    EXPECT_FALSE(obstacle_set.anyContains(Point(-2, -2)));
+    EXPECT_FALSE(obstacle_set.anyContains(Point(2.2, 3.5)));
+}
+
+TEST_F(ObstacleSetTest, any_contains_batch)
+{
+    EXPECT_TRUE(obstacle_set.anyContains(std::vector<Point>{{-2, -2}, {0, 0}}));
+    EXPECT_FALSE(obstacle_set.anyContains(std::vector<Point>{{-2, -2}, {5, 5}}));
+    EXPECT_FALSE(obstacle_set.anyContains(std::vector<Point>{}));
+}
+
+TEST_F(ObstacleSetTest, min_distance)
+{
+    EXPECT_DOUBLE_EQ(0, obstacle_set.minDistance(Point(0, 0)));
+    EXPECT_DOUBLE_EQ(0.75, obstacle_set.minDistance(Point(-2, -0.25)));
+    EXPECT_DOUBLE_EQ(1, obstacle_set.minDistance(Point(0, -2)));
+}
+
+TEST_F(ObstacleSetTest, any_intersects)
+{
+    // Passes through the rectangle
+    EXPECT_TRUE(obstacle_set.anyIntersects(Segment({0, -3}, {0, 3})));
+    // Starts and ends inside the rectangle
+    EXPECT_TRUE(obstacle_set.anyIntersects(Segment({-0.5, 0}, {0.5, 0})));
+    // Touches the small circle
+    EXPECT_TRUE(obstacle_set.anyIntersects(Segment({-3, 1.5}, {-1, 1.5})));
+    EXPECT_FALSE(obstacle_set.anyIntersects(Segment({-3, -3}, {5, -3})));
+}
+
+TEST_F(ObstacleSetTest, any_intersects_batch)
+{
+    EXPECT_TRUE(obstacle_set.anyIntersects(
+        std::vector<Segment>{Segment({-3, -3}, {5, -3}), Segment({0, -3}, {0, 3})}));
+    EXPECT_FALSE(obstacle_set.anyIntersects(
+        std::vector<Segment>{Segment({-3, -3}, {5, -3}), Segment({5, -3}, {5, 5})}));
+}
+
+TEST_F(ObstacleSetTest, queries_match_obstacle_ptrs)
+{
+    std::mt19937 random_number_generator(0);
+    std::uniform_real_distribution<double> coordinate(-5, 5);
+    auto random_point = [&]() {
+        return Point(coordinate(random_number_generator),
+                     coordinate(random_number_generator));
+    };
+
+    for (int i = 0; i < 2000; i++)
+    {
+        Point point = random_point();
+        Segment segment(point, random_point());
+
+        bool expected_contains   = false;
+        bool expected_intersects = false;
+        double expected_min_dist = std::numeric_limits<double>::max();
+        for (const auto& obstacle : obstacles)
+        {
+            expected_contains   = expected_contains || obstacle->contains(point);
+            expected_intersects = expected_intersects || obstacle->intersects(segment);
+            expected_min_dist   = std::min(expected_min_dist, obstacle->distance(point));
+        }
+
+        EXPECT_EQ(expected_contains, obstacle_set.anyContains(point)) << point;
+        EXPECT_EQ(expected_intersects, obstacle_set.anyIntersects(segment))
+            << segment.getStart() << ", " << segment.getEnd();
+        EXPECT_DOUBLE_EQ(expected_min_dist, obstacle_set.minDistance(point)) << point;
+    }
+}
+
+TEST_F(ObstacleSetTest, trajectory_obstacles_are_only_checked_in_time)
+{
+    // Moves up along x = 0 and reaches y = -3 at t = 1
+    obstacle_set.add(TrajectoryObstacle(Circle({0, -4}, 0.2), Vector(0, 1), Vector(),
+                                        Duration::fromSeconds(2)));
+    Segment segment({-1, -3}, {1, -3});
+
+    EXPECT_EQ(5, obstacle_set.size());
+    EXPECT_FALSE(obstacle_set.anyContains(Point(0, -4)));
+    EXPECT_FALSE(obstacle_set.anyIntersects(segment));
+    EXPECT_TRUE(obstacle_set.anyTrajectoryIntersects(segment, Duration::fromSeconds(0.5),
+                                                     Duration::fromSeconds(1.5)));
+    EXPECT_FALSE(obstacle_set.anyTrajectoryIntersects(segment, Duration(),
+                                                      Duration::fromSeconds(0.5)));
+}
+
+TEST_F(ObstacleSetTest, remove_trajectory_obstacles_containing_point)
+{
+    obstacle_set.add(std::make_shared<TrajectoryObstacle>(
+        Circle({0, -4}, 0.2), Vector(0, 1), Vector(), Duration::fromSeconds(2)));
+    obstacle_set.add(TrajectoryObstacle(Circle({4, -4}, 0.2), Vector(0, 1), Vector(),
+                                        Duration::fromSeconds(2)));
+
+    obstacle_set.removeTrajectoryObstaclesContaining(Point(0, -4.1));
+
+    EXPECT_EQ(5, obstacle_set.size());
+    EXPECT_FALSE(obstacle_set.anyTrajectoryIntersects(Segment({-1, -3}, {1, -3}),
+                                                      Duration::fromSeconds(0.5),
+                                                      Duration::fromSeconds(1.5)));
+    EXPECT_TRUE(obstacle_set.anyTrajectoryIntersects(Segment({3, -3}, {5, -3}),
+                                                     Duration::fromSeconds(0.5),
+                                                     Duration::fromSeconds(1.5)));
+}
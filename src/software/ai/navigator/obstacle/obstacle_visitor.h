@@ -4,11 +4,12 @@
 #include "software/geom/circle.h"
 #include "software/geom/polygon.h"
 
-// We forward-declare GeomObstacle because if we include them we induce a
-// circular dependency between the Individual library for each obstacle and this
+// We forward-declare GeomObstacle and TrajectoryObstacle because if we include them we
+// induce a circular dependency between the Individual library for each obstacle and this
 // visitor.
 template <typename GEOM_TYPE>
 class GeomObstacle;
+class TrajectoryObstacle;
 
 /**
  * This class provides an interface for all Obstacle Visitors. The Visitor design pattern
@@ -28,6 +29,7 @@ class ObstacleVisitor
      *
      * @param The Obstacle to visit
      */
-    virtual void visit(const GeomObstacle<Circle> &geom_obstacle)  = 0;
-    virtual void visit(const GeomObstacle<Polygon> &geom_obstacle) = 0;
+    virtual void visit(const GeomObstacle<Circle> &geom_obstacle)     = 0;
+    virtual void visit(const GeomObstacle<Polygon> &geom_obstacle)    = 0;
+    virtual void visit(const TrajectoryObstacle &trajectory_obstacle) = 0;
 };
@@ -142,6 +142,33 @@ std::vector<ObstaclePtr> RobotNavigationObstacleFactory::createFromTeam(
     return obstacles;
 }
 
+ObstaclePtr RobotNavigationObstacleFactory::createTrajectoryFromRobot(
+    const Robot &robot) const
+{
+    if (isStationaryOverPredictionHorizon(robot.velocity()))
+    {
+        return createFromRobotPosition(robot.position());
+    }
+
+    // We don't know the acceleration of robots, so they are assumed to keep moving at
+    // their current velocity
+    return std::make_shared<TrajectoryObstacle>(
+        Circle(robot.position(), ROBOT_MAX_RADIUS_METERS + robot_radius_expansion_amount),
+        robot.velocity(), Vector(),
+        Duration::fromSeconds(config->getTrajectoryObstaclePredictionHorizon()->value()));
+}
+
+std::vector<ObstaclePtr> RobotNavigationObstacleFactory::createTrajectoriesFromTeam(
+    const Team &team) const
+{
+    std::vector<ObstaclePtr> obstacles;
+    for (const auto &robot : team.getAllRobots())
+    {
+        obstacles.push_back(createTrajectoryFromRobot(robot));
+    }
+    return obstacles;
+}
+
 std::vector<ObstaclePtr> RobotNavigationObstacleFactory::createEnemyCollisionAvoidance(
     const Team &enemy_team, double friendly_robot_speed) const
 {
@@ -156,6 +183,10 @@ std::vector<ObstaclePtr> RobotNavigationObstacleFactory::createEnemyCollisionAvo
         }
         return obstacles;
     }
+    else if (config->getUseTrajectoryObstacles()->value())
+    {
+        return createTrajectoriesFromTeam(enemy_team);
+    }
     else
     {
         return createFromTeam(enemy_team);
@@ -168,6 +199,21 @@ ObstaclePtr RobotNavigationObstacleFactory::createFromBallPosition(
     return createFromShape(Circle(ball_position, BALL_MAX_RADIUS_METERS));
 }
 
+ObstaclePtr RobotNavigationObstacleFactory::createFromBall(const Ball &ball) const
+{
+    if (config->getUseTrajectoryObstacles()->value() &&
+        !isStationaryOverPredictionHorizon(ball.velocity()))
+    {
+        return std::make_shared<TrajectoryObstacle>(
+            Circle(ball.position(),
+                   BALL_MAX_RADIUS_METERS + robot_radius_expansion_amount),
+            ball.velocity(), ball.acceleration(),
+            Duration::fromSeconds(
+                config->getTrajectoryObstaclePredictionHorizon()->value()));
+    }
+    return createFromBallPosition(ball.position());
+}
+
 ObstaclePtr RobotNavigationObstacleFactory::createFromRobotPosition(
     const Point &robot_position) const
 {
@@ -211,3 +257,10 @@ ObstaclePtr RobotNavigationObstacleFactory::createFromFieldRectangle(
     return std::make_shared<GeomObstacle<Polygon>>(
         Rectangle(Point(xMin, yMin), Point(xMax, yMax)));
 }
+
+bool RobotNavigationObstacleFactory::isStationaryOverPredictionHorizon(
+    const Vector &velocity) const
+{
+    return velocity.length() * config->getTrajectoryObstaclePredictionHorizon()->value() <
+           ROBOT_MAX_RADIUS_METERS;
+}
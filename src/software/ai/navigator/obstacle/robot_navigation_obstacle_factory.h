@@ -3,6 +3,7 @@
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/ai/motion_constraint/motion_constraint.h"
 #include "software/ai/navigator/obstacle/obstacle.h"
+#include "software/ai/navigator/obstacle/trajectory_obstacle.h"
 #include "software/geom/point.h"
 #include "software/logger/logger.h"
 #include "software/world/world.h"
@@ -71,6 +72,29 @@ class RobotNavigationObstacleFactory
      */
     std::vector<ObstaclePtr> createFromTeam(const Team &team) const;
 
+    /**
+     * Create an obstacle that follows the predicted motion of the given robot
+     *
+     * The robot is assumed to keep moving at its current velocity for the trajectory
+     * obstacle prediction horizon set in the config. Robots that would move less than
+     * their radius over the horizon are represented by a static circle obstacle instead
+     *
+     * @param robot The robot to get a representative obstacle for
+     *
+     * @return An obstacle representing the given robot over time
+     */
+    ObstaclePtr createTrajectoryFromRobot(const Robot &robot) const;
+
+    /**
+     * Create a list of obstacles that follow the predicted motion of the robots on the
+     * given team
+     *
+     * @param team The team to get representative obstacles for
+     *
+     * @return A list of obstacles representing the given team over time
+     */
+    std::vector<ObstaclePtr> createTrajectoriesFromTeam(const Team &team) const;
+
     /**
      * Create a list of obstacles that stop enemy robot collision. These obstacles are
      * scaled down if friendly_robot_speed is below a threshold set in the config to allow
@@ -102,6 +126,17 @@ class RobotNavigationObstacleFactory
      */
     ObstaclePtr createFromBallPosition(const Point &ball_position) const;
 
+    /**
+     * Create an obstacle around the ball. If trajectory obstacles are enabled in the
+     * config and the ball is moving, the obstacle follows the predicted motion of the
+     * ball, otherwise it is around the current ball position
+     *
+     * @param ball The ball to make an obstacle around
+     *
+     * @return obstacle around the ball
+     */
+    ObstaclePtr createFromBall(const Ball &ball) const;
+
     /**
      * Returns an obstacle for the shape
      * NOTE: as with all other obstacles created by RobotNavigationObstacleFactory, the
@@ -135,4 +170,18 @@ class RobotNavigationObstacleFactory
                                          const Rectangle &field_lines,
                                          const Rectangle &field_boundary,
                                          double additional_expansion_amount = 0.0) const;
+
+    /**
+     * Returns whether something moving at the given velocity would move less than a
+     * robot radius over the trajectory obstacle prediction horizon, in which case it is
+     * represented by a static obstacle rather than a TrajectoryObstacle. Static
+     * obstacles are also checked by the queries that don't take a time (ex. moving a
+     * destination out of an obstacle), which ignore TrajectoryObstacles
+     *
+     * @param velocity The velocity to check
+     *
+     * @return whether something moving at the given velocity should be treated as
+     * stationary
+     */
+    bool isStationaryOverPredictionHorizon(const Vector &velocity) const;
 };
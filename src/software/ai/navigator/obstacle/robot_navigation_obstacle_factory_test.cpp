@@ -228,6 +228,109 @@ TEST_F(RobotNavigationObstacleFactoryTest, another_fast_moving_robot_obstacle)
     }
 }
 
+TEST_F(RobotNavigationObstacleFactoryTest, trajectory_robot_obstacle)
+{
+    Point origin(-2.1, 5);
+    Vector velocity(1.27, 0.34);
+    Circle expected(origin, 0.207);
+    Robot robot = Robot(3, origin, velocity, Angle::fromRadians(2.2),
+                        AngularVelocity::fromRadians(-0.6), current_time);
+    ObstaclePtr obstacle =
+        robot_navigation_obstacle_factory.createTrajectoryFromRobot(robot);
+
+    try
+    {
+        auto trajectory_obstacle = dynamic_cast<TrajectoryObstacle&>(*obstacle);
+        EXPECT_EQ(expected, trajectory_obstacle.getCircle());
+        EXPECT_EQ(velocity, trajectory_obstacle.getVelocity());
+        EXPECT_EQ(Vector(), trajectory_obstacle.getAcceleration());
+    }
+    catch (std::bad_cast&)
+    {
+        ADD_FAILURE() << "TrajectoryObstacle was not created for a robot";
+    }
+}
+
+TEST_F(RobotNavigationObstacleFactoryTest, stationary_robot_trajectory_obstacle)
+{
+    // The robot is moving so slowly that it barely moves over the prediction horizon,
+    // so it should be a static obstacle
+    Point origin(-2.1, 5);
+    Circle expected(origin, 0.207);
+    Robot robot = Robot(3, origin, Vector(0.01, 0.02), Angle::fromRadians(2.2),
+                        AngularVelocity::fromRadians(-0.6), current_time);
+    ObstaclePtr obstacle =
+        robot_navigation_obstacle_factory.createTrajectoryFromRobot(robot);
+
+    try
+    {
+        auto circle_obstacle = dynamic_cast<GeomObstacle<Circle>&>(*obstacle);
+        EXPECT_EQ(expected, circle_obstacle.getGeom());
+    }
+    catch (std::bad_cast&)
+    {
+        ADD_FAILURE() << "GeomObstacle<Circle> was not created for a stationary robot";
+    }
+}
+
+TEST_F(RobotNavigationObstacleFactoryTest, ball_obstacle_without_trajectory_obstacles)
+{
+    Ball ball(Point(2.5, 4), Vector(1, 0), current_time, Vector(-0.5, 0));
+    Circle expected(Point(2.5, 4), 0.1385);
+    ObstaclePtr obstacle = robot_navigation_obstacle_factory.createFromBall(ball);
+
+    try
+    {
+        auto circle_obstacle = dynamic_cast<GeomObstacle<Circle>&>(*obstacle);
+        EXPECT_EQ(expected, circle_obstacle.getGeom());
+    }
+    catch (std::bad_cast&)
+    {
+        ADD_FAILURE() << "GeomObstacle<Circle>Ptr was not created for a ball";
+    }
+}
+
+TEST_F(RobotNavigationObstacleFactoryTest, ball_obstacle_with_trajectory_obstacles)
+{
+    robot_navigation_obstacle_config->getMutableUseTrajectoryObstacles()->setValue(true);
+    Ball ball(Point(2.5, 4), Vector(1, 0), current_time, Vector(-0.5, 0));
+    Circle expected(Point(2.5, 4), 0.1385);
+    ObstaclePtr obstacle = robot_navigation_obstacle_factory.createFromBall(ball);
+
+    try
+    {
+        auto trajectory_obstacle = dynamic_cast<TrajectoryObstacle&>(*obstacle);
+        EXPECT_EQ(expected, trajectory_obstacle.getCircle());
+        EXPECT_EQ(Vector(1, 0), trajectory_obstacle.getVelocity());
+        EXPECT_EQ(Vector(-0.5, 0), trajectory_obstacle.getAcceleration());
+    }
+    catch (std::bad_cast&)
+    {
+        ADD_FAILURE() << "TrajectoryObstacle was not created for a ball";
+    }
+}
+
+TEST_F(RobotNavigationObstacleFactoryTest,
+       stationary_ball_obstacle_with_trajectory_obstacles)
+{
+    // The ball is not moving, so it should be a static obstacle even though trajectory
+    // obstacles are enabled
+    robot_navigation_obstacle_config->getMutableUseTrajectoryObstacles()->setValue(true);
+    Ball ball(Point(2.5, 4), Vector(), current_time);
+    Circle expected(Point(2.5, 4), 0.1385);
+    ObstaclePtr obstacle = robot_navigation_obstacle_factory.createFromBall(ball);
+
+    try
+    {
+        auto circle_obstacle = dynamic_cast<GeomObstacle<Circle>&>(*obstacle);
+        EXPECT_EQ(expected, circle_obstacle.getGeom());
+    }
+    catch (std::bad_cast&)
+    {
+        ADD_FAILURE() << "GeomObstacle<Circle> was not created for a stationary ball";
+    }
+}
+
 TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest, centre_circle)
 {
     auto obstacles = robot_navigation_obstacle_factory.createFromMotionConstraint(
@@ -0,0 +1,149 @@
+#include "software/ai/navigator/obstacle/trajectory_obstacle.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "software/ai/navigator/obstacle/obstacle_visitor.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/physics/physics.h"
+
+TrajectoryObstacle::TrajectoryObstacle(const Circle& circle, const Vector& velocity,
+                                       const Vector& acceleration,
+                                       const Duration& prediction_horizon)
+    : circle_(circle),
+      velocity_(velocity),
+      acceleration_(acceleration),
+      stop_time_(prediction_horizon)
+{
+    // If the obstacle is decelerating, it stops when its velocity in the direction
+    // of the acceleration reaches 0, rather than moving backwards
+    double acceleration_squared = acceleration_.lengthSquared();
+    if (acceleration_squared > 0)
+    {
+        double seconds_until_stopped =
+            -velocity_.dot(acceleration_) / acceleration_squared;
+        if (seconds_until_stopped >= 0 && seconds_until_stopped < stop_time_.toSeconds())
+        {
+            stop_time_ = Duration::fromSeconds(seconds_until_stopped);
+        }
+    }
+}
+
+bool TrajectoryObstacle::contains(const Point& p) const
+{
+    return ::contains(circle_, p);
+}
+
+double TrajectoryObstacle::distance(const Point& p) const
+{
+    return ::distance(circle_, p);
+}
+
+bool TrajectoryObstacle::intersects(const Segment& segment) const
+{
+    return ::intersects(circle_, segment);
+}
+
+std::string TrajectoryObstacle::toString(void) const
+{
+    std::ostringstream ss;
+    ss << "Obstacle with shape " << circle_ << " moving with velocity " << velocity_
+       << " and acceleration " << acceleration_ << " for " << stop_time_;
+    return ss.str();
+}
+
+void TrajectoryObstacle::accept(ObstacleVisitor& visitor) const
+{
+    visitor.visit(*this);
+}
+
+bool TrajectoryObstacle::contains(const Point& p, const Duration& time) const
+{
+    return ::contains(getCircleAtTime(time), p);
+}
+
+bool TrajectoryObstacle::intersects(const Segment& segment, const Duration& start_time,
+                                    const Duration& end_time) const
+{
+    const double start_seconds = start_time.toSeconds();
+    const double end_seconds   = std::max(end_time.toSeconds(), start_seconds);
+    const double stop_seconds  = stop_time_.toSeconds();
+
+    // Returns where we are on the segment at the given time, relative to the obstacle
+    auto relative_position = [&](double seconds) {
+        double fraction_travelled =
+            end_seconds > start_seconds
+                ? (seconds - start_seconds) / (end_seconds - start_seconds)
+                : 0.0;
+        Point position = segment.getStart() + segment.toVector() * fraction_travelled;
+        return Point(position - getCircleAtTime(Duration::fromSeconds(seconds)).origin());
+    };
+
+    // Both we and the obstacle move in a straight line over a short enough time, so
+    // we move in a straight line relative to the obstacle and the closest we get to
+    // it is the distance from its centre to that line. The obstacle changes direction
+    // when it stops, so we split the time there
+    // This is called for every segment of every path that is checked, so the time
+    // ranges are kept on the stack
+    std::array<std::pair<double, double>, 2> time_ranges;
+    size_t num_time_ranges = 0;
+    if (start_seconds < stop_seconds && stop_seconds < end_seconds)
+    {
+        time_ranges[num_time_ranges++] = {start_seconds, stop_seconds};
+        time_ranges[num_time_ranges++] = {stop_seconds, end_seconds};
+    }
+    else
+    {
+        time_ranges[num_time_ranges++] = {start_seconds, end_seconds};
+    }
+
+    for (size_t range_index = 0; range_index < num_time_ranges; range_index++)
+    {
+        const auto& [range_start, range_end] = time_ranges[range_index];
+        int num_steps                        = std::max(
+            1, static_cast<int>(std::ceil((range_end - range_start) /
+                                          MAX_COLLISION_CHECK_TIME_STEP_SECONDS)));
+        double step_seconds = (range_end - range_start) / num_steps;
+        Point step_start    = relative_position(range_start);
+        for (int i = 1; i <= num_steps; i++)
+        {
+            Point step_end = relative_position(range_start + step_seconds * i);
+            if (::distance(Segment(step_start, step_end), Point(0, 0)) <=
+                circle_.radius())
+            {
+                return true;
+            }
+            step_start = step_end;
+        }
+    }
+    return false;
+}
+
+Circle TrajectoryObstacle::getCircleAtTime(const Duration& time) const
+{
+    Duration prediction_time = std::min(std::max(time, Duration()), stop_time_);
+    return Circle(calculateFuturePosition(circle_.origin(), velocity_, acceleration_,
+                                          prediction_time),
+                  circle_.radius());
+}
+
+const Circle& TrajectoryObstacle::getCircle(void) const
+{
+    return circle_;
+}
+
+const Vector& TrajectoryObstacle::getVelocity(void) const
+{
+    return velocity_;
+}
+
+const Vector& TrajectoryObstacle::getAcceleration(void) const
+{
+    return acceleration_;
+}
+
+const Duration& TrajectoryObstacle::getStopTime(void) const
+{
+    return stop_time_;
+}
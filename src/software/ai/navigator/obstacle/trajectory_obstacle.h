@@ -0,0 +1,114 @@
+#pragma once
+
+#include "software/ai/navigator/obstacle/obstacle.h"
+#include "software/geom/circle.h"
+#include "software/geom/vector.h"
+#include "software/time/duration.h"
+
+/**
+ * A TrajectoryObstacle is a circle that moves over time, such as a robot or the ball.
+ * Its position is predicted from its current velocity and acceleration, up until it
+ * stops (if it is decelerating) or the prediction horizon is reached, after which it is
+ * assumed to stay where it is.
+ *
+ * The Obstacle functions treat the obstacle as a circle at its current position, so
+ * TrajectoryObstacles can be used anywhere other obstacles are. Path planners that plan
+ * in time can use the functions that take a time instead, so that they only avoid the
+ * places the obstacle will be when the robot gets there.
+ */
+class TrajectoryObstacle : public Obstacle
+{
+   public:
+    TrajectoryObstacle() = delete;
+
+    /**
+     * Creates a TrajectoryObstacle
+     *
+     * @param circle The obstacle at its current position
+     * @param velocity The current velocity of the obstacle
+     * @param acceleration The constant acceleration of the obstacle
+     * @param prediction_horizon How far into the future to predict the motion of the
+     * obstacle, after which it is assumed to stop moving
+     */
+    TrajectoryObstacle(const Circle& circle, const Vector& velocity,
+                       const Vector& acceleration, const Duration& prediction_horizon);
+
+    bool contains(const Point& p) const override;
+    double distance(const Point& p) const override;
+    bool intersects(const Segment& segment) const override;
+    std::string toString(void) const override;
+    void accept(ObstacleVisitor& visitor) const override;
+
+    /**
+     * Determines whether the obstacle contains the given Point at the given time
+     *
+     * @param p The point to check
+     * @param time The time from now to check at
+     *
+     * @return whether the obstacle contains p at the given time
+     */
+    bool contains(const Point& p, const Duration& time) const;
+
+    /**
+     * Determines whether something moving along the given segment at a constant speed,
+     * from the start of the segment at start_time to the end of the segment at
+     * end_time, collides with the obstacle
+     *
+     * @param segment The segment travelled along
+     * @param start_time The time from now the start of the segment is at
+     * @param end_time The time from now the end of the segment is reached
+     *
+     * @return whether moving along the segment collides with the obstacle
+     */
+    bool intersects(const Segment& segment, const Duration& start_time,
+                    const Duration& end_time) const;
+
+    /**
+     * Gets the obstacle at the given time
+     *
+     * @param time The time from now
+     *
+     * @return the circle the obstacle occupies at the given time
+     */
+    Circle getCircleAtTime(const Duration& time) const;
+
+    /**
+     * Gets the obstacle at its current position
+     *
+     * @return the circle the obstacle currently occupies
+     */
+    const Circle& getCircle(void) const;
+
+    /**
+     * Gets the current velocity of the obstacle
+     *
+     * @return the current velocity of the obstacle
+     */
+    const Vector& getVelocity(void) const;
+
+    /**
+     * Gets the acceleration of the obstacle
+     *
+     * @return the acceleration of the obstacle
+     */
+    const Vector& getAcceleration(void) const;
+
+    /**
+     * Gets the time from now after which the obstacle is assumed to not move, which is
+     * the prediction horizon or the time it stops, whichever is sooner
+     *
+     * @return the time the obstacle stops moving
+     */
+    const Duration& getStopTime(void) const;
+
+   private:
+    // The longest time between the points where collisions are checked when moving
+    // along a segment. The motion of the obstacle is treated as linear between these
+    // points, which is exact for obstacles that aren't accelerating
+    static constexpr double MAX_COLLISION_CHECK_TIME_STEP_SECONDS = 0.05;
+
+    Circle circle_;
+    Vector velocity_;
+    Vector acceleration_;
+    Duration stop_time_;
+};
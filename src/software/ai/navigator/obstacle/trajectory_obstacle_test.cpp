@@ -0,0 +1,95 @@
+#include "software/ai/navigator/obstacle/trajectory_obstacle.h"
+
+#include <gtest/gtest.h>
+
+TEST(TrajectoryObstacleTest, static_functions_use_current_position)
+{
+    TrajectoryObstacle obstacle(Circle({0, 0}, 0.5), Vector(2, 0), Vector(),
+                                Duration::fromSeconds(1));
+
+    EXPECT_TRUE(obstacle.contains(Point(0.4, 0)));
+    EXPECT_FALSE(obstacle.contains(Point(1.5, 0)));
+    EXPECT_DOUBLE_EQ(1, obstacle.distance(Point(0, 1.5)));
+    EXPECT_TRUE(obstacle.intersects(Segment({-1, 0.4}, {1, 0.4})));
+    EXPECT_FALSE(obstacle.intersects(Segment({1, -1}, {1, 1})));
+}
+
+TEST(TrajectoryObstacleTest, constant_velocity_position_over_time)
+{
+    TrajectoryObstacle obstacle(Circle({0, 0}, 0.5), Vector(2, 0), Vector(),
+                                Duration::fromSeconds(1));
+
+    EXPECT_EQ(Point(1, 0), obstacle.getCircleAtTime(Duration::fromSeconds(0.5)).origin());
+    EXPECT_TRUE(obstacle.contains(Point(1, 0), Duration::fromSeconds(0.5)));
+    EXPECT_FALSE(obstacle.contains(Point(0, 0), Duration::fromSeconds(0.5)));
+}
+
+TEST(TrajectoryObstacleTest, stops_at_prediction_horizon)
+{
+    TrajectoryObstacle obstacle(Circle({0, 0}, 0.5), Vector(2, 0), Vector(),
+                                Duration::fromSeconds(1));
+
+    EXPECT_EQ(Duration::fromSeconds(1), obstacle.getStopTime());
+    EXPECT_EQ(Point(2, 0), obstacle.getCircleAtTime(Duration::fromSeconds(5)).origin());
+}
+
+TEST(TrajectoryObstacleTest, decelerating_obstacle_stops_instead_of_reversing)
+{
+    // Stops after 1 second, 1 metre from where it started
+    TrajectoryObstacle obstacle(Circle({0, 0}, 0.1), Vector(2, 0), Vector(-2, 0),
+                                Duration::fromSeconds(3));
+
+    EXPECT_DOUBLE_EQ(1, obstacle.getStopTime().toSeconds());
+    EXPECT_EQ(Point(1, 0), obstacle.getCircleAtTime(Duration::fromSeconds(2)).origin());
+}
+
+TEST(TrajectoryObstacleTest, intersects_when_crossing_at_the_same_time)
+{
+    // The obstacle moves up along x = 1 and reaches y = 0 at t = 1
+    TrajectoryObstacle obstacle(Circle({1, -1}, 0.2), Vector(0, 1), Vector(),
+                                Duration::fromSeconds(2));
+    Segment segment({0, 0}, {2, 0});
+
+    EXPECT_TRUE(obstacle.intersects(segment, Duration::fromSeconds(0.5),
+                                    Duration::fromSeconds(1.5)));
+}
+
+TEST(TrajectoryObstacleTest, does_not_intersect_when_crossing_after_it_has_passed)
+{
+    // The obstacle moves up along x = 1 and is past y = 0 by the time we get there
+    TrajectoryObstacle obstacle(Circle({1, -1}, 0.2), Vector(0, 2), Vector(),
+                                Duration::fromSeconds(2));
+    Segment segment({0, 0}, {2, 0});
+
+    EXPECT_FALSE(
+        obstacle.intersects(segment, Duration::fromSeconds(1), Duration::fromSeconds(2)));
+}
+
+TEST(TrajectoryObstacleTest, does_not_intersect_when_crossing_before_it_arrives)
+{
+    TrajectoryObstacle obstacle(Circle({1, -3}, 0.2), Vector(0, 1), Vector(),
+                                Duration::fromSeconds(5));
+    Segment segment({0, 0}, {2, 0});
+
+    EXPECT_FALSE(obstacle.intersects(segment, Duration(), Duration::fromSeconds(1)));
+}
+
+TEST(TrajectoryObstacleTest, intersects_obstacle_that_has_stopped_on_the_segment)
+{
+    TrajectoryObstacle obstacle(Circle({1, -1}, 0.2), Vector(0, 2), Vector(0, -2),
+                                Duration::fromSeconds(5));
+    Segment segment({0, 0}, {2, 0});
+
+    EXPECT_TRUE(
+        obstacle.intersects(segment, Duration::fromSeconds(3), Duration::fromSeconds(4)));
+}
+
+TEST(TrajectoryObstacleTest, intersects_obstacle_moving_along_the_segment)
+{
+    // Chasing a slower obstacle along the segment
+    TrajectoryObstacle obstacle(Circle({1, 0}, 0.2), Vector(0.5, 0), Vector(),
+                                Duration::fromSeconds(5));
+    Segment segment({0, 0}, {4, 0});
+
+    EXPECT_TRUE(obstacle.intersects(segment, Duration(), Duration::fromSeconds(2)));
+}
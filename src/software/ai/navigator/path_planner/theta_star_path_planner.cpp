@@ -1,11 +1,37 @@
 #include "software/ai/navigator/path_planner/theta_star_path_planner.h"
 
 #include <stack>
+#include <utility>
 
 #include "software/geom/algorithms/distance.h"
 #include "software/geom/algorithms/intersects.h"
 #include "software/logger/logger.h"
 
+namespace
+{
+    /**
+     * Calls the given function when it goes out of scope, whether the scope is left
+     * by returning or by an exception
+     */
+    template <typename Function>
+    class ScopeGuard
+    {
+       public:
+        explicit ScopeGuard(Function function) : function(std::move(function)) {}
+
+        ScopeGuard(const ScopeGuard &) = delete;
+        ScopeGuard &operator=(const ScopeGuard &) = delete;
+
+        ~ScopeGuard()
+        {
+            function();
+        }
+
+       private:
+        Function function;
+    };
+}  // namespace
+
 ThetaStarPathPlanner::ThetaStarPathPlanner()
     : num_grid_rows(0),
       num_grid_cols(0),
@@ -24,23 +50,13 @@ bool ThetaStarPathPlanner::isUnblocked(const Coordinate &coord)
 {
     // If we haven't checked this Coordinate for obstacles before, check it now
 
-    auto unblocked_grid_it = unblocked_grid.find(coord);
-    if (unblocked_grid_it == unblocked_grid.end())
+    auto unblocked_grid_it = search_state->unblocked_grid.find(coord);
+    if (unblocked_grid_it == search_state->unblocked_grid.end())
     {
-        bool blocked = false;
-
-        Point p = convertCoordToPoint(coord);
-        for (auto &obstacle : obstacles)
-        {
-            if (obstacle->contains(p))
-            {
-                blocked = true;
-                break;
-            }
-        }
+        bool blocked = obstacles.anyContains(convertCoordToPoint(coord));
 
         // We use the opposite convention to indicate blocked or not
-        unblocked_grid[coord] = !blocked;
+        search_state->unblocked_grid[coord] = !blocked;
         return !blocked;
     }
 
@@ -59,29 +75,36 @@ bool ThetaStarPathPlanner::lineOfSight(const Coordinate &coord1, const Coordinat
 {
     CoordinatePair coord_pair(coord1, coord2);
     // If we haven't checked this Coordinate pair for intersects before, check it now
-    auto line_of_sight_cache_it = line_of_sight_cache.find(coord_pair);
-    if (line_of_sight_cache_it == line_of_sight_cache.end())
+    auto line_of_sight_cache_it = search_state->line_of_sight_cache.find(coord_pair);
+    if (line_of_sight_cache_it == search_state->line_of_sight_cache.end())
     {
         Segment seg(convertCoordToPoint(coord1), convertCoordToPoint(coord2));
-        bool has_line_of_sight = true;
-
-        for (const auto &obstacle : obstacles)
-        {
-            if (obstacle->intersects(seg))
-            {
-                has_line_of_sight = false;
-                break;
-            }
-        }
+        bool has_line_of_sight = !obstacles.anyIntersects(seg);
 
         // We use the opposite convention to indicate blocked or not
-        line_of_sight_cache[coord_pair] = has_line_of_sight;
+        search_state->line_of_sight_cache[coord_pair] = has_line_of_sight;
         return has_line_of_sight;
     }
 
     return line_of_sight_cache_it->second;
 }
 
+bool ThetaStarPathPlanner::edgeCollidesWithTrajectories(const Coordinate &coord1,
+                                                        const Coordinate &coord2)
+{
+    double start_path_cost =
+        search_state->cell_heuristics[coord1.row()][coord1.col()].bestPathCost();
+    double end_path_cost = start_path_cost + coordDistance(coord1, coord2);
+    // Path costs are in grid cells
+    double seconds_per_cell =
+        SIZE_OF_GRID_CELL_IN_METERS / TRAJECTORY_PLANNING_SPEED_METERS_PER_SECOND;
+
+    Segment seg(convertCoordToPoint(coord1), convertCoordToPoint(coord2));
+    return obstacles.anyTrajectoryIntersects(
+        seg, Duration::fromSeconds(start_path_cost * seconds_per_cell),
+        Duration::fromSeconds(end_path_cost * seconds_per_cell));
+}
+
 std::vector<Point> ThetaStarPathPlanner::tracePath(const Coordinate &end) const
 {
     Coordinate current = end;
@@ -89,10 +112,11 @@ std::vector<Point> ThetaStarPathPlanner::tracePath(const Coordinate &end) const
     std::stack<Coordinate> path;
 
     // loop until parent equals current
-    while (!(cell_heuristics[current.row()][current.col()].parent() == current))
+    while (!(search_state->cell_heuristics[current.row()][current.col()].parent() ==
+             current))
     {
         path.push(current);
-        current = cell_heuristics[current.row()][current.col()].parent();
+        current = search_state->cell_heuristics[current.row()][current.col()].parent();
     }
 
     path.push(current);
@@ -114,23 +138,32 @@ bool ThetaStarPathPlanner::updateVertex(const Coordinate &current, const Coordin
     {
         // If the successor is already on the closed list or if it is blocked, then ignore
         // it.  Else do the following
-        if (closed_list.find(next) == closed_list.end() && isUnblocked(next))
+        if (search_state->closed_list.find(next) == search_state->closed_list.end() &&
+            isUnblocked(next))
         {
             double updated_best_path_cost;
             Coordinate next_parent;
-            Coordinate parent = cell_heuristics[current.row()][current.col()].parent();
-            if (lineOfSight(parent, next))
+            Coordinate parent =
+                search_state->cell_heuristics[current.row()][current.col()].parent();
+            if (lineOfSight(parent, next) && !edgeCollidesWithTrajectories(parent, next))
             {
                 next_parent = parent;
                 updated_best_path_cost =
-                    cell_heuristics[parent.row()][parent.col()].bestPathCost() +
+                    search_state->cell_heuristics[parent.row()][parent.col()]
+                        .bestPathCost() +
                     coordDistance(parent, next);
             }
+            else if (edgeCollidesWithTrajectories(current, next))
+            {
+                // Something will be in the way by the time we get to next this way
+                return false;
+            }
             else
             {
                 next_parent = current;
                 updated_best_path_cost =
-                    cell_heuristics[current.row()][current.col()].bestPathCost() +
+                    search_state->cell_heuristics[current.row()][current.col()]
+                        .bestPathCost() +
                     coordDistance(current, next);
             }
 
@@ -143,14 +176,15 @@ bool ThetaStarPathPlanner::updateVertex(const Coordinate &current, const Coordin
             //                               OR
             // If it is on the open list already, check to see if this path to that square
             // is better, using start_to_end_cost_estimate as the measure.
-            if (!cell_heuristics[next.row()][next.col()].isInitialized() ||
-                cell_heuristics[next.row()][next.col()].pathCostAndEndDistHeuristic() >
-                    next_start_to_end_cost_estimate)
+            if (!search_state->cell_heuristics[next.row()][next.col()].isInitialized() ||
+                search_state->cell_heuristics[next.row()][next.col()]
+                        .pathCostAndEndDistHeuristic() > next_start_to_end_cost_estimate)
             {
-                open_list.insert(std::make_pair(next_start_to_end_cost_estimate, next));
+                search_state->open_list.insert(
+                    std::make_pair(next_start_to_end_cost_estimate, next));
 
                 // Update the details of this CellHeuristic
-                cell_heuristics[next.row()][next.col()].update(
+                search_state->cell_heuristics[next.row()][next.col()].update(
                     next_parent, next_start_to_end_cost_estimate, updated_best_path_cost);
             }
             // If the end is the same as the current successor
@@ -179,7 +213,12 @@ std::optional<Path> ThetaStarPathPlanner::findPath(
         return std::nullopt;
     }
 
+    // The search state may be allocated from the current arena, so it is destroyed as
+    // soon as we're done with it rather than when the next path is planned. This
+    // happens even if planning throws, so no stale state is left behind
+    ScopeGuard reset_search_state([this]() { search_state.reset(); });
     resetAndInitializeMemberVariables(navigable_area, obstacles);
+    this->obstacles.removeTrajectoryObstaclesContaining(start);
 
     Point closest_end      = findClosestFreePoint(end);
     Coordinate start_coord = convertPointToCoord(start);
@@ -205,8 +244,9 @@ std::optional<Path> ThetaStarPathPlanner::findPath(
     }
 
     // Initialising the parameters of the starting cell
-    cell_heuristics[start_coord.row()][start_coord.col()].update(start_coord, 0.0, 0.0);
-    open_list.insert(std::make_pair(0.0, start_coord));
+    search_state->cell_heuristics[start_coord.row()][start_coord.col()].update(
+        start_coord, 0.0, 0.0);
+    search_state->open_list.insert(std::make_pair(0.0, start_coord));
 
     bool found_end = findPathToEnd(end_coord);
 
@@ -291,15 +331,15 @@ bool ThetaStarPathPlanner::adjustEndPointsAndCheckForNoPath(Coordinate &start_co
 
 bool ThetaStarPathPlanner::findPathToEnd(const Coordinate &end_coord)
 {
-    while (!open_list.empty())
+    while (!search_state->open_list.empty())
     {
-        Coordinate current_coord(open_list.begin()->second);
+        Coordinate current_coord(search_state->open_list.begin()->second);
 
         // Remove this vertex from the open list
-        open_list.erase(open_list.begin());
+        search_state->open_list.erase(search_state->open_list.begin());
 
         // Add this vertex to the closed list
-        closed_list.insert(current_coord);
+        search_state->closed_list.insert(current_coord);
 
         // Check if the the destination is in the neighbouring coordinates
         if (visitNeighbours(current_coord, end_coord))
@@ -470,20 +510,7 @@ Point ThetaStarPathPlanner::findClosestFreePoint(const Point &p)
 
 bool ThetaStarPathPlanner::isPointNavigableAndFreeOfObstacles(const Point &p)
 {
-    if (!isPointNavigable(p))
-    {
-        return false;
-    }
-
-    for (auto &obstacle : obstacles)
-    {
-        if (obstacle->contains(p))
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return isPointNavigable(p) && !obstacles.anyContains(p);
 }
 
 bool ThetaStarPathPlanner::isPointNavigable(const Point &p) const
@@ -513,12 +540,32 @@ ThetaStarPathPlanner::Coordinate ThetaStarPathPlanner::convertPointToCoord(
                                        SIZE_OF_GRID_CELL_IN_METERS));
 }
 
+ThetaStarPathPlanner::SearchState::SearchState(unsigned int num_grid_rows,
+                                               unsigned int num_grid_cols)
+    : open_list(),
+      closed_list(),
+      cell_heuristics(),
+      unblocked_grid(),
+      line_of_sight_cache()
+{
+    // The rows are constructed in place so that they use the same allocator as
+    // cell_heuristics, copying them would allocate them from the heap
+    cell_heuristics.reserve(num_grid_rows);
+    for (unsigned int row = 0; row < num_grid_rows; row++)
+    {
+        cell_heuristics.emplace_back(num_grid_cols, CellHeuristic());
+    }
+}
+
 void ThetaStarPathPlanner::resetAndInitializeMemberVariables(
     const Rectangle &navigable_area, const std::vector<ObstaclePtr> &obstacles)
 {
     // Initialize member variables
-    this->obstacles = obstacles;
-    centre          = navigable_area.centre();
+    // The obstacles are copied into an ObstacleSet, which reuses its memory from the
+    // previous search
+    this->obstacles.clear();
+    this->obstacles.add(obstacles);
+    centre = navigable_area.centre();
     max_navigable_x_coord =
         std::max(navigable_area.xLength() / 2.0 - ROBOT_MAX_RADIUS_METERS, 0.0);
     max_navigable_y_coord =
@@ -535,12 +582,7 @@ void ThetaStarPathPlanner::resetAndInitializeMemberVariables(
     assert(num_grid_rows < (1 << 16));
     assert(num_grid_cols < (1 << 16));
 
-    // Reset data structures to path plan again
-    open_list.clear();
-    closed_list.clear();
-    unblocked_grid.clear();
-    line_of_sight_cache.clear();
-    cell_heuristics = std::vector<std::vector<CellHeuristic>>(
-        num_grid_rows,
-        std::vector<CellHeuristic>(num_grid_cols, ThetaStarPathPlanner::CellHeuristic()));
+    // Create new data structures to path plan again, which are allocated from the
+    // current arena if there is one
+    search_state.emplace(num_grid_rows, num_grid_cols);
 }
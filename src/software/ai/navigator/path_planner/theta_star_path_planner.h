@@ -2,9 +2,12 @@
 
 #include <cassert>
 #include <map>
+#include <optional>
 #include <set>
 
+#include "software/ai/navigator/obstacle/obstacle_set.h"
 #include "software/ai/navigator/path_planner/path_planner.h"
+#include "software/util/memory/arena_allocator.h"
 
 /**
  * ThetaStarPathPlanner uses the theta * algorithm to implement
@@ -18,6 +21,15 @@
  * Read
  * https://web.archive.org/web/20190218161704/http://aigamedev.com/open/tutorial/theta-star-any-angle-paths/
  * for an explanation of how that works, including pseudocode and diagrams.
+ *
+ * TrajectoryObstacles are avoided in time as well as space. The time the robot reaches
+ * each cell is estimated from the length of the path to it, and an edge is only blocked
+ * by a TrajectoryObstacle if the obstacle is on the edge while the robot travels along
+ * it.
+ *
+ * The data structures used while searching for a path are allocated from the current
+ * MonotonicArena of the calling thread if there is one (ex. during an AI tick), and are
+ * destroyed before findPath returns.
  */
 
 class ThetaStarPathPlanner : public PathPlanner
@@ -298,6 +310,18 @@ class ThetaStarPathPlanner : public PathPlanner
      */
     bool lineOfSight(const Coordinate &coord1, const Coordinate &coord2);
 
+    /**
+     * Checks whether travelling from coord1 to coord2 collides with a
+     * TrajectoryObstacle, given the best path cost to coord1
+     *
+     * @param coord1 The Coordinate the edge starts from
+     * @param coord2 The Coordinate the edge ends at
+     *
+     * @return true if travelling from coord1 to coord2 collides with a
+     * TrajectoryObstacle
+     */
+    bool edgeCollidesWithTrajectories(const Coordinate &coord1, const Coordinate &coord2);
+
     /**
      * Finds closest unblocked cell to current_cell
      *
@@ -411,35 +435,59 @@ class ThetaStarPathPlanner : public PathPlanner
     const double SIZE_OF_GRID_CELL_IN_METERS =
         ROBOT_MAX_RADIUS_METERS;  // this is the n in the O(n^2) algorithm :p
 
-    std::vector<ObstaclePtr> obstacles;
+    // The average speed the robot is assumed to travel along the path at when
+    // estimating when it will reach each cell. This is lower than the max speed of the
+    // robot since it has to accelerate
+    static constexpr double TRAJECTORY_PLANNING_SPEED_METERS_PER_SECOND = 1.5;
+
+    ObstacleSet obstacles;
     Point centre;
     unsigned int num_grid_rows;
     unsigned int num_grid_cols;
     double max_navigable_x_coord;
     double max_navigable_y_coord;
 
-    // open_list represents Coordinates that we'd like to visit. Elements are pairs of
-    // start_to_end_cost_estimate and Coordinate, so the set is implicitly ordered by
-    // start_to_end_cost_estimate (and then by Coordinate to break ties). This ensures
-    // that open_list.begin() is the Coordinate with the lowest start_to_end_cost_estimate
-    std::set<std::pair<double, Coordinate>> open_list;
-
-    // closed_list represent coords we've already visited so
-    // it contains coords for which we calculated the CellHeuristic
-    std::set<Coordinate> closed_list;
-
-    // Declare a 2D array of structure to hold the details of that CellHeuristic
-    std::vector<std::vector<CellHeuristic>> cell_heuristics;
-
-    // The following data structures improve performance by caching the results of
-    // isUnblocked and lineOfSight.
-    // Description of the Grid-
-    // unblocked_grid is indexed with coordinate
-    // true --> The cell is not blocked
-    // false --> The cell is blocked
-    // We update this as we go to avoid updating cells we don't use
-    std::map<Coordinate, bool> unblocked_grid;
-    // Cache of line of sight that maps a pair of
-    // coordinates to whether those two Coordinates have line of sight between them
-    std::map<CoordinatePair, bool> line_of_sight_cache;
+    /**
+     * The data structures used while searching for a path, which are only valid
+     * during a call to findPath
+     */
+    struct SearchState
+    {
+        /**
+         * Creates the data structures to search a grid of the given size, allocated
+         * from the current arena if there is one
+         *
+         * @param num_grid_rows The number of rows in the grid
+         * @param num_grid_cols The number of columns in the grid
+         */
+        SearchState(unsigned int num_grid_rows, unsigned int num_grid_cols);
+
+        // open_list represents Coordinates that we'd like to visit. Elements are pairs
+        // of start_to_end_cost_estimate and Coordinate, so the set is implicitly ordered
+        // by start_to_end_cost_estimate (and then by Coordinate to break ties). This
+        // ensures that open_list.begin() is the Coordinate with the lowest
+        // start_to_end_cost_estimate
+        ArenaSet<std::pair<double, Coordinate>> open_list;
+
+        // closed_list represent coords we've already visited so
+        // it contains coords for which we calculated the CellHeuristic
+        ArenaSet<Coordinate> closed_list;
+
+        // Declare a 2D array of structure to hold the details of that CellHeuristic
+        ArenaVector<ArenaVector<CellHeuristic>> cell_heuristics;
+
+        // The following data structures improve performance by caching the results of
+        // isUnblocked and lineOfSight.
+        // Description of the Grid-
+        // unblocked_grid is indexed with coordinate
+        // true --> The cell is not blocked
+        // false --> The cell is blocked
+        // We update this as we go to avoid updating cells we don't use
+        ArenaMap<Coordinate, bool> unblocked_grid;
+        // Cache of line of sight that maps a pair of
+        // coordinates to whether those two Coordinates have line of sight between them
+        ArenaMap<CoordinatePair, bool> line_of_sight_cache;
+    };
+
+    std::optional<SearchState> search_state;
 };
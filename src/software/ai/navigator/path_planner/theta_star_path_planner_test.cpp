@@ -5,8 +5,12 @@
 #include "shared/constants.h"
 #include "software/ai/navigator/obstacle/obstacle.h"
 #include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
+#include "software/ai/navigator/obstacle/trajectory_obstacle.h"
 #include "software/geom/point.h"
+#include "software/util/memory/monotonic_arena.h"
+#include "software/world/ball.h"
 #include "software/world/field.h"
+#include "software/world/team.h"
 
 class TestThetaStarPathPlanner : public testing::Test
 {
@@ -368,3 +372,131 @@ TEST_F(TestThetaStarPathPlanner,
     EXPECT_EQ(2, path->getKnots().size());
     EXPECT_EQ(start, path->getStartPoint());
 }
+
+TEST_F(TestThetaStarPathPlanner, test_theta_star_path_planner_with_current_arena)
+{
+    // The search should allocate from the current arena and find the same path as it
+    // does on the heap, including when the arena is reused
+    Field field = Field::createSSLDivisionBField();
+    Point start{-3, 0}, dest{3, 0};
+
+    std::vector<ObstaclePtr> obstacles = {
+        robot_navigation_obstacle_factory.createFromShape(
+            Rectangle(Point(-0.5, -1), Point(0.5, 1)))};
+
+    Rectangle navigable_area = field.fieldBoundary();
+
+    auto heap_path = planner->findPath(start, dest, navigable_area, obstacles);
+    ASSERT_TRUE(heap_path != std::nullopt);
+
+    MonotonicArena arena(1024);
+    for (int i = 0; i < 2; i++)
+    {
+        {
+            ScopedCurrentArena scoped_arena(arena);
+            auto arena_path = planner->findPath(start, dest, navigable_area, obstacles);
+
+            ASSERT_TRUE(arena_path != std::nullopt);
+            EXPECT_EQ(heap_path->getKnots(), arena_path->getKnots());
+            EXPECT_GT(arena.getBytesAllocated(), 0);
+        }
+        arena.release();
+    }
+}
+
+TEST_F(TestThetaStarPathPlanner,
+       test_theta_star_does_not_avoid_trajectory_obstacle_that_moves_out_of_the_way)
+{
+    // The obstacle is on the straight line path now, but is long gone by the time the
+    // robot gets there
+    Field field = Field::createSSLDivisionBField();
+    Point start{-3, 0}, dest{3, 0};
+
+    std::vector<ObstaclePtr> obstacles = {std::make_shared<TrajectoryObstacle>(
+        Circle(Point(-1, 0), 0.3), Vector(0, 3), Vector(), Duration::fromSeconds(1))};
+
+    Rectangle navigable_area = field.fieldBoundary();
+
+    auto path = planner->findPath(start, dest, navigable_area, obstacles);
+
+    ASSERT_TRUE(path != std::nullopt);
+    EXPECT_EQ(2, path->getKnots().size());
+    EXPECT_EQ(start, path->getStartPoint());
+    EXPECT_EQ(dest, path->getEndPoint());
+}
+
+TEST_F(TestThetaStarPathPlanner,
+       test_theta_star_avoids_trajectory_obstacle_that_moves_into_the_way)
+{
+    // The obstacle isn't on the straight line path now, but reaches it at about the
+    // same time as the robot
+    Field field = Field::createSSLDivisionBField();
+    Point start{-3, 0}, dest{3, 0};
+
+    std::vector<ObstaclePtr> obstacles = {std::make_shared<TrajectoryObstacle>(
+        Circle(Point(0, -2), 0.3), Vector(0, 1), Vector(), Duration::fromSeconds(3))};
+
+    Rectangle navigable_area = field.fieldBoundary();
+
+    auto path = planner->findPath(start, dest, navigable_area, obstacles);
+
+    ASSERT_TRUE(path != std::nullopt);
+    EXPECT_GT(path->getKnots().size(), 2);
+    EXPECT_EQ(start, path->getStartPoint());
+    EXPECT_EQ(dest, path->getEndPoint());
+    checkPathDoesNotExceedBoundingBox(path->getKnots(), navigable_area);
+}
+
+TEST_F(
+    TestThetaStarPathPlanner,
+    test_theta_star_moves_destination_out_of_stationary_enemy_with_trajectory_obstacles)
+{
+    // The destination is inside an enemy robot that isn't moving, so the path should
+    // end next to it even though enemies are represented by trajectory obstacles
+    auto config = std::make_shared<RobotNavigationObstacleConfig>();
+    config->getMutableUseTrajectoryObstacles()->setValue(true);
+    RobotNavigationObstacleFactory factory(config);
+
+    Field field = Field::createSSLDivisionBField();
+    Point start{-2, 0}, dest{1, 0.5};
+    Team enemy_team(Duration::fromSeconds(1));
+    enemy_team.updateRobots({Robot(0, dest, Vector(), Angle::zero(),
+                                   AngularVelocity::zero(), Timestamp::fromSeconds(0))});
+    std::vector<ObstaclePtr> obstacles =
+        factory.createEnemyCollisionAvoidance(enemy_team, 2.0);
+
+    Rectangle navigable_area = field.fieldBoundary();
+
+    auto path = planner->findPath(start, dest, navigable_area, obstacles);
+
+    ASSERT_TRUE(path != std::nullopt);
+    EXPECT_EQ(start, path->getStartPoint());
+    EXPECT_FALSE(obstacles[0]->contains(path->getEndPoint()));
+    EXPECT_LT((path->getEndPoint() - dest).length(), 0.4);
+    checkPathDoesNotIntersectObstacle(path->getKnots(), obstacles);
+}
+
+TEST_F(TestThetaStarPathPlanner,
+       test_theta_star_moves_destination_out_of_stationary_ball_with_trajectory_obstacles)
+{
+    // The destination is on a ball that isn't moving, so the path should end next to
+    // it even though the ball would be a trajectory obstacle if it were moving
+    auto config = std::make_shared<RobotNavigationObstacleConfig>();
+    config->getMutableUseTrajectoryObstacles()->setValue(true);
+    RobotNavigationObstacleFactory factory(config);
+
+    Field field = Field::createSSLDivisionBField();
+    Point start{-2, 0}, dest{1, 0.5};
+    Ball ball(dest, Vector(), Timestamp::fromSeconds(0));
+    std::vector<ObstaclePtr> obstacles = {factory.createFromBall(ball)};
+
+    Rectangle navigable_area = field.fieldBoundary();
+
+    auto path = planner->findPath(start, dest, navigable_area, obstacles);
+
+    ASSERT_TRUE(path != std::nullopt);
+    EXPECT_EQ(start, path->getStartPoint());
+    EXPECT_FALSE(obstacles[0]->contains(path->getEndPoint()));
+    EXPECT_LT((path->getEndPoint() - dest).length(), 0.3);
+    checkPathDoesNotIntersectObstacle(path->getKnots(), obstacles);
+}
@@ -0,0 +1,218 @@
+#include <google/protobuf/arena.h>
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+
+#include "shared/proto/tbots_software_msgs.pb.h"
+#include "software/ai/intent/move_intent.h"
+#include "software/ai/intent/stop_intent.h"
+#include "software/ai/navigator/navigating_primitive_creator.h"
+#include "software/ai/navigator/navigator.h"
+#include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
+#include "software/ai/navigator/path_manager/velocity_obstacle_path_manager.h"
+#include "software/ai/navigator/path_planner/theta_star_path_planner.h"
+#include "software/ai/profiler/allocation_tracker.h"
+#include "software/proto/primitive/primitive_msg_factory.h"
+#include "software/test_util/test_util.h"
+#include "software/util/memory/protobuf_arena_options.h"
+
+/**
+ * These tests check that building the primitives sent to the robots every tick does not
+ * allocate any memory once everything has been set up. This test links in the
+ * allocation tracking operator new so it can count the allocations made while a test is
+ * measuring.
+ */
+
+namespace
+{
+    constexpr unsigned int NUM_ROBOTS_ON_TEAM      = 11;
+    constexpr std::size_t ARENA_INITIAL_BLOCK_SIZE = 64 * 1024;
+
+    /**
+     * Counts the heap allocations the current thread makes while it is alive
+     */
+    class ScopedAllocationCounter
+    {
+       public:
+        ScopedAllocationCounter()
+        {
+            AllocationTracker::setEnabled(true);
+            start_stats = AllocationTracker::getThreadAllocationStats();
+        }
+
+        ~ScopedAllocationCounter()
+        {
+            AllocationTracker::setEnabled(false);
+        }
+
+        /**
+         * Returns the number of allocations made since this counter was created
+         *
+         * @return the number of allocations
+         */
+        uint64_t getNumAllocations() const
+        {
+            return (AllocationTracker::getThreadAllocationStats() - start_stats)
+                .num_allocations;
+        }
+
+       private:
+        AllocationStats start_stats;
+    };
+}  // namespace
+
+class PrimitiveConstructionAllocationTest : public testing::Test
+{
+   protected:
+    PrimitiveConstructionAllocationTest()
+        : navigator_config(std::make_shared<const NavigatorConfig>()),
+          obstacle_factory(std::make_shared<const RobotNavigationObstacleConfig>()),
+          enemy_robot_obstacles(std::vector<ObstaclePtr>(
+              {obstacle_factory.createFromRobotPosition(Point(1, 1)),
+               obstacle_factory.createFromRobotPosition(Point(-2, 0.5))})),
+          path({Point(0, 0), Point(1, 0), Point(2, 1)}),
+          move_intent(0, Point(2, 1), Angle::quarter(), 0.0, DribblerMode::OFF,
+                      BallCollisionType::AVOID, {AutoChipOrKickMode::AUTOKICK, 3.0},
+                      MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0),
+          navigator(std::make_unique<VelocityObstaclePathManager>(
+                        std::make_unique<ThetaStarPathPlanner>(), obstacle_factory),
+                    obstacle_factory, navigator_config),
+          world(::TestUtil::createBlankTestingWorld()),
+          intents(),
+          arena_initial_block(ARENA_INITIAL_BLOCK_SIZE),
+          arena(createProtobufArenaOptions(arena_initial_block))
+    {
+        // A full team, where every robot but the last moves across the field past the
+        // enemies, like the AI does every tick
+        std::vector<Point> friendly_positions;
+        for (RobotId id = 0; id < NUM_ROBOTS_ON_TEAM; id++)
+        {
+            friendly_positions.emplace_back(-4.0, 2.5 - 0.5 * id);
+        }
+        world.updateFriendlyTeamState(::TestUtil::setRobotPositionsHelper(
+            world.friendlyTeam(), friendly_positions, world.getMostRecentTimestamp()));
+        world.updateEnemyTeamState(::TestUtil::setRobotPositionsHelper(
+            world.enemyTeam(), {Point(0, 1), Point(0, -1), Point(1.5, 0)},
+            world.getMostRecentTimestamp()));
+
+        for (RobotId id = 0; id < NUM_ROBOTS_ON_TEAM - 1; id++)
+        {
+            intents.emplace_back(std::make_unique<MoveIntent>(
+                id, Point(4.0, 2.5 - 0.5 * id), Angle::half(), 0.0, DribblerMode::OFF,
+                BallCollisionType::AVOID, AutoChipOrKick{AutoChipOrKickMode::OFF, 0.0},
+                MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0));
+        }
+        intents.emplace_back(std::make_unique<StopIntent>(NUM_ROBOTS_ON_TEAM - 1, false));
+    }
+
+    /**
+     * Builds the PrimitiveSet for the intents with the Navigator on the reset arena,
+     * the same way the AI does every tick
+     *
+     * @return the PrimitiveSet, which is only valid until the arena is next reset
+     */
+    TbotsProto::PrimitiveSet& buildPrimitiveSetOnArena()
+    {
+        arena.Reset();
+        auto primitive_set =
+            google::protobuf::Arena::CreateMessage<TbotsProto::PrimitiveSet>(&arena);
+        navigator.getAssignedPrimitives(world, intents, *primitive_set);
+        return *primitive_set;
+    }
+
+    std::shared_ptr<const NavigatorConfig> navigator_config;
+    RobotNavigationObstacleFactory obstacle_factory;
+    ObstacleSet enemy_robot_obstacles;
+    Path path;
+    MoveIntent move_intent;
+    Navigator navigator;
+    World world;
+    std::vector<std::unique_ptr<Intent>> intents;
+    std::vector<char> arena_initial_block;
+    google::protobuf::Arena arena;
+};
+
+TEST_F(PrimitiveConstructionAllocationTest, creating_a_primitive_on_the_heap_allocates)
+{
+    // Makes sure the allocation counter works, so the tests below are meaningful
+    ScopedAllocationCounter allocation_counter;
+    auto primitive = createStopPrimitive(false);
+    EXPECT_GT(allocation_counter.getNumAllocations(), 0);
+}
+
+TEST_F(PrimitiveConstructionAllocationTest, set_move_primitive_on_arena_does_not_allocate)
+{
+    auto primitive =
+        google::protobuf::Arena::CreateMessage<TbotsProto::Primitive>(&arena);
+
+    ScopedAllocationCounter allocation_counter;
+    setMovePrimitive(*primitive, Point(1, 2), 1.5, Angle::half(), DribblerMode::MAX_FORCE,
+                     {AutoChipOrKickMode::AUTOCHIP, 2.0},
+                     MaxAllowedSpeedMode::STOP_COMMAND, 1.0);
+    EXPECT_EQ(0, allocation_counter.getNumAllocations());
+}
+
+TEST_F(PrimitiveConstructionAllocationTest,
+       setting_a_move_primitive_again_reuses_its_messages)
+{
+    TbotsProto::Primitive primitive;
+    setMovePrimitive(primitive, Point(1, 2), 1.5, Angle::half(), DribblerMode::OFF,
+                     {AutoChipOrKickMode::AUTOKICK, 2.0},
+                     MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0);
+
+    ScopedAllocationCounter allocation_counter;
+    setMovePrimitive(primitive, Point(-1, 0), 0.5, Angle::zero(), DribblerMode::OFF,
+                     {AutoChipOrKickMode::AUTOKICK, 4.0},
+                     MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0);
+    EXPECT_EQ(0, allocation_counter.getNumAllocations());
+}
+
+TEST_F(PrimitiveConstructionAllocationTest,
+       create_navigating_primitive_in_place_does_not_allocate)
+{
+    NavigatingPrimitiveCreator navigating_primitive_creator(navigator_config);
+    TbotsProto::Primitive primitive;
+    navigating_primitive_creator.createNavigatingPrimitive(
+        move_intent, path, enemy_robot_obstacles, primitive);
+
+    ScopedAllocationCounter allocation_counter;
+    navigating_primitive_creator.createNavigatingPrimitive(
+        move_intent, path, enemy_robot_obstacles, primitive);
+    EXPECT_EQ(0, allocation_counter.getNumAllocations());
+}
+
+TEST_F(PrimitiveConstructionAllocationTest,
+       navigator_builds_primitive_set_on_arena_without_allocating_primitives)
+{
+    // The first ticks can allocate while the arena and path planner set themselves up
+    buildPrimitiveSetOnArena();
+    navigator.getAssignedPrimitives(world, intents);
+
+    uint64_t num_heap_allocations;
+    std::unique_ptr<TbotsProto::PrimitiveSet> heap_primitive_set;
+    {
+        ScopedAllocationCounter allocation_counter;
+        heap_primitive_set   = navigator.getAssignedPrimitives(world, intents);
+        num_heap_allocations = allocation_counter.getNumAllocations();
+    }
+
+    uint64_t num_arena_allocations;
+    {
+        ScopedAllocationCounter allocation_counter;
+        buildPrimitiveSetOnArena();
+        num_arena_allocations = allocation_counter.getNumAllocations();
+    }
+    TbotsProto::PrimitiveSet& arena_primitive_set = buildPrimitiveSetOnArena();
+
+    // Path planning still allocates, so the only difference from building the
+    // PrimitiveSet on the heap should be that the primitives don't allocate, since
+    // they all live on the arena
+    ASSERT_EQ(NUM_ROBOTS_ON_TEAM, arena_primitive_set.robot_primitives_size());
+    EXPECT_EQ(&arena, arena_primitive_set.GetArena());
+    for (RobotId id = 0; id < NUM_ROBOTS_ON_TEAM; id++)
+    {
+        EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equals(
+            heap_primitive_set->robot_primitives().at(id),
+            arena_primitive_set.robot_primitives().at(id)));
+    }
+    EXPECT_LE(num_arena_allocations + NUM_ROBOTS_ON_TEAM, num_heap_allocations);
+}
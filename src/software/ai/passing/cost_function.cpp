@@ -4,37 +4,482 @@
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/../shared/constants.h"
+#include "software/ai/evaluation/batch_time_to_position.h"
 #include "software/ai/evaluation/calc_best_shot.h"
 #include "software/ai/evaluation/pass.h"
+#include "software/ai/passing/static_position_quality_grid.h"
 #include "software/geom/algorithms/acute_angle.h"
 #include "software/geom/algorithms/closest_point.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/logger/logger.h"
 
+namespace
+{
+    /**
+     * Returns the static position quality grids shared by every pass rating
+     *
+     * @return the static position quality grids shared by every pass rating
+     */
+    StaticPositionQualityGridCache& getStaticPositionQualityGridCache()
+    {
+        static StaticPositionQualityGridCache static_position_quality_grid_cache;
+        return static_position_quality_grid_cache;
+    }
+
+    // The positions and velocities of the friendly robots, and the time for each of
+    // them to get to the pass receive point, reused by every pass rated on a thread so
+    // that rating a pass doesn't allocate
+    thread_local PointBuffer friendly_robot_positions;
+    thread_local PointBuffer friendly_robot_velocities;
+    thread_local std::vector<double> friendly_robot_times_to_receive_point;
+
+    /**
+     * Rates a pass based on the probability of scoring once we receive it (see the
+     * ratePassShootScore overload taking a Team)
+     *
+     * @param field The field we are playing on
+     * @param enemy_robots The enemy robots
+     * @param pass The pass to rate
+     * @param ideal_max_rotation_to_shoot_degrees The ideal max rotation to shoot from the
+     * passing config
+     *
+     * @return A value in [0,1], with 1 indicating that it is guaranteed to be able to
+     *         score off of the pass
+     */
+    double ratePassShootScore(const Field& field, const std::vector<Robot>& enemy_robots,
+                              const Pass& pass,
+                              double ideal_max_rotation_to_shoot_degrees)
+    {
+        // Figure out the range of angles for which we have an open shot to the goal after
+        // receiving the pass
+        auto shot_opt = calcBestShotOnGoal(
+            Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg()),
+            pass.receiverPoint(), enemy_robots, TeamType::ENEMY);
+
+        Angle open_angle_to_goal = Angle::zero();
+        Point shot_target        = field.enemyGoalCenter();
+        if (shot_opt && shot_opt->getOpenAngle().abs() > Angle::fromDegrees(0))
+        {
+            open_angle_to_goal = shot_opt->getOpenAngle();
+        }
+
+        // Figure out what the maximum open angle of the goal could be from the receiver
+        // pos.
+        Angle goal_angle = acuteAngle(field.enemyGoalpostNeg(), pass.receiverPoint(),
+                                      field.enemyGoalpostPos())
+                               .abs();
+        double net_percent_open = 0;
+        if (goal_angle > Angle::zero())
+        {
+            net_percent_open = open_angle_to_goal.toDegrees() / goal_angle.toDegrees();
+        }
+
+        // Create the shoot score by creating a sigmoid that goes to a large value as
+        // the section of net we're shooting on approaches 100% (ie. completely open)
+        double shot_openness_score = sigmoid(net_percent_open, 0.45, 0.95);
+
+        // Prefer angles where the robot does not have to turn much after receiving the
+        // pass to take the shot (or equivalently the shot deflection angle)
+        //
+        // Receiver robots on the friendly side, almost always, need to rotate a full 180
+        // degrees to shoot on net. So we relax that requirement for both receiver and
+        // ball locations on the friendly side
+        //
+        // TODO (#1987) This creates a very steep slope, find a better way to do this
+        if (pass.receiverPoint().x() < 0 || pass.passerPoint().x() < 0)
+        {
+            ideal_max_rotation_to_shoot_degrees = 180;
+        }
+        Angle rotation_to_shot_target_after_pass = pass.receiverOrientation().minDiff(
+            (shot_target - pass.receiverPoint()).orientation());
+        double required_rotation_for_shot_score =
+            1 - sigmoid(rotation_to_shot_target_after_pass.abs().toDegrees(),
+                        ideal_max_rotation_to_shoot_degrees, 4);
+
+        return shot_openness_score * required_rotation_for_shot_score;
+    }
+
+    /**
+     * Calculates the likelihood that the given pass will be intercepted by a given robot
+     * (see the calculateInterceptRisk overload taking a PassingConfig)
+     *
+     * @param enemy_robot The robot that might intercept our pass
+     * @param pass The pass we want to get the intercept probability for
+     * @param enemy_reaction_time The enemy reaction time from the passing config
+     *
+     * @return A value in [0,1] indicating the probability that the given pass will be
+     *         intercepted by the given robot
+     */
+    double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
+                                  const Duration& enemy_reaction_time)
+    {
+        // We estimate the intercept by the risk that the robot will get to the closest
+        // point on the pass before the ball, and by the risk that the robot will get to
+        // the reception point before the ball. We take the greater of these two risks.
+
+        // If the enemy cannot intercept the pass at BOTH the closest point on the pass
+        // and the receiver point for the pass, then it is guaranteed that it will not be
+        // able to intercept the pass anywhere.
+
+        // Figure out how long the enemy robot and ball will take to reach the closest
+        // point on the pass to the enemy's current position
+        Point closest_point_on_pass_to_robot = closestPoint(
+            enemy_robot.position(), Segment(pass.passerPoint(), pass.receiverPoint()));
+        Duration enemy_robot_time_to_closest_pass_point = getTimeToPositionForRobot(
+            enemy_robot.position(), enemy_robot.velocity(),
+            closest_point_on_pass_to_robot, ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND,
+            ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED,
+            ROBOT_MAX_RADIUS_METERS);
+        Duration ball_time_to_closest_pass_point = Duration::fromSeconds(
+            (closest_point_on_pass_to_robot - pass.passerPoint()).length() /
+            pass.speed());
+
+        // Check for division by 0
+        if (pass.speed() == 0)
+        {
+            ball_time_to_closest_pass_point =
+                Duration::fromSeconds(std::numeric_limits<int>::max());
+        }
+
+        // Figure out how long the enemy robot and ball will take to reach the receive
+        // point for the pass.
+        Duration enemy_robot_time_to_pass_receive_position = getTimeToPositionForRobot(
+            enemy_robot.position(), enemy_robot.velocity(), pass.receiverPoint(),
+            ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND,
+            ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED,
+            ROBOT_MAX_RADIUS_METERS);
+        Duration ball_time_to_pass_receive_position = pass.estimatePassDuration();
+
+        double robot_ball_time_diff_at_closest_pass_point =
+            ((enemy_robot_time_to_closest_pass_point + enemy_reaction_time) -
+             (ball_time_to_closest_pass_point))
+                .toSeconds();
+        double robot_ball_time_diff_at_pass_receive_point =
+            ((enemy_robot_time_to_pass_receive_position + enemy_reaction_time) -
+             (ball_time_to_pass_receive_position))
+                .toSeconds();
+
+        double min_time_diff = std::min(robot_ball_time_diff_at_closest_pass_point,
+                                        robot_ball_time_diff_at_pass_receive_point);
+
+        // Whether or not the enemy will be able to intercept the pass can be determined
+        // by whether or not they will be able to reach the pass receive position before
+        // the pass does. As such, we place the time difference between the robot and ball
+        // on a sigmoid that is centered at 0, and goes to 1 at positive values, 0 at
+        // negative values.
+        return 1 - sigmoid(min_time_diff, 0, 1);
+    }
+
+    /**
+     * Calculates the likelihood that the given pass will be intercepted by any of the
+     * given robots
+     *
+     * @param enemy_robots The robots that might intercept our pass
+     * @param pass The pass we want to get the intercept probability for
+     * @param enemy_reaction_time The enemy reaction time from the passing config
+     *
+     * @return A value in [0,1] indicating the probability that the given pass will be
+     *         intercepted by one of the robots
+     */
+    double calculateInterceptRisk(const std::vector<Robot>& enemy_robots,
+                                  const Pass& pass, const Duration& enemy_reaction_time)
+    {
+        // Return the highest risk for all the enemy robots, if there are any
+        if (enemy_robots.empty())
+        {
+            return 0;
+        }
+        std::vector<double> enemy_intercept_risks(enemy_robots.size());
+        std::transform(enemy_robots.begin(), enemy_robots.end(),
+                       enemy_intercept_risks.begin(), [&](Robot robot) {
+                           return calculateInterceptRisk(robot, pass,
+                                                         enemy_reaction_time);
+                       });
+        return *std::max_element(enemy_intercept_risks.begin(),
+                                 enemy_intercept_risks.end());
+    }
+
+    /**
+     * Calculates the risk of an enemy robot interfering with a given pass (see the
+     * ratePassEnemyRisk overload taking a Team)
+     *
+     * @param enemy_robots The enemy robots
+     * @param pass The pass to rate
+     * @param enemy_proximity_importance The enemy proximity importance from the passing
+     * config
+     * @param enemy_reaction_time The enemy reaction time from the passing config
+     *
+     * @return A value in [0,1] indicating the quality of the pass based on the risk that
+     *         an enemy interferes with it, with 1 being no risk
+     */
+    double ratePassEnemyRisk(const std::vector<Robot>& enemy_robots, const Pass& pass,
+                             double enemy_proximity_importance,
+                             const Duration& enemy_reaction_time)
+    {
+        // Calculate a risk score based on the distance of the enemy robots from the
+        // receive point, based on an exponential function of the distance of each robot
+        // from the receiver point
+        double enemy_receiver_proximity_risk = 1;
+        for (const Robot& enemy : enemy_robots)
+        {
+            double dist = (pass.receiverPoint() - enemy.position()).length();
+            enemy_receiver_proximity_risk *=
+                enemy_proximity_importance * std::exp(-dist * dist);
+        }
+        if (enemy_robots.empty())
+        {
+            enemy_receiver_proximity_risk = 0;
+        }
+
+        double intercept_risk =
+            calculateInterceptRisk(enemy_robots, pass, enemy_reaction_time);
+
+        // We want to rate a pass more highly if it is lower risk, so subtract from 1
+        return 1 - std::max(intercept_risk, enemy_receiver_proximity_risk);
+    }
+
+    /**
+     * Calculates the probability of a friendly robot receiving the given pass (see the
+     * ratePassFriendlyCapability overload taking a Team)
+     *
+     * @param friendly_robots The robots that might receive the given pass
+     * @param friendly_robot_positions The position of each of the friendly robots
+     * @param friendly_robot_velocities The velocity of each of the friendly robots
+     * @param pass The pass we want a robot to receive
+     *
+     * @return A value in [0,1] indicating how likely it would be for a friendly robot to
+     *         receive the given pass, with 1 being very likely
+     */
+    double ratePassFriendlyCapability(const std::vector<Robot>& friendly_robots,
+                                      const PointBuffer& friendly_robot_positions,
+                                      const PointBuffer& friendly_robot_velocities,
+                                      const Pass& pass)
+    {
+        // We need at least one robot to pass to
+        if (friendly_robots.empty())
+        {
+            return 0;
+        }
+
+        // Special case where pass speed is 0
+        if (pass.speed() == 0)
+        {
+            return 0;
+        }
+
+        // Get the robot that can get to where the pass would be received the soonest
+        batchTimeToPosition(friendly_robot_positions, friendly_robot_velocities,
+                            pass.receiverPoint(), ROBOT_MAX_SPEED_METERS_PER_SECOND,
+                            ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED, 0,
+                            friendly_robot_times_to_receive_point);
+        auto best_receiver_index = static_cast<std::size_t>(
+            std::min_element(friendly_robot_times_to_receive_point.begin(),
+                             friendly_robot_times_to_receive_point.end()) -
+            friendly_robot_times_to_receive_point.begin());
+        const Robot& best_receiver = friendly_robots[best_receiver_index];
+
+        // Figure out what time the robot would have to receive the ball at
+        Duration ball_travel_time = Duration::fromSeconds(
+            (pass.receiverPoint() - pass.passerPoint()).length() / pass.speed());
+        Timestamp receive_time = best_receiver.timestamp() + ball_travel_time;
+
+        // Figure out how long it would take our robot to get there
+        Duration min_robot_travel_time = Duration::fromSeconds(
+            friendly_robot_times_to_receive_point[best_receiver_index]);
+        Timestamp earliest_time_to_receive_point =
+            best_receiver.timestamp() + min_robot_travel_time;
+
+        // Figure out what angle the robot would have to be at to receive the ball
+        Angle receive_angle =
+            (pass.passerPoint() - best_receiver.position()).orientation();
+        Duration time_to_receive_angle = getTimeToOrientationForRobot(
+            best_receiver.orientation(), best_receiver.angularVelocity(), receive_angle,
+            ROBOT_MAX_ANG_SPEED_RAD_PER_SECOND,
+            ROBOT_MAX_ANG_ACCELERATION_RAD_PER_SECOND_SQUARED);
+        Timestamp earliest_time_to_receive_angle =
+            best_receiver.timestamp() + time_to_receive_angle;
+
+        // Figure out if rotation or moving will take us longer
+        Timestamp latest_time_to_reciever_state =
+            std::max(earliest_time_to_receive_angle, earliest_time_to_receive_point);
+
+        // Create a sigmoid that goes to 0 as the time required to get to the reception
+        // point exceeds the time we would need to get there by
+        double sigmoid_width                  = 0.4;
+        double time_to_receiver_state_slack_s = 0.25;
+
+        return sigmoid(
+            receive_time.toSeconds(),
+            latest_time_to_reciever_state.toSeconds() + time_to_receiver_state_slack_s,
+            sigmoid_width);
+    }
+
+    /**
+     * The parts of the rating of a pass that only depend on the world and the passing
+     * config. ratePasses creates one of these per call and shares it between every pass
+     * it rates
+     */
+    struct PassRatingContext
+    {
+        const World& world;
+        std::shared_ptr<const PassingConfig> passing_config;
+        // The grid to interpolate the static position quality from, or nullptr if it
+        // should be calculated exactly
+        std::shared_ptr<const StaticPositionQualityGrid> static_position_quality_grid;
+        const std::vector<Robot>& friendly_robots;
+        const PointBuffer& friendly_robot_positions;
+        const PointBuffer& friendly_robot_velocities;
+        const std::vector<Robot>& enemy_robots;
+        double min_pass_speed;
+        double max_pass_speed;
+        double enemy_proximity_importance;
+        Duration enemy_reaction_time;
+        double ideal_max_rotation_to_shoot_degrees;
+    };
+
+    /**
+     * Stores the positions and velocities of the given robots in friendly_robot_positions
+     * and friendly_robot_velocities
+     *
+     * @param friendly_robots The friendly robots
+     */
+    void loadFriendlyRobotStates(const std::vector<Robot>& friendly_robots)
+    {
+        friendly_robot_positions.clear();
+        friendly_robot_velocities.clear();
+        for (const Robot& robot : friendly_robots)
+        {
+            friendly_robot_positions.push_back(robot.position());
+            friendly_robot_velocities.push_back(
+                Point(robot.velocity().x(), robot.velocity().y()));
+        }
+    }
+
+    /**
+     * Creates the context for rating passes on the given world
+     *
+     * This loads the friendly robot states into friendly_robot_positions and
+     * friendly_robot_velocities, which the context refers to, so only one context may be
+     * used on a thread at a time
+     *
+     * @param world The world to rate passes on
+     * @param passing_config The passing config used for tuning
+     *
+     * @return the context for rating passes on the given world
+     */
+    PassRatingContext createPassRatingContext(
+        const World& world, std::shared_ptr<const PassingConfig> passing_config)
+    {
+        loadFriendlyRobotStates(world.friendlyTeam().getAllRobots());
+        return PassRatingContext{
+            world,
+            passing_config,
+            passing_config->getUseStaticPositionQualityGrid()->value()
+                ? getStaticPositionQualityGridCache().getGrid(world.field(),
+                                                              passing_config)
+                : nullptr,
+            world.friendlyTeam().getAllRobots(),
+            friendly_robot_positions,
+            friendly_robot_velocities,
+            world.enemyTeam().getAllRobots(),
+            passing_config->getMinPassSpeedMPerS()->value(),
+            passing_config->getMaxPassSpeedMPerS()->value(),
+            passing_config->getEnemyProximityImportance()->value(),
+            Duration::fromSeconds(passing_config->getEnemyReactionTime()->value()),
+            passing_config->getIdealMaxRotationToShootDegrees()->value()};
+    }
+
+    /**
+     * Calculates the quality of a given pass (see ratePass)
+     *
+     * @param context The context for the world to rate the pass on
+     * @param pass The pass to rate
+     * @param zone The zone this pass is constrained to
+     *
+     * @return A value in [0,1] representing the quality of the pass
+     */
+    double ratePass(const PassRatingContext& context, const Pass& pass,
+                    const Rectangle& zone)
+    {
+        double static_pass_quality =
+            context.static_position_quality_grid
+                ? context.static_position_quality_grid->getStaticPositionQuality(
+                      pass.receiverPoint())
+                : getStaticPositionQuality(context.world.field(), pass.receiverPoint(),
+                                           context.passing_config);
+
+        double friendly_pass_rating = ratePassFriendlyCapability(
+            context.friendly_robots, context.friendly_robot_positions,
+            context.friendly_robot_velocities, pass);
+
+        double enemy_pass_rating = ratePassEnemyRisk(context.enemy_robots, pass,
+                                                     context.enemy_proximity_importance,
+                                                     context.enemy_reaction_time);
+
+        double shoot_pass_rating =
+            ratePassShootScore(context.world.field(), context.enemy_robots, pass,
+                               context.ideal_max_rotation_to_shoot_degrees);
+
+        double in_region_quality = rectangleSigmoid(zone, pass.receiverPoint(), 0.2);
+
+        // Place strict limits on the ball speed
+        double pass_speed_quality =
+            sigmoid(pass.speed(), context.min_pass_speed, 0.2) *
+            (1 - sigmoid(pass.speed(), context.max_pass_speed, 0.2));
+
+        return static_pass_quality * friendly_pass_rating * enemy_pass_rating *
+               shoot_pass_rating * pass_speed_quality * in_region_quality;
+    }
+}  // namespace
+
 double ratePass(const World& world, const Pass& pass, const Rectangle& zone,
                 std::shared_ptr<const PassingConfig> passing_config)
 {
-    double static_pass_quality =
-        getStaticPositionQuality(world.field(), pass.receiverPoint(), passing_config);
+    return ratePass(createPassRatingContext(world, passing_config), pass, zone);
+}
 
-    double friendly_pass_rating =
-        ratePassFriendlyCapability(world.friendlyTeam(), pass, passing_config);
+std::vector<double> ratePasses(const World& world, const std::vector<Pass>& passes,
+                               const Rectangle& zone,
+                               std::shared_ptr<const PassingConfig> passing_config)
+{
+    const PassRatingContext context = createPassRatingContext(world, passing_config);
 
-    double enemy_pass_rating = ratePassEnemyRisk(world.enemyTeam(), pass, passing_config);
+    std::vector<double> ratings;
+    ratings.reserve(passes.size());
+    for (const Pass& pass : passes)
+    {
+        ratings.push_back(ratePass(context, pass, zone));
+    }
+    return ratings;
+}
 
-    double shoot_pass_rating =
-        ratePassShootScore(world.field(), world.enemyTeam(), pass, passing_config);
+std::array<double, NUM_PARAMS_TO_OPTIMIZE> approximateRatePassGradient(
+    const World& world, const Pass& pass, const Rectangle& zone,
+    const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& step_sizes,
+    std::shared_ptr<const PassingConfig> passing_config)
+{
+    const std::array<double, NUM_PARAMS_TO_OPTIMIZE> pass_array = pass.toPassArray();
 
-    double in_region_quality = rectangleSigmoid(zone, pass.receiverPoint(), 0.2);
+    // The first pass is the unperturbed pass, followed by the pass perturbed in each
+    // param of the pass array
+    std::vector<Pass> passes = {pass};
+    passes.reserve(NUM_PARAMS_TO_OPTIMIZE + 1);
+    for (size_t i = 0; i < NUM_PARAMS_TO_OPTIMIZE; i++)
+    {
+        auto perturbed_pass_array = pass_array;
+        perturbed_pass_array[i] += step_sizes[i];
+        passes.emplace_back(
+            Pass::fromPassArray(pass.passerPoint(), perturbed_pass_array));
+    }
 
-    // Place strict limits on the ball speed
-    double min_pass_speed     = passing_config->getMinPassSpeedMPerS()->value();
-    double max_pass_speed     = passing_config->getMaxPassSpeedMPerS()->value();
-    double pass_speed_quality = sigmoid(pass.speed(), min_pass_speed, 0.2) *
-                                (1 - sigmoid(pass.speed(), max_pass_speed, 0.2));
+    std::vector<double> ratings = ratePasses(world, passes, zone, passing_config);
 
-    return static_pass_quality * friendly_pass_rating * enemy_pass_rating *
-           shoot_pass_rating * pass_speed_quality * in_region_quality;
+    std::array<double, NUM_PARAMS_TO_OPTIMIZE> gradient = {0};
+    for (size_t i = 0; i < NUM_PARAMS_TO_OPTIMIZE; i++)
+    {
+        gradient[i] = (ratings[i + 1] - ratings[0]) / step_sizes[i];
+    }
+    return gradient;
 }
 
 double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zone,
@@ -78,226 +523,54 @@ double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zon
 double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass& pass,
                           std::shared_ptr<const PassingConfig> passing_config)
 {
-    double ideal_max_rotation_to_shoot_degrees =
-        passing_config->getIdealMaxRotationToShootDegrees()->value();
-
-    // Figure out the range of angles for which we have an open shot to the goal after
-    // receiving the pass
-    auto shot_opt = calcBestShotOnGoal(
-        Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg()), pass.receiverPoint(),
-        enemy_team.getAllRobots(), TeamType::ENEMY);
-
-    Angle open_angle_to_goal = Angle::zero();
-    Point shot_target        = field.enemyGoalCenter();
-    if (shot_opt && shot_opt->getOpenAngle().abs() > Angle::fromDegrees(0))
-    {
-        open_angle_to_goal = shot_opt->getOpenAngle();
-    }
-
-    // Figure out what the maximum open angle of the goal could be from the receiver pos.
-    Angle goal_angle = acuteAngle(field.enemyGoalpostNeg(), pass.receiverPoint(),
-                                  field.enemyGoalpostPos())
-                           .abs();
-    double net_percent_open = 0;
-    if (goal_angle > Angle::zero())
-    {
-        net_percent_open = open_angle_to_goal.toDegrees() / goal_angle.toDegrees();
-    }
-
-    // Create the shoot score by creating a sigmoid that goes to a large value as
-    // the section of net we're shooting on approaches 100% (ie. completely open)
-    double shot_openness_score = sigmoid(net_percent_open, 0.45, 0.95);
-
-    // Prefer angles where the robot does not have to turn much after receiving the
-    // pass to take the shot (or equivalently the shot deflection angle)
-    //
-    // Receiver robots on the friendly side, almost always, need to rotate a full 180
-    // degrees to shoot on net. So we relax that requirement for both receiver and ball
-    // locations on the friendly side
-    //
-    // TODO (#1987) This creates a very steep slope, find a better way to do this
-    if (pass.receiverPoint().x() < 0 || pass.passerPoint().x() < 0)
-    {
-        ideal_max_rotation_to_shoot_degrees = 180;
-    }
-    Angle rotation_to_shot_target_after_pass = pass.receiverOrientation().minDiff(
-        (shot_target - pass.receiverPoint()).orientation());
-    double required_rotation_for_shot_score =
-        1 - sigmoid(rotation_to_shot_target_after_pass.abs().toDegrees(),
-                    ideal_max_rotation_to_shoot_degrees, 4);
-
-    return shot_openness_score * required_rotation_for_shot_score;
+    return ratePassShootScore(
+        field, enemy_team.getAllRobots(), pass,
+        passing_config->getIdealMaxRotationToShootDegrees()->value());
 }
 
 double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
                          std::shared_ptr<const PassingConfig> passing_config)
 {
-    double enemy_proximity_importance =
-        passing_config->getEnemyProximityImportance()->value();
-
-    // Calculate a risk score based on the distance of the enemy robots from the receive
-    // point, based on an exponential function of the distance of each robot from the
-    // receiver point
-    auto enemy_robots                    = enemy_team.getAllRobots();
-    double enemy_receiver_proximity_risk = 1;
-    for (const Robot& enemy : enemy_team.getAllRobots())
-    {
-        double dist = (pass.receiverPoint() - enemy.position()).length();
-        enemy_receiver_proximity_risk *=
-            enemy_proximity_importance * std::exp(-dist * dist);
-    }
-    if (enemy_robots.empty())
-    {
-        enemy_receiver_proximity_risk = 0;
-    }
-
-    double intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_config);
-
-    // We want to rate a pass more highly if it is lower risk, so subtract from 1
-    return 1 - std::max(intercept_risk, enemy_receiver_proximity_risk);
+    return ratePassEnemyRisk(
+        enemy_team.getAllRobots(), pass,
+        passing_config->getEnemyProximityImportance()->value(),
+        Duration::fromSeconds(passing_config->getEnemyReactionTime()->value()));
 }
 
 double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
                               std::shared_ptr<const PassingConfig> passing_config)
 {
-    // Return the highest risk for all the enemy robots, if there are any
-    const std::vector<Robot>& enemy_robots = enemy_team.getAllRobots();
-    if (enemy_robots.empty())
-    {
-        return 0;
-    }
-    std::vector<double> enemy_intercept_risks(enemy_robots.size());
-    std::transform(
-        enemy_robots.begin(), enemy_robots.end(), enemy_intercept_risks.begin(),
-        [&](Robot robot) { return calculateInterceptRisk(robot, pass, passing_config); });
-    return *std::max_element(enemy_intercept_risks.begin(), enemy_intercept_risks.end());
+    return calculateInterceptRisk(
+        enemy_team.getAllRobots(), pass,
+        Duration::fromSeconds(passing_config->getEnemyReactionTime()->value()));
 }
 
 double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
                               std::shared_ptr<const PassingConfig> passing_config)
 {
-    // We estimate the intercept by the risk that the robot will get to the closest
-    // point on the pass before the ball, and by the risk that the robot will get to
-    // the reception point before the ball. We take the greater of these two risks.
-
-    // If the enemy cannot intercept the pass at BOTH the closest point on the pass and
-    // the receiver point for the pass, then it is guaranteed that it will not be
-    // able to intercept the pass anywhere.
-
-    // Figure out how long the enemy robot and ball will take to reach the closest
-    // point on the pass to the enemy's current position
-    Point closest_point_on_pass_to_robot = closestPoint(
-        enemy_robot.position(), Segment(pass.passerPoint(), pass.receiverPoint()));
-    Duration enemy_robot_time_to_closest_pass_point = getTimeToPositionForRobot(
-        enemy_robot.position(), closest_point_on_pass_to_robot,
-        ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND,
-        ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED, ROBOT_MAX_RADIUS_METERS);
-    Duration ball_time_to_closest_pass_point = Duration::fromSeconds(
-        (closest_point_on_pass_to_robot - pass.passerPoint()).length() / pass.speed());
-
-    // Check for division by 0
-    if (pass.speed() == 0)
-    {
-        ball_time_to_closest_pass_point =
-            Duration::fromSeconds(std::numeric_limits<int>::max());
-    }
-
-    // Figure out how long the enemy robot and ball will take to reach the receive point
-    // for the pass.
-    Duration enemy_robot_time_to_pass_receive_position = getTimeToPositionForRobot(
-        enemy_robot.position(), pass.receiverPoint(),
-        ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND,
-        ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED, ROBOT_MAX_RADIUS_METERS);
-    Duration ball_time_to_pass_receive_position = pass.estimatePassDuration();
-
-    Duration enemy_reaction_time =
-        Duration::fromSeconds(passing_config->getEnemyReactionTime()->value());
-
-    double robot_ball_time_diff_at_closest_pass_point =
-        ((enemy_robot_time_to_closest_pass_point + enemy_reaction_time) -
-         (ball_time_to_closest_pass_point))
-            .toSeconds();
-    double robot_ball_time_diff_at_pass_receive_point =
-        ((enemy_robot_time_to_pass_receive_position + enemy_reaction_time) -
-         (ball_time_to_pass_receive_position))
-            .toSeconds();
-
-    double min_time_diff = std::min(robot_ball_time_diff_at_closest_pass_point,
-                                    robot_ball_time_diff_at_pass_receive_point);
-
-    // Whether or not the enemy will be able to intercept the pass can be determined
-    // by whether or not they will be able to reach the pass receive position before
-    // the pass does. As such, we place the time difference between the robot and ball
-    // on a sigmoid that is centered at 0, and goes to 1 at positive values, 0 at
-    // negative values.
-    return 1 - sigmoid(min_time_diff, 0, 1);
+    return calculateInterceptRisk(
+        enemy_robot, pass,
+        Duration::fromSeconds(passing_config->getEnemyReactionTime()->value()));
 }
 
-double ratePassFriendlyCapability(Team friendly_team, const Pass& pass,
+double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
                                   std::shared_ptr<const PassingConfig> passing_config)
 {
-    // We need at least one robot to pass to
-    if (friendly_team.getAllRobots().empty())
-    {
-        return 0;
-    }
-
-    // Special case where pass speed is 0
-    if (pass.speed() == 0)
-    {
-        return 0;
-    }
-
-    // Get the robot that is closest to where the pass would be received
-    Robot best_receiver = friendly_team.getAllRobots()[0];
-    for (const Robot& robot : friendly_team.getAllRobots())
-    {
-        double distance = (robot.position() - pass.receiverPoint()).length();
-        double curr_best_distance =
-            (best_receiver.position() - pass.receiverPoint()).length();
-        if (distance < curr_best_distance)
-        {
-            best_receiver = robot;
-        }
-    }
-
-    // Figure out what time the robot would have to receive the ball at
-    Duration ball_travel_time = Duration::fromSeconds(
-        (pass.receiverPoint() - pass.passerPoint()).length() / pass.speed());
-    Timestamp receive_time = best_receiver.timestamp() + ball_travel_time;
-
-    // Figure out how long it would take our robot to get there
-    Duration min_robot_travel_time = getTimeToPositionForRobot(
-        best_receiver.position(), pass.receiverPoint(), ROBOT_MAX_SPEED_METERS_PER_SECOND,
-        ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED);
-    Timestamp earliest_time_to_receive_point =
-        best_receiver.timestamp() + min_robot_travel_time;
-
-    // Figure out what angle the robot would have to be at to receive the ball
-    Angle receive_angle = (pass.passerPoint() - best_receiver.position()).orientation();
-    Duration time_to_receive_angle = getTimeToOrientationForRobot(
-        best_receiver.orientation(), receive_angle, ROBOT_MAX_ANG_SPEED_RAD_PER_SECOND,
-        ROBOT_MAX_ANG_ACCELERATION_RAD_PER_SECOND_SQUARED);
-    Timestamp earliest_time_to_receive_angle =
-        best_receiver.timestamp() + time_to_receive_angle;
-
-    // Figure out if rotation or moving will take us longer
-    Timestamp latest_time_to_reciever_state =
-        std::max(earliest_time_to_receive_angle, earliest_time_to_receive_point);
-
-    // Create a sigmoid that goes to 0 as the time required to get to the reception
-    // point exceeds the time we would need to get there by
-    double sigmoid_width                  = 0.4;
-    double time_to_receiver_state_slack_s = 0.25;
-
-    return sigmoid(
-        receive_time.toSeconds(),
-        latest_time_to_reciever_state.toSeconds() + time_to_receiver_state_slack_s,
-        sigmoid_width);
+    loadFriendlyRobotStates(friendly_team.getAllRobots());
+    return ratePassFriendlyCapability(friendly_team.getAllRobots(),
+                                      friendly_robot_positions, friendly_robot_velocities,
+                                      pass);
 }
 
 double getStaticPositionQuality(const Field& field, const Point& position,
                                 std::shared_ptr<const PassingConfig> passing_config)
+{
+    return getStaticPositionQualities(field, {position}, passing_config).front();
+}
+
+std::vector<double> getStaticPositionQualities(
+    const Field& field, const std::vector<Point>& positions,
+    std::shared_ptr<const PassingConfig> passing_config)
 {
     // This constant is used to determine how steep the sigmoid slopes below are
     static const double sig_width = 0.1;
@@ -315,20 +588,31 @@ double getStaticPositionQuality(const Field& field, const Point& position,
     Rectangle reduced_size_field(
         Point(-half_field_length + x_offset, -half_field_width + y_offset),
         Point(half_field_length - x_offset, half_field_width - y_offset));
-    double on_field_quality = rectangleSigmoid(reduced_size_field, position, sig_width);
-
-    // Add a negative weight for positions closer to our goal
-    Vector vec_to_friendly_goal = Vector(field.friendlyGoalCenter().x() - position.x(),
-                                         field.friendlyGoalCenter().y() - position.y());
-    double distance_to_friendly_goal = vec_to_friendly_goal.length();
-    double near_friendly_goal_quality =
-        (1 -
-         std::exp(-friendly_goal_weight * (std::pow(5, -2 + distance_to_friendly_goal))));
-
-    // Add a strong negative weight for positions within the enemy defense area, as we
-    // cannot pass there
-    double in_enemy_defense_area_quality =
-        1 - rectangleSigmoid(field.enemyDefenseArea(), position, sig_width);
-
-    return on_field_quality * near_friendly_goal_quality * in_enemy_defense_area_quality;
+    Rectangle enemy_defense_area = field.enemyDefenseArea();
+    Point friendly_goal_center   = field.friendlyGoalCenter();
+
+    std::vector<double> qualities;
+    qualities.reserve(positions.size());
+    for (const Point& position : positions)
+    {
+        double on_field_quality =
+            rectangleSigmoid(reduced_size_field, position, sig_width);
+
+        // Add a negative weight for positions closer to our goal
+        Vector vec_to_friendly_goal      = Vector(friendly_goal_center.x() - position.x(),
+                                             friendly_goal_center.y() - position.y());
+        double distance_to_friendly_goal = vec_to_friendly_goal.length();
+        double near_friendly_goal_quality =
+            (1 - std::exp(-friendly_goal_weight *
+                          (std::pow(5, -2 + distance_to_friendly_goal))));
+
+        // Add a strong negative weight for positions within the enemy defense area, as
+        // we cannot pass there
+        double in_enemy_defense_area_quality =
+            1 - rectangleSigmoid(enemy_defense_area, position, sig_width);
+
+        qualities.push_back(on_field_quality * near_friendly_goal_quality *
+                            in_enemy_defense_area_quality);
+    }
+    return qualities;
 }
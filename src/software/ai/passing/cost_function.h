@@ -24,6 +24,44 @@
 double ratePass(const World& world, const Pass& pass, const Rectangle& zone,
                 std::shared_ptr<const PassingConfig> passing_config);
 
+/**
+ * Calculate the quality of each of the given passes
+ *
+ * This gives the same ratings as calling ratePass on each pass, and is used by
+ * optimizers that rate a whole population of passes at once
+ *
+ * @param world The world in which to rate the passes
+ * @param passes The passes to rate
+ * @param zone The zone these passes are constrained to
+ * @param passing_config The passing config used for tuning
+ *
+ * @return The quality of each pass, in the same order as the given passes (see
+ *         ratePass)
+ */
+std::vector<double> ratePasses(const World& world, const std::vector<Pass>& passes,
+                               const Rectangle& zone,
+                               std::shared_ptr<const PassingConfig> passing_config);
+
+/**
+ * Approximates the gradient of ratePass with forward differences, with respect to each
+ * param in the pass array of the given pass (see Pass::toPassArray)
+ *
+ * The pass and every perturbed pass are rated with a single call to ratePasses
+ *
+ * @param world The world in which to rate the pass
+ * @param pass The pass to find the gradient of the rating at
+ * @param zone The zone this pass is constrained to
+ * @param step_sizes The step to take in each param of the pass array
+ * @param passing_config The passing config used for tuning
+ *
+ * @return The partial derivative of the rating of the pass with respect to each param
+ *         of its pass array
+ */
+std::array<double, NUM_PARAMS_TO_OPTIMIZE> approximateRatePassGradient(
+    const World& world, const Pass& pass, const Rectangle& zone,
+    const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& step_sizes,
+    std::shared_ptr<const PassingConfig> passing_config);
+
 /**
  * Calculate the quality of a given zone
  *
@@ -112,7 +150,7 @@ double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
  *         friendly team to receive the given pass, with 1 being very likely, 0
  *         being impossible
  */
-double ratePassFriendlyCapability(Team friendly_team, const Pass& pass,
+double ratePassFriendlyCapability(const Team& friendly_team, const Pass& pass,
                                   std::shared_ptr<const PassingConfig> passing_config);
 
 /**
@@ -131,3 +169,21 @@ double ratePassFriendlyCapability(Team friendly_team, const Pass& pass,
  */
 double getStaticPositionQuality(const Field& field, const Point& position,
                                 std::shared_ptr<const PassingConfig> passing_config);
+
+/**
+ * Calculates the static position quality for each of the given positions on a given
+ * field
+ *
+ * This gives the same values as calling getStaticPositionQuality on each position,
+ * but only reads the passing config and builds the field regions once
+ *
+ * @param field The field on which to calculate the static position quality
+ * @param positions The positions on the field at which to calculate the quality
+ * @param passing_config The passing config used for tuning
+ *
+ * @return The quality of each position, in the same order as the given positions (see
+ *         getStaticPositionQuality)
+ */
+std::vector<double> getStaticPositionQualities(
+    const Field& field, const std::vector<Point>& positions,
+    std::shared_ptr<const PassingConfig> passing_config);
@@ -408,6 +408,78 @@ TEST_F(PassingEvaluationTest, DISABLED_ratePass_attempting_to_pass_and_receive_n
     EXPECT_LE(pass_rating, 1.0);
 }
 
+TEST_F(PassingEvaluationTest, ratePasses_matches_ratePass)
+{
+    World world = ::TestUtil::createBlankTestingWorld();
+    Team friendly_team(Duration::fromSeconds(10));
+    friendly_team.updateRobots({
+        Robot(1, {-0.5, 1}, {0.5, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(2, {2, -1}, {0, 0}, Angle::half(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+    });
+    world.updateFriendlyTeamState(friendly_team);
+    Team enemy_team(Duration::fromSeconds(10));
+    enemy_team.updateRobots({
+        Robot(0, {1, 0.5}, {0, -1}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+        Robot(3, {3, -0.5}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+    });
+    world.updateEnemyTeamState(enemy_team);
+
+    std::vector<Pass> passes = {
+        Pass({-1, 0}, {-0.5, 1}, avg_desired_pass_speed),
+        Pass({-1, 0}, {2, -1}, avg_desired_pass_speed),
+        Pass({-1, 0}, {3, 1}, 2.0),
+        Pass({-1, 0}, {1, 0.4}, 5.0),
+    };
+
+    std::vector<double> ratings =
+        ratePasses(world, passes, *entire_field, passing_config);
+
+    ASSERT_EQ(passes.size(), ratings.size());
+    for (size_t i = 0; i < passes.size(); i++)
+    {
+        EXPECT_DOUBLE_EQ(ratePass(world, passes[i], *entire_field, passing_config),
+                         ratings[i]);
+    }
+}
+
+TEST_F(PassingEvaluationTest, approximateRatePassGradient_matches_forward_differences)
+{
+    Pass pass({2, 2}, {0.5, -0.5}, avg_desired_pass_speed);
+
+    World world = ::TestUtil::createBlankTestingWorld();
+    Team friendly_team(Duration::fromSeconds(10));
+    friendly_team.updateRobots({
+        Robot(1, {0, 0}, {0, 0}, pass.receiverOrientation(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+    });
+    world.updateFriendlyTeamState(friendly_team);
+    Team enemy_team(Duration::fromSeconds(10));
+    enemy_team.updateRobots({
+        Robot(0, {1.2, 0.3}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+    });
+    world.updateEnemyTeamState(enemy_team);
+
+    const std::array<double, NUM_PARAMS_TO_OPTIMIZE> step_sizes = {1e-4, 2e-4, 1e-5};
+    auto gradient = approximateRatePassGradient(world, pass, *entire_field, step_sizes,
+                                                passing_config);
+
+    double rating = ratePass(world, pass, *entire_field, passing_config);
+    for (size_t i = 0; i < NUM_PARAMS_TO_OPTIMIZE; i++)
+    {
+        auto pass_array = pass.toPassArray();
+        pass_array[i] += step_sizes[i];
+        double perturbed_rating =
+            ratePass(world, Pass::fromPassArray(pass.passerPoint(), pass_array),
+                     *entire_field, passing_config);
+        EXPECT_DOUBLE_EQ((perturbed_rating - rating) / step_sizes[i], gradient[i]);
+    }
+}
+
 TEST_F(PassingEvaluationTest, ratePassShootScore_no_robots_and_directly_facing_goal)
 {
     // No robots on the field, we receive the pass and are directly facing the goal
@@ -833,6 +905,50 @@ TEST_F(PassingEvaluationTest,
 }
 
 
+TEST_F(PassingEvaluationTest,
+       ratePassFriendlyCapability_moving_robot_beats_closer_stationary_robot)
+{
+    // The stationary robot is closer to the reception point, but the other robot is
+    // already moving towards it at full speed, so it would get there first. Both
+    // robots are facing the passer, so they don't need to turn
+    Pass pass({0, 0}, {3, 0}, 1.3);
+    Robot stationary_robot(0, {3, -2.9}, {0, 0},
+                           (pass.passerPoint() - Point(3, -2.9)).orientation(),
+                           AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Robot moving_robot(1, {3, 3}, {0, -2},
+                       (pass.passerPoint() - Point(3, 3)).orientation(),
+                       AngularVelocity::zero(), Timestamp::fromSeconds(0));
+
+    Team stationary_team({stationary_robot}, Duration::fromSeconds(10));
+    EXPECT_LE(ratePassFriendlyCapability(stationary_team, pass, passing_config), 0.3);
+
+    Team team({stationary_robot, moving_robot}, Duration::fromSeconds(10));
+    EXPECT_GE(ratePassFriendlyCapability(team, pass, passing_config), 0.9);
+    EXPECT_LE(ratePassFriendlyCapability(team, pass, passing_config), 1.0);
+}
+
+TEST_F(PassingEvaluationTest,
+       ratePassFriendlyCapability_robot_moving_away_loses_to_further_stationary_robot)
+{
+    // The moving robot is closer to the reception point, but it is moving away from it
+    // at full speed and would have to stop and come back, so the stationary robot would
+    // get there first. Both robots are facing the passer, so they don't need to turn
+    Pass pass({0, 0}, {3, 0}, 1.5);
+    Robot moving_robot(0, {3, 0.5}, {0, 2},
+                       (pass.passerPoint() - Point(3, 0.5)).orientation(),
+                       AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Robot stationary_robot(1, {3, -1}, {0, 0},
+                           (pass.passerPoint() - Point(3, -1)).orientation(),
+                           AngularVelocity::zero(), Timestamp::fromSeconds(0));
+
+    Team moving_team({moving_robot}, Duration::fromSeconds(10));
+    EXPECT_LE(ratePassFriendlyCapability(moving_team, pass, passing_config), 0.1);
+
+    Team team({moving_robot, stationary_robot}, Duration::fromSeconds(10));
+    EXPECT_GE(ratePassFriendlyCapability(team, pass, passing_config), 0.9);
+    EXPECT_LE(ratePassFriendlyCapability(team, pass, passing_config), 1.0);
+}
+
 TEST_F(PassingEvaluationTest, getStaticPositionQuality_on_field_quality)
 {
     Field f = Field::createSSLDivisionBField();
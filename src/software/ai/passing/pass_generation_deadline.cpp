@@ -0,0 +1,78 @@
+#include "software/ai/passing/pass_generation_deadline.h"
+
+#include <stdexcept>
+
+namespace
+{
+    thread_local ScopedPassGenerationDeadline* current_deadline = nullptr;
+}  // namespace
+
+ScopedPassGenerationDeadline::ScopedPassGenerationDeadline(
+    std::chrono::steady_clock::time_point deadline,
+    unsigned int expected_num_pass_generations)
+    : deadline(deadline),
+      expected_num_pass_generations(expected_num_pass_generations),
+      num_pass_generations(0),
+      pass_generation_start_time(),
+      pass_generation_duration(0),
+      previous_deadline(current_deadline)
+{
+    if (expected_num_pass_generations == 0)
+    {
+        throw std::invalid_argument(
+            "ScopedPassGenerationDeadline must expect at least one pass generation");
+    }
+    current_deadline = this;
+}
+
+ScopedPassGenerationDeadline::~ScopedPassGenerationDeadline()
+{
+    current_deadline = previous_deadline;
+}
+
+std::optional<std::chrono::steady_clock::time_point>
+ScopedPassGenerationDeadline::startPassGeneration(
+    std::chrono::steady_clock::time_point now)
+{
+    if (!current_deadline)
+    {
+        return std::nullopt;
+    }
+
+    unsigned int num_remaining_pass_generations = 1;
+    if (current_deadline->num_pass_generations <
+        current_deadline->expected_num_pass_generations)
+    {
+        num_remaining_pass_generations = current_deadline->expected_num_pass_generations -
+                                         current_deadline->num_pass_generations;
+    }
+    current_deadline->num_pass_generations++;
+    current_deadline->pass_generation_start_time = now;
+
+    if (now >= current_deadline->deadline)
+    {
+        return current_deadline->deadline;
+    }
+    return now + (current_deadline->deadline - now) / num_remaining_pass_generations;
+}
+
+void ScopedPassGenerationDeadline::finishPassGeneration(
+    std::chrono::steady_clock::time_point now)
+{
+    if (current_deadline)
+    {
+        current_deadline->pass_generation_duration +=
+            now - current_deadline->pass_generation_start_time;
+    }
+}
+
+unsigned int ScopedPassGenerationDeadline::getNumPassGenerations() const
+{
+    return num_pass_generations;
+}
+
+std::chrono::steady_clock::duration
+ScopedPassGenerationDeadline::getPassGenerationDuration() const
+{
+    return pass_generation_duration;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+/**
+ * Sets the time that every PassGenerator on the calling thread must finish generating
+ * passes by, for as long as this object exists, restoring the previous deadline when
+ * it is destroyed.
+ *
+ * This lets the AI give pass generation whatever time is left in its tick, without
+ * passing the deadline through every Play that uses a PassGenerator. While a deadline
+ * is set, PassGenerator::generatePassEvaluation(world) keeps improving passes until
+ * the end of its share of the time left (see startPassGeneration and PassGenerator
+ * for details).
+ *
+ * Passes may be generated more than once before the deadline (ex. a Play that
+ * generates passes twice per tick), so the time until the deadline is shared between
+ * the number of pass generations that are expected before it.
+ */
+class ScopedPassGenerationDeadline
+{
+   public:
+    ScopedPassGenerationDeadline() = delete;
+
+    /**
+     * Sets the pass generation deadline of the calling thread
+     *
+     * @param deadline The time that all pass generation must finish by
+     * @param expected_num_pass_generations The number of times passes are expected to
+     * be generated before the deadline, ex. how many times they were generated in the
+     * previous tick. This must be at least 1
+     *
+     * @throws std::invalid_argument if expected_num_pass_generations is 0
+     */
+    explicit ScopedPassGenerationDeadline(std::chrono::steady_clock::time_point deadline,
+                                          unsigned int expected_num_pass_generations = 1);
+
+    // Copying this class is not permitted, since the previous deadline must only be
+    // restored once
+    ScopedPassGenerationDeadline(const ScopedPassGenerationDeadline&) = delete;
+    ScopedPassGenerationDeadline& operator=(const ScopedPassGenerationDeadline&) = delete;
+
+    ~ScopedPassGenerationDeadline();
+
+    /**
+     * Starts a pass generation on the calling thread, and returns the time that it
+     * must finish by
+     *
+     * The time left until the deadline is shared evenly between this pass generation
+     * and the pass generations that are still expected after it. If more pass
+     * generations start than were expected, the extra ones get all the time left.
+     *
+     * @param now The current time
+     *
+     * @return the time that this pass generation must finish by, or std::nullopt if
+     * the calling thread doesn't have a deadline
+     */
+    static std::optional<std::chrono::steady_clock::time_point> startPassGeneration(
+        std::chrono::steady_clock::time_point now);
+
+    /**
+     * Finishes the pass generation most recently started on the calling thread,
+     * counting the time since it started towards getPassGenerationDuration. Does
+     * nothing if the calling thread doesn't have a deadline
+     *
+     * @param now The current time
+     */
+    static void finishPassGeneration(std::chrono::steady_clock::time_point now);
+
+    /**
+     * Returns the number of pass generations started while this was the deadline of
+     * the calling thread
+     *
+     * @return the number of pass generations started
+     */
+    unsigned int getNumPassGenerations() const;
+
+    /**
+     * Returns the total time between starting and finishing each pass generation
+     * while this was the deadline of the calling thread
+     *
+     * @return the time spent generating passes
+     */
+    std::chrono::steady_clock::duration getPassGenerationDuration() const;
+
+   private:
+    std::chrono::steady_clock::time_point deadline;
+    unsigned int expected_num_pass_generations;
+    unsigned int num_pass_generations;
+    std::chrono::steady_clock::time_point pass_generation_start_time;
+    std::chrono::steady_clock::duration pass_generation_duration;
+
+    // The deadline of the calling thread before this one was created
+    ScopedPassGenerationDeadline* previous_deadline;
+};
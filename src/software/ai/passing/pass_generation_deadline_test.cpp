@@ -0,0 +1,82 @@
+#include "software/ai/passing/pass_generation_deadline.h"
+
+#include <gtest/gtest.h>
+
+class ScopedPassGenerationDeadlineTest : public testing::Test
+{
+   protected:
+    std::chrono::steady_clock::time_point start_time;
+};
+
+TEST_F(ScopedPassGenerationDeadlineTest, no_deadline)
+{
+    EXPECT_EQ(std::nullopt,
+              ScopedPassGenerationDeadline::startPassGeneration(start_time));
+}
+
+TEST_F(ScopedPassGenerationDeadlineTest, zero_expected_pass_generations)
+{
+    EXPECT_THROW(ScopedPassGenerationDeadline(start_time, 0), std::invalid_argument);
+}
+
+TEST_F(ScopedPassGenerationDeadlineTest, time_left_is_shared_between_expected_generations)
+{
+    ScopedPassGenerationDeadline scoped_deadline(
+        start_time + std::chrono::milliseconds(30), 3);
+
+    EXPECT_EQ(start_time + std::chrono::milliseconds(10),
+              ScopedPassGenerationDeadline::startPassGeneration(start_time));
+    EXPECT_EQ(start_time + std::chrono::milliseconds(20),
+              ScopedPassGenerationDeadline::startPassGeneration(
+                  start_time + std::chrono::milliseconds(10)));
+
+    // The last expected pass generation gets all the time left, and so does any pass
+    // generation after it
+    EXPECT_EQ(start_time + std::chrono::milliseconds(30),
+              ScopedPassGenerationDeadline::startPassGeneration(
+                  start_time + std::chrono::milliseconds(22)));
+    EXPECT_EQ(start_time + std::chrono::milliseconds(30),
+              ScopedPassGenerationDeadline::startPassGeneration(
+                  start_time + std::chrono::milliseconds(25)));
+    EXPECT_EQ(4, scoped_deadline.getNumPassGenerations());
+}
+
+TEST_F(ScopedPassGenerationDeadlineTest, deadline_in_the_past)
+{
+    ScopedPassGenerationDeadline scoped_deadline(start_time, 2);
+
+    EXPECT_EQ(start_time, ScopedPassGenerationDeadline::startPassGeneration(
+                              start_time + std::chrono::milliseconds(5)));
+}
+
+TEST_F(ScopedPassGenerationDeadlineTest, counts_time_spent_generating_passes)
+{
+    ScopedPassGenerationDeadline scoped_deadline(
+        start_time + std::chrono::milliseconds(30), 2);
+
+    ScopedPassGenerationDeadline::startPassGeneration(start_time);
+    ScopedPassGenerationDeadline::finishPassGeneration(start_time +
+                                                       std::chrono::milliseconds(4));
+    ScopedPassGenerationDeadline::startPassGeneration(start_time +
+                                                      std::chrono::milliseconds(10));
+    ScopedPassGenerationDeadline::finishPassGeneration(start_time +
+                                                       std::chrono::milliseconds(13));
+
+    EXPECT_EQ(std::chrono::milliseconds(7), scoped_deadline.getPassGenerationDuration());
+}
+
+TEST_F(ScopedPassGenerationDeadlineTest, restores_previous_deadline)
+{
+    ScopedPassGenerationDeadline outer_deadline(start_time +
+                                                std::chrono::milliseconds(30));
+    {
+        ScopedPassGenerationDeadline inner_deadline(start_time +
+                                                    std::chrono::milliseconds(10));
+        EXPECT_EQ(start_time + std::chrono::milliseconds(10),
+                  ScopedPassGenerationDeadline::startPassGeneration(start_time));
+        EXPECT_EQ(1, inner_deadline.getNumPassGenerations());
+    }
+    EXPECT_EQ(start_time + std::chrono::milliseconds(30),
+              ScopedPassGenerationDeadline::startPassGeneration(start_time));
+    EXPECT_EQ(1, outer_deadline.getNumPassGenerations());
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <functional>
 #include <mutex>
 #include <random>
 #include <thread>
@@ -8,7 +10,10 @@
 #include "software/ai/passing/cost_function.h"
 #include "software/ai/passing/pass.h"
 #include "software/ai/passing/pass_evaluation.h"
+#include "software/ai/passing/pass_generation_deadline.h"
+#include "software/ai/passing/pass_optimizer.h"
 #include "software/ai/passing/pass_with_rating.h"
+#include "software/optimization/cross_entropy_optimizer.h"
 #include "software/optimization/gradient_descent_optimizer.h"
 #include "software/time/timestamp.h"
 #include "software/world/world.h"
@@ -19,6 +24,17 @@ static const int PASS_GENERATOR_SEED = 14;
 template <class ZoneEnum>
 using ZonePassMap = std::unordered_map<ZoneEnum, PassWithRating>;
 
+/**
+ * Statistics about the most recent call to PassGenerator::generatePassEvaluation
+ */
+struct PassGenerationStats
+{
+    // The number of times a pass was rated
+    unsigned int num_pass_evaluations;
+    // The number of times the optimizer was run to look for a better pass in a zone
+    unsigned int num_zones_optimized;
+};
+
 /**
  * This class is responsible for generating passes for us to perform
  */
@@ -29,6 +45,10 @@ class PassGenerator
                   "PassGenerator: ZoneEnum must be a zone id enum");
 
    public:
+    // A function returning the current time, which is used to check pass generation
+    // deadlines
+    using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
     /**
      * Creates a new PassGenerator with the given pitch_division.
      *
@@ -36,10 +56,14 @@ class PassGenerator
      * in each zone after the pitch has been divided.
      *
      * @param pitch_division The pitch division to use when looking for passes
+     * @param passing_config The passing config used for tuning
+     * @param clock The clock used to check pass generation deadlines, which can be
+     * replaced in tests so that generating passes with a deadline is deterministic
      */
     explicit PassGenerator(
         std::shared_ptr<const FieldPitchDivision<ZoneEnum>> pitch_division,
-        std::shared_ptr<const PassingConfig> passing_config);
+        std::shared_ptr<const PassingConfig> passing_config,
+        Clock clock = std::chrono::steady_clock::now);
 
     /**
      * Creates a PassEvaluation given a world and a field pitch division.
@@ -56,12 +80,45 @@ class PassGenerator
      * be done with executables built in "Release" in order to maximize performance
      * ("Release" can be 2-10x faster then "Debug").
      *
+     * If a ScopedPassGenerationDeadline is active on the calling thread, this keeps
+     * looking for better passes until the end of the share of the time left that it
+     * gives this call instead (see the overload below). Otherwise, every zone is
+     * optimized once.
+     *
      * @param world The world to compute the pass evaluation on
      *
      * @return The best currently known pass and the rating of that pass (in [0-1])
      */
     PassEvaluation<ZoneEnum> generatePassEvaluation(const World& world);
 
+    /**
+     * Creates a PassEvaluation given a world, looking for better passes until the
+     * given deadline.
+     *
+     * The current best passes are always re-rated on the given world, even if the
+     * deadline has already passed. After that, the zones are optimized one at a time
+     * until the deadline, continuing from the zone after the last one optimized in the
+     * previous call, so that every zone is improved over a few ticks even if there is
+     * only time to optimize some of them each tick.
+     *
+     * The deadline is only checked between zones, so this may run past it by the
+     * time it takes to optimize one zone.
+     *
+     * @param world The world to compute the pass evaluation on
+     * @param deadline The time to stop looking for better passes at
+     *
+     * @return The best currently known pass and the rating of that pass (in [0-1])
+     */
+    PassEvaluation<ZoneEnum> generatePassEvaluation(
+        const World& world, std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * Returns statistics about the most recent call to generatePassEvaluation
+     *
+     * @return statistics about the most recent call to generatePassEvaluation
+     */
+    PassGenerationStats getPassGenerationStats() const;
+
 
    private:
     // Weights used to normalize the parameters that we pass to GradientDescent
@@ -75,6 +132,22 @@ class PassGenerator
     std::array<double, NUM_PARAMS_TO_OPTIMIZE> optimizer_param_weights = {
         PASS_SPACE_WEIGHT, PASS_SPACE_WEIGHT, PASS_SPEED_WEIGHT};
 
+    // Gradient descent stops early once a step of one weight in any param (see
+    // optimizer_param_weights) would change the rating of the pass by less than this,
+    // since the pass is then on a flat part of the rating function. This is tiny
+    // because Adam takes full size steps along any gradient, so even gentle slopes
+    // in the rating function lead to better passes
+    static constexpr double PASS_GRADIENT_CONVERGENCE_THRESHOLD = 1e-8;
+
+    // The initial spread of the passes sampled by the cross entropy optimizer around
+    // the best starting pass in each zone. Zones are roughly 1.5m x 2m, so this covers
+    // a good part of the zone while still mostly sampling near the starting pass
+    static constexpr double PASS_SPACE_STD_DEV = 0.3;
+    static constexpr double PASS_SPEED_STD_DEV = 0.3;
+    // The cross entropy optimizer only has a few ratings per zone each iteration, so
+    // we use small generations to refit the distribution more often
+    static constexpr unsigned int PASS_SEARCH_POPULATION_SIZE = 3;
+
     /**
      * Randomly samples a receive point across every zone and assigns a random
      * speed to each pass.
@@ -84,8 +157,19 @@ class PassGenerator
     ZonePassMap<ZoneEnum> samplePasses(const World& world);
 
     /**
-     * Given a map of passes, runs a gradient descent optimizer to find
-     * better passes.
+     * Randomly samples a receive point in the given zone and assigns a random speed
+     * to the pass
+     *
+     * @param world The world
+     * @param zone_id The zone to sample the receive point in
+     *
+     * @returns the sampled pass
+     */
+    Pass samplePassInZone(const World& world, ZoneEnum zone_id);
+
+    /**
+     * Given a map of passes, runs the optimizer selected in the passing config to
+     * find better passes.
      *
      * @param The world
      * @param The passes to be optimized mapped to the zone
@@ -94,6 +178,43 @@ class PassGenerator
     ZonePassMap<ZoneEnum> optimizePasses(const World& world,
                                          const ZonePassMap<ZoneEnum>& initial_passes);
 
+    /**
+     * Runs the optimizer selected in the passing config from the given pass
+     *
+     * @param world The world
+     * @param zone_id The zone the pass is in
+     * @param initial_pass The pass to start from
+     *
+     * @returns the optimized pass
+     */
+    Pass optimizePass(const World& world, ZoneEnum zone_id, const Pass& initial_pass);
+
+    /**
+     * Runs a few steps of gradient descent from the given pass, stopping early if the
+     * pass is on a flat part of the rating function
+     *
+     * @param world The world
+     * @param zone_id The zone the pass is in
+     * @param initial_pass The pass to start from
+     *
+     * @returns the optimized pass
+     */
+    Pass optimizePassWithGradientDescent(const World& world, ZoneEnum zone_id,
+                                         const Pass& initial_pass);
+
+    /**
+     * Searches for a better pass with the cross entropy method, starting from the
+     * given pass, the current best pass in the zone and random passes in the zone
+     *
+     * @param world The world
+     * @param zone_id The zone the pass is in
+     * @param initial_pass The pass to start from
+     *
+     * @returns the best pass found
+     */
+    Pass optimizePassWithCrossEntropy(const World& world, ZoneEnum zone_id,
+                                      const Pass& initial_pass);
+
     /**
      * Re-evaluates ratePass on the previous world's passes and keeps the better pass
      * w/ the higher score in current_best_passes_;
@@ -104,11 +225,38 @@ class PassGenerator
      */
     void updatePasses(const World& world, const ZonePassMap<ZoneEnum>& optimized_passes);
 
+    /**
+     * Moves the passer point of each current best pass to the ball, and re-rates
+     * them on the given world
+     *
+     * @param world The world
+     */
+    void rerateCurrentBestPasses(const World& world);
+
+    /**
+     * Rates the given pass, counting the evaluation in pass_generation_stats_
+     *
+     * @param world The world
+     * @param pass The pass to rate
+     * @param zone_id The zone the pass is in
+     *
+     * @returns the rating of the pass
+     */
+    double ratePassInZone(const World& world, const Pass& pass, ZoneEnum zone_id);
+
     // All the passes that we are currently trying to optimize in gradient descent
     ZonePassMap<ZoneEnum> current_best_passes_;
 
-    // The optimizer we're using to find passes
-    GradientDescentOptimizer<NUM_PARAMS_TO_OPTIMIZE> optimizer_;
+    // The index (in pitch_division_->getAllZoneIds()) of the zone that will be
+    // optimized first by the next call to generatePassEvaluation with a deadline
+    size_t next_zone_index_;
+
+    // Statistics about the most recent call to generatePassEvaluation
+    PassGenerationStats pass_generation_stats_;
+
+    // The optimizers we can use to find passes (see PassOptimizer)
+    GradientDescentOptimizer<NUM_PARAMS_TO_OPTIMIZE> gradient_descent_optimizer_;
+    CrossEntropyOptimizer<NUM_PARAMS_TO_OPTIMIZE> cross_entropy_optimizer_;
 
     // Pitch division
     std::shared_ptr<const FieldPitchDivision<ZoneEnum>> pitch_division_;
@@ -118,6 +266,9 @@ class PassGenerator
 
     // A random number generator for use across the class
     std::mt19937 random_num_gen_;
+
+    // The clock used to check pass generation deadlines
+    Clock clock_;
 };
 
 #include "software/ai/passing/pass_generator.tpp"
@@ -5,15 +5,25 @@
 #include "software/ai/passing/cost_function.h"
 #include "software/ai/passing/pass_evaluation.h"
 #include "software/ai/passing/pass_generator.h"
+#include "software/ai/profiler/ai_profiler.h"
 
 template <class ZoneEnum>
 PassGenerator<ZoneEnum>::PassGenerator(
     std::shared_ptr<const FieldPitchDivision<ZoneEnum>> pitch_division,
-    std::shared_ptr<const PassingConfig> passing_config)
-    : optimizer_(optimizer_param_weights),
+    std::shared_ptr<const PassingConfig> passing_config, Clock clock)
+    : next_zone_index_(0),
+      pass_generation_stats_{0, 0},
+      gradient_descent_optimizer_(optimizer_param_weights),
+      cross_entropy_optimizer_(
+          {PASS_SPACE_STD_DEV, PASS_SPACE_STD_DEV, PASS_SPEED_STD_DEV},
+          PASS_SEARCH_POPULATION_SIZE,
+          CrossEntropyOptimizer<NUM_PARAMS_TO_OPTIMIZE>::DEFAULT_ELITE_FRACTION,
+          CrossEntropyOptimizer<NUM_PARAMS_TO_OPTIMIZE>::DEFAULT_SMOOTHING_FACTOR,
+          PASS_GENERATOR_SEED),
       pitch_division_(pitch_division),
       passing_config_(passing_config),
-      random_num_gen_(PASS_GENERATOR_SEED)
+      random_num_gen_(PASS_GENERATOR_SEED),
+      clock_(clock)
 {
 }
 
@@ -21,6 +31,18 @@ template <class ZoneEnum>
 PassEvaluation<ZoneEnum> PassGenerator<ZoneEnum>::generatePassEvaluation(
     const World& world)
 {
+    auto deadline = ScopedPassGenerationDeadline::startPassGeneration(clock_());
+    if (deadline)
+    {
+        auto pass_evaluation = generatePassEvaluation(world, *deadline);
+        ScopedPassGenerationDeadline::finishPassGeneration(clock_());
+        return pass_evaluation;
+    }
+
+    PROFILE_SCOPE("PassGenerator::generatePassEvaluation");
+
+    pass_generation_stats_ = PassGenerationStats{0, 0};
+
     auto generated_passes = samplePasses(world);
     if (current_best_passes_.empty())
     {
@@ -35,70 +57,191 @@ PassEvaluation<ZoneEnum> PassGenerator<ZoneEnum>::generatePassEvaluation(
 }
 
 template <class ZoneEnum>
-ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::samplePasses(const World& world)
+PassEvaluation<ZoneEnum> PassGenerator<ZoneEnum>::generatePassEvaluation(
+    const World& world, std::chrono::steady_clock::time_point deadline)
 {
-    std::uniform_real_distribution speed_distribution(
-        passing_config_->getMinPassSpeedMPerS()->value(),
-        passing_config_->getMaxPassSpeedMPerS()->value());
+    PROFILE_SCOPE("PassGenerator::generatePassEvaluation");
+
+    pass_generation_stats_ = PassGenerationStats{0, 0};
 
+    // The current best passes have to be valid for this world no matter how little
+    // time we have, so this is done before checking the deadline
+    if (current_best_passes_.empty())
+    {
+        current_best_passes_ = samplePasses(world);
+    }
+    else
+    {
+        rerateCurrentBestPasses(world);
+    }
+
+    const auto& zone_ids = pitch_division_->getAllZoneIds();
+    while (clock_() < deadline)
+    {
+        ZoneEnum zone_id = zone_ids.at(next_zone_index_);
+        next_zone_index_ = (next_zone_index_ + 1) % zone_ids.size();
+
+        auto new_pass = optimizePass(world, zone_id, samplePassInZone(world, zone_id));
+        auto score    = ratePassInZone(world, new_pass, zone_id);
+        if (score > current_best_passes_.at(zone_id).rating)
+        {
+            current_best_passes_.at(zone_id) = PassWithRating{new_pass, score};
+        }
+        pass_generation_stats_.num_zones_optimized++;
+    }
+
+    return PassEvaluation<ZoneEnum>(pitch_division_, current_best_passes_,
+                                    passing_config_, world.getMostRecentTimestamp());
+}
+
+template <class ZoneEnum>
+PassGenerationStats PassGenerator<ZoneEnum>::getPassGenerationStats() const
+{
+    return pass_generation_stats_;
+}
+
+template <class ZoneEnum>
+ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::samplePasses(const World& world)
+{
     ZonePassMap<ZoneEnum> passes;
 
     // Randomly sample a pass in each zone
     for (ZoneEnum zone_id : pitch_division_->getAllZoneIds())
     {
-        auto zone = pitch_division_->getZone(zone_id);
-
-        std::uniform_real_distribution x_distribution(zone.xMin(), zone.xMax());
-        std::uniform_real_distribution y_distribution(zone.yMin(), zone.yMax());
-
-        auto pass =
-            Pass(world.ball().position(),
-                 Point(x_distribution(random_num_gen_), y_distribution(random_num_gen_)),
-                 speed_distribution(random_num_gen_));
+        auto pass = samplePassInZone(world, zone_id);
 
-        passes.emplace(
-            zone_id,
-            PassWithRating{pass, ratePass(world, pass, pitch_division_->getZone(zone_id),
-                                          passing_config_)});
+        passes.emplace(zone_id,
+                       PassWithRating{pass, ratePassInZone(world, pass, zone_id)});
     }
 
     return passes;
 }
 
+template <class ZoneEnum>
+Pass PassGenerator<ZoneEnum>::samplePassInZone(const World& world, ZoneEnum zone_id)
+{
+    std::uniform_real_distribution speed_distribution(
+        passing_config_->getMinPassSpeedMPerS()->value(),
+        passing_config_->getMaxPassSpeedMPerS()->value());
+
+    auto zone = pitch_division_->getZone(zone_id);
+
+    std::uniform_real_distribution x_distribution(zone.xMin(), zone.xMax());
+    std::uniform_real_distribution y_distribution(zone.yMin(), zone.yMax());
+
+    return Pass(world.ball().position(),
+                Point(x_distribution(random_num_gen_), y_distribution(random_num_gen_)),
+                speed_distribution(random_num_gen_));
+}
+
 template <class ZoneEnum>
 ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::optimizePasses(
     const World& world, const ZonePassMap<ZoneEnum>& generated_passes)
 {
-    // Run gradient descent to optimize the passes to for the requested number
-    // of iterations
+    PROFILE_SCOPE("PassGenerator::optimizePasses");
+
     ZonePassMap<ZoneEnum> optimized_passes;
 
     for (ZoneEnum zone_id : pitch_division_->getAllZoneIds())
     {
-        // The objective function we minimize in gradient descent to improve each pass
-        // that we're optimizing
-        const auto objective_function =
-            [this, &world,
-             zone_id](const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& pass_array) {
-                return ratePass(world,
-                                Pass::fromPassArray(world.ball().position(), pass_array),
-                                pitch_division_->getZone(zone_id), passing_config_);
-            };
-
-        auto pass_array = optimizer_.maximize(
-            objective_function, generated_passes.at(zone_id).pass.toPassArray(),
-            passing_config_->getNumberOfGradientDescentStepsPerIter()->value());
-
-        auto new_pass = Pass::fromPassArray(world.ball().position(), pass_array);
-        auto score =
-            ratePass(world, new_pass, pitch_division_->getZone(zone_id), passing_config_);
+        auto new_pass = optimizePass(world, zone_id, generated_passes.at(zone_id).pass);
+        auto score    = ratePassInZone(world, new_pass, zone_id);
 
         optimized_passes.emplace(zone_id, PassWithRating{new_pass, score});
+        pass_generation_stats_.num_zones_optimized++;
     }
 
     return optimized_passes;
 }
 
+template <class ZoneEnum>
+Pass PassGenerator<ZoneEnum>::optimizePass(const World& world, ZoneEnum zone_id,
+                                           const Pass& initial_pass)
+{
+    PassOptimizer pass_optimizer =
+        fromStringToPassOptimizer(passing_config_->getPassOptimizer()->value());
+
+    return pass_optimizer == PassOptimizer::CROSS_ENTROPY
+               ? optimizePassWithCrossEntropy(world, zone_id, initial_pass)
+               : optimizePassWithGradientDescent(world, zone_id, initial_pass);
+}
+
+template <class ZoneEnum>
+Pass PassGenerator<ZoneEnum>::optimizePassWithGradientDescent(const World& world,
+                                                              ZoneEnum zone_id,
+                                                              const Pass& initial_pass)
+{
+    // The gradient of the rating of the pass, approximated with the same steps that
+    // the optimizer would use, but rating all the perturbed passes in one batch
+    std::array<double, NUM_PARAMS_TO_OPTIMIZE> gradient_step_sizes;
+    for (size_t i = 0; i < NUM_PARAMS_TO_OPTIMIZE; i++)
+    {
+        gradient_step_sizes[i] =
+            GradientDescentOptimizer<
+                NUM_PARAMS_TO_OPTIMIZE>::DEFAULT_GRADIENT_APPROX_STEP_SIZE *
+            optimizer_param_weights[i];
+    }
+    const auto gradient_function =
+        [this, &world, zone_id, &gradient_step_sizes](
+            const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& pass_array) {
+            pass_generation_stats_.num_pass_evaluations += NUM_PARAMS_TO_OPTIMIZE + 1;
+            return approximateRatePassGradient(
+                world, Pass::fromPassArray(world.ball().position(), pass_array),
+                pitch_division_->getZone(zone_id), gradient_step_sizes, passing_config_);
+        };
+
+    // Run gradient descent to optimize the passes to for the requested number
+    // of iterations, or until the pass is on a flat part of the rating function
+    auto pass_array = gradient_descent_optimizer_.maximizeWithGradient(
+        gradient_function, initial_pass.toPassArray(),
+        passing_config_->getNumberOfGradientDescentStepsPerIter()->value(),
+        PASS_GRADIENT_CONVERGENCE_THRESHOLD);
+
+    return Pass::fromPassArray(world.ball().position(), pass_array);
+}
+
+template <class ZoneEnum>
+Pass PassGenerator<ZoneEnum>::optimizePassWithCrossEntropy(const World& world,
+                                                           ZoneEnum zone_id,
+                                                           const Pass& initial_pass)
+{
+    // Rates a whole generation of passes at once
+    const auto batch_objective_function =
+        [this, &world, zone_id](
+            const std::vector<std::array<double, NUM_PARAMS_TO_OPTIMIZE>>& pass_arrays) {
+            std::vector<Pass> passes;
+            passes.reserve(pass_arrays.size());
+            for (const auto& pass_array : pass_arrays)
+            {
+                passes.emplace_back(
+                    Pass::fromPassArray(world.ball().position(), pass_array));
+            }
+            pass_generation_stats_.num_pass_evaluations +=
+                static_cast<unsigned int>(passes.size());
+            return ratePasses(world, passes, pitch_division_->getZone(zone_id),
+                              passing_config_);
+        };
+
+    // Start from the newly sampled pass, the best pass we've found in this zone so
+    // far, and more random passes in the zone, so that the search isn't stuck on
+    // the plateau that any one of them is on
+    std::vector<std::array<double, NUM_PARAMS_TO_OPTIMIZE>> starting_points = {
+        initial_pass.toPassArray(), current_best_passes_.at(zone_id).pass.toPassArray()};
+    auto num_starting_points = static_cast<size_t>(
+        passing_config_->getNumberOfPassSearchStartingPoints()->value());
+    while (starting_points.size() < num_starting_points)
+    {
+        starting_points.emplace_back(samplePassInZone(world, zone_id).toPassArray());
+    }
+
+    auto pass_array = cross_entropy_optimizer_.maximize(
+        batch_objective_function, starting_points,
+        static_cast<unsigned int>(
+            passing_config_->getPassSearchEvaluationBudget()->value()));
+
+    return Pass::fromPassArray(world.ball().position(), pass_array);
+}
+
 template <class ZoneEnum>
 void PassGenerator<ZoneEnum>::updatePasses(const World& world,
                                            const ZonePassMap<ZoneEnum>& optimized_passes)
@@ -109,11 +252,29 @@ void PassGenerator<ZoneEnum>::updatePasses(const World& world,
         current_best_passes_.at(zone_id).pass = Pass::fromPassArray(
             world.ball().position(), current_best_passes_.at(zone_id).pass.toPassArray());
 
-        if (ratePass(world, current_best_passes_.at(zone_id).pass,
-                     pitch_division_->getZone(zone_id),
-                     passing_config_) < optimized_passes.at(zone_id).rating)
+        if (ratePassInZone(world, current_best_passes_.at(zone_id).pass, zone_id) <
+            optimized_passes.at(zone_id).rating)
         {
             current_best_passes_.at(zone_id) = optimized_passes.at(zone_id);
         }
     }
 }
+
+template <class ZoneEnum>
+void PassGenerator<ZoneEnum>::rerateCurrentBestPasses(const World& world)
+{
+    for (auto& [zone_id, pass_with_rating] : current_best_passes_)
+    {
+        pass_with_rating.pass   = Pass::fromPassArray(world.ball().position(),
+                                                    pass_with_rating.pass.toPassArray());
+        pass_with_rating.rating = ratePassInZone(world, pass_with_rating.pass, zone_id);
+    }
+}
+
+template <class ZoneEnum>
+double PassGenerator<ZoneEnum>::ratePassInZone(const World& world, const Pass& pass,
+                                               ZoneEnum zone_id)
+{
+    pass_generation_stats_.num_pass_evaluations++;
+    return ratePass(world, pass, pitch_division_->getZone(zone_id), passing_config_);
+}
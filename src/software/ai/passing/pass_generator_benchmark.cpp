@@ -0,0 +1,318 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <memory>
+#include <random>
+
+#include "software/ai/passing/cost_function.h"
+#include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/ai/passing/pass.h"
+#include "software/ai/passing/pass_generator.h"
+#include "software/optimization/gradient_descent_optimizer.h"
+#include "software/test_util/test_util.h"
+
+/**
+ * Benchmarks for the PassGenerator, comparing the pass quality each PassOptimizer
+ * reaches per millisecond of pass generation.
+ *
+ * Each iteration creates a new PassGenerator for every game state and runs it for
+ * NUM_TICKS ticks, as it would when the game state changes. The game states are
+ * generated from a fixed seed, with both teams spread over the field and the ball in
+ * front of a friendly robot. The counters are:
+ *  - best_pass_rating: The average rating of the best pass on the field
+ *  - mean_zone_rating: The average rating of the best pass in each zone
+ *  - quality_per_ms: best_pass_rating summed over the game states, divided by the
+ *                    time taken to generate them
+ *
+ * The GRADIENT_DESCENT benchmark takes the number of gradient descent steps as its
+ * argument, and the CROSS_ENTROPY benchmark takes the pass search evaluation budget.
+ * The default config values are 2 steps and a budget of 8 ratings, which use the same
+ * number of calls to ratePass.
+ *
+ * The tick benchmark (benchmarkGradientDescentTick) measures a single tick of a
+ * PassGenerator that has already run NUM_TICKS ticks on the game state, which is what
+ * the AI pays every tick while the game state changes slowly. It takes the number of
+ * gradient descent steps as its argument. The counters are:
+ *  - ms_per_tick: The average time taken by a tick
+ *  - pass_evaluations_per_tick: The average number of passes rated in a tick
+ *
+ * The gradient descent optimization benchmarks compare how the PassGenerator
+ * optimizes a pass with gradient descent (benchmarkBatchedGradientDescentPass) against
+ * the previous approach of approximating the gradient one ratePass call at a time,
+ * without stopping early (benchmarkNumericalGradientDescentPass). They take the number
+ * of gradient descent steps as their argument, and report the average rating of the
+ * optimized passes as mean_pass_rating.
+ *
+ * Run with: bazel run -c opt //software/ai/passing:pass_generator_benchmark
+ */
+
+namespace
+{
+    const unsigned int NUM_GAME_STATES = 16;
+    const unsigned int NUM_TICKS       = 10;
+    const unsigned int NUM_ROBOTS      = 6;
+
+    // The gradient descent param weights and convergence threshold used by the
+    // PassGenerator
+    const double PASS_SPACE_WEIGHT                   = 0.1;
+    const double PASS_SPEED_WEIGHT                   = 0.01;
+    const double PASS_GRADIENT_CONVERGENCE_THRESHOLD = 1e-8;
+
+    /**
+     * Creates game states with robots randomly placed on the field
+     *
+     * @return the game states
+     */
+    std::vector<World> createGameStates()
+    {
+        std::mt19937 random_num_gen(1);
+        std::vector<World> worlds;
+        for (unsigned int i = 0; i < NUM_GAME_STATES; i++)
+        {
+            World world = ::TestUtil::createBlankTestingWorld();
+            std::uniform_real_distribution x_distribution(-world.field().xLength() / 2,
+                                                          world.field().xLength() / 2);
+            std::uniform_real_distribution y_distribution(-world.field().yLength() / 2,
+                                                          world.field().yLength() / 2);
+
+            std::vector<Point> friendly_positions, enemy_positions;
+            for (unsigned int j = 0; j < NUM_ROBOTS; j++)
+            {
+                friendly_positions.emplace_back(x_distribution(random_num_gen),
+                                                y_distribution(random_num_gen));
+                enemy_positions.emplace_back(x_distribution(random_num_gen),
+                                             y_distribution(random_num_gen));
+            }
+            world.updateFriendlyTeamState(TestUtil::setRobotPositionsHelper(
+                Team(), friendly_positions, Timestamp::fromSeconds(0)));
+            world.updateEnemyTeamState(TestUtil::setRobotPositionsHelper(
+                Team(), enemy_positions, Timestamp::fromSeconds(0)));
+            world.updateBall(
+                Ball(BallState(friendly_positions.front() + Vector(0.1, 0), Vector()),
+                     Timestamp::fromSeconds(0)));
+            worlds.emplace_back(world);
+        }
+        return worlds;
+    }
+
+    /**
+     * Runs a new PassGenerator on each game state and reports the pass quality reached
+     *
+     * @param state The benchmark state
+     * @param passing_config The passing config to generate passes with
+     */
+    void benchmarkPassGenerator(benchmark::State& state,
+                                std::shared_ptr<const PassingConfig> passing_config)
+    {
+        const std::vector<World> worlds = createGameStates();
+        auto pitch_division =
+            std::make_shared<const EighteenZonePitchDivision>(worlds.front().field());
+
+        double best_pass_rating_sum = 0;
+        double mean_zone_rating_sum = 0;
+        std::chrono::duration<double, std::milli> generation_time(0);
+        for (auto _ : state)
+        {
+            for (const World& world : worlds)
+            {
+                auto start_time = std::chrono::steady_clock::now();
+                PassGenerator<EighteenZoneId> pass_generator(pitch_division,
+                                                             passing_config);
+                for (unsigned int tick = 0; tick < NUM_TICKS - 1; tick++)
+                {
+                    pass_generator.generatePassEvaluation(world);
+                }
+                auto pass_evaluation = pass_generator.generatePassEvaluation(world);
+                generation_time += std::chrono::steady_clock::now() - start_time;
+
+                best_pass_rating_sum += pass_evaluation.getBestPassOnField().rating;
+                for (EighteenZoneId zone_id : pitch_division->getAllZoneIds())
+                {
+                    mean_zone_rating_sum +=
+                        pass_evaluation.getBestPassInZones({zone_id}).rating /
+                        static_cast<double>(pitch_division->getAllZoneIds().size());
+                }
+            }
+        }
+
+        auto num_runs = static_cast<double>(state.iterations() * NUM_GAME_STATES);
+        state.counters["best_pass_rating"] = best_pass_rating_sum / num_runs;
+        state.counters["mean_zone_rating"] = mean_zone_rating_sum / num_runs;
+        state.counters["quality_per_ms"] = best_pass_rating_sum / generation_time.count();
+    }
+
+    void benchmarkGradientDescent(benchmark::State& state)
+    {
+        auto passing_config = std::make_shared<PassingConfig>();
+        passing_config->getMutablePassOptimizer()->setValue("GRADIENT_DESCENT");
+        passing_config->getMutableNumberOfGradientDescentStepsPerIter()->setValue(
+            static_cast<int>(state.range(0)));
+        benchmarkPassGenerator(state, passing_config);
+    }
+
+    void benchmarkCrossEntropy(benchmark::State& state)
+    {
+        auto passing_config = std::make_shared<PassingConfig>();
+        passing_config->getMutablePassOptimizer()->setValue("CROSS_ENTROPY");
+        passing_config->getMutablePassSearchEvaluationBudget()->setValue(
+            static_cast<int>(state.range(0)));
+        benchmarkPassGenerator(state, passing_config);
+    }
+
+    void benchmarkGradientDescentTick(benchmark::State& state)
+    {
+        const std::vector<World> worlds = createGameStates();
+        auto pitch_division =
+            std::make_shared<const EighteenZonePitchDivision>(worlds.front().field());
+        auto passing_config = std::make_shared<PassingConfig>();
+        passing_config->getMutablePassOptimizer()->setValue("GRADIENT_DESCENT");
+        passing_config->getMutableNumberOfGradientDescentStepsPerIter()->setValue(
+            static_cast<int>(state.range(0)));
+
+        std::vector<std::unique_ptr<PassGenerator<EighteenZoneId>>> pass_generators;
+        for (const World& world : worlds)
+        {
+            pass_generators.emplace_back(std::make_unique<PassGenerator<EighteenZoneId>>(
+                pitch_division, passing_config));
+            for (unsigned int tick = 0; tick < NUM_TICKS; tick++)
+            {
+                pass_generators.back()->generatePassEvaluation(world);
+            }
+        }
+
+        double num_pass_evaluations = 0;
+        std::chrono::duration<double, std::milli> tick_time(0);
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < worlds.size(); i++)
+            {
+                auto start_time = std::chrono::steady_clock::now();
+                benchmark::DoNotOptimize(
+                    pass_generators[i]->generatePassEvaluation(worlds[i]));
+                tick_time += std::chrono::steady_clock::now() - start_time;
+                num_pass_evaluations +=
+                    pass_generators[i]->getPassGenerationStats().num_pass_evaluations;
+            }
+        }
+
+        auto num_ticks = static_cast<double>(state.iterations() * NUM_GAME_STATES);
+        state.counters["ms_per_tick"]               = tick_time.count() / num_ticks;
+        state.counters["pass_evaluations_per_tick"] = num_pass_evaluations / num_ticks;
+    }
+
+    /**
+     * Optimizes a random pass in every zone of each game state with gradient descent,
+     * and reports the average rating of the optimized passes
+     *
+     * @param state The benchmark state
+     * @param optimize_pass Runs gradient descent from the given pass in the given zone
+     *                      on the given world, for the given number of steps, and
+     *                      returns the optimized pass array
+     */
+    template <typename OptimizePassFunction>
+    void benchmarkGradientDescentPass(benchmark::State& state,
+                                      OptimizePassFunction optimize_pass)
+    {
+        const std::vector<World> worlds = createGameStates();
+        auto pitch_division =
+            std::make_shared<const EighteenZonePitchDivision>(worlds.front().field());
+        auto num_steps = static_cast<unsigned int>(state.range(0));
+
+        std::mt19937 random_num_gen(1);
+        std::vector<Pass> initial_passes;
+        for (const World& world : worlds)
+        {
+            for (EighteenZoneId zone_id : pitch_division->getAllZoneIds())
+            {
+                auto zone = pitch_division->getZone(zone_id);
+                std::uniform_real_distribution x_distribution(zone.xMin(), zone.xMax());
+                std::uniform_real_distribution y_distribution(zone.yMin(), zone.yMax());
+                initial_passes.emplace_back(
+                    world.ball().position(),
+                    Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+                    3.5);
+            }
+        }
+
+        auto passing_config    = std::make_shared<const PassingConfig>();
+        double pass_rating_sum = 0;
+        for (auto _ : state)
+        {
+            auto initial_pass = initial_passes.begin();
+            for (const World& world : worlds)
+            {
+                for (EighteenZoneId zone_id : pitch_division->getAllZoneIds())
+                {
+                    auto zone       = pitch_division->getZone(zone_id);
+                    auto pass_array = optimize_pass(world, zone, *initial_pass++,
+                                                    passing_config, num_steps);
+                    pass_rating_sum += ratePass(
+                        world, Pass::fromPassArray(world.ball().position(), pass_array),
+                        zone, passing_config);
+                }
+            }
+        }
+
+        state.counters["mean_pass_rating"] =
+            pass_rating_sum /
+            static_cast<double>(state.iterations() * initial_passes.size());
+    }
+
+    void benchmarkNumericalGradientDescentPass(benchmark::State& state)
+    {
+        GradientDescentOptimizer<NUM_PARAMS_TO_OPTIMIZE> optimizer(
+            {PASS_SPACE_WEIGHT, PASS_SPACE_WEIGHT, PASS_SPEED_WEIGHT});
+        benchmarkGradientDescentPass(
+            state, [&optimizer](const World& world, const Rectangle& zone,
+                                const Pass& initial_pass,
+                                std::shared_ptr<const PassingConfig> passing_config,
+                                unsigned int num_steps) {
+                return optimizer.maximize(
+                    [&](const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& pass_array) {
+                        return ratePass(
+                            world,
+                            Pass::fromPassArray(world.ball().position(), pass_array),
+                            zone, passing_config);
+                    },
+                    initial_pass.toPassArray(), num_steps);
+            });
+    }
+
+    void benchmarkBatchedGradientDescentPass(benchmark::State& state)
+    {
+        GradientDescentOptimizer<NUM_PARAMS_TO_OPTIMIZE> optimizer(
+            {PASS_SPACE_WEIGHT, PASS_SPACE_WEIGHT, PASS_SPEED_WEIGHT});
+        const double step_size = GradientDescentOptimizer<
+            NUM_PARAMS_TO_OPTIMIZE>::DEFAULT_GRADIENT_APPROX_STEP_SIZE;
+        benchmarkGradientDescentPass(
+            state,
+            [&](const World& world, const Rectangle& zone, const Pass& initial_pass,
+                std::shared_ptr<const PassingConfig> passing_config,
+                unsigned int num_steps) {
+                return optimizer.maximizeWithGradient(
+                    [&](const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& pass_array) {
+                        return approximateRatePassGradient(
+                            world,
+                            Pass::fromPassArray(world.ball().position(), pass_array),
+                            zone,
+                            {step_size * PASS_SPACE_WEIGHT, step_size * PASS_SPACE_WEIGHT,
+                             step_size * PASS_SPEED_WEIGHT},
+                            passing_config);
+                    },
+                    initial_pass.toPassArray(), num_steps,
+                    PASS_GRADIENT_CONVERGENCE_THRESHOLD);
+            });
+    }
+}  // namespace
+
+BENCHMARK(benchmarkGradientDescent)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond);
+BENCHMARK(benchmarkGradientDescentTick)->Arg(2)->Arg(10)->Unit(benchmark::kMillisecond);
+BENCHMARK(benchmarkCrossEntropy)->Arg(8)->Arg(16)->Unit(benchmark::kMillisecond);
+BENCHMARK(benchmarkNumericalGradientDescentPass)
+    ->Arg(2)
+    ->Arg(10)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(benchmarkBatchedGradientDescentPass)
+    ->Arg(2)
+    ->Arg(10)
+    ->Unit(benchmark::kMicrosecond);
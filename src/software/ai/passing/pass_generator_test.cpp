@@ -41,6 +41,22 @@ class PassGeneratorTest : public testing::Test
         }
     }
 
+    /**
+     * Creates a clock that moves forward by one millisecond every time it is read
+     *
+     * @param time The time of the clock, which is advanced every time it is read
+     *
+     * @return the clock
+     */
+    static PassGenerator<EighteenZoneId>::Clock createSteppingClock(
+        std::chrono::steady_clock::time_point& time)
+    {
+        return [&time]() {
+            time += std::chrono::milliseconds(1);
+            return time;
+        };
+    }
+
     World world = ::TestUtil::createBlankTestingWorld();
     std::shared_ptr<const PassingConfig> passing_config;
     std::shared_ptr<const FieldPitchDivision<EighteenZoneId>> pitch_division;
@@ -216,3 +232,151 @@ TEST_F(PassGeneratorTest, test_passer_point_changes_are_respected)
     EXPECT_GT((converged_pass.receiverPoint() - neg_y_friendly.position()).length(),
               (converged_pass.receiverPoint() - pos_y_friendly.position()).length());
 }
+
+TEST_F(PassGeneratorTest, cross_entropy_optimizer_converges_to_receiver)
+{
+    // Test that the cross entropy optimizer finds the same pass as gradient descent in
+    // check_pass_does_not_converge_to_self_pass
+    auto cross_entropy_passing_config = std::make_shared<PassingConfig>();
+    cross_entropy_passing_config->getMutablePassOptimizer()->setValue("CROSS_ENTROPY");
+    pass_generator = std::make_shared<PassGenerator<EighteenZoneId>>(
+        pitch_division, cross_entropy_passing_config);
+
+    world.updateBall(Ball(BallState({3.5, 0}, {0, 0}), Timestamp::fromSeconds(0)));
+
+    Robot passer   = Robot(0, {3.7, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                         Timestamp::fromSeconds(0));
+    Robot receiver = Robot(1, {3.7, 2}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                           Timestamp::fromSeconds(0));
+
+    Team friendly_team({passer, receiver}, Duration::fromSeconds(10));
+    world.updateFriendlyTeamState(friendly_team);
+
+    Team enemy_team(
+        {
+            Robot(0, {0, 3}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0)),
+            Robot(1, {0, -3}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0)),
+            Robot(2, {2, 3}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0)),
+        },
+        Duration::fromSeconds(10));
+    world.updateEnemyTeamState(enemy_team);
+
+    // call generate evaluation 100 times on the given world
+    stepPassGenerator(pass_generator, world, 100);
+
+    auto pass_eval = pass_generator->generatePassEvaluation(world);
+    auto [converged_pass, converged_score] = pass_eval.getBestPassOnField();
+
+    EXPECT_LE((converged_pass.receiverPoint() - receiver.position()).length(), 0.55);
+    UNUSED(converged_score);
+}
+
+TEST_F(PassGeneratorTest, deadline_in_the_past_only_rates_current_best_passes)
+{
+    // The first call has to sample and rate a pass in every zone, and later calls
+    // have to re-rate them, even if there's no time left to look for better passes
+    auto num_zones = static_cast<unsigned int>(pitch_division->getAllZoneIds().size());
+    auto deadline  = std::chrono::steady_clock::now() - std::chrono::milliseconds(1);
+
+    pass_generator->generatePassEvaluation(world, deadline);
+    EXPECT_EQ(num_zones, pass_generator->getPassGenerationStats().num_pass_evaluations);
+    EXPECT_EQ(0, pass_generator->getPassGenerationStats().num_zones_optimized);
+
+    pass_generator->generatePassEvaluation(world, deadline);
+    EXPECT_EQ(num_zones, pass_generator->getPassGenerationStats().num_pass_evaluations);
+    EXPECT_EQ(0, pass_generator->getPassGenerationStats().num_zones_optimized);
+}
+
+TEST_F(PassGeneratorTest, longer_deadline_optimizes_more_zones)
+{
+    world.updateBall(Ball(BallState({3.5, 0}, {0, 0}), Timestamp::fromSeconds(0)));
+    world.updateFriendlyTeamState(TestUtil::setRobotPositionsHelper(
+        Team(), {{3.7, 0}, {3.7, 2}, {1, -2}}, Timestamp::fromSeconds(0)));
+
+    std::chrono::steady_clock::time_point time;
+    pass_generator = std::make_shared<PassGenerator<EighteenZoneId>>(
+        pitch_division, passing_config, createSteppingClock(time));
+
+    // The clock is read once before each zone is optimized, so a zone is optimized at
+    // every millisecond before the deadline
+    pass_generator->generatePassEvaluation(world, time + std::chrono::milliseconds(5));
+    auto short_stats = pass_generator->getPassGenerationStats();
+
+    pass_generator->generatePassEvaluation(world, time + std::chrono::milliseconds(20));
+    auto long_stats = pass_generator->getPassGenerationStats();
+
+    EXPECT_EQ(4, short_stats.num_zones_optimized);
+    EXPECT_EQ(19, long_stats.num_zones_optimized);
+    EXPECT_GT(long_stats.num_pass_evaluations, short_stats.num_pass_evaluations);
+}
+
+TEST_F(PassGeneratorTest, scoped_deadline_is_shared_between_pass_generations)
+{
+    std::chrono::steady_clock::time_point time;
+    pass_generator = std::make_shared<PassGenerator<EighteenZoneId>>(
+        pitch_division, passing_config, createSteppingClock(time));
+
+    ScopedPassGenerationDeadline scoped_deadline(time + std::chrono::milliseconds(21), 2);
+
+    // The first pass generation starts at 1 ms, and gets half of the 20 ms left, so it
+    // optimizes zones at 2 ms to 10 ms
+    pass_generator->generatePassEvaluation(world);
+    EXPECT_EQ(9, pass_generator->getPassGenerationStats().num_zones_optimized);
+
+    // It finishes at 12 ms, so the second pass generation starts at 13 ms and gets
+    // the rest of the time, optimizing zones at 14 ms to 20 ms
+    pass_generator->generatePassEvaluation(world);
+    EXPECT_EQ(7, pass_generator->getPassGenerationStats().num_zones_optimized);
+
+    EXPECT_EQ(2, scoped_deadline.getNumPassGenerations());
+    EXPECT_EQ(std::chrono::milliseconds(11) + std::chrono::milliseconds(9),
+              scoped_deadline.getPassGenerationDuration());
+}
+
+TEST_F(PassGeneratorTest, scoped_deadline_converges_to_receiver)
+{
+    // Test that passes keep improving across ticks with a deadline too, in the same
+    // scenario as check_pass_does_not_converge_to_self_pass
+    world.updateBall(Ball(BallState({3.5, 0}, {0, 0}), Timestamp::fromSeconds(0)));
+
+    Robot passer   = Robot(0, {3.7, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                         Timestamp::fromSeconds(0));
+    Robot receiver = Robot(1, {3.7, 2}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                           Timestamp::fromSeconds(0));
+
+    Team friendly_team({passer, receiver}, Duration::fromSeconds(10));
+    world.updateFriendlyTeamState(friendly_team);
+
+    Team enemy_team(
+        {
+            Robot(0, {0, 3}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0)),
+            Robot(1, {0, -3}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0)),
+            Robot(2, {2, 3}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0)),
+        },
+        Duration::fromSeconds(10));
+    world.updateEnemyTeamState(enemy_team);
+
+    std::chrono::steady_clock::time_point time;
+    pass_generator = std::make_shared<PassGenerator<EighteenZoneId>>(
+        pitch_division, passing_config, createSteppingClock(time));
+
+    for (int i = 0; i < 100; i++)
+    {
+        // The pass generation starts at 1 ms, so zones are optimized at 2 ms to 5 ms
+        ScopedPassGenerationDeadline scoped_deadline(time + std::chrono::milliseconds(6));
+        pass_generator->generatePassEvaluation(world);
+        ASSERT_EQ(4, pass_generator->getPassGenerationStats().num_zones_optimized);
+    }
+
+    auto pass_eval = pass_generator->generatePassEvaluation(world);
+    auto [converged_pass, converged_score] = pass_eval.getBestPassOnField();
+
+    EXPECT_LE((converged_pass.receiverPoint() - receiver.position()).length(), 0.55);
+    UNUSED(converged_score);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "software/util/make_enum/make_enum.h"
+
+/**
+ * The optimizers the PassGenerator can use to improve the passes in each zone
+ *
+ * GRADIENT_DESCENT: Polishes the sampled pass in each zone with a few steps of Adam
+ *                   gradient descent
+ * CROSS_ENTROPY:    Rates several starting passes in each zone and searches around
+ *                   the best one with the cross-entropy method, under a fixed budget
+ *                   of pass ratings
+ */
+MAKE_ENUM(PassOptimizer, GRADIENT_DESCENT, CROSS_ENTROPY);
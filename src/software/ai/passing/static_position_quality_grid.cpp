@@ -0,0 +1,155 @@
+#include "software/ai/passing/static_position_quality_grid.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "software/ai/passing/cost_function.h"
+
+StaticPositionQualityGrid::StaticPositionQualityGrid(
+    const Field& field, std::shared_ptr<const PassingConfig> passing_config,
+    double grid_spacing)
+    : field(field),
+      passing_config(passing_config),
+      grid_spacing(grid_spacing),
+      grid_origin(field.fieldBoundary().negXNegYCorner()),
+      num_x_points(
+          static_cast<size_t>(std::ceil(field.fieldBoundary().xLength() / grid_spacing)) +
+          1),
+      num_y_points(
+          static_cast<size_t>(std::ceil(field.fieldBoundary().yLength() / grid_spacing)) +
+          1),
+      grid_qualities(num_x_points * num_y_points)
+{
+    // The grid is built a row at a time, so the passing config is only read once per
+    // row
+    std::vector<Point> row_points(num_x_points);
+    for (size_t j = 0; j < num_y_points; j++)
+    {
+        for (size_t i = 0; i < num_x_points; i++)
+        {
+            row_points[i] =
+                Point(grid_origin.x() + static_cast<double>(i) * grid_spacing,
+                      grid_origin.y() + static_cast<double>(j) * grid_spacing);
+        }
+        std::vector<double> row_qualities =
+            getStaticPositionQualities(field, row_points, passing_config);
+        std::copy(row_qualities.begin(), row_qualities.end(),
+                  grid_qualities.begin() + static_cast<std::ptrdiff_t>(j * num_x_points));
+    }
+}
+
+double StaticPositionQualityGrid::getStaticPositionQuality(const Point& position) const
+{
+    // The position in grid coordinates, where grid point (i, j) is at (i, j)
+    double grid_x = (position.x() - grid_origin.x()) / grid_spacing;
+    double grid_y = (position.y() - grid_origin.y()) / grid_spacing;
+    if (!(grid_x >= 0 && grid_y >= 0 && grid_x < static_cast<double>(num_x_points - 1) &&
+          grid_y < static_cast<double>(num_y_points - 1)))
+    {
+        return ::getStaticPositionQuality(field, position, passing_config);
+    }
+
+    auto i            = static_cast<size_t>(grid_x);
+    auto j            = static_cast<size_t>(grid_y);
+    double x_fraction = grid_x - static_cast<double>(i);
+    double y_fraction = grid_y - static_cast<double>(j);
+
+    const float* row      = &grid_qualities[j * num_x_points + i];
+    const float* next_row = row + num_x_points;
+    double bottom         = row[0] + x_fraction * (row[1] - row[0]);
+    double top            = next_row[0] + x_fraction * (next_row[1] - next_row[0]);
+    return bottom + y_fraction * (top - bottom);
+}
+
+const Field& StaticPositionQualityGrid::getField() const
+{
+    return field;
+}
+
+StaticPositionQualityGridCache::StaticPositionQualityGridCache(double grid_spacing)
+    : grid_spacing(grid_spacing), mutex(), cached_grids()
+{
+}
+
+std::shared_ptr<const StaticPositionQualityGrid> StaticPositionQualityGridCache::getGrid(
+    const Field& field, std::shared_ptr<const PassingConfig> passing_config)
+{
+    std::scoped_lock lock(mutex);
+    return updateGrid(field, passing_config);
+}
+
+std::shared_ptr<const StaticPositionQualityGrid>
+StaticPositionQualityGridCache::waitForGrid(
+    const Field& field, std::shared_ptr<const PassingConfig> passing_config)
+{
+    while (true)
+    {
+        std::shared_future<std::shared_ptr<const StaticPositionQualityGrid>> pending_grid;
+        {
+            std::scoped_lock lock(mutex);
+            auto grid = updateGrid(field, passing_config);
+            if (grid)
+            {
+                return grid;
+            }
+            pending_grid = cached_grids.at(passing_config).pending_grid;
+        }
+
+        // The lock isn't held while waiting, so other threads can still get the grids
+        // that are ready. The pending grid may not be the one we need (ex. if it was
+        // started for a different field), in which case we try again once it is built
+        pending_grid.wait();
+    }
+}
+
+std::shared_ptr<const StaticPositionQualityGrid>
+StaticPositionQualityGridCache::updateGrid(
+    const Field& field, std::shared_ptr<const PassingConfig> passing_config)
+{
+    auto [iter, inserted]   = cached_grids.try_emplace(passing_config);
+    CachedGrid& cached_grid = iter->second;
+    if (inserted)
+    {
+        cached_grid.passing_config_changed = std::make_shared<std::atomic_bool>(false);
+        auto on_param_changed =
+            [passing_config_changed = cached_grid.passing_config_changed](
+                double /* new_value */) { *passing_config_changed = true; };
+        passing_config->getStaticFieldPositionQualityXOffset()->registerCallbackFunction(
+            on_param_changed);
+        passing_config->getStaticFieldPositionQualityYOffset()->registerCallbackFunction(
+            on_param_changed);
+        passing_config->getStaticFieldPositionQualityFriendlyGoalDistanceWeight()
+            ->registerCallbackFunction(on_param_changed);
+    }
+
+    if (cached_grid.pending_grid.valid() &&
+        cached_grid.pending_grid.wait_for(std::chrono::seconds(0)) ==
+            std::future_status::ready)
+    {
+        cached_grid.grid         = cached_grid.pending_grid.get();
+        cached_grid.pending_grid = {};
+    }
+
+    if (cached_grid.grid && cached_grid.grid->getField() == field &&
+        !*cached_grid.passing_config_changed)
+    {
+        return cached_grid.grid;
+    }
+
+    // Only one grid is built at a time for each passing config. If the params change
+    // while it is being built, the flag is set again and it is rebuilt once it is done.
+    // The out of date grid is dropped, since the flag no longer marks it as out of date
+    if (!cached_grid.pending_grid.valid())
+    {
+        *cached_grid.passing_config_changed = false;
+        cached_grid.grid                    = nullptr;
+        cached_grid.pending_grid =
+            std::async(std::launch::async, [field, passing_config,
+                                            grid_spacing = grid_spacing]() {
+                return std::make_shared<const StaticPositionQualityGrid>(
+                    field, passing_config, grid_spacing);
+            }).share();
+    }
+    return nullptr;
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "shared/parameter/cpp_dynamic_parameters.h"
+#include "software/geom/point.h"
+#include "software/world/field.h"
+
+/**
+ * A precomputed grid of the static position quality (see getStaticPositionQuality in
+ * cost_function.h) over the whole field, including the boundary.
+ *
+ * The static position quality only depends on the field and a few passing config
+ * params, but it takes several exponentials to calculate, and it is calculated for
+ * every pass that is rated. This class calculates it once at every grid point when the
+ * grid is created and bilinearly interpolates between the grid points instead.
+ *
+ * The grid never changes once it is created, so it can be shared by every thread that
+ * rates passes. It is only valid for the field and static position quality params it
+ * was created with (see StaticPositionQualityGridCache for keeping a grid up to date).
+ * Positions outside the field boundary aren't in the grid, and are calculated exactly.
+ */
+class StaticPositionQualityGrid
+{
+   public:
+    // The distance between grid points, in metres. The sigmoids at the edges of the
+    // field and the enemy defense area are 0.1m wide, so the grid points need to be
+    // much closer than that for interpolation to follow them closely. At this spacing
+    // the interpolated quality is within 0.01 of the exact quality everywhere
+    static constexpr double DEFAULT_GRID_SPACING_M = 0.01;
+
+    StaticPositionQualityGrid() = delete;
+
+    /**
+     * Creates a StaticPositionQualityGrid, calculating the static position quality at
+     * every grid point
+     *
+     * @param field The field to build the grid for
+     * @param passing_config The passing config to calculate the static position
+     * quality with
+     * @param grid_spacing The distance between grid points, in metres
+     */
+    explicit StaticPositionQualityGrid(
+        const Field& field, std::shared_ptr<const PassingConfig> passing_config,
+        double grid_spacing = DEFAULT_GRID_SPACING_M);
+
+    /**
+     * Returns the static position quality of the given position on the field the grid
+     * was built for, interpolated from the grid
+     *
+     * @param position The position on the field at which to calculate the quality
+     *
+     * @return A value in [0,1] representing the quality of the given point on the
+     *         field, with a higher value representing a more desirable position
+     */
+    double getStaticPositionQuality(const Point& position) const;
+
+    /**
+     * Returns the field the grid was built for
+     *
+     * @return the field the grid was built for
+     */
+    const Field& getField() const;
+
+   private:
+    Field field;
+    std::shared_ptr<const PassingConfig> passing_config;
+    double grid_spacing;
+
+    // The position of the first grid point, and the number of grid points along each
+    // axis
+    Point grid_origin;
+    size_t num_x_points;
+    size_t num_y_points;
+
+    // The static position quality at each grid point, in row-major order (consecutive
+    // points along the x axis are next to each other). Floats are plenty precise and
+    // halve the size of the grid, which is about 4.8MB for a division A field at the
+    // default grid spacing
+    std::vector<float> grid_qualities;
+};
+
+/**
+ * Keeps a StaticPositionQualityGrid up to date with the field and the static position
+ * quality params of each passing config, so that every pass rated with the same
+ * passing config shares one grid.
+ *
+ * Building a grid takes much longer than a tick, so grids are built in the background.
+ * getGrid never waits for a grid to be built: it returns nullptr until the grid for
+ * the given field and the current params is ready, and the static position quality
+ * should be calculated exactly until then.
+ *
+ * Changes to the static position quality params are detected with Parameter
+ * callbacks, which are registered once per passing config, the first time a grid is
+ * requested for it. Since the callbacks can't be unregistered, the cache keeps every
+ * passing config it has been given alive.
+ *
+ * This class is thread safe.
+ */
+class StaticPositionQualityGridCache
+{
+   public:
+    /**
+     * Creates an empty StaticPositionQualityGridCache
+     *
+     * @param grid_spacing The distance between grid points of the grids, in metres
+     */
+    explicit StaticPositionQualityGridCache(
+        double grid_spacing = StaticPositionQualityGrid::DEFAULT_GRID_SPACING_M);
+
+    /**
+     * Returns the grid for the given field and the current static position quality
+     * params of the given passing config, if it has been built. If it hasn't, it is
+     * built in the background. This never waits for a grid to be built
+     *
+     * @param field The field the grid should be built for
+     * @param passing_config The passing config the grid should be built with
+     *
+     * @return the grid for the given field and passing config, or nullptr if it is not
+     * ready yet
+     */
+    std::shared_ptr<const StaticPositionQualityGrid> getGrid(
+        const Field& field, std::shared_ptr<const PassingConfig> passing_config);
+
+    /**
+     * Returns the grid for the given field and the current static position quality
+     * params of the given passing config, waiting for it to be built if it isn't ready
+     * yet
+     *
+     * @param field The field the grid should be built for
+     * @param passing_config The passing config the grid should be built with
+     *
+     * @return the grid for the given field and passing config
+     */
+    std::shared_ptr<const StaticPositionQualityGrid> waitForGrid(
+        const Field& field, std::shared_ptr<const PassingConfig> passing_config);
+
+   private:
+    // The grid kept up to date for one passing config
+    struct CachedGrid
+    {
+        // Set by the Parameter callbacks whenever a static position quality param
+        // changes. The callbacks can't be unregistered, so they share ownership of
+        // this flag rather than referring to the cache
+        std::shared_ptr<std::atomic_bool> passing_config_changed;
+        // The most recently built grid, or nullptr if none has been built yet
+        std::shared_ptr<const StaticPositionQualityGrid> grid;
+        // The grid being built in the background, if any
+        std::shared_future<std::shared_ptr<const StaticPositionQualityGrid>> pending_grid;
+    };
+
+    /**
+     * Returns the grid for the given field and passing config if it is up to date,
+     * starting to build it in the background if it is not and no other grid for the
+     * passing config is being built. The mutex must be held when calling this function
+     *
+     * @param field The field the grid should be built for
+     * @param passing_config The passing config the grid should be built with
+     *
+     * @return the grid for the given field and passing config, or nullptr if it is not
+     * ready yet
+     */
+    std::shared_ptr<const StaticPositionQualityGrid> updateGrid(
+        const Field& field, std::shared_ptr<const PassingConfig> passing_config);
+
+    double grid_spacing;
+
+    std::mutex mutex;
+    std::map<std::shared_ptr<const PassingConfig>, CachedGrid> cached_grids;
+};
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "software/ai/passing/cost_function.h"
+#include "software/ai/passing/static_position_quality_grid.h"
+
+/**
+ * Benchmarks for the StaticPositionQualityGrid, compared to calculating the static
+ * position quality exactly.
+ *
+ * Each iteration finds the static position quality of NUM_POSITIONS random positions
+ * spread over the field. The build benchmark measures how long it takes to build the
+ * grid, which is done in the background the first time it is requested and after the
+ * field or passing config changes.
+ *
+ * Run with: bazel run -c opt //software/ai/passing:static_position_quality_grid_benchmark
+ */
+
+namespace
+{
+    const std::size_t NUM_POSITIONS = 1024;
+
+    /**
+     * Creates random positions inside the field boundary
+     *
+     * @param field The field to create the positions on
+     *
+     * @return the random positions
+     */
+    std::vector<Point> createRandomPositions(const Field& field)
+    {
+        std::mt19937 random_num_gen(1);
+        Rectangle field_boundary = field.fieldBoundary();
+        std::uniform_real_distribution x_distribution(field_boundary.xMin(),
+                                                      field_boundary.xMax());
+        std::uniform_real_distribution y_distribution(field_boundary.yMin(),
+                                                      field_boundary.yMax());
+        std::vector<Point> positions;
+        for (std::size_t i = 0; i < NUM_POSITIONS; i++)
+        {
+            positions.emplace_back(x_distribution(random_num_gen),
+                                   y_distribution(random_num_gen));
+        }
+        return positions;
+    }
+
+    void benchmarkExactStaticPositionQuality(benchmark::State& state)
+    {
+        auto passing_config                = std::make_shared<const PassingConfig>();
+        const Field field                  = Field::createSSLDivisionBField();
+        const std::vector<Point> positions = createRandomPositions(field);
+
+        for (auto _ : state)
+        {
+            for (const Point& position : positions)
+            {
+                benchmark::DoNotOptimize(
+                    getStaticPositionQuality(field, position, passing_config));
+            }
+        }
+        state.SetItemsProcessed(
+            static_cast<int64_t>(state.iterations() * positions.size()));
+    }
+
+    void benchmarkGridStaticPositionQuality(benchmark::State& state)
+    {
+        auto passing_config                = std::make_shared<const PassingConfig>();
+        const Field field                  = Field::createSSLDivisionBField();
+        const std::vector<Point> positions = createRandomPositions(field);
+        StaticPositionQualityGrid grid(field, passing_config);
+
+        for (auto _ : state)
+        {
+            for (const Point& position : positions)
+            {
+                benchmark::DoNotOptimize(grid.getStaticPositionQuality(position));
+            }
+        }
+        state.SetItemsProcessed(
+            static_cast<int64_t>(state.iterations() * positions.size()));
+    }
+
+    void benchmarkGridBuild(benchmark::State& state)
+    {
+        auto passing_config = std::make_shared<const PassingConfig>();
+        const Field field   = Field::createSSLDivisionBField();
+
+        for (auto _ : state)
+        {
+            StaticPositionQualityGrid grid(field, passing_config);
+            benchmark::DoNotOptimize(grid.getStaticPositionQuality(Point()));
+        }
+    }
+}  // namespace
+
+BENCHMARK(benchmarkExactStaticPositionQuality);
+BENCHMARK(benchmarkGridStaticPositionQuality);
+BENCHMARK(benchmarkGridBuild)->Unit(benchmark::kMillisecond);
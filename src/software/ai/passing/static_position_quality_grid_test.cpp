@@ -0,0 +1,143 @@
+#include "software/ai/passing/static_position_quality_grid.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/ai/passing/cost_function.h"
+
+class StaticPositionQualityGridTest : public testing::Test
+{
+   protected:
+    /**
+     * Expects the grid to be close to getStaticPositionQuality at random positions
+     * inside the field boundary of the field it was built for
+     *
+     * @param grid The grid to check
+     * @param passing_config The passing config to calculate the exact quality with
+     */
+    static void expectCloseToExactQuality(
+        const StaticPositionQualityGrid& grid,
+        std::shared_ptr<const PassingConfig> passing_config)
+    {
+        const Field& field = grid.getField();
+        std::mt19937 random_num_gen(1);
+        Rectangle field_boundary = field.fieldBoundary();
+        std::uniform_real_distribution x_distribution(field_boundary.xMin(),
+                                                      field_boundary.xMax());
+        std::uniform_real_distribution y_distribution(field_boundary.yMin(),
+                                                      field_boundary.yMax());
+
+        double max_error   = 0;
+        double total_error = 0;
+        for (unsigned int i = 0; i < NUM_TEST_POSITIONS; i++)
+        {
+            Point position(x_distribution(random_num_gen),
+                           y_distribution(random_num_gen));
+            double error =
+                std::abs(grid.getStaticPositionQuality(position) -
+                         getStaticPositionQuality(field, position, passing_config));
+            max_error = std::max(max_error, error);
+            total_error += error;
+        }
+
+        // The largest errors are where the sigmoids at the edges of the field and
+        // enemy defense area are steepest. Everywhere else the grid is much closer
+        EXPECT_LT(max_error, MAX_ERROR);
+        EXPECT_LT(total_error / NUM_TEST_POSITIONS, MAX_MEAN_ERROR);
+    }
+
+    static constexpr unsigned int NUM_TEST_POSITIONS = 10000;
+    static constexpr double MAX_ERROR                = 0.01;
+    static constexpr double MAX_MEAN_ERROR           = 0.0002;
+
+    std::shared_ptr<PassingConfig> passing_config = std::make_shared<PassingConfig>();
+    Field field                                   = Field::createSSLDivisionBField();
+};
+
+TEST_F(StaticPositionQualityGridTest, close_to_exact_quality_on_division_b_field)
+{
+    StaticPositionQualityGrid grid(field, passing_config);
+    expectCloseToExactQuality(grid, passing_config);
+}
+
+TEST_F(StaticPositionQualityGridTest, close_to_exact_quality_on_division_a_field)
+{
+    StaticPositionQualityGrid grid(Field::createSSLDivisionAField(), passing_config);
+    expectCloseToExactQuality(grid, passing_config);
+}
+
+TEST_F(StaticPositionQualityGridTest, exact_quality_at_grid_points)
+{
+    StaticPositionQualityGrid grid(field, passing_config);
+    Point grid_point =
+        field.fieldBoundary().negXNegYCorner() +
+        Vector(100, 100) * StaticPositionQualityGrid::DEFAULT_GRID_SPACING_M;
+
+    EXPECT_NEAR(getStaticPositionQuality(field, grid_point, passing_config),
+                grid.getStaticPositionQuality(grid_point), 1e-6);
+}
+
+TEST_F(StaticPositionQualityGridTest, exact_quality_outside_field_boundary)
+{
+    StaticPositionQualityGrid grid(field, passing_config);
+    Point position(field.totalXLength(), 0);
+
+    EXPECT_DOUBLE_EQ(getStaticPositionQuality(field, position, passing_config),
+                     grid.getStaticPositionQuality(position));
+}
+
+TEST_F(StaticPositionQualityGridTest, cache_builds_grid_in_background)
+{
+    StaticPositionQualityGridCache cache;
+
+    // The first request only starts building the grid
+    EXPECT_EQ(nullptr, cache.getGrid(field, passing_config));
+
+    auto grid = cache.waitForGrid(field, passing_config);
+    ASSERT_NE(nullptr, grid);
+    EXPECT_EQ(field, grid->getField());
+    expectCloseToExactQuality(*grid, passing_config);
+
+    // The grid is shared until the field or passing config changes
+    EXPECT_EQ(grid, cache.getGrid(field, passing_config));
+}
+
+TEST_F(StaticPositionQualityGridTest, cache_rebuilds_grid_when_field_changes)
+{
+    StaticPositionQualityGridCache cache;
+    cache.waitForGrid(field, passing_config);
+
+    Field division_a_field = Field::createSSLDivisionAField();
+    EXPECT_EQ(nullptr, cache.getGrid(division_a_field, passing_config));
+
+    auto grid = cache.waitForGrid(division_a_field, passing_config);
+    ASSERT_NE(nullptr, grid);
+    EXPECT_EQ(division_a_field, grid->getField());
+    expectCloseToExactQuality(*grid, passing_config);
+}
+
+TEST_F(StaticPositionQualityGridTest, cache_rebuilds_grid_when_passing_config_changes)
+{
+    StaticPositionQualityGridCache cache;
+    // A point near the edge of the field, which is only inside the area with a high
+    // quality until the offset from the sides of the field is increased
+    Point position(0, field.yLength() / 2 - 0.4);
+    double quality_before_change =
+        cache.waitForGrid(field, passing_config)->getStaticPositionQuality(position);
+
+    passing_config->getMutableStaticFieldPositionQualityYOffset()->setValue(1.0);
+    passing_config->getMutableStaticFieldPositionQualityFriendlyGoalDistanceWeight()
+        ->setValue(0.8);
+
+    // The old grid is out of date, so it isn't returned while the new one is built
+    EXPECT_EQ(nullptr, cache.getGrid(field, passing_config));
+
+    auto grid = cache.waitForGrid(field, passing_config);
+    ASSERT_NE(nullptr, grid);
+    double quality_after_change = grid->getStaticPositionQuality(position);
+    EXPECT_LT(quality_after_change, quality_before_change - 0.5);
+    EXPECT_NEAR(getStaticPositionQuality(field, position, passing_config),
+                quality_after_change, MAX_ERROR);
+    expectCloseToExactQuality(*grid, passing_config);
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <thread>
+
+#include "shared/parameter/cpp_dynamic_parameters.h"
+#include "software/ai/passing/pass_evaluation.h"
+#include "software/ai/passing/pass_generator.h"
+#include "software/ai/passing/pass_with_rating.h"
+#include "software/multithreading/observer.h"
+#include "software/time/duration.h"
+#include "software/time/timestamp.h"
+#include "software/world/world.h"
+
+/**
+ * Runs a PassGenerator in its own thread, so that pass search is decoupled from the
+ * AI tick.
+ *
+ * This observes Worlds like the ThreadedAI does. The thread always works on the most
+ * recently received World, and keeps improving the passes for it until a newer World
+ * arrives, publishing a new PassEvaluation every EVALUATION_PUBLISH_PERIOD. Because
+ * the search no longer has to fit in the few milliseconds of the tick left over after
+ * everything else, it can do much more work per World without delaying the
+ * primitives sent to the robots.
+ *
+ * The most recent PassEvaluation is published as an immutable snapshot, which can be
+ * read from any thread without waiting for the search. Since the snapshot may have
+ * been computed on an older World than the reader's, getPassEvaluation and getBestPass
+ * can check how old it is against the reader's World.
+ *
+ * The pitch division is created from the field of the received Worlds, and is only
+ * recreated if the field changes, so the ThreadedPassGenerator can be created before
+ * the field is known.
+ *
+ * If no new World is received for MAX_REFINEMENT_DURATION, the thread stops searching
+ * until the next World arrives, so it doesn't use a whole core while the AI isn't
+ * running.
+ *
+ * @tparam ZoneEnum The zone id enum of the pitch division passes are generated in
+ */
+template <class ZoneEnum>
+class ThreadedPassGenerator : public Observer<World>
+{
+   public:
+    // How often the thread publishes a new PassEvaluation while it is searching
+    static constexpr std::chrono::milliseconds EVALUATION_PUBLISH_PERIOD{5};
+    // How long the thread keeps searching for better passes on the same World
+    static constexpr std::chrono::seconds MAX_REFINEMENT_DURATION{1};
+
+    // Creates the pitch division to look for passes in on the given field
+    using PitchDivisionFactory =
+        std::function<std::shared_ptr<const FieldPitchDivision<ZoneEnum>>(
+            const Field& field)>;
+
+    ThreadedPassGenerator() = delete;
+
+    /**
+     * Creates a new ThreadedPassGenerator and starts its thread
+     *
+     * @param create_pitch_division Creates the pitch division to use when looking for
+     * passes on the field of the received Worlds
+     * @param passing_config The passing config to generate passes with
+     */
+    explicit ThreadedPassGenerator(PitchDivisionFactory create_pitch_division,
+                                   std::shared_ptr<const PassingConfig> passing_config);
+
+    ~ThreadedPassGenerator() override;
+
+    // Delete the copy and assignment operators because this class really shouldn't need
+    // them and we don't want to risk doing anything nasty with the internal
+    // multithreading this class uses
+    ThreadedPassGenerator& operator=(const ThreadedPassGenerator&) = delete;
+    ThreadedPassGenerator(const ThreadedPassGenerator&)            = delete;
+
+    /**
+     * Returns the most recently published PassEvaluation. This never waits for the
+     * pass search
+     *
+     * @return the most recently published PassEvaluation, or nullptr if no
+     * PassEvaluation has been published yet
+     */
+    std::shared_ptr<const PassEvaluation<ZoneEnum>> getPassEvaluation() const;
+
+    /**
+     * Returns the most recently published PassEvaluation, if it was computed on a
+     * World that is recent enough. This never waits for the pass search
+     *
+     * @param current_time The current time, usually the most recent timestamp of the
+     * World the caller is using
+     * @param max_age How much older than current_time the World the PassEvaluation was
+     * computed on may be
+     *
+     * @return the most recently published PassEvaluation, or nullptr if no
+     * PassEvaluation has been published yet or the most recent one is too old
+     */
+    std::shared_ptr<const PassEvaluation<ZoneEnum>> getPassEvaluation(
+        const Timestamp& current_time, const Duration& max_age) const;
+
+    /**
+     * Returns the best pass on the field from the most recently published
+     * PassEvaluation, if it was computed on a World that is recent enough. This never
+     * waits for the pass search
+     *
+     * @param current_time The current time, usually the most recent timestamp of the
+     * World the caller is using
+     * @param max_age How much older than current_time the World the PassEvaluation was
+     * computed on may be
+     *
+     * @return the best pass on the field, or std::nullopt if no PassEvaluation has been
+     * published yet or the most recent one is too old
+     */
+    std::optional<PassWithRating> getBestPass(const Timestamp& current_time,
+                                              const Duration& max_age) const;
+
+   private:
+    /**
+     * Searches for passes on the most recently received World and publishes
+     * PassEvaluations until the destructor of this class is called.
+     * This is intended to be run in a separate thread.
+     */
+    void continuouslyGeneratePassEvaluations();
+
+    PitchDivisionFactory create_pitch_division;
+    std::shared_ptr<const PassingConfig> passing_config;
+
+    // Only used by pass_generation_thread. The pass generator is created for the field
+    // of the first World received, and recreated whenever the field changes
+    std::optional<Field> pass_generator_field;
+    std::unique_ptr<PassGenerator<ZoneEnum>> pass_generator;
+
+    // The most recently published PassEvaluation. This is only accessed with the
+    // std::atomic_load and std::atomic_store overloads for shared_ptr, so it can be
+    // replaced by pass_generation_thread while other threads read it
+    std::shared_ptr<const PassEvaluation<ZoneEnum>> latest_pass_evaluation;
+
+    // This indicates if the destructor of this class has been called
+    std::atomic_bool in_destructor;
+
+    // The period for checking whether or not the destructor for this class has
+    // been called while waiting for a World
+    const Duration IN_DESTRUCTOR_CHECK_PERIOD;
+
+    // This is the thread that searches for passes
+    std::thread pass_generation_thread;
+};
+
+#include "software/ai/passing/threaded_pass_generator.tpp"
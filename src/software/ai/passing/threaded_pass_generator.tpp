@@ -0,0 +1,100 @@
+#pragma once
+
+#include "software/ai/passing/threaded_pass_generator.h"
+
+template <class ZoneEnum>
+ThreadedPassGenerator<ZoneEnum>::ThreadedPassGenerator(
+    PitchDivisionFactory create_pitch_division,
+    std::shared_ptr<const PassingConfig> passing_config)
+    : Observer<World>(DEFAULT_BUFFER_SIZE, false),
+      create_pitch_division(create_pitch_division),
+      passing_config(passing_config),
+      pass_generator_field(std::nullopt),
+      pass_generator(nullptr),
+      latest_pass_evaluation(nullptr),
+      in_destructor(false),
+      IN_DESTRUCTOR_CHECK_PERIOD(Duration::fromSeconds(0.1))
+{
+    // The thread is started last, so that everything it uses has been constructed
+    pass_generation_thread =
+        std::thread(&ThreadedPassGenerator::continuouslyGeneratePassEvaluations, this);
+}
+
+template <class ZoneEnum>
+ThreadedPassGenerator<ZoneEnum>::~ThreadedPassGenerator()
+{
+    in_destructor = true;
+
+    // We must wait for the thread to stop, as if we destroy it while it's still
+    // running we will segfault
+    pass_generation_thread.join();
+}
+
+template <class ZoneEnum>
+std::shared_ptr<const PassEvaluation<ZoneEnum>>
+ThreadedPassGenerator<ZoneEnum>::getPassEvaluation() const
+{
+    return std::atomic_load(&latest_pass_evaluation);
+}
+
+template <class ZoneEnum>
+std::shared_ptr<const PassEvaluation<ZoneEnum>>
+ThreadedPassGenerator<ZoneEnum>::getPassEvaluation(const Timestamp& current_time,
+                                                   const Duration& max_age) const
+{
+    auto pass_evaluation = getPassEvaluation();
+    if (pass_evaluation && current_time - pass_evaluation->getEvaluationTime() > max_age)
+    {
+        return nullptr;
+    }
+    return pass_evaluation;
+}
+
+template <class ZoneEnum>
+std::optional<PassWithRating> ThreadedPassGenerator<ZoneEnum>::getBestPass(
+    const Timestamp& current_time, const Duration& max_age) const
+{
+    auto pass_evaluation = getPassEvaluation(current_time, max_age);
+    if (!pass_evaluation)
+    {
+        return std::nullopt;
+    }
+    return pass_evaluation->getBestPassOnField();
+}
+
+template <class ZoneEnum>
+void ThreadedPassGenerator<ZoneEnum>::continuouslyGeneratePassEvaluations()
+{
+    std::optional<World> world;
+    auto world_received_time = std::chrono::steady_clock::now();
+
+    while (!in_destructor)
+    {
+        // While there is a World to improve passes for, we only check for a newer one
+        // between searches. Otherwise, we wait for one to arrive
+        bool searching = world && std::chrono::steady_clock::now() - world_received_time <
+                                      MAX_REFINEMENT_DURATION;
+        std::optional<World> new_world = popMostRecentlyReceivedValue(
+            searching ? Duration::fromSeconds(0) : IN_DESTRUCTOR_CHECK_PERIOD);
+        if (new_world)
+        {
+            world               = new_world;
+            world_received_time = std::chrono::steady_clock::now();
+            if (!pass_generator_field || *pass_generator_field != world->field())
+            {
+                pass_generator_field = world->field();
+                pass_generator       = std::make_unique<PassGenerator<ZoneEnum>>(
+                    create_pitch_division(world->field()), passing_config);
+            }
+        }
+        else if (!searching)
+        {
+            continue;
+        }
+
+        auto pass_evaluation = std::make_shared<const PassEvaluation<ZoneEnum>>(
+            pass_generator->generatePassEvaluation(
+                *world, std::chrono::steady_clock::now() + EVALUATION_PUBLISH_PERIOD));
+        std::atomic_store(&latest_pass_evaluation, pass_evaluation);
+    }
+}
@@ -0,0 +1,193 @@
+#include "software/ai/passing/threaded_pass_generator.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/test_util/test_util.h"
+
+class ThreadedPassGeneratorTest : public testing::Test
+{
+   protected:
+    virtual void SetUp()
+    {
+        passing_config          = std::make_shared<const PassingConfig>();
+        threaded_pass_generator = std::make_unique<ThreadedPassGenerator<EighteenZoneId>>(
+            [](const Field& field) {
+                return std::make_shared<const EighteenZonePitchDivision>(field);
+            },
+            passing_config);
+    }
+
+    /**
+     * Polls the ThreadedPassGenerator until it publishes a PassEvaluation that satisfies
+     * the given condition, or a timeout that is long enough that it should never be
+     * reached passes
+     *
+     * @param condition Returns whether the PassEvaluation is the one being waited for
+     *
+     * @return the first PassEvaluation that satisfies the condition, or the most
+     * recently published PassEvaluation if the timeout was reached
+     */
+    std::shared_ptr<const PassEvaluation<EighteenZoneId>> waitForPassEvaluation(
+        std::function<bool(const PassEvaluation<EighteenZoneId>&)> condition)
+    {
+        auto timeout         = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        auto pass_evaluation = threaded_pass_generator->getPassEvaluation();
+        while (std::chrono::steady_clock::now() < timeout)
+        {
+            pass_evaluation = threaded_pass_generator->getPassEvaluation();
+            if (pass_evaluation && condition(*pass_evaluation))
+            {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return pass_evaluation;
+    }
+
+    /**
+     * Polls the ThreadedPassGenerator until it publishes a PassEvaluation computed on a
+     * World with the given timestamp, or a timeout that is long enough that it should
+     * never be reached passes
+     *
+     * @param evaluation_time The most recent timestamp of the World to wait for
+     *
+     * @return the PassEvaluation computed on the World, or the most recently published
+     * PassEvaluation if the timeout was reached
+     */
+    std::shared_ptr<const PassEvaluation<EighteenZoneId>> waitForPassEvaluation(
+        const Timestamp& evaluation_time)
+    {
+        return waitForPassEvaluation(
+            [evaluation_time](const PassEvaluation<EighteenZoneId>& pass_evaluation) {
+                return pass_evaluation.getEvaluationTime() == evaluation_time;
+            });
+    }
+
+    World world = ::TestUtil::createBlankTestingWorld();
+    std::shared_ptr<const PassingConfig> passing_config;
+    std::unique_ptr<ThreadedPassGenerator<EighteenZoneId>> threaded_pass_generator;
+};
+
+TEST_F(ThreadedPassGeneratorTest, no_pass_evaluation_before_world_received)
+{
+    EXPECT_EQ(nullptr, threaded_pass_generator->getPassEvaluation());
+    EXPECT_EQ(std::nullopt, threaded_pass_generator->getBestPass(
+                                Timestamp::fromSeconds(0), Duration::fromSeconds(1)));
+}
+
+TEST_F(ThreadedPassGeneratorTest, publishes_pass_evaluation_for_received_world)
+{
+    world.updateBall(Ball(BallState({1, 0}, {0, 0}), Timestamp::fromSeconds(3)));
+    threaded_pass_generator->receiveValue(world);
+
+    auto pass_evaluation = waitForPassEvaluation(Timestamp::fromSeconds(3));
+    ASSERT_NE(nullptr, pass_evaluation);
+    EXPECT_EQ(Timestamp::fromSeconds(3), pass_evaluation->getEvaluationTime());
+    EXPECT_EQ(Point(1, 0), pass_evaluation->getBestPassOnField().pass.passerPoint());
+}
+
+TEST_F(ThreadedPassGeneratorTest, stale_pass_evaluation_is_not_returned)
+{
+    world.updateBall(Ball(BallState({1, 0}, {0, 0}), Timestamp::fromSeconds(3)));
+    threaded_pass_generator->receiveValue(world);
+
+    ASSERT_NE(nullptr, waitForPassEvaluation(Timestamp::fromSeconds(3)));
+
+    EXPECT_NE(nullptr, threaded_pass_generator->getPassEvaluation(
+                           Timestamp::fromSeconds(3.1), Duration::fromSeconds(0.5)));
+    EXPECT_EQ(nullptr, threaded_pass_generator->getPassEvaluation(
+                           Timestamp::fromSeconds(4), Duration::fromSeconds(0.5)));
+}
+
+TEST_F(ThreadedPassGeneratorTest, get_best_pass_from_recent_pass_evaluation)
+{
+    world.updateBall(Ball(BallState({1, 0}, {0, 0}), Timestamp::fromSeconds(3)));
+    threaded_pass_generator->receiveValue(world);
+
+    ASSERT_NE(nullptr, waitForPassEvaluation(Timestamp::fromSeconds(3)));
+
+    auto best_pass = threaded_pass_generator->getBestPass(Timestamp::fromSeconds(3.1),
+                                                          Duration::fromSeconds(0.5));
+    ASSERT_TRUE(best_pass);
+    EXPECT_EQ(Point(1, 0), best_pass->pass.passerPoint());
+    EXPECT_EQ(std::nullopt, threaded_pass_generator->getBestPass(
+                                Timestamp::fromSeconds(4), Duration::fromSeconds(0.5)));
+}
+
+TEST_F(ThreadedPassGeneratorTest, pass_evaluation_follows_newest_world)
+{
+    world.updateBall(Ball(BallState({1, 0}, {0, 0}), Timestamp::fromSeconds(3)));
+    threaded_pass_generator->receiveValue(world);
+    ASSERT_NE(nullptr, waitForPassEvaluation(Timestamp::fromSeconds(3)));
+
+    world.updateBall(Ball(BallState({-1, 1}, {0, 0}), Timestamp::fromSeconds(4)));
+    threaded_pass_generator->receiveValue(world);
+
+    auto pass_evaluation = waitForPassEvaluation(Timestamp::fromSeconds(4));
+    ASSERT_NE(nullptr, pass_evaluation);
+    EXPECT_EQ(Timestamp::fromSeconds(4), pass_evaluation->getEvaluationTime());
+    EXPECT_EQ(Point(-1, 1), pass_evaluation->getBestPassOnField().pass.passerPoint());
+}
+
+TEST_F(ThreadedPassGeneratorTest, pitch_division_follows_field_of_newest_world)
+{
+    world.updateBall(Ball(BallState({1, 0}, {0, 0}), Timestamp::fromSeconds(3)));
+    threaded_pass_generator->receiveValue(world);
+    ASSERT_NE(nullptr, waitForPassEvaluation(Timestamp::fromSeconds(3)));
+
+    World div_a_world(Field::createSSLDivisionAField(), world.ball(),
+                      world.friendlyTeam(), world.enemyTeam());
+    div_a_world.updateBall(Ball(BallState({1, 0}, {0, 0}), Timestamp::fromSeconds(4)));
+    threaded_pass_generator->receiveValue(div_a_world);
+
+    auto pass_evaluation = waitForPassEvaluation(Timestamp::fromSeconds(4));
+    ASSERT_NE(nullptr, pass_evaluation);
+    EXPECT_EQ(Timestamp::fromSeconds(4), pass_evaluation->getEvaluationTime());
+    EXPECT_EQ(
+        EighteenZonePitchDivision(div_a_world.field()).getZone(EighteenZoneId::ZONE_1),
+        pass_evaluation->getFieldPitchDivsion()->getZone(EighteenZoneId::ZONE_1));
+}
+
+TEST_F(ThreadedPassGeneratorTest, converges_to_receiver_without_new_worlds)
+{
+    // The same scenario as PassGeneratorTest.check_pass_does_not_converge_to_self_pass,
+    // but the passes are only improved by the thread searching on a single World
+    world.updateBall(Ball(BallState({3.5, 0}, {0, 0}), Timestamp::fromSeconds(0)));
+
+    Robot passer   = Robot(0, {3.7, 0}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                         Timestamp::fromSeconds(0));
+    Robot receiver = Robot(1, {3.7, 2}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                           Timestamp::fromSeconds(0));
+
+    Team friendly_team({passer, receiver}, Duration::fromSeconds(10));
+    world.updateFriendlyTeamState(friendly_team);
+
+    Team enemy_team(
+        {
+            Robot(0, {0, 3}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0)),
+            Robot(1, {0, -3}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0)),
+            Robot(2, {2, 3}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0)),
+        },
+        Duration::fromSeconds(10));
+    world.updateEnemyTeamState(enemy_team);
+
+    threaded_pass_generator->receiveValue(world);
+
+    auto pass_evaluation = waitForPassEvaluation(
+        [receiver](const PassEvaluation<EighteenZoneId>& pass_evaluation) {
+            return (pass_evaluation.getBestPassOnField().pass.receiverPoint() -
+                    receiver.position())
+                       .length() <= 0.55;
+        });
+    ASSERT_NE(nullptr, pass_evaluation);
+    EXPECT_LE(
+        (pass_evaluation->getBestPassOnField().pass.receiverPoint() - receiver.position())
+            .length(),
+        0.55);
+}
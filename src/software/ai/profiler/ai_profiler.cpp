@@ -0,0 +1,260 @@
+#include "software/ai/profiler/ai_profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "software/multithreading/spsc_ring_buffer.h"
+#include "software/proto/message_translation/tbots_protobuf.h"
+#include "software/util/typename/typename.h"
+
+namespace
+{
+    /**
+     * The scopes recorded by a single thread. The thread that owns the buffer is the only
+     * producer, and the AIProfiler ending the tick is the only consumer
+     */
+    struct ThreadBuffer
+    {
+        explicit ThreadBuffer(unsigned int thread_index)
+            : events(AIProfiler::THREAD_BUFFER_SIZE),
+              num_dropped_events(0),
+              thread_index(thread_index)
+        {
+        }
+
+        SpscRingBuffer<ProfiledScopeEvent> events;
+        std::atomic<unsigned int> num_dropped_events;
+        const unsigned int thread_index;
+    };
+
+    /**
+     * The profiler state of a single thread
+     */
+    struct ThreadProfilerState
+    {
+        std::shared_ptr<ThreadBuffer> buffer;
+        // The number of scopes currently being timed on this thread
+        unsigned int depth = 0;
+    };
+
+    std::atomic_bool profiler_enabled(true);
+
+    // Protects the list of thread buffers, and makes sure only one thread drains the
+    // buffers at a time. This is never locked while recording a scope, except for the
+    // very first scope recorded by each thread
+    std::mutex thread_buffers_mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> thread_buffers;
+    unsigned int next_thread_index = 0;
+
+    thread_local ThreadProfilerState thread_state;
+
+    ThreadBuffer &getThreadBuffer()
+    {
+        if (!thread_state.buffer)
+        {
+            std::scoped_lock<std::mutex> lock(thread_buffers_mutex);
+            thread_state.buffer = std::make_shared<ThreadBuffer>(next_thread_index++);
+            thread_buffers.emplace_back(thread_state.buffer);
+        }
+        return *thread_state.buffer;
+    }
+
+    double toMilliseconds(std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+}  // namespace
+
+AIProfiler::AIProfiler()
+    : tick_start_time(std::chrono::steady_clock::now()),
+      tick_start_timestamp(),
+      tick_start_allocation_stats(std::nullopt),
+      recording_allocation_call_sites(false),
+      scope_names()
+{
+}
+
+void AIProfiler::startTick()
+{
+    std::scoped_lock<std::mutex> lock(thread_buffers_mutex);
+    for (const auto &buffer : thread_buffers)
+    {
+        while (buffer->events.pop())
+        {
+        }
+        buffer->num_dropped_events = 0;
+    }
+
+    tick_start_timestamp = *createCurrentTimestamp();
+
+    if (recording_allocation_call_sites)
+    {
+        AllocationTracker::stopRecordingCallSites(0);
+        recording_allocation_call_sites = false;
+    }
+    tick_start_allocation_stats = std::nullopt;
+    if (AllocationTracker::isEnabled())
+    {
+        // Something else, ex. a test, may already be recording call sites for a larger
+        // section of code that includes this tick
+        if (!AllocationTracker::isRecordingCallSites())
+        {
+            recording_allocation_call_sites =
+                AllocationTracker::startRecordingCallSites();
+        }
+        tick_start_allocation_stats = AllocationTracker::getThreadAllocationStats();
+    }
+
+    tick_start_time = std::chrono::steady_clock::now();
+}
+
+std::unique_ptr<TbotsProto::AiProfile> AIProfiler::endTick()
+{
+    const auto tick_end_time = std::chrono::steady_clock::now();
+    // Building the profile allocates, so the allocations made by the tick are counted
+    // before anything else is done
+    std::optional<AllocationStats> tick_allocation_stats;
+    if (tick_start_allocation_stats)
+    {
+        tick_allocation_stats =
+            AllocationTracker::getThreadAllocationStats() - *tick_start_allocation_stats;
+    }
+    std::vector<AllocationCallSite> allocation_call_sites;
+    if (recording_allocation_call_sites)
+    {
+        allocation_call_sites =
+            AllocationTracker::stopRecordingCallSites(NUM_TOP_ALLOCATION_CALL_SITES);
+        recording_allocation_call_sites = false;
+    }
+
+    auto profile                          = std::make_unique<TbotsProto::AiProfile>();
+    *(profile->mutable_tick_start_time()) = tick_start_timestamp;
+    profile->set_tick_duration_ms(toMilliseconds(tick_end_time - tick_start_time));
+    if (tick_allocation_stats)
+    {
+        profile->set_num_allocations(tick_allocation_stats->num_allocations);
+        profile->set_allocated_bytes(tick_allocation_stats->allocated_bytes);
+    }
+    for (const auto &call_site : allocation_call_sites)
+    {
+        TbotsProto::AllocationCallSite *call_site_msg =
+            profile->add_top_allocation_call_sites();
+        call_site_msg->set_name(call_site.name);
+        call_site_msg->set_num_allocations(call_site.stats.num_allocations);
+        call_site_msg->set_allocated_bytes(call_site.stats.allocated_bytes);
+    }
+
+    std::vector<std::pair<unsigned int, ProfiledScopeEvent>> events;
+    unsigned int num_dropped_events = 0;
+    {
+        std::scoped_lock<std::mutex> lock(thread_buffers_mutex);
+        for (const auto &buffer : thread_buffers)
+        {
+            while (std::optional<ProfiledScopeEvent> event = buffer->events.pop())
+            {
+                // Scopes on other threads may have started before this tick did
+                if (event->start_time >= tick_start_time)
+                {
+                    events.emplace_back(buffer->thread_index, *event);
+                }
+            }
+            num_dropped_events += buffer->num_dropped_events.exchange(0);
+        }
+
+        // Once a thread has exited, only this list holds its buffer
+        thread_buffers.erase(
+            std::remove_if(thread_buffers.begin(), thread_buffers.end(),
+                           [](const auto &buffer) { return buffer.use_count() == 1; }),
+            thread_buffers.end());
+    }
+
+    // Scopes are recorded when they end, so nested scopes are recorded before the
+    // scopes they are nested in
+    std::sort(events.begin(), events.end(), [](const auto &lhs, const auto &rhs) {
+        return std::make_tuple(lhs.first, lhs.second.start_time, lhs.second.depth) <
+               std::make_tuple(rhs.first, rhs.second.start_time, rhs.second.depth);
+    });
+
+    for (const auto &[thread_index, event] : events)
+    {
+        TbotsProto::ProfiledScope *scope = profile->add_scopes();
+        scope->set_name(getScopeName(event));
+        scope->set_depth(event.depth);
+        scope->set_thread_index(thread_index);
+        scope->set_start_time_ms(toMilliseconds(event.start_time - tick_start_time));
+        scope->set_duration_ms(toMilliseconds(event.end_time - event.start_time));
+        scope->set_num_allocations(event.allocation_stats.num_allocations);
+        scope->set_allocated_bytes(event.allocation_stats.allocated_bytes);
+    }
+    profile->set_num_dropped_scopes(num_dropped_events);
+
+    return profile;
+}
+
+void AIProfiler::setEnabled(bool enabled)
+{
+    profiler_enabled = enabled;
+}
+
+bool AIProfiler::isEnabled()
+{
+    return profiler_enabled;
+}
+
+const std::string &AIProfiler::getScopeName(const ProfiledScopeEvent &event)
+{
+    auto iter = scope_names.find(event.name);
+    if (iter == scope_names.end())
+    {
+        iter = scope_names
+                   .emplace(event.name, event.is_type_name ? demangleTypeId(event.name)
+                                                           : std::string(event.name))
+                   .first;
+    }
+    return iter->second;
+}
+
+ScopedProfilerTimer::ScopedProfilerTimer(const char *name)
+    : event{name, false, 0, {}, {}, {}},
+      enabled(AIProfiler::isEnabled()),
+      tracking_allocations(enabled && AllocationTracker::isEnabled())
+{
+    if (enabled)
+    {
+        event.depth = thread_state.depth++;
+        if (tracking_allocations)
+        {
+            // Holds the allocation counts at the start of the scope until it ends
+            event.allocation_stats = AllocationTracker::getThreadAllocationStats();
+        }
+        event.start_time = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedProfilerTimer::ScopedProfilerTimer(const std::type_info &type)
+    : ScopedProfilerTimer(type.name())
+{
+    event.is_type_name = true;
+}
+
+ScopedProfilerTimer::~ScopedProfilerTimer()
+{
+    if (enabled)
+    {
+        event.end_time = std::chrono::steady_clock::now();
+        if (tracking_allocations)
+        {
+            event.allocation_stats =
+                AllocationTracker::getThreadAllocationStats() - event.allocation_stats;
+        }
+        thread_state.depth--;
+
+        ThreadBuffer &buffer = getThreadBuffer();
+        if (!buffer.events.push(event))
+        {
+            buffer.num_dropped_events++;
+        }
+    }
+}
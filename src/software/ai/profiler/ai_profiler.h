@@ -0,0 +1,191 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "software/ai/profiler/allocation_tracker.h"
+#include "software/proto/ai_profile_msg.pb.h"
+
+/**
+ * A single scope that was timed by a ScopedProfilerTimer
+ */
+struct ProfiledScopeEvent
+{
+    // The name of the scope. This must point to a string that lives for the rest of the
+    // program (ex. a string literal or the name of a std::type_info), so that recording
+    // a scope never has to copy or allocate a string
+    const char* name;
+    // Whether the name is a mangled type name that must be demangled before it is shown
+    bool is_type_name;
+    // How many other scopes on the same thread this scope is nested in
+    unsigned int depth;
+    std::chrono::steady_clock::time_point start_time;
+    std::chrono::steady_clock::time_point end_time;
+    // The allocations made during the scope, if allocation tracking is enabled
+    AllocationStats allocation_stats;
+};
+
+/**
+ * Collects the time taken by the different stages of each AI tick, ex. play selection,
+ * tactic updates, robot to tactic assignment and navigation.
+ *
+ * Scopes are timed with ScopedProfilerTimers (usually through the PROFILE_SCOPE macros
+ * below), which can be placed anywhere in the AI. Every thread that times scopes gets
+ * its own lock-free SpscRingBuffer, so timing a scope never blocks and threads never
+ * contend with each other. When a tick ends, the buffers of all threads are drained and
+ * the scopes that ran during the tick are aggregated into a TbotsProto::AiProfile.
+ *
+ * If the AllocationTracker is enabled, the heap allocations made by each scope and by
+ * the thread that runs the tick are recorded as well, along with the functions that
+ * made the most allocations during the tick.
+ *
+ * NOTE: The thread buffers are shared by all AIProfilers, so only one AIProfiler
+ * should be running ticks at a time.
+ */
+class AIProfiler
+{
+   public:
+    /**
+     * Creates a new AIProfiler
+     */
+    explicit AIProfiler();
+
+    /**
+     * Marks the start of a new tick. Any scopes that were recorded before this are
+     * discarded. The tick must be ended on the same thread for its allocations to be
+     * recorded
+     */
+    void startTick();
+
+    /**
+     * Marks the end of the current tick, and returns the scopes that ran during it
+     *
+     * @return the profile of the tick
+     */
+    std::unique_ptr<TbotsProto::AiProfile> endTick();
+
+    /**
+     * Sets whether scopes are recorded. When disabled, ScopedProfilerTimers do nothing
+     * but check this flag, and ticks will only report their total duration.
+     *
+     * @param enabled Whether scopes are recorded
+     */
+    static void setEnabled(bool enabled);
+
+    /**
+     * Returns whether scopes are being recorded
+     *
+     * @return whether scopes are being recorded
+     */
+    static bool isEnabled();
+
+    // The maximum number of scopes each thread can record in one tick
+    static constexpr std::size_t THREAD_BUFFER_SIZE = 4096;
+    // The number of call sites that made the most allocations to record each tick
+    static constexpr std::size_t NUM_TOP_ALLOCATION_CALL_SITES = 10;
+
+   private:
+    /**
+     * Returns the name of the given scope to display, demangling it if required
+     *
+     * @param event The scope
+     *
+     * @return the name of the scope
+     */
+    const std::string& getScopeName(const ProfiledScopeEvent& event);
+
+    std::chrono::steady_clock::time_point tick_start_time;
+    TbotsProto::Timestamp tick_start_timestamp;
+    std::optional<AllocationStats> tick_start_allocation_stats;
+    // Whether this profiler is recording the call sites of the allocations made this
+    // tick, which it won't be if something else is already recording them
+    bool recording_allocation_call_sites;
+    // Demangling type names is slow, so we only do it once for each type
+    std::unordered_map<const char*, std::string> scope_names;
+};
+
+/**
+ * Times the scope it is created in, from when it is constructed to when it is destroyed,
+ * and records it with the AIProfiler
+ */
+class ScopedProfilerTimer
+{
+   public:
+    ScopedProfilerTimer() = delete;
+
+    /**
+     * Starts timing a scope with the given name
+     *
+     * @param name The name of the scope. Must live for the rest of the program, ex. a
+     * string literal
+     */
+    explicit ScopedProfilerTimer(const char* name);
+
+    /**
+     * Starts timing a scope named after the given type, ex. the type of a Play or Tactic
+     *
+     * @param type The type to name the scope after
+     */
+    explicit ScopedProfilerTimer(const std::type_info& type);
+
+    // Copying this class is not permitted, since each timer must only be recorded once
+    ScopedProfilerTimer(const ScopedProfilerTimer&) = delete;
+
+    ~ScopedProfilerTimer();
+
+   private:
+    ProfiledScopeEvent event;
+    bool enabled;
+    bool tracking_allocations;
+};
+
+/**
+ * Returns the dynamic type of the given object, for naming ScopedProfilerTimers.
+ *
+ * Note: Taking the object by const reference avoids evaluating expressions with side
+ * effects as operand to typeid, see software/util/typename/typename.h
+ *
+ * @param object The object to get the type of
+ *
+ * @return the dynamic type of the object
+ */
+template <typename T>
+const std::type_info& profiledObjectType(const T& object)
+{
+    return typeid(object);
+}
+
+#define PROFILER_CONCATENATE_HELPER(a, b) a##b
+#define PROFILER_CONCATENATE(a, b) PROFILER_CONCATENATE_HELPER(a, b)
+
+/**
+ * MACRO to time the rest of the current scope, i.e.
+ * ```
+ * void Navigator::getAssignedPrimitives(...)
+ * {
+ *     PROFILE_SCOPE("Navigator::getAssignedPrimitives");
+ *     ...
+ * }
+ * ```
+ *
+ * @param name The name of the scope, which must be a string literal
+ */
+#define PROFILE_SCOPE(name)                                                              \
+    ScopedProfilerTimer PROFILER_CONCATENATE(scoped_profiler_timer_, __LINE__)(name)
+
+/**
+ * MACRO to time the rest of the current scope, named after the type of the given object,
+ * i.e.
+ * ```
+ * PROFILE_OBJECT_SCOPE(*current_play); // Named ShootOrPassPlay
+ * ```
+ *
+ * @param object The object to name the scope after
+ */
+#define PROFILE_OBJECT_SCOPE(object)                                                     \
+    ScopedProfilerTimer PROFILER_CONCATENATE(scoped_profiler_timer_,                     \
+                                             __LINE__)(profiledObjectType(object))
@@ -0,0 +1,216 @@
+#include "software/ai/profiler/ai_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+class AIProfilerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        AIProfiler::setEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        AIProfiler::setEnabled(true);
+        AllocationTracker::setEnabled(false);
+    }
+
+    AIProfiler profiler;
+};
+
+namespace
+{
+    class ProfiledClass
+    {
+       public:
+        virtual ~ProfiledClass() = default;
+    };
+
+    class DerivedProfiledClass : public ProfiledClass
+    {
+    };
+
+    /**
+     * Makes the given number of heap allocations. The memory is allocated by calling
+     * operator new directly, so the allocations can't be optimized out
+     *
+     * @param num_allocations The number of allocations to make
+     */
+    void makeHeapAllocations(unsigned int num_allocations)
+    {
+        for (unsigned int i = 0; i < num_allocations; i++)
+        {
+            ::operator delete(::operator new(64));
+        }
+    }
+}  // namespace
+
+TEST_F(AIProfilerTest, empty_tick)
+{
+    profiler.startTick();
+    auto profile = profiler.endTick();
+
+    EXPECT_EQ(0, profile->scopes_size());
+    EXPECT_EQ(0, profile->num_dropped_scopes());
+    EXPECT_GE(profile->tick_duration_ms(), 0.0);
+    EXPECT_GT(profile->tick_start_time().epoch_timestamp_seconds(), 0.0);
+}
+
+TEST_F(AIProfilerTest, nested_scopes_are_ordered_by_start_time)
+{
+    profiler.startTick();
+    {
+        PROFILE_SCOPE("outer");
+        {
+            PROFILE_SCOPE("first_inner");
+        }
+        {
+            PROFILE_SCOPE("second_inner");
+            PROFILE_SCOPE("innermost");
+        }
+    }
+    auto profile = profiler.endTick();
+
+    ASSERT_EQ(4, profile->scopes_size());
+    EXPECT_EQ("outer", profile->scopes(0).name());
+    EXPECT_EQ(0, profile->scopes(0).depth());
+    EXPECT_EQ("first_inner", profile->scopes(1).name());
+    EXPECT_EQ(1, profile->scopes(1).depth());
+    EXPECT_EQ("second_inner", profile->scopes(2).name());
+    EXPECT_EQ(1, profile->scopes(2).depth());
+    EXPECT_EQ("innermost", profile->scopes(3).name());
+    EXPECT_EQ(2, profile->scopes(3).depth());
+
+    // Nested scopes start after and run no longer than the scope they are nested in
+    for (int i = 1; i < profile->scopes_size(); i++)
+    {
+        EXPECT_GE(profile->scopes(i).start_time_ms(), profile->scopes(0).start_time_ms());
+        EXPECT_LE(profile->scopes(i).duration_ms(), profile->scopes(0).duration_ms());
+    }
+    EXPECT_LE(profile->scopes(0).duration_ms(), profile->tick_duration_ms());
+}
+
+TEST_F(AIProfilerTest, object_scope_is_named_after_dynamic_type)
+{
+    std::unique_ptr<ProfiledClass> object = std::make_unique<DerivedProfiledClass>();
+
+    profiler.startTick();
+    {
+        PROFILE_OBJECT_SCOPE(*object);
+    }
+    auto profile = profiler.endTick();
+
+    ASSERT_EQ(1, profile->scopes_size());
+    EXPECT_EQ("(anonymous namespace)::DerivedProfiledClass", profile->scopes(0).name());
+}
+
+TEST_F(AIProfilerTest, scopes_from_before_the_tick_are_discarded)
+{
+    {
+        PROFILE_SCOPE("before_tick");
+    }
+
+    profiler.startTick();
+    {
+        PROFILE_SCOPE("during_tick");
+    }
+    auto profile = profiler.endTick();
+
+    ASSERT_EQ(1, profile->scopes_size());
+    EXPECT_EQ("during_tick", profile->scopes(0).name());
+}
+
+TEST_F(AIProfilerTest, scopes_are_not_recorded_when_disabled)
+{
+    AIProfiler::setEnabled(false);
+
+    profiler.startTick();
+    {
+        PROFILE_SCOPE("disabled");
+    }
+    auto profile = profiler.endTick();
+
+    EXPECT_EQ(0, profile->scopes_size());
+}
+
+TEST_F(AIProfilerTest, scopes_from_other_threads_are_recorded)
+{
+    profiler.startTick();
+    {
+        PROFILE_SCOPE("main_thread");
+        std::thread other_thread([]() { PROFILE_SCOPE("other_thread"); });
+        other_thread.join();
+    }
+    auto profile = profiler.endTick();
+
+    ASSERT_EQ(2, profile->scopes_size());
+    EXPECT_EQ(0, profile->scopes(0).depth());
+    EXPECT_EQ(0, profile->scopes(1).depth());
+    EXPECT_NE(profile->scopes(0).thread_index(), profile->scopes(1).thread_index());
+}
+
+TEST_F(AIProfilerTest, scopes_are_dropped_when_the_buffer_is_full)
+{
+    const unsigned int num_extra_scopes = 10;
+
+    profiler.startTick();
+    for (unsigned int i = 0; i < AIProfiler::THREAD_BUFFER_SIZE + num_extra_scopes; i++)
+    {
+        PROFILE_SCOPE("scope");
+    }
+    auto profile = profiler.endTick();
+
+    EXPECT_EQ(AIProfiler::THREAD_BUFFER_SIZE, profile->scopes_size());
+    EXPECT_EQ(num_extra_scopes, profile->num_dropped_scopes());
+
+    // The dropped scopes should not carry over into the next tick
+    profiler.startTick();
+    profile = profiler.endTick();
+    EXPECT_EQ(0, profile->num_dropped_scopes());
+}
+
+TEST_F(AIProfilerTest, allocations_are_not_recorded_when_tracking_is_disabled)
+{
+    profiler.startTick();
+    {
+        PROFILE_SCOPE("allocating_scope");
+        makeHeapAllocations(3);
+    }
+    auto profile = profiler.endTick();
+
+    ASSERT_EQ(1, profile->scopes_size());
+    EXPECT_EQ(0, profile->scopes(0).num_allocations());
+    EXPECT_EQ(0, profile->num_allocations());
+    EXPECT_EQ(0, profile->top_allocation_call_sites_size());
+}
+
+TEST_F(AIProfilerTest, allocations_are_recorded_for_each_scope_and_the_tick)
+{
+    AllocationTracker::setEnabled(true);
+
+    profiler.startTick();
+    {
+        PROFILE_SCOPE("outer");
+        makeHeapAllocations(1);
+        {
+            PROFILE_SCOPE("inner");
+            makeHeapAllocations(2);
+        }
+    }
+    auto profile = profiler.endTick();
+
+    ASSERT_EQ(2, profile->scopes_size());
+    EXPECT_EQ("outer", profile->scopes(0).name());
+    // Scopes include the allocations made by the scopes nested in them
+    EXPECT_GE(profile->scopes(0).num_allocations(), 3);
+    EXPECT_EQ("inner", profile->scopes(1).name());
+    EXPECT_EQ(2, profile->scopes(1).num_allocations());
+    EXPECT_EQ(2 * 64, profile->scopes(1).allocated_bytes());
+    EXPECT_GE(profile->num_allocations(), profile->scopes(0).num_allocations());
+    EXPECT_GT(profile->top_allocation_call_sites_size(), 0);
+    EXPECT_LE(profile->top_allocation_call_sites_size(),
+              AIProfiler::NUM_TOP_ALLOCATION_CALL_SITES);
+}
@@ -0,0 +1,336 @@
+#include "software/ai/profiler/allocation_tracker.h"
+
+#include <dlfcn.h>
+#include <execinfo.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include "software/util/typename/typename.h"
+
+namespace
+{
+    /**
+     * The allocation tracking state of a single thread. This must be constant
+     * initialized, since operator new can be called before any dynamic initialization
+     * of a thread_local has run
+     */
+    struct ThreadAllocationState
+    {
+        AllocationStats stats;
+        bool recording_call_sites = false;
+        // Set while a stack trace is being captured, since capturing a stack trace can
+        // allocate
+        bool capturing_stack_trace = false;
+    };
+
+    /**
+     * A distinct stack trace that allocated memory while call sites were being recorded
+     */
+    struct RecordedStackTrace
+    {
+        // The hash of the frames, or 0 if this entry is empty
+        std::size_t hash;
+        std::array<void*, AllocationTracker::MAX_STACK_TRACE_DEPTH> frames;
+        std::size_t depth;
+        AllocationStats stats;
+    };
+
+    std::atomic_bool tracking_enabled(false);
+    std::atomic_bool hook_installed(false);
+    // Whether any thread is recording call sites
+    std::atomic_bool call_sites_being_recorded(false);
+
+    thread_local ThreadAllocationState thread_state;
+
+    // The stack traces are only ever accessed by the thread that is recording call
+    // sites. This is an open addressing hash table so that recording an allocation
+    // never allocates
+    std::array<RecordedStackTrace, AllocationTracker::MAX_RECORDED_STACK_TRACES>
+        recorded_stack_traces;
+    // The allocations from stack traces that did not fit in recorded_stack_traces
+    AllocationStats unrecorded_stack_trace_stats;
+
+    std::size_t hashStackTrace(void* const* frames, std::size_t depth)
+    {
+        std::size_t hash = 14695981039346656037ULL;
+        for (std::size_t i = 0; i < depth; i++)
+        {
+            hash ^= reinterpret_cast<std::uintptr_t>(frames[i]);
+            hash *= 1099511628211ULL;
+        }
+        // 0 marks an empty entry
+        return hash == 0 ? 1 : hash;
+    }
+
+    void recordStackTrace(void* const* frames, std::size_t depth, std::size_t size)
+    {
+        const std::size_t hash = hashStackTrace(frames, depth);
+        for (std::size_t probe = 0; probe < recorded_stack_traces.size(); probe++)
+        {
+            RecordedStackTrace& entry =
+                recorded_stack_traces[(hash + probe) % recorded_stack_traces.size()];
+            if (entry.hash == 0)
+            {
+                entry.hash  = hash;
+                entry.depth = depth;
+                std::copy(frames, frames + depth, entry.frames.begin());
+            }
+            if (entry.hash == hash && entry.depth == depth &&
+                std::equal(frames, frames + depth, entry.frames.begin()))
+            {
+                entry.stats.num_allocations++;
+                entry.stats.allocated_bytes += size;
+                return;
+            }
+        }
+        unrecorded_stack_trace_stats.num_allocations++;
+        unrecorded_stack_trace_stats.allocated_bytes += size;
+    }
+
+    /**
+     * Removes the return type and parameters from a demangled function name, i.e.
+     * "std::vector<int> Foo::bar<int>(int)" becomes "Foo::bar<int>"
+     *
+     * @param demangled_name The demangled name of the function
+     *
+     * @return the qualified name of the function
+     */
+    std::string getQualifiedFunctionName(const std::string& demangled_name)
+    {
+        int template_depth         = 0;
+        std::size_t name_start     = 0;
+        std::size_t name_end       = demangled_name.size();
+        const std::string OPERATOR = "operator";
+        for (std::size_t i = 0; i < demangled_name.size(); i++)
+        {
+            if (demangled_name.compare(i, OPERATOR.size(), OPERATOR) == 0)
+            {
+                // Operator names can contain spaces, brackets and parentheses
+                break;
+            }
+            const char c = demangled_name[i];
+            if (c == '<')
+            {
+                template_depth++;
+            }
+            else if (c == '>')
+            {
+                template_depth--;
+            }
+            else if (c == ' ' && template_depth == 0)
+            {
+                name_start = i + 1;
+            }
+            else if (c == '(' && template_depth == 0)
+            {
+                name_end = i;
+                break;
+            }
+        }
+        return demangled_name.substr(name_start, name_end - name_start);
+    }
+
+    /**
+     * Returns whether the given function belongs to the standard library or the
+     * allocation tracking itself, rather than the code that wanted the memory
+     *
+     * @param function_name The qualified name of the function
+     *
+     * @return whether the function should be skipped when naming a call site
+     */
+    bool isAllocatorFunction(const std::string& function_name)
+    {
+        for (const std::string& prefix :
+             {"operator new", "AllocationTracker::", "std::", "__gnu_cxx::"})
+        {
+            if (function_name.compare(0, prefix.size(), prefix) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Names a stack trace after the first function in it that is not part of the
+     * allocator or the standard library. Functions that can't be named are skipped,
+     * since they are usually internal to the allocator
+     *
+     * @param stack_trace The stack trace
+     *
+     * @return the name of the call site
+     */
+    std::string getCallSiteName(const RecordedStackTrace& stack_trace)
+    {
+        std::string fallback_name;
+        for (std::size_t i = 0; i < stack_trace.depth; i++)
+        {
+            Dl_info info;
+            if (dladdr(stack_trace.frames[i], &info) == 0 || info.dli_sname == nullptr)
+            {
+                // The function isn't in the dynamic symbol table (ex. it has internal
+                // linkage), so the best we can do is its address
+                if (fallback_name.empty())
+                {
+                    std::ostringstream address;
+                    address << stack_trace.frames[i];
+                    fallback_name = address.str();
+                }
+                continue;
+            }
+
+            std::string function_name =
+                getQualifiedFunctionName(demangleTypeId(info.dli_sname));
+            if (!isAllocatorFunction(function_name))
+            {
+                return function_name;
+            }
+        }
+        return fallback_name;
+    }
+
+    void warmUpStackTraces()
+    {
+        // The first stack trace loads the unwinder, which allocates, so we get that
+        // out of the way before recording any call sites
+        static std::once_flag warm_up_flag;
+        std::call_once(warm_up_flag, []() {
+            std::array<void*, AllocationTracker::MAX_STACK_TRACE_DEPTH> frames;
+            thread_state.capturing_stack_trace = true;
+            backtrace(frames.data(), static_cast<int>(frames.size()));
+            thread_state.capturing_stack_trace = false;
+        });
+    }
+}  // namespace
+
+AllocationStats AllocationStats::operator-(const AllocationStats& other) const
+{
+    return AllocationStats{num_allocations - other.num_allocations,
+                           allocated_bytes - other.allocated_bytes};
+}
+
+void AllocationTracker::setEnabled(bool enabled)
+{
+    tracking_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool AllocationTracker::isEnabled()
+{
+    return tracking_enabled.load(std::memory_order_relaxed);
+}
+
+bool AllocationTracker::isHookInstalled()
+{
+    return hook_installed;
+}
+
+AllocationStats AllocationTracker::getThreadAllocationStats()
+{
+    return thread_state.stats;
+}
+
+bool AllocationTracker::startRecordingCallSites()
+{
+    if (thread_state.recording_call_sites)
+    {
+        return true;
+    }
+    bool expected = false;
+    if (!call_sites_being_recorded.compare_exchange_strong(expected, true))
+    {
+        return false;
+    }
+
+    warmUpStackTraces();
+    for (auto& stack_trace : recorded_stack_traces)
+    {
+        stack_trace.hash  = 0;
+        stack_trace.stats = AllocationStats();
+    }
+    unrecorded_stack_trace_stats      = AllocationStats();
+    thread_state.recording_call_sites = true;
+    return true;
+}
+
+bool AllocationTracker::isRecordingCallSites()
+{
+    return thread_state.recording_call_sites;
+}
+
+std::vector<AllocationCallSite> AllocationTracker::stopRecordingCallSites(
+    std::size_t max_call_sites)
+{
+    if (!thread_state.recording_call_sites)
+    {
+        return {};
+    }
+    thread_state.recording_call_sites = false;
+
+    // Many stack traces can come from the same function, ex. when it is called from
+    // different places, so they are combined by name
+    std::unordered_map<std::string, AllocationStats> call_site_stats;
+    for (const auto& stack_trace : recorded_stack_traces)
+    {
+        if (stack_trace.hash != 0)
+        {
+            AllocationStats& stats = call_site_stats[getCallSiteName(stack_trace)];
+            stats.num_allocations += stack_trace.stats.num_allocations;
+            stats.allocated_bytes += stack_trace.stats.allocated_bytes;
+        }
+    }
+    if (unrecorded_stack_trace_stats.num_allocations > 0)
+    {
+        call_site_stats["unknown"] = unrecorded_stack_trace_stats;
+    }
+    call_sites_being_recorded = false;
+
+    std::vector<AllocationCallSite> call_sites;
+    call_sites.reserve(call_site_stats.size());
+    for (const auto& [name, stats] : call_site_stats)
+    {
+        call_sites.emplace_back(AllocationCallSite{name, stats});
+    }
+    std::sort(
+        call_sites.begin(), call_sites.end(),
+        [](const AllocationCallSite& lhs, const AllocationCallSite& rhs) {
+            return std::make_tuple(lhs.stats.num_allocations, lhs.stats.allocated_bytes) >
+                   std::make_tuple(rhs.stats.num_allocations, rhs.stats.allocated_bytes);
+        });
+    if (call_sites.size() > max_call_sites)
+    {
+        call_sites.resize(max_call_sites);
+    }
+    return call_sites;
+}
+
+void AllocationTracker::recordAllocation(std::size_t size)
+{
+    if (!tracking_enabled.load(std::memory_order_relaxed) ||
+        thread_state.capturing_stack_trace)
+    {
+        return;
+    }
+
+    thread_state.stats.num_allocations++;
+    thread_state.stats.allocated_bytes += size;
+
+    if (thread_state.recording_call_sites)
+    {
+        std::array<void*, MAX_STACK_TRACE_DEPTH> frames;
+        thread_state.capturing_stack_trace = true;
+        int depth = backtrace(frames.data(), static_cast<int>(frames.size()));
+        thread_state.capturing_stack_trace = false;
+        recordStackTrace(frames.data(), static_cast<std::size_t>(std::max(depth, 0)),
+                         size);
+    }
+}
+
+void AllocationTracker::markHookInstalled()
+{
+    hook_installed = true;
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * The number of heap allocations made, and the number of bytes they requested
+ */
+struct AllocationStats
+{
+    uint64_t num_allocations = 0;
+    uint64_t allocated_bytes = 0;
+
+    AllocationStats operator-(const AllocationStats& other) const;
+};
+
+/**
+ * A place in the code that allocates memory, and how much it allocated
+ */
+struct AllocationCallSite
+{
+    // The name of the function that made the allocations
+    std::string name;
+    AllocationStats stats;
+};
+
+/**
+ * Counts the heap allocations made by each thread, and optionally which functions made
+ * them, so that we can see how much allocator churn each stage of the AI causes.
+ *
+ * Allocations are only seen if the binary links in the replacement global operator new
+ * from the allocation_tracking_operator_new target, which reports every allocation to
+ * recordAllocation. Tracking is off by default, in which case the replacement operator
+ * new only has to check a flag before calling malloc.
+ *
+ * Finding call sites captures a stack trace on every allocation, which is slow, so it is
+ * only done on a thread between startRecordingCallSites and stopRecordingCallSites.
+ * Call sites are named using the dynamic symbol table, so binaries should be linked with
+ * -rdynamic (the allocation_tracking_operator_new target does this), otherwise only
+ * addresses are reported.
+ */
+class AllocationTracker
+{
+   public:
+    AllocationTracker() = delete;
+
+    /**
+     * Sets whether allocations are tracked
+     *
+     * @param enabled Whether allocations are tracked
+     */
+    static void setEnabled(bool enabled);
+
+    /**
+     * Returns whether allocations are being tracked
+     *
+     * @return whether allocations are being tracked
+     */
+    static bool isEnabled();
+
+    /**
+     * Returns whether the replacement operator new that reports allocations to the
+     * tracker is linked into this binary. If it is not, no allocations will be seen
+     *
+     * @return whether allocations can be tracked in this binary
+     */
+    static bool isHookInstalled();
+
+    /**
+     * Returns the allocations made by the calling thread while tracking was enabled.
+     * The counts only ever increase, so the allocations made by a section of code can
+     * be found by subtracting the counts from before it ran
+     *
+     * @return the allocations made by the calling thread
+     */
+    static AllocationStats getThreadAllocationStats();
+
+    /**
+     * Starts recording the call sites of the allocations made by the calling thread,
+     * discarding any call sites that were recorded before. Only one thread can record
+     * call sites at a time, so this does nothing if another thread is recording
+     *
+     * @return whether the calling thread is now recording call sites
+     */
+    static bool startRecordingCallSites();
+
+    /**
+     * Returns whether the calling thread is recording call sites
+     *
+     * @return whether the calling thread is recording call sites
+     */
+    static bool isRecordingCallSites();
+
+    /**
+     * Stops recording call sites on the calling thread, and returns the call sites that
+     * made the most allocations since recording started
+     *
+     * @param max_call_sites The maximum number of call sites to return
+     *
+     * @return the call sites that made the most allocations, from most to least
+     */
+    static std::vector<AllocationCallSite> stopRecordingCallSites(
+        std::size_t max_call_sites);
+
+    /**
+     * Records an allocation made by the calling thread. Called by the replacement
+     * operator new on every allocation, so this must never allocate itself
+     *
+     * @param size The number of bytes that were requested
+     */
+    static void recordAllocation(std::size_t size);
+
+    /**
+     * Marks the replacement operator new as linked into this binary
+     */
+    static void markHookInstalled();
+
+    // The maximum number of distinct stack traces that can be recorded between
+    // startRecordingCallSites and stopRecordingCallSites. Allocations from any other
+    // stack traces are counted towards an "unknown" call site
+    static constexpr std::size_t MAX_RECORDED_STACK_TRACES = 4096;
+    // How many frames of each allocation's stack trace are recorded
+    static constexpr std::size_t MAX_STACK_TRACE_DEPTH = 12;
+};
@@ -0,0 +1,125 @@
+#include "software/ai/profiler/allocation_tracker.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+/**
+ * Makes the given number of heap allocations of the given size. The memory is allocated
+ * by calling operator new directly, so the allocations can't be optimized out. This is
+ * not in an anonymous namespace so that it is in the dynamic symbol table, which is
+ * used to name call sites
+ *
+ * @param num_allocations The number of allocations to make
+ * @param size The size of each allocation in bytes
+ */
+__attribute__((noinline)) void allocateFromAllocationTrackerTest(
+    unsigned int num_allocations, std::size_t size)
+{
+    for (unsigned int i = 0; i < num_allocations; i++)
+    {
+        ::operator delete(::operator new(size));
+    }
+}
+
+class AllocationTrackerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        AllocationTracker::setEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        AllocationTracker::stopRecordingCallSites(0);
+        AllocationTracker::setEnabled(false);
+    }
+};
+
+TEST_F(AllocationTrackerTest, hook_is_installed)
+{
+    EXPECT_TRUE(AllocationTracker::isHookInstalled());
+}
+
+TEST_F(AllocationTrackerTest, allocations_are_counted_when_enabled)
+{
+    AllocationStats start_stats = AllocationTracker::getThreadAllocationStats();
+    allocateFromAllocationTrackerTest(3, 100);
+    AllocationStats stats = AllocationTracker::getThreadAllocationStats() - start_stats;
+
+    EXPECT_EQ(3, stats.num_allocations);
+    EXPECT_EQ(300, stats.allocated_bytes);
+}
+
+TEST_F(AllocationTrackerTest, allocations_are_not_counted_when_disabled)
+{
+    AllocationTracker::setEnabled(false);
+
+    AllocationStats start_stats = AllocationTracker::getThreadAllocationStats();
+    allocateFromAllocationTrackerTest(3, 100);
+    AllocationStats stats = AllocationTracker::getThreadAllocationStats() - start_stats;
+
+    EXPECT_EQ(0, stats.num_allocations);
+    EXPECT_EQ(0, stats.allocated_bytes);
+}
+
+TEST_F(AllocationTrackerTest, allocations_are_counted_per_thread)
+{
+    AllocationStats start_stats = AllocationTracker::getThreadAllocationStats();
+    std::thread other_thread([]() { allocateFromAllocationTrackerTest(5, 10); });
+    other_thread.join();
+    AllocationStats stats = AllocationTracker::getThreadAllocationStats() - start_stats;
+
+    // Starting the thread allocates on this thread, but the allocations made by the
+    // other thread are not counted here
+    EXPECT_LT(stats.num_allocations, 5);
+}
+
+TEST_F(AllocationTrackerTest, call_sites_that_allocate_the_most_are_reported_first)
+{
+    ASSERT_TRUE(AllocationTracker::startRecordingCallSites());
+    EXPECT_TRUE(AllocationTracker::isRecordingCallSites());
+    allocateFromAllocationTrackerTest(20, 8);
+    auto call_sites = AllocationTracker::stopRecordingCallSites(3);
+    EXPECT_FALSE(AllocationTracker::isRecordingCallSites());
+
+    ASSERT_GE(call_sites.size(), 1);
+    EXPECT_LE(call_sites.size(), 3);
+    EXPECT_EQ("allocateFromAllocationTrackerTest", call_sites[0].name);
+    EXPECT_EQ(20, call_sites[0].stats.num_allocations);
+    EXPECT_EQ(160, call_sites[0].stats.allocated_bytes);
+    for (std::size_t i = 1; i < call_sites.size(); i++)
+    {
+        EXPECT_LE(call_sites[i].stats.num_allocations,
+                  call_sites[i - 1].stats.num_allocations);
+    }
+}
+
+TEST_F(AllocationTrackerTest, call_sites_from_before_recording_started_are_discarded)
+{
+    ASSERT_TRUE(AllocationTracker::startRecordingCallSites());
+    allocateFromAllocationTrackerTest(20, 8);
+    AllocationTracker::stopRecordingCallSites(0);
+
+    ASSERT_TRUE(AllocationTracker::startRecordingCallSites());
+    auto call_sites = AllocationTracker::stopRecordingCallSites(10);
+
+    for (const auto& call_site : call_sites)
+    {
+        EXPECT_NE("allocateFromAllocationTrackerTest", call_site.name);
+    }
+}
+
+TEST_F(AllocationTrackerTest, only_one_thread_can_record_call_sites)
+{
+    ASSERT_TRUE(AllocationTracker::startRecordingCallSites());
+
+    bool other_thread_started_recording = true;
+    std::thread other_thread([&other_thread_started_recording]() {
+        other_thread_started_recording = AllocationTracker::startRecordingCallSites();
+    });
+    other_thread.join();
+
+    EXPECT_FALSE(other_thread_started_recording);
+}
@@ -0,0 +1,124 @@
+#include <cstdlib>
+#include <new>
+
+#include "software/ai/profiler/allocation_tracker.h"
+
+/**
+ * Replaces the global operator new so that every allocation is reported to the
+ * AllocationTracker. Memory is still allocated with malloc, so the default operator
+ * delete (which calls free) stays compatible, but it is replaced as well for clarity.
+ *
+ * Linking this into a binary affects every allocation it makes, so it should only be
+ * linked into binaries that want to track allocations, ex. full_system and the
+ * simulated tests.
+ */
+
+namespace
+{
+    const bool hook_installed = (AllocationTracker::markHookInstalled(), true);
+
+    /**
+     * Allocates memory the way the standard operator new does, calling the new handler
+     * until the allocation succeeds or there is no new handler left
+     *
+     * @param size The number of bytes to allocate
+     * @param alignment The alignment of the memory, or 0 for the default alignment
+     *
+     * @throws std::bad_alloc if the memory could not be allocated
+     *
+     * @return the allocated memory
+     */
+    void* allocate(std::size_t size, std::size_t alignment)
+    {
+        AllocationTracker::recordAllocation(size);
+        if (size == 0)
+        {
+            size = 1;
+        }
+
+        while (true)
+        {
+            void* ptr = nullptr;
+            if (alignment == 0)
+            {
+                ptr = std::malloc(size);
+            }
+            else if (posix_memalign(&ptr, alignment, size) != 0)
+            {
+                ptr = nullptr;
+            }
+
+            if (ptr)
+            {
+                return ptr;
+            }
+
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+            {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    return allocate(size, 0);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
@@ -4,14 +4,17 @@
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/gui/drawing/navigator.h"
+#include "software/tracing/pipeline_tracer.h"
 
-ThreadedAI::ThreadedAI(std::shared_ptr<const AiConfig> ai_config,
-                       std::shared_ptr<const AiControlConfig> control_config,
-                       std::shared_ptr<const PlayConfig> play_config)
+ThreadedAI::ThreadedAI(
+    std::shared_ptr<const AiConfig> ai_config,
+    std::shared_ptr<const AiControlConfig> control_config,
+    std::shared_ptr<const PlayConfig> play_config,
+    std::shared_ptr<const ThreadedPassGenerator<EighteenZoneId>> threaded_pass_generator)
     // Disabling warnings on log buffer full, since buffer size is 1 and we always want AI
     // to use the latest World
     : FirstInFirstOutThreadedObserver<World>(DEFAULT_BUFFER_SIZE, false),
-      ai(ai_config, control_config, play_config),
+      ai(ai_config, control_config, play_config, threaded_pass_generator),
       control_config(control_config)
 {
 }
@@ -22,16 +25,25 @@ void ThreadedAI::onValueReceived(World world)
     drawAI();
 }
 
-void ThreadedAI::runAIAndSendPrimitives(const World &world)
+void ThreadedAI::runAIAndSendPrimitives(const World& world)
 {
     if (control_config->getRunAi()->value())
     {
-        auto new_primitives = ai.getPrimitives(world);
+        PipelineTracer& tracer = PipelineTracer::getGlobalTracer();
+        tracer.startStage(world.getTraceId(), PipelineStage::AI);
+
+        const auto& new_primitives = ai.getPrimitives(world);
+
+        // The stage ends before the primitives are sent, so the time the backend takes
+        // to pick them up is counted as queueing
+        tracer.endStage(world.getTraceId(), PipelineStage::AI);
 
         PlayInfo play_info = ai.getPlayInfo();
         Subject<PlayInfo>::sendValueToObservers(play_info);
 
-        Subject<TbotsProto::PrimitiveSet>::sendValueToObservers(*new_primitives);
+        Subject<TbotsProto::PrimitiveSet>::sendValueToObservers(new_primitives);
+
+        Subject<TbotsProto::AiProfile>::sendValueToObservers(ai.getAiProfile());
     }
 }
 
@@ -3,9 +3,12 @@
 #include "shared/proto/tbots_software_msgs.pb.h"
 #include "software/ai/ai.h"
 #include "software/ai/hl/stp/play_info.h"
+#include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/ai/passing/threaded_pass_generator.h"
 #include "software/gui/drawing/draw_functions.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
 #include "software/multithreading/subject.h"
+#include "software/proto/ai_profile_msg.pb.h"
 #include "software/world/world.h"
 
 /**
@@ -16,7 +19,8 @@
 class ThreadedAI : public FirstInFirstOutThreadedObserver<World>,
                    public Subject<TbotsProto::PrimitiveSet>,
                    public Subject<AIDrawFunction>,
-                   public Subject<PlayInfo>
+                   public Subject<PlayInfo>,
+                   public Subject<TbotsProto::AiProfile>
 {
    public:
     ThreadedAI() = delete;
@@ -27,10 +31,15 @@ class ThreadedAI : public FirstInFirstOutThreadedObserver<World>,
      * @param ai_config The AI configuration
      * @param control_config The AI control configuration
      * @param play_config The play configuration
+     * @param threaded_pass_generator The pass generator that is searching for passes
+     * in the background, which should observe the same Worlds as this ThreadedAI. If
+     * this is nullptr, plays generate all their passes during the tick
      */
     explicit ThreadedAI(std::shared_ptr<const AiConfig> ai_config,
                         std::shared_ptr<const AiControlConfig> control_config,
-                        std::shared_ptr<const PlayConfig> play_config);
+                        std::shared_ptr<const PlayConfig> play_config,
+                        std::shared_ptr<const ThreadedPassGenerator<EighteenZoneId>>
+                            threaded_pass_generator = nullptr);
 
    private:
     void onValueReceived(World world) override;
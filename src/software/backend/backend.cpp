@@ -1,6 +1,7 @@
 #include "software/backend/backend.h"
 
 #include "software/proto/message_translation/tbots_protobuf.h"
+#include "software/tracing/pipeline_tracer.h"
 
 void Backend::receiveRobotStatus(TbotsProto::RobotStatus msg)
 {
@@ -13,6 +14,7 @@ void Backend::receiveRobotStatus(TbotsProto::RobotStatus msg)
 void Backend::receiveSSLWrapperPacket(SSLProto::SSL_WrapperPacket msg)
 {
     SensorProto sensor_msg;
+    sensor_msg.set_trace_id(PipelineTracer::getGlobalTracer().startTrace());
     *(sensor_msg.mutable_ssl_vision_msg())        = msg;
     *(sensor_msg.mutable_backend_received_time()) = *createCurrentTimestamp();
     Subject<SensorProto>::sendValueToObservers(sensor_msg);
@@ -25,3 +27,23 @@ void Backend::receiveSSLReferee(SSLProto::Referee msg)
     *(sensor_msg.mutable_backend_received_time()) = *createCurrentTimestamp();
     Subject<SensorProto>::sendValueToObservers(sensor_msg);
 }
+
+void Backend::startSendingPrimitives(const TbotsProto::PrimitiveSet& primitives)
+{
+    PipelineTracer::getGlobalTracer().startStage(primitives.trace_id(),
+                                                 PipelineStage::BACKEND);
+}
+
+void Backend::finishSendingPrimitives(const TbotsProto::PrimitiveSet& primitives)
+{
+    PipelineTracer& tracer = PipelineTracer::getGlobalTracer();
+    tracer.endStage(primitives.trace_id(), PipelineStage::BACKEND);
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now - last_pipeline_latency_publish_time >= PIPELINE_LATENCY_PUBLISH_PERIOD)
+    {
+        Subject<TbotsProto::PipelineLatency>::sendValueToObservers(
+            *tracer.getPipelineLatency());
+        last_pipeline_latency_publish_time = now;
+    }
+}
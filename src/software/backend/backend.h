@@ -1,8 +1,11 @@
 #pragma once
 
+#include <chrono>
+
 #include "shared/proto/tbots_software_msgs.pb.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
 #include "software/multithreading/subject.h"
+#include "software/proto/pipeline_latency_msg.pb.h"
 #include "software/proto/sensor_msg.pb.h"
 #include "software/world/world.h"
 
@@ -13,8 +16,12 @@
  *
  * This produce/consume pattern is performed by extending both "Observer" and
  * "Subject". Please see the implementation of those classes for details.
+ *
+ * The Backend is where vision packets enter the system and primitives leave it, so it
+ * also measures and periodically publishes the latency between the two.
  */
 class Backend : public Subject<SensorProto>,
+                public Subject<TbotsProto::PipelineLatency>,
                 public FirstInFirstOutThreadedObserver<World>,
                 public FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>
 {
@@ -32,4 +39,28 @@ class Backend : public Subject<SensorProto>,
     void receiveRobotStatus(TbotsProto::RobotStatus msg);
     void receiveSSLWrapperPacket(SSLProto::SSL_WrapperPacket msg);
     void receiveSSLReferee(SSLProto::Referee msg);
+
+   protected:
+    /**
+     * Records that the backend has started sending the given primitives to the robots,
+     * for measuring the latency of the pipeline
+     *
+     * @param primitives The primitives being sent
+     */
+    void startSendingPrimitives(const TbotsProto::PrimitiveSet& primitives);
+
+    /**
+     * Records that the backend has finished sending the given primitives to the robots,
+     * and publishes the latency of the pipeline if it hasn't been published recently
+     *
+     * @param primitives The primitives that were sent
+     */
+    void finishSendingPrimitives(const TbotsProto::PrimitiveSet& primitives);
+
+   private:
+    // How often the latency of the pipeline is published
+    static constexpr std::chrono::seconds PIPELINE_LATENCY_PUBLISH_PERIOD =
+        std::chrono::seconds(1);
+    std::chrono::steady_clock::time_point last_pipeline_latency_publish_time =
+        std::chrono::steady_clock::now();
 };
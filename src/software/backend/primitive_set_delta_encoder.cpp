@@ -0,0 +1,111 @@
+#include "software/backend/primitive_set_delta_encoder.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+PrimitiveSetDeltaEncoder::PrimitiveSetDeltaEncoder(unsigned int keyframe_period,
+                                                   unsigned int redundancy)
+    : keyframe_period(keyframe_period),
+      redundancy(redundancy),
+      encoder_mutex(),
+      last_sequence_number(0),
+      robot_primitive_states(),
+      acknowledged_sequence_numbers(),
+      serialized_primitive_buffer()
+{
+    if (keyframe_period == 0)
+    {
+        throw std::invalid_argument("The keyframe period must be at least 1");
+    }
+    if (redundancy == 0)
+    {
+        throw std::invalid_argument("The redundancy must be at least 1");
+    }
+}
+
+TbotsProto::PrimitiveSet PrimitiveSetDeltaEncoder::encode(
+    const TbotsProto::PrimitiveSet& primitive_set)
+{
+    std::scoped_lock lock(encoder_mutex);
+
+    uint64_t sequence_number = ++last_sequence_number;
+    // The first PrimitiveSet is always a keyframe
+    bool is_keyframe = (sequence_number - 1) % keyframe_period == 0;
+
+    TbotsProto::PrimitiveSet encoded_primitive_set;
+    *encoded_primitive_set.mutable_time_sent() = primitive_set.time_sent();
+    encoded_primitive_set.set_trace_id(primitive_set.trace_id());
+    encoded_primitive_set.set_sequence_number(sequence_number);
+    encoded_primitive_set.set_is_keyframe(is_keyframe);
+
+    // Forget the robots that are no longer being sent primitives
+    for (auto iter = robot_primitive_states.begin();
+         iter != robot_primitive_states.end();)
+    {
+        if (primitive_set.robot_primitives().count(iter->first) == 0)
+        {
+            iter = robot_primitive_states.erase(iter);
+        }
+        else
+        {
+            iter++;
+        }
+    }
+
+    auto& encoded_robot_primitives = *encoded_primitive_set.mutable_robot_primitives();
+    for (const auto& [robot_id, primitive] : primitive_set.robot_primitives())
+    {
+        primitive.SerializeToString(&serialized_primitive_buffer);
+
+        auto state_iter = robot_primitive_states.find(robot_id);
+        if (state_iter == robot_primitive_states.end())
+        {
+            state_iter =
+                robot_primitive_states
+                    .emplace(robot_id, RobotPrimitiveState{serialized_primitive_buffer,
+                                                           sequence_number})
+                    .first;
+        }
+        else if (state_iter->second.serialized_primitive != serialized_primitive_buffer)
+        {
+            state_iter->second.serialized_primitive.swap(serialized_primitive_buffer);
+            state_iter->second.changed_sequence_number = sequence_number;
+        }
+
+        if (is_keyframe ||
+            mustSendPrimitive(robot_id, state_iter->second, sequence_number))
+        {
+            encoded_robot_primitives[robot_id] = primitive;
+        }
+    }
+
+    return encoded_primitive_set;
+}
+
+void PrimitiveSetDeltaEncoder::acknowledge(RobotId robot_id, uint64_t sequence_number)
+{
+    if (sequence_number == 0)
+    {
+        return;
+    }
+
+    std::scoped_lock lock(encoder_mutex);
+    uint64_t& acknowledged_sequence_number = acknowledged_sequence_numbers[robot_id];
+    acknowledged_sequence_number =
+        std::max(acknowledged_sequence_number, sequence_number);
+}
+
+bool PrimitiveSetDeltaEncoder::mustSendPrimitive(RobotId robot_id,
+                                                 const RobotPrimitiveState& state,
+                                                 uint64_t sequence_number) const
+{
+    auto acknowledged_iter = acknowledged_sequence_numbers.find(robot_id);
+    if (acknowledged_iter != acknowledged_sequence_numbers.end())
+    {
+        // Every PrimitiveSet since the primitive changed contains the primitive, so
+        // the robot has it once it acknowledges any of them
+        return acknowledged_iter->second < state.changed_sequence_number;
+    }
+
+    return sequence_number - state.changed_sequence_number < redundancy;
+}
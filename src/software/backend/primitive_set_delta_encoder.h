@@ -0,0 +1,100 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "shared/proto/tbots_software_msgs.pb.h"
+#include "software/world/robot_state.h"
+
+/**
+ * Delta encodes the PrimitiveSets sent to the robots so primitives that the robots
+ * already have are not sent again every tick.
+ *
+ * Every encoded PrimitiveSet gets the next sequence number, and contains the primitives
+ * for the whole team in one message. A robot's primitive is left out of an encoded
+ * PrimitiveSet when the robot is known to already be running it:
+ * - If the robot acknowledges the PrimitiveSets it receives, its primitive is sent
+ *   until it acknowledges a PrimitiveSet sent after the primitive last changed
+ * - Otherwise, a changed primitive is sent in the next `redundancy` PrimitiveSets so it
+ *   still arrives if some of them are lost
+ *
+ * Every `keyframe_period` PrimitiveSets a keyframe containing every primitive is sent,
+ * which bounds how long a robot that missed an update runs a stale primitive.
+ *
+ * This class is thread-safe, so PrimitiveSets can be encoded and acknowledged from
+ * different threads.
+ */
+class PrimitiveSetDeltaEncoder
+{
+   public:
+    /**
+     * Creates a new PrimitiveSetDeltaEncoder
+     *
+     * @param keyframe_period How often to send a keyframe, in number of PrimitiveSets.
+     * Must be at least 1. A period of 1 sends every primitive in every PrimitiveSet
+     * @param redundancy How many PrimitiveSets a changed primitive is sent in for robots
+     * that have not acknowledged any PrimitiveSets. Must be at least 1
+     *
+     * @throws std::invalid_argument if keyframe_period or redundancy is 0
+     */
+    explicit PrimitiveSetDeltaEncoder(unsigned int keyframe_period,
+                                      unsigned int redundancy);
+    PrimitiveSetDeltaEncoder() = delete;
+
+    /**
+     * Encodes the given PrimitiveSet, leaving out the primitives the robots already
+     * have. Robots that are not in the given PrimitiveSet are forgotten, so their
+     * primitives are sent in full if they return.
+     *
+     * @param primitive_set The primitives for every robot on the team
+     *
+     * @return the delta encoded PrimitiveSet to send
+     */
+    TbotsProto::PrimitiveSet encode(const TbotsProto::PrimitiveSet& primitive_set);
+
+    /**
+     * Records that a robot received the PrimitiveSet with the given sequence number
+     *
+     * @param robot_id The id of the robot
+     * @param sequence_number The sequence number of the most recent PrimitiveSet the
+     * robot received. 0 means the robot has not received any PrimitiveSets and is
+     * ignored
+     */
+    void acknowledge(RobotId robot_id, uint64_t sequence_number);
+
+   private:
+    // What the encoder knows about the primitive of each robot
+    struct RobotPrimitiveState
+    {
+        // The serialized primitive, used to check if the primitive changed
+        std::string serialized_primitive;
+        // The sequence number of the first PrimitiveSet the primitive was sent in
+        uint64_t changed_sequence_number;
+    };
+
+    /**
+     * Returns whether the given robot's primitive has to be sent in the PrimitiveSet
+     * with the given sequence number
+     *
+     * @param robot_id The id of the robot
+     * @param state The state of the robot's primitive
+     * @param sequence_number The sequence number of the PrimitiveSet being encoded
+     *
+     * @return true if the primitive has to be sent, false if the robot already has it
+     */
+    bool mustSendPrimitive(RobotId robot_id, const RobotPrimitiveState& state,
+                           uint64_t sequence_number) const;
+
+    const unsigned int keyframe_period;
+    const unsigned int redundancy;
+
+    std::mutex encoder_mutex;
+    // The sequence number of the last encoded PrimitiveSet
+    uint64_t last_sequence_number;
+    std::map<RobotId, RobotPrimitiveState> robot_primitive_states;
+    // The most recent sequence number each robot acknowledged
+    std::map<RobotId, uint64_t> acknowledged_sequence_numbers;
+    // Reused between calls to avoid reallocating while comparing primitives
+    std::string serialized_primitive_buffer;
+};
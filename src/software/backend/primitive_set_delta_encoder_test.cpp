@@ -0,0 +1,297 @@
+#include "software/backend/primitive_set_delta_encoder.h"
+
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <optional>
+#include <random>
+
+#include "software/proto/primitive/primitive_msg_factory.h"
+
+namespace
+{
+    /**
+     * Creates a move primitive to the given destination
+     *
+     * @param x The x coordinate of the destination
+     *
+     * @return a move primitive to (x, 0)
+     */
+    TbotsProto::Primitive createTestPrimitive(double x)
+    {
+        return *createMovePrimitive(Point(x, 0), 0, Angle::zero(), DribblerMode::OFF,
+                                    {AutoChipOrKickMode::OFF, 0},
+                                    MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0);
+    }
+
+    /**
+     * Creates a PrimitiveSet with a primitive for robots 0 to num_robots - 1
+     *
+     * @param num_robots The number of robots
+     * @param x The x coordinate of the destination of every primitive
+     *
+     * @return the PrimitiveSet
+     */
+    TbotsProto::PrimitiveSet createTestPrimitiveSet(unsigned int num_robots, double x)
+    {
+        TbotsProto::PrimitiveSet primitive_set;
+        for (RobotId id = 0; id < num_robots; id++)
+        {
+            (*primitive_set.mutable_robot_primitives())[id] = createTestPrimitive(x);
+        }
+        return primitive_set;
+    }
+}  // namespace
+
+TEST(PrimitiveSetDeltaEncoderTest, zero_keyframe_period_or_redundancy_throws)
+{
+    EXPECT_THROW(PrimitiveSetDeltaEncoder(0, 1), std::invalid_argument);
+    EXPECT_THROW(PrimitiveSetDeltaEncoder(1, 0), std::invalid_argument);
+}
+
+TEST(PrimitiveSetDeltaEncoderTest, first_primitive_set_is_a_keyframe)
+{
+    PrimitiveSetDeltaEncoder encoder(10, 1);
+    auto primitive_set = createTestPrimitiveSet(3, 1.0);
+    primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(12.5);
+    primitive_set.set_trace_id(7);
+
+    auto encoded = encoder.encode(primitive_set);
+
+    EXPECT_EQ(1, encoded.sequence_number());
+    EXPECT_TRUE(encoded.is_keyframe());
+    EXPECT_EQ(3, encoded.robot_primitives_size());
+    EXPECT_DOUBLE_EQ(12.5, encoded.time_sent().epoch_timestamp_seconds());
+    EXPECT_EQ(7, encoded.trace_id());
+}
+
+TEST(PrimitiveSetDeltaEncoderTest, unchanged_primitives_are_sent_redundancy_times)
+{
+    PrimitiveSetDeltaEncoder encoder(100, 3);
+    auto primitive_set = createTestPrimitiveSet(3, 1.0);
+
+    for (uint64_t sequence_number = 1; sequence_number <= 3; sequence_number++)
+    {
+        auto encoded = encoder.encode(primitive_set);
+        EXPECT_EQ(sequence_number, encoded.sequence_number());
+        EXPECT_EQ(3, encoded.robot_primitives_size());
+    }
+
+    auto encoded = encoder.encode(primitive_set);
+    EXPECT_EQ(4, encoded.sequence_number());
+    EXPECT_FALSE(encoded.is_keyframe());
+    EXPECT_EQ(0, encoded.robot_primitives_size());
+}
+
+TEST(PrimitiveSetDeltaEncoderTest, only_changed_primitives_are_sent)
+{
+    PrimitiveSetDeltaEncoder encoder(100, 1);
+    auto primitive_set = createTestPrimitiveSet(3, 1.0);
+    encoder.encode(primitive_set);
+
+    (*primitive_set.mutable_robot_primitives())[1] = createTestPrimitive(2.0);
+    auto encoded                                   = encoder.encode(primitive_set);
+
+    ASSERT_EQ(1, encoded.robot_primitives_size());
+    EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equals(
+        createTestPrimitive(2.0), encoded.robot_primitives().at(1)));
+}
+
+TEST(PrimitiveSetDeltaEncoderTest, keyframes_contain_every_primitive)
+{
+    PrimitiveSetDeltaEncoder encoder(5, 1);
+    auto primitive_set = createTestPrimitiveSet(4, 1.0);
+
+    for (uint64_t sequence_number = 1; sequence_number <= 11; sequence_number++)
+    {
+        auto encoded = encoder.encode(primitive_set);
+        bool expected_keyframe =
+            sequence_number == 1 || sequence_number == 6 || sequence_number == 11;
+        EXPECT_EQ(expected_keyframe, encoded.is_keyframe());
+        EXPECT_EQ(expected_keyframe ? 4 : 0, encoded.robot_primitives_size());
+    }
+}
+
+TEST(PrimitiveSetDeltaEncoderTest, primitives_are_sent_until_acknowledged)
+{
+    PrimitiveSetDeltaEncoder encoder(100, 1);
+    auto primitive_set = createTestPrimitiveSet(2, 1.0);
+    encoder.encode(primitive_set);
+    encoder.acknowledge(0, 1);
+    encoder.acknowledge(1, 1);
+
+    (*primitive_set.mutable_robot_primitives())[0] = createTestPrimitive(2.0);
+    // The primitive for robot 0 changed in PrimitiveSet 2, so it is sent until robot 0
+    // acknowledges PrimitiveSet 2 or later, even though the redundancy is 1
+    EXPECT_EQ(1, encoder.encode(primitive_set).robot_primitives().count(0));
+    EXPECT_EQ(1, encoder.encode(primitive_set).robot_primitives().count(0));
+
+    encoder.acknowledge(0, 3);
+    auto encoded = encoder.encode(primitive_set);
+    EXPECT_EQ(0, encoded.robot_primitives_size());
+}
+
+TEST(PrimitiveSetDeltaEncoderTest, acknowledging_an_older_primitive_set_is_ignored)
+{
+    PrimitiveSetDeltaEncoder encoder(100, 1);
+    auto primitive_set = createTestPrimitiveSet(1, 1.0);
+    encoder.encode(primitive_set);
+    (*primitive_set.mutable_robot_primitives())[0] = createTestPrimitive(2.0);
+    encoder.encode(primitive_set);
+
+    encoder.acknowledge(0, 2);
+    // Acknowledgements can arrive out of order
+    encoder.acknowledge(0, 1);
+    EXPECT_EQ(0, encoder.encode(primitive_set).robot_primitives_size());
+}
+
+TEST(PrimitiveSetDeltaEncoderTest, robots_that_return_are_sent_their_primitive)
+{
+    PrimitiveSetDeltaEncoder encoder(100, 1);
+    auto primitive_set = createTestPrimitiveSet(2, 1.0);
+    encoder.encode(primitive_set);
+    encoder.acknowledge(1, 1);
+
+    encoder.encode(createTestPrimitiveSet(1, 1.0));
+    auto encoded = encoder.encode(primitive_set);
+
+    // Robot 1 was forgotten, so its primitive is sent again until it acknowledges it
+    ASSERT_EQ(1, encoded.robot_primitives_size());
+    EXPECT_EQ(1, encoded.robot_primitives().count(1));
+}
+
+/**
+ * Sends a changing PrimitiveSet for a full team through a PrimitiveSetDeltaEncoder to
+ * every robot, over a loopback channel that drops packets and acknowledgements at
+ * random, and checks the robots run the correct primitives. Each robot runs the latest
+ * primitive it has received for itself and drops PrimitiveSets that arrive out of order,
+ * which is all a robot needs to do to receive delta encoded PrimitiveSets.
+ */
+class PrimitiveSetDeltaEncoderLoopbackTest
+    : public ::testing::TestWithParam<std::tuple<double, bool>>
+{
+   protected:
+    static constexpr unsigned int NUM_ROBOTS      = 11;
+    static constexpr unsigned int KEYFRAME_PERIOD = 30;
+    static constexpr unsigned int REDUNDANCY      = 3;
+
+    /**
+     * Sends the given PrimitiveSet to every robot, dropping it for each robot with the
+     * given probability
+     *
+     * @param primitive_set The PrimitiveSet to send
+     * @param loss_probability The probability a robot does not receive the PrimitiveSet
+     */
+    void sendPrimitiveSet(const TbotsProto::PrimitiveSet& primitive_set,
+                          double loss_probability)
+    {
+        auto encoded           = encoder.encode(primitive_set);
+        std::string serialized = encoded.SerializeAsString();
+        full_bytes += primitive_set.ByteSizeLong();
+        encoded_bytes += serialized.size();
+
+        std::uniform_real_distribution<double> distribution(0, 1);
+        for (RobotId id = 0; id < NUM_ROBOTS; id++)
+        {
+            if (distribution(random_engine) < loss_probability)
+            {
+                continue;
+            }
+
+            TbotsProto::PrimitiveSet received;
+            ASSERT_TRUE(received.ParseFromString(serialized));
+            if (received.sequence_number() > last_sequence_numbers[id])
+            {
+                last_sequence_numbers[id] = received.sequence_number();
+                if (received.robot_primitives().count(id) != 0)
+                {
+                    robot_primitives[id] = received.robot_primitives().at(id);
+                }
+            }
+
+            bool acknowledge = std::get<1>(GetParam());
+            if (acknowledge && distribution(random_engine) >= loss_probability)
+            {
+                encoder.acknowledge(id, last_sequence_numbers[id]);
+            }
+        }
+    }
+
+    /**
+     * Returns the number of robots that are not running the primitive in the given
+     * PrimitiveSet
+     *
+     * @param primitive_set The primitives the robots should be running
+     *
+     * @return the number of robots running the wrong primitive
+     */
+    unsigned int countRobotsWithStalePrimitives(
+        const TbotsProto::PrimitiveSet& primitive_set)
+    {
+        unsigned int num_stale = 0;
+        for (RobotId id = 0; id < NUM_ROBOTS; id++)
+        {
+            if (!robot_primitives[id] ||
+                !google::protobuf::util::MessageDifferencer::Equals(
+                    *robot_primitives[id], primitive_set.robot_primitives().at(id)))
+            {
+                num_stale++;
+            }
+        }
+        return num_stale;
+    }
+
+    PrimitiveSetDeltaEncoder encoder{KEYFRAME_PERIOD, REDUNDANCY};
+    // The primitive each robot is running, and the sequence number of the most recent
+    // PrimitiveSet it received
+    std::array<std::optional<TbotsProto::Primitive>, NUM_ROBOTS> robot_primitives;
+    std::array<uint64_t, NUM_ROBOTS> last_sequence_numbers{};
+    std::mt19937 random_engine{0};
+    size_t full_bytes    = 0;
+    size_t encoded_bytes = 0;
+};
+
+TEST_P(PrimitiveSetDeltaEncoderLoopbackTest, robots_run_the_latest_primitives)
+{
+    double loss_probability = std::get<0>(GetParam());
+
+    // Each robot gets a new primitive every 20 ticks, at different times
+    auto createPrimitiveSetForTick = [](unsigned int tick) {
+        TbotsProto::PrimitiveSet primitive_set;
+        for (RobotId id = 0; id < NUM_ROBOTS; id++)
+        {
+            (*primitive_set.mutable_robot_primitives())[id] =
+                createTestPrimitive(static_cast<double>((tick + id * 7) / 20));
+        }
+        return primitive_set;
+    };
+
+    unsigned int stale_robot_ticks = 0;
+    const unsigned int NUM_TICKS   = 600;
+    for (unsigned int tick = 0; tick < NUM_TICKS; tick++)
+    {
+        auto primitive_set = createPrimitiveSetForTick(tick);
+        sendPrimitiveSet(primitive_set, loss_probability);
+        stale_robot_ticks += countRobotsWithStalePrimitives(primitive_set);
+    }
+
+    // Robots that miss a primitive catch up when they receive a later PrimitiveSet
+    // with it, so they should rarely be running an old primitive
+    EXPECT_LT(static_cast<double>(stale_robot_ticks) / (NUM_TICKS * NUM_ROBOTS),
+              loss_probability + 0.05);
+    // Most primitives don't change between ticks, so much less data should be sent
+    EXPECT_LT(encoded_bytes, full_bytes / 2);
+
+    // Once the packet loss stops, every robot catches up by the next keyframe
+    auto primitive_set = createPrimitiveSetForTick(NUM_TICKS);
+    for (unsigned int tick = 0; tick < KEYFRAME_PERIOD; tick++)
+    {
+        sendPrimitiveSet(primitive_set, 0.0);
+    }
+    EXPECT_EQ(0, countRobotsWithStalePrimitives(primitive_set));
+}
+
+INSTANTIATE_TEST_CASE_P(PacketLoss, PrimitiveSetDeltaEncoderLoopbackTest,
+                        ::testing::Combine(::testing::Values(0.0, 0.1, 0.3),
+                                           ::testing::Bool()));
@@ -18,7 +18,9 @@ RadioBackend::RadioBackend(std::shared_ptr<const BackendConfig> config)
 
 void RadioBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 {
+    startSendingPrimitives(primitives);
     radio_output.sendPrimitives(primitives);
+    finishSendingPrimitives(primitives);
 }
 
 void RadioBackend::onValueReceived(World world)
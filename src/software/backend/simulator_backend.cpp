@@ -31,7 +31,9 @@ SimulatorBackend::SimulatorBackend(std::shared_ptr<const BackendConfig> config)
 
 void SimulatorBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 {
+    startSendingPrimitives(primitives);
     primitive_output->sendProto(primitives);
+    finishSendingPrimitives(primitives);
 
     if (sensor_fusion_config->getOverrideGameControllerDefendingSide()->value())
     {
@@ -6,7 +6,7 @@ SSLProtoClient::SSLProtoClient(
     std::shared_ptr<const SslCommunicationConfig> ssl_communication_config)
     : ssl_communication_config(ssl_communication_config),
       ssl_vision_listener(
-          std::make_unique<ThreadedProtoUdpListener<SSLProto::SSL_WrapperPacket>>(
+          std::make_unique<ThreadedBatchedProtoUdpListener<SSLProto::SSL_WrapperPacket>>(
               ssl_communication_config->getVisionIpv4Address()->value(),
               ssl_communication_config->getVisionPort()->value(),
               received_vision_callback, true)),
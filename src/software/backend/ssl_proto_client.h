@@ -10,6 +10,9 @@
  * This class encapsulates ProtoUdpListener<SSLProto::SSL_WrapperPacket> and
  * ProtoUdpListener<SSLProto::Referee> to abstract all ssl protobuf networking
  * operations behind a single interface.
+ *
+ * Vision packets arrive in bursts from every camera at once, so they are received with
+ * a BatchedProtoUdpListener.
  */
 class SSLProtoClient
 {
@@ -31,7 +34,7 @@ class SSLProtoClient
 
    private:
     std::shared_ptr<const SslCommunicationConfig> ssl_communication_config;
-    std::unique_ptr<ThreadedProtoUdpListener<SSLProto::SSL_WrapperPacket>>
+    std::unique_ptr<ThreadedBatchedProtoUdpListener<SSLProto::SSL_WrapperPacket>>
         ssl_vision_listener;
     std::unique_ptr<ThreadedProtoUdpListener<SSLProto::Referee>> ssl_referee_listener;
 };
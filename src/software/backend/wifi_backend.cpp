@@ -37,12 +37,22 @@ WifiBackend::WifiBackend(std::shared_ptr<const BackendConfig> config)
                                                  arduino_config->getPort()->value());
     estop_reader = std::make_unique<ThreadedEstopReader>(std::move(uart_device), 0);
 
+    if (network_config->getDeltaEncodePrimitives()->value())
+    {
+        primitive_set_encoder = std::make_unique<PrimitiveSetDeltaEncoder>(
+            static_cast<unsigned int>(
+                network_config->getPrimitiveKeyframePeriod()->value()),
+            static_cast<unsigned int>(network_config->getPrimitiveRedundancy()->value()));
+    }
+
     // connect to current channel
     joinMulticastChannel(channel, network_interface);
 }
 
 void WifiBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 {
+    startSendingPrimitives(primitives);
+
     // check if estop has been set
     if (estop_reader != nullptr && !estop_reader->isEstopPlay())
     {
@@ -55,7 +65,15 @@ void WifiBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
         }
     }
 
-    primitive_output->sendProto(primitives);
+    if (primitive_set_encoder)
+    {
+        primitive_output->sendProto(primitive_set_encoder->encode(primitives));
+    }
+    else
+    {
+        primitive_output->sendProto(primitives);
+    }
+    finishSendingPrimitives(primitives);
 
 
     if (sensor_fusion_config->getOverrideGameControllerDefendingSide()->value())
@@ -84,6 +102,17 @@ void WifiBackend::receiveRobotLogs(TbotsProto::RobotLog log)
               << "]: " << log.log_msg() << std::endl;
 }
 
+void WifiBackend::receiveRobotStatusAndAcknowledgePrimitives(
+    TbotsProto::RobotStatus robot_status)
+{
+    if (primitive_set_encoder)
+    {
+        primitive_set_encoder->acknowledge(
+            robot_status.robot_id(), robot_status.last_primitive_set_sequence_number());
+    }
+    receiveRobotStatus(robot_status);
+}
+
 void WifiBackend::joinMulticastChannel(int channel, const std::string& interface)
 {
     vision_output.reset(new ThreadedProtoUdpSender<TbotsProto::Vision>(
@@ -96,7 +125,9 @@ void WifiBackend::joinMulticastChannel(int channel, const std::string& interface
 
     robot_status_input.reset(new ThreadedProtoUdpListener<TbotsProto::RobotStatus>(
         std::string(ROBOT_MULTICAST_CHANNELS[channel]) + "%" + interface,
-        ROBOT_STATUS_PORT, boost::bind(&Backend::receiveRobotStatus, this, _1), true));
+        ROBOT_STATUS_PORT,
+        boost::bind(&WifiBackend::receiveRobotStatusAndAcknowledgePrimitives, this, _1),
+        true));
 
     robot_log_input.reset(new ThreadedProtoUdpListener<TbotsProto::RobotLog>(
         std::string(ROBOT_MULTICAST_CHANNELS[channel]) + "%" + interface, ROBOT_LOGS_PORT,
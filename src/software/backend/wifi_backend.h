@@ -5,6 +5,7 @@
 #include "shared/proto/robot_status_msg.pb.h"
 #include "shared/proto/tbots_software_msgs.pb.h"
 #include "software/backend/backend.h"
+#include "software/backend/primitive_set_delta_encoder.h"
 #include "software/backend/ssl_proto_client.h"
 #include "software/estop/threaded_estop_reader.h"
 #include "software/networking/threaded_proto_udp_listener.h"
@@ -44,6 +45,14 @@ class WifiBackend : public Backend
      */
     void receiveRobotLogs(TbotsProto::RobotLog robot_log);
 
+    /**
+     * Callback for the RobotStatus listener. Acknowledges the most recent PrimitiveSet
+     * the robot received if primitives are being delta encoded
+     *
+     * @param robot_status The robot_status that was received
+     */
+    void receiveRobotStatusAndAcknowledgePrimitives(TbotsProto::RobotStatus robot_status);
+
     const std::shared_ptr<const NetworkConfig> network_config;
     const std::shared_ptr<const SensorFusionConfig> sensor_fusion_config;
     const std::shared_ptr<const ArduinoConfig> arduino_config;
@@ -51,6 +60,11 @@ class WifiBackend : public Backend
     // Client to listen for SSL protobufs
     SSLProtoClient ssl_proto_client;
 
+    // Delta encodes the PrimitiveSets sent to the robots, or nullptr if every primitive
+    // is sent every tick. This is declared before the listeners so it is destroyed
+    // after them, since the RobotStatus listener thread acknowledges PrimitiveSets
+    std::unique_ptr<PrimitiveSetDeltaEncoder> primitive_set_encoder;
+
     // ProtoMulticast** to communicate with robots
     std::unique_ptr<ThreadedProtoUdpSender<TbotsProto::Vision>> vision_output;
     std::unique_ptr<ThreadedProtoUdpSender<TbotsProto::PrimitiveSet>> primitive_output;
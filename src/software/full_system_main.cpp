@@ -1,10 +1,13 @@
 #include <boost/program_options.hpp>
 #include <experimental/filesystem>
+#include <fstream>
 #include <iostream>
 #include <numeric>
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/ai/hl/stp/play_info.h"
+#include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/ai/passing/threaded_pass_generator.h"
 #include "software/ai/threaded_ai.h"
 #include "software/backend/backend.h"
 #include "software/constants.h"
@@ -15,6 +18,7 @@
 #include "software/proto/logging/proto_logger.h"
 #include "software/proto/message_translation/ssl_wrapper.h"
 #include "software/sensor_fusion/threaded_sensor_fusion.h"
+#include "software/tracing/pipeline_tracer.h"
 #include "software/util/design_patterns/generic_factory.h"
 
 // clang-format off
@@ -99,13 +103,22 @@ int main(int argc, char** argv)
                 args->getBackend()->value(), thunderbots_config->getBackendConfig());
         auto sensor_fusion = std::make_shared<ThreadedSensorFusion>(
             thunderbots_config->getSensorFusionConfig());
-        auto ai = std::make_shared<ThreadedAI>(thunderbots_config->getAiConfig(),
-                                               thunderbots_config->getAiControlConfig(),
-                                               thunderbots_config->getPlayConfig());
+        // Passes are searched for in the background on the same Worlds the AI gets, so
+        // plays can use them without generating passes during the tick
+        auto pass_generator = std::make_shared<ThreadedPassGenerator<EighteenZoneId>>(
+            [](const Field& field) {
+                return std::make_shared<const EighteenZonePitchDivision>(field);
+            },
+            thunderbots_config->getPlayConfig()->getPassingConfig());
+        auto ai = std::make_shared<ThreadedAI>(
+            thunderbots_config->getAiConfig(), thunderbots_config->getAiControlConfig(),
+            thunderbots_config->getPlayConfig(), pass_generator);
         std::shared_ptr<ThreadedFullSystemGUI> visualizer;
 
         // Connect observers
         ai->Subject<TbotsProto::PrimitiveSet>::registerObserver(backend);
+        ai->Subject<TbotsProto::PrimitiveSet>::registerObserver(sensor_fusion);
+        sensor_fusion->Subject<World>::registerObserver(pass_generator);
         sensor_fusion->Subject<World>::registerObserver(ai);
         sensor_fusion->Subject<World>::registerObserver(backend);
         backend->Subject<SensorProto>::registerObserver(sensor_fusion);
@@ -119,6 +132,7 @@ int main(int argc, char** argv)
             ai->Subject<TbotsProto::PrimitiveSet>::registerObserver(visualizer);
             ai->Subject<AIDrawFunction>::registerObserver(visualizer);
             ai->Subject<PlayInfo>::registerObserver(visualizer);
+            ai->Subject<TbotsProto::AiProfile>::registerObserver(visualizer);
             backend->Subject<SensorProto>::registerObserver(visualizer);
         }
 
@@ -145,8 +159,18 @@ int main(int argc, char** argv)
             auto primitive_set_logger =
                 std::make_shared<ProtoLogger<TbotsProto::PrimitiveSet>>(
                     proto_log_output_dir / "AI_PrimitiveSet");
+            // log how long each stage of the AI took every tick
+            auto ai_profile_logger = std::make_shared<ProtoLogger<TbotsProto::AiProfile>>(
+                proto_log_output_dir / "AI_AiProfile");
+            // log the latency from receiving vision data to sending primitives
+            auto pipeline_latency_logger =
+                std::make_shared<ProtoLogger<TbotsProto::PipelineLatency>>(
+                    proto_log_output_dir / "Backend_PipelineLatency");
             backend->Subject<SensorProto>::registerObserver(sensor_msg_logger);
             ai->Subject<TbotsProto::PrimitiveSet>::registerObserver(primitive_set_logger);
+            ai->Subject<TbotsProto::AiProfile>::registerObserver(ai_profile_logger);
+            backend->Subject<TbotsProto::PipelineLatency>::registerObserver(
+                pipeline_latency_logger);
 
             // log filtered world state
             bool friendly_colour_yellow = thunderbots_config->getSensorFusionConfig()
@@ -172,9 +196,12 @@ int main(int argc, char** argv)
             // we are logging protologs, set the save_protologs_chunk_fn function
             // to save the in-progress protolog chunks
             save_protolog_chunks_fn = [sensor_msg_logger, primitive_set_logger,
+                                       ai_profile_logger, pipeline_latency_logger,
                                        vision_logger]() {
                 sensor_msg_logger->saveCurrentChunk();
                 primitive_set_logger->saveCurrentChunk();
+                ai_profile_logger->saveCurrentChunk();
+                pipeline_latency_logger->saveCurrentChunk();
                 vision_logger->saveCurrentChunk();
                 LOG(DEBUG) << "Saved in-progress ProtoLog chunks.";
             };
@@ -195,6 +222,14 @@ int main(int argc, char** argv)
         }
 
         save_protolog_chunks_fn();
+
+        if (!args->getLatencyTraceOutputFile()->value().empty())
+        {
+            std::ofstream latency_trace_file(args->getLatencyTraceOutputFile()->value());
+            PipelineTracer::getGlobalTracer().writeChromeTrace(latency_trace_file);
+            LOG(INFO) << "Wrote latency traces to "
+                      << args->getLatencyTraceOutputFile()->value();
+        }
     }
 
     return 0;
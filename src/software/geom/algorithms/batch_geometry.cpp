@@ -0,0 +1,499 @@
+#include "software/geom/algorithms/batch_geometry.h"
+
+#include <stdexcept>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersects.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define BATCH_GEOMETRY_X86
+#endif
+
+// The SIMD implementations below compile each function for the instruction set it uses
+// with a target attribute, rather than compiling the whole file with -mavx2, so that
+// the same binary still runs on CPUs without AVX2. FMA is deliberately not enabled, so
+// that the compiler can't fuse multiplies and adds and give results that differ from
+// the scalar functions.
+//
+// Each implementation answers as many inputs as fit in a SIMD register at a time, and
+// calls the scalar function for the inputs left over at the end.
+
+namespace
+{
+    void checkImplementationIsSupported(BatchGeometryImplementation implementation)
+    {
+        if (!isBatchGeometryImplementationSupported(implementation))
+        {
+            throw std::invalid_argument(
+                "Batch geometry implementation is not supported by this CPU");
+        }
+    }
+
+    void batchContainsPortable(const Polygon& container, const PointBuffer& points,
+                               std::size_t begin, std::uint8_t* contained)
+    {
+        for (std::size_t k = begin; k < points.size(); k++)
+        {
+            contained[k] = contains(container, points[k]);
+        }
+    }
+
+    void batchDistancePortable(const PointBuffer& points, const Segment& segment,
+                               std::size_t begin, double* distances)
+    {
+        for (std::size_t k = begin; k < points.size(); k++)
+        {
+            distances[k] = distance(points[k], segment);
+        }
+    }
+
+    void batchIntersectsPortable(const Segment& segment,
+                                 const PointBuffer& segment_starts,
+                                 const PointBuffer& segment_ends, std::size_t begin,
+                                 std::uint8_t* intersects_results)
+    {
+        for (std::size_t k = begin; k < segment_starts.size(); k++)
+        {
+            intersects_results[k] =
+                intersects(segment, Segment(segment_starts[k], segment_ends[k]));
+        }
+    }
+
+#ifdef BATCH_GEOMETRY_X86
+    __attribute__((target("sse2"))) void batchContainsSse2(const Polygon& container,
+                                                           const PointBuffer& points,
+                                                           std::uint8_t* contained)
+    {
+        // See contains(const Polygon&, const Point&) for a description of the algorithm
+        const std::vector<Point>& vertices = container.getPoints();
+        const double* xs                   = points.xData();
+        const double* ys                   = points.yData();
+
+        std::size_t k = 0;
+        for (; k + 2 <= points.size(); k += 2)
+        {
+            const __m128d px     = _mm_loadu_pd(xs + k);
+            const __m128d py     = _mm_loadu_pd(ys + k);
+            __m128d is_contained = _mm_setzero_pd();
+            for (std::size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++)
+            {
+                // Horizontal edges can't be crossed by the ray, so they never change
+                // whether the point is contained
+                if (vertices[i].y() == vertices[j].y())
+                {
+                    continue;
+                }
+                const __m128d pix = _mm_set1_pd(vertices[i].x());
+                const __m128d piy = _mm_set1_pd(vertices[i].y());
+                const __m128d pjx = _mm_set1_pd(vertices[j].x());
+                const __m128d pjy = _mm_set1_pd(vertices[j].y());
+
+                const __m128d p_within_edge_y_range =
+                    _mm_xor_pd(_mm_cmpgt_pd(piy, py), _mm_cmpgt_pd(pjy, py));
+                const __m128d edge_x = _mm_add_pd(
+                    _mm_div_pd(_mm_mul_pd(_mm_sub_pd(pjx, pix), _mm_sub_pd(py, piy)),
+                               _mm_sub_pd(pjy, piy)),
+                    pix);
+                const __m128d p_in_half_plane_to_left_of_extended_edge =
+                    _mm_cmplt_pd(px, edge_x);
+                is_contained = _mm_xor_pd(
+                    is_contained, _mm_and_pd(p_within_edge_y_range,
+                                             p_in_half_plane_to_left_of_extended_edge));
+            }
+
+            const int mask   = _mm_movemask_pd(is_contained);
+            contained[k]     = static_cast<std::uint8_t>(mask & 1);
+            contained[k + 1] = static_cast<std::uint8_t>((mask >> 1) & 1);
+        }
+        batchContainsPortable(container, points, k, contained);
+    }
+
+    __attribute__((target("sse2"))) void batchDistanceSse2(const PointBuffer& points,
+                                                           const Segment& segment,
+                                                           double* distances)
+    {
+        // See distanceSquared(const Point&, const Segment&) for the scalar version
+        const Vector seg_vec             = segment.toVector();
+        const __m128d sx                 = _mm_set1_pd(segment.getStart().x());
+        const __m128d sy                 = _mm_set1_pd(segment.getStart().y());
+        const __m128d ex                 = _mm_set1_pd(segment.getEnd().x());
+        const __m128d ey                 = _mm_set1_pd(segment.getEnd().y());
+        const __m128d vx                 = _mm_set1_pd(seg_vec.x());
+        const __m128d vy                 = _mm_set1_pd(seg_vec.y());
+        const __m128d seg_length_squared = _mm_set1_pd(seg_vec.lengthSquared());
+        const __m128d zero               = _mm_setzero_pd();
+        const __m128d sign_bit           = _mm_set1_pd(-0.0);
+        const double* xs                 = points.xData();
+        const double* ys                 = points.yData();
+
+        std::size_t k = 0;
+        for (; k + 2 <= points.size(); k += 2)
+        {
+            const __m128d px = _mm_loadu_pd(xs + k);
+            const __m128d py = _mm_loadu_pd(ys + k);
+
+            const __m128d start_dx = _mm_sub_pd(px, sx);
+            const __m128d start_dy = _mm_sub_pd(py, sy);
+            const __m128d end_dx   = _mm_sub_pd(px, ex);
+            const __m128d end_dy   = _mm_sub_pd(py, ey);
+
+            const __m128d before_start = _mm_cmple_pd(
+                _mm_add_pd(_mm_mul_pd(vx, start_dx), _mm_mul_pd(vy, start_dy)), zero);
+            const __m128d after_end = _mm_cmpge_pd(
+                _mm_add_pd(_mm_mul_pd(vx, end_dx), _mm_mul_pd(vy, end_dy)), zero);
+
+            const __m128d start_distance_squared = _mm_add_pd(
+                _mm_mul_pd(start_dx, start_dx), _mm_mul_pd(start_dy, start_dy));
+            const __m128d end_distance_squared =
+                _mm_add_pd(_mm_mul_pd(end_dx, end_dx), _mm_mul_pd(end_dy, end_dy));
+            const __m128d cross =
+                _mm_sub_pd(_mm_mul_pd(start_dx, vy), _mm_mul_pd(start_dy, vx));
+            const __m128d perpendicular_distance_squared = _mm_andnot_pd(
+                sign_bit, _mm_div_pd(_mm_mul_pd(cross, cross), seg_length_squared));
+
+            __m128d distance_squared =
+                _mm_or_pd(_mm_and_pd(after_end, end_distance_squared),
+                          _mm_andnot_pd(after_end, perpendicular_distance_squared));
+            distance_squared = _mm_or_pd(_mm_and_pd(before_start, start_distance_squared),
+                                         _mm_andnot_pd(before_start, distance_squared));
+            _mm_storeu_pd(distances + k, _mm_sqrt_pd(distance_squared));
+        }
+        batchDistancePortable(points, segment, k, distances);
+    }
+
+    __attribute__((target("sse2"))) void batchIntersectsSse2(
+        const Segment& segment, const PointBuffer& segment_starts,
+        const PointBuffer& segment_ends, std::uint8_t* intersects_results)
+    {
+        // See intersects(const Segment&, const Segment&) for the scalar version
+        const double p1x      = segment.getStart().x();
+        const double p1y      = segment.getStart().y();
+        const __m128d p1x_vec = _mm_set1_pd(p1x);
+        const __m128d p1y_vec = _mm_set1_pd(p1y);
+        const __m128d ax      = _mm_set1_pd(segment.getEnd().x() - p1x);
+        const __m128d ay      = _mm_set1_pd(segment.getEnd().y() - p1y);
+        const __m128d zero    = _mm_setzero_pd();
+
+        std::size_t k = 0;
+        for (; k + 2 <= segment_starts.size(); k += 2)
+        {
+            const __m128d p3x = _mm_loadu_pd(segment_ends.xData() + k);
+            const __m128d p3y = _mm_loadu_pd(segment_ends.yData() + k);
+            const __m128d p4x = _mm_loadu_pd(segment_starts.xData() + k);
+            const __m128d p4y = _mm_loadu_pd(segment_starts.yData() + k);
+
+            const __m128d bx = _mm_sub_pd(p3x, p4x);
+            const __m128d by = _mm_sub_pd(p3y, p4y);
+            const __m128d cx = _mm_sub_pd(p1x_vec, p3x);
+            const __m128d cy = _mm_sub_pd(p1y_vec, p3y);
+
+            const __m128d denominator =
+                _mm_sub_pd(_mm_mul_pd(ay, bx), _mm_mul_pd(ax, by));
+            const __m128d numerator1 = _mm_sub_pd(_mm_mul_pd(by, cx), _mm_mul_pd(bx, cy));
+            const __m128d numerator2 = _mm_sub_pd(_mm_mul_pd(ax, cy), _mm_mul_pd(ay, cx));
+
+            // The numerators must be between 0 and the denominator for the segments to
+            // intersect
+            const __m128d positive_denominator = _mm_cmpgt_pd(denominator, zero);
+            const __m128d outside_if_positive =
+                _mm_or_pd(_mm_or_pd(_mm_cmplt_pd(numerator1, zero),
+                                    _mm_cmpgt_pd(numerator1, denominator)),
+                          _mm_or_pd(_mm_cmplt_pd(numerator2, zero),
+                                    _mm_cmpgt_pd(numerator2, denominator)));
+            const __m128d outside_if_not_positive =
+                _mm_or_pd(_mm_or_pd(_mm_cmpgt_pd(numerator1, zero),
+                                    _mm_cmplt_pd(numerator1, denominator)),
+                          _mm_or_pd(_mm_cmpgt_pd(numerator2, zero),
+                                    _mm_cmplt_pd(numerator2, denominator)));
+            const __m128d outside =
+                _mm_or_pd(_mm_and_pd(positive_denominator, outside_if_positive),
+                          _mm_andnot_pd(positive_denominator, outside_if_not_positive));
+
+            const int mask            = _mm_movemask_pd(outside);
+            intersects_results[k]     = static_cast<std::uint8_t>(!(mask & 1));
+            intersects_results[k + 1] = static_cast<std::uint8_t>(!(mask & 2));
+        }
+        batchIntersectsPortable(segment, segment_starts, segment_ends, k,
+                                intersects_results);
+    }
+
+    __attribute__((target("avx2"))) void batchContainsAvx2(const Polygon& container,
+                                                           const PointBuffer& points,
+                                                           std::uint8_t* contained)
+    {
+        const std::vector<Point>& vertices = container.getPoints();
+        const double* xs                   = points.xData();
+        const double* ys                   = points.yData();
+
+        std::size_t k = 0;
+        for (; k + 4 <= points.size(); k += 4)
+        {
+            const __m256d px     = _mm256_loadu_pd(xs + k);
+            const __m256d py     = _mm256_loadu_pd(ys + k);
+            __m256d is_contained = _mm256_setzero_pd();
+            for (std::size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++)
+            {
+                if (vertices[i].y() == vertices[j].y())
+                {
+                    continue;
+                }
+                const __m256d pix = _mm256_set1_pd(vertices[i].x());
+                const __m256d piy = _mm256_set1_pd(vertices[i].y());
+                const __m256d pjx = _mm256_set1_pd(vertices[j].x());
+                const __m256d pjy = _mm256_set1_pd(vertices[j].y());
+
+                const __m256d p_within_edge_y_range =
+                    _mm256_xor_pd(_mm256_cmp_pd(piy, py, _CMP_GT_OQ),
+                                  _mm256_cmp_pd(pjy, py, _CMP_GT_OQ));
+                const __m256d edge_x = _mm256_add_pd(
+                    _mm256_div_pd(
+                        _mm256_mul_pd(_mm256_sub_pd(pjx, pix), _mm256_sub_pd(py, piy)),
+                        _mm256_sub_pd(pjy, piy)),
+                    pix);
+                const __m256d p_in_half_plane_to_left_of_extended_edge =
+                    _mm256_cmp_pd(px, edge_x, _CMP_LT_OQ);
+                is_contained = _mm256_xor_pd(
+                    is_contained,
+                    _mm256_and_pd(p_within_edge_y_range,
+                                  p_in_half_plane_to_left_of_extended_edge));
+            }
+
+            const int mask = _mm256_movemask_pd(is_contained);
+            for (std::size_t lane = 0; lane < 4; lane++)
+            {
+                contained[k + lane] = static_cast<std::uint8_t>((mask >> lane) & 1);
+            }
+        }
+        batchContainsPortable(container, points, k, contained);
+    }
+
+    __attribute__((target("avx2"))) void batchDistanceAvx2(const PointBuffer& points,
+                                                           const Segment& segment,
+                                                           double* distances)
+    {
+        const Vector seg_vec             = segment.toVector();
+        const __m256d sx                 = _mm256_set1_pd(segment.getStart().x());
+        const __m256d sy                 = _mm256_set1_pd(segment.getStart().y());
+        const __m256d ex                 = _mm256_set1_pd(segment.getEnd().x());
+        const __m256d ey                 = _mm256_set1_pd(segment.getEnd().y());
+        const __m256d vx                 = _mm256_set1_pd(seg_vec.x());
+        const __m256d vy                 = _mm256_set1_pd(seg_vec.y());
+        const __m256d seg_length_squared = _mm256_set1_pd(seg_vec.lengthSquared());
+        const __m256d zero               = _mm256_setzero_pd();
+        const __m256d sign_bit           = _mm256_set1_pd(-0.0);
+        const double* xs                 = points.xData();
+        const double* ys                 = points.yData();
+
+        std::size_t k = 0;
+        for (; k + 4 <= points.size(); k += 4)
+        {
+            const __m256d px = _mm256_loadu_pd(xs + k);
+            const __m256d py = _mm256_loadu_pd(ys + k);
+
+            const __m256d start_dx = _mm256_sub_pd(px, sx);
+            const __m256d start_dy = _mm256_sub_pd(py, sy);
+            const __m256d end_dx   = _mm256_sub_pd(px, ex);
+            const __m256d end_dy   = _mm256_sub_pd(py, ey);
+
+            const __m256d before_start = _mm256_cmp_pd(
+                _mm256_add_pd(_mm256_mul_pd(vx, start_dx), _mm256_mul_pd(vy, start_dy)),
+                zero, _CMP_LE_OQ);
+            const __m256d after_end = _mm256_cmp_pd(
+                _mm256_add_pd(_mm256_mul_pd(vx, end_dx), _mm256_mul_pd(vy, end_dy)), zero,
+                _CMP_GE_OQ);
+
+            const __m256d start_distance_squared = _mm256_add_pd(
+                _mm256_mul_pd(start_dx, start_dx), _mm256_mul_pd(start_dy, start_dy));
+            const __m256d end_distance_squared = _mm256_add_pd(
+                _mm256_mul_pd(end_dx, end_dx), _mm256_mul_pd(end_dy, end_dy));
+            const __m256d cross =
+                _mm256_sub_pd(_mm256_mul_pd(start_dx, vy), _mm256_mul_pd(start_dy, vx));
+            const __m256d perpendicular_distance_squared = _mm256_andnot_pd(
+                sign_bit, _mm256_div_pd(_mm256_mul_pd(cross, cross), seg_length_squared));
+
+            __m256d distance_squared = _mm256_blendv_pd(perpendicular_distance_squared,
+                                                        end_distance_squared, after_end);
+            distance_squared =
+                _mm256_blendv_pd(distance_squared, start_distance_squared, before_start);
+            _mm256_storeu_pd(distances + k, _mm256_sqrt_pd(distance_squared));
+        }
+        batchDistancePortable(points, segment, k, distances);
+    }
+
+    __attribute__((target("avx2"))) void batchIntersectsAvx2(
+        const Segment& segment, const PointBuffer& segment_starts,
+        const PointBuffer& segment_ends, std::uint8_t* intersects_results)
+    {
+        const double p1x      = segment.getStart().x();
+        const double p1y      = segment.getStart().y();
+        const __m256d p1x_vec = _mm256_set1_pd(p1x);
+        const __m256d p1y_vec = _mm256_set1_pd(p1y);
+        const __m256d ax      = _mm256_set1_pd(segment.getEnd().x() - p1x);
+        const __m256d ay      = _mm256_set1_pd(segment.getEnd().y() - p1y);
+        const __m256d zero    = _mm256_setzero_pd();
+
+        std::size_t k = 0;
+        for (; k + 4 <= segment_starts.size(); k += 4)
+        {
+            const __m256d p3x = _mm256_loadu_pd(segment_ends.xData() + k);
+            const __m256d p3y = _mm256_loadu_pd(segment_ends.yData() + k);
+            const __m256d p4x = _mm256_loadu_pd(segment_starts.xData() + k);
+            const __m256d p4y = _mm256_loadu_pd(segment_starts.yData() + k);
+
+            const __m256d bx = _mm256_sub_pd(p3x, p4x);
+            const __m256d by = _mm256_sub_pd(p3y, p4y);
+            const __m256d cx = _mm256_sub_pd(p1x_vec, p3x);
+            const __m256d cy = _mm256_sub_pd(p1y_vec, p3y);
+
+            const __m256d denominator =
+                _mm256_sub_pd(_mm256_mul_pd(ay, bx), _mm256_mul_pd(ax, by));
+            const __m256d numerator1 =
+                _mm256_sub_pd(_mm256_mul_pd(by, cx), _mm256_mul_pd(bx, cy));
+            const __m256d numerator2 =
+                _mm256_sub_pd(_mm256_mul_pd(ax, cy), _mm256_mul_pd(ay, cx));
+
+            const __m256d positive_denominator =
+                _mm256_cmp_pd(denominator, zero, _CMP_GT_OQ);
+            const __m256d outside_if_positive = _mm256_or_pd(
+                _mm256_or_pd(_mm256_cmp_pd(numerator1, zero, _CMP_LT_OQ),
+                             _mm256_cmp_pd(numerator1, denominator, _CMP_GT_OQ)),
+                _mm256_or_pd(_mm256_cmp_pd(numerator2, zero, _CMP_LT_OQ),
+                             _mm256_cmp_pd(numerator2, denominator, _CMP_GT_OQ)));
+            const __m256d outside_if_not_positive = _mm256_or_pd(
+                _mm256_or_pd(_mm256_cmp_pd(numerator1, zero, _CMP_GT_OQ),
+                             _mm256_cmp_pd(numerator1, denominator, _CMP_LT_OQ)),
+                _mm256_or_pd(_mm256_cmp_pd(numerator2, zero, _CMP_GT_OQ),
+                             _mm256_cmp_pd(numerator2, denominator, _CMP_LT_OQ)));
+            const __m256d outside = _mm256_blendv_pd(
+                outside_if_not_positive, outside_if_positive, positive_denominator);
+
+            const int mask = _mm256_movemask_pd(outside);
+            for (std::size_t lane = 0; lane < 4; lane++)
+            {
+                intersects_results[k + lane] =
+                    static_cast<std::uint8_t>(!((mask >> lane) & 1));
+            }
+        }
+        batchIntersectsPortable(segment, segment_starts, segment_ends, k,
+                                intersects_results);
+    }
+#endif
+}  // namespace
+
+bool isBatchGeometryImplementationSupported(BatchGeometryImplementation implementation)
+{
+    switch (implementation)
+    {
+        case BatchGeometryImplementation::PORTABLE:
+            return true;
+#ifdef BATCH_GEOMETRY_X86
+        case BatchGeometryImplementation::SSE2:
+            // SSE2 is part of x86-64, so every x86-64 CPU supports it
+            return true;
+        case BatchGeometryImplementation::AVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#else
+        case BatchGeometryImplementation::SSE2:
+        case BatchGeometryImplementation::AVX2:
+            return false;
+#endif
+    }
+    return false;
+}
+
+BatchGeometryImplementation getFastestBatchGeometryImplementation()
+{
+    static const BatchGeometryImplementation fastest_implementation = []() {
+        for (BatchGeometryImplementation implementation :
+             {BatchGeometryImplementation::AVX2, BatchGeometryImplementation::SSE2})
+        {
+            if (isBatchGeometryImplementationSupported(implementation))
+            {
+                return implementation;
+            }
+        }
+        return BatchGeometryImplementation::PORTABLE;
+    }();
+    return fastest_implementation;
+}
+
+void batchContains(const Polygon& container, const PointBuffer& points,
+                   std::vector<std::uint8_t>& contained,
+                   BatchGeometryImplementation implementation)
+{
+    checkImplementationIsSupported(implementation);
+    contained.resize(points.size());
+
+    switch (implementation)
+    {
+#ifdef BATCH_GEOMETRY_X86
+        case BatchGeometryImplementation::AVX2:
+            batchContainsAvx2(container, points, contained.data());
+            return;
+        case BatchGeometryImplementation::SSE2:
+            batchContainsSse2(container, points, contained.data());
+            return;
+#endif
+        default:
+            batchContainsPortable(container, points, 0, contained.data());
+            return;
+    }
+}
+
+void batchDistance(const PointBuffer& points, const Segment& segment,
+                   std::vector<double>& distances,
+                   BatchGeometryImplementation implementation)
+{
+    checkImplementationIsSupported(implementation);
+    distances.resize(points.size());
+
+    switch (implementation)
+    {
+#ifdef BATCH_GEOMETRY_X86
+        case BatchGeometryImplementation::AVX2:
+            batchDistanceAvx2(points, segment, distances.data());
+            return;
+        case BatchGeometryImplementation::SSE2:
+            batchDistanceSse2(points, segment, distances.data());
+            return;
+#endif
+        default:
+            batchDistancePortable(points, segment, 0, distances.data());
+            return;
+    }
+}
+
+void batchIntersects(const Segment& segment, const PointBuffer& segment_starts,
+                     const PointBuffer& segment_ends,
+                     std::vector<std::uint8_t>& segments_intersect,
+                     BatchGeometryImplementation implementation)
+{
+    if (segment_starts.size() != segment_ends.size())
+    {
+        throw std::invalid_argument(
+            "There must be the same number of segment starts and ends");
+    }
+    checkImplementationIsSupported(implementation);
+    segments_intersect.resize(segment_starts.size());
+
+    switch (implementation)
+    {
+#ifdef BATCH_GEOMETRY_X86
+        case BatchGeometryImplementation::AVX2:
+            batchIntersectsAvx2(segment, segment_starts, segment_ends,
+                                segments_intersect.data());
+            return;
+        case BatchGeometryImplementation::SSE2:
+            batchIntersectsSse2(segment, segment_starts, segment_ends,
+                                segments_intersect.data());
+            return;
+#endif
+        default:
+            batchIntersectsPortable(segment, segment_starts, segment_ends, 0,
+                                    segments_intersect.data());
+            return;
+    }
+}
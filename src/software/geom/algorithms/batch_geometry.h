@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "software/geom/point_buffer.h"
+#include "software/geom/polygon.h"
+#include "software/geom/segment.h"
+#include "software/util/make_enum/make_enum.h"
+
+/**
+ * Batch versions of contains, distance and intersects, which answer the same query for
+ * many points or segments at once.
+ *
+ * The inputs are stored in PointBuffers, so on x86 the queries can be answered for 2
+ * (SSE2) or 4 (AVX2) inputs at a time. The instruction set is chosen at runtime based
+ * on what the CPU supports, and a portable implementation is used everywhere else. Every
+ * implementation gives exactly the same results as calling the scalar function on each
+ * input, since they do the same floating point operations in the same order.
+ */
+
+MAKE_ENUM(BatchGeometryImplementation, PORTABLE, SSE2, AVX2);
+
+/**
+ * Returns whether the given implementation can run on this CPU
+ *
+ * @param implementation The implementation
+ *
+ * @return whether the implementation can run on this CPU
+ */
+bool isBatchGeometryImplementationSupported(BatchGeometryImplementation implementation);
+
+/**
+ * Returns the fastest implementation that can run on this CPU
+ *
+ * @return the fastest implementation that can run on this CPU
+ */
+BatchGeometryImplementation getFastestBatchGeometryImplementation();
+
+/**
+ * Determines whether each of the given points is contained by the polygon, the same
+ * way as contains(const Polygon&, const Point&)
+ *
+ * @param container The polygon
+ * @param points The points to check
+ * @param contained Resized to the number of points, with element i set to 1 if point i
+ * is contained by the polygon and 0 otherwise. Passing the same vector to every call
+ * avoids allocating
+ * @param implementation The implementation to use
+ *
+ * @throws std::invalid_argument if the implementation can't run on this CPU
+ */
+void batchContains(
+    const Polygon& container, const PointBuffer& points,
+    std::vector<std::uint8_t>& contained,
+    BatchGeometryImplementation implementation = getFastestBatchGeometryImplementation());
+
+/**
+ * Calculates the distance from each of the given points to the segment, the same way as
+ * distance(const Point&, const Segment&)
+ *
+ * @param points The points
+ * @param segment The segment
+ * @param distances Resized to the number of points, with element i set to the distance
+ * from point i to the segment. Passing the same vector to every call avoids allocating
+ * @param implementation The implementation to use
+ *
+ * @throws std::invalid_argument if the implementation can't run on this CPU
+ */
+void batchDistance(
+    const PointBuffer& points, const Segment& segment, std::vector<double>& distances,
+    BatchGeometryImplementation implementation = getFastestBatchGeometryImplementation());
+
+/**
+ * Determines whether the segment intersects each of the given segments, the same way as
+ * intersects(const Segment&, const Segment&)
+ *
+ * @param segment The segment
+ * @param segment_starts The start points of the segments to check
+ * @param segment_ends The end points of the segments to check
+ * @param segments_intersect Resized to the number of segments, with element i set to 1 if
+ * the segment intersects segment i and 0 otherwise. Passing the same vector to every call
+ * avoids allocating
+ * @param implementation The implementation to use
+ *
+ * @throws std::invalid_argument if there are a different number of segment starts and
+ * ends, or if the implementation can't run on this CPU
+ */
+void batchIntersects(
+    const Segment& segment, const PointBuffer& segment_starts,
+    const PointBuffer& segment_ends, std::vector<std::uint8_t>& segments_intersect,
+    BatchGeometryImplementation implementation = getFastestBatchGeometryImplementation());
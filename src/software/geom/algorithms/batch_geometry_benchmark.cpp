@@ -0,0 +1,183 @@
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <random>
+
+#include "software/geom/algorithms/batch_geometry.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersects.h"
+
+/**
+ * Benchmarks for the batch geometry functions, compared to calling the scalar functions
+ * on each point or segment.
+ *
+ * The batch benchmarks take the BatchGeometryImplementation to use as an argument
+ * (0 = PORTABLE, 1 = SSE2, 2 = AVX2). Each iteration answers a query for NUM_INPUTS
+ * random points or segments spread over the field.
+ *
+ * Run with: bazel run -c opt //software/geom/algorithms:batch_geometry_benchmark
+ */
+
+namespace
+{
+    const std::size_t NUM_INPUTS = 1024;
+
+    /**
+     * Creates random points on the field
+     *
+     * @param seed The seed for the random points
+     *
+     * @return the random points
+     */
+    std::vector<Point> createRandomPoints(unsigned int seed)
+    {
+        std::mt19937 random_generator(seed);
+        std::uniform_real_distribution<double> x_distribution(-4.5, 4.5);
+        std::uniform_real_distribution<double> y_distribution(-3, 3);
+        std::vector<Point> points;
+        for (std::size_t i = 0; i < NUM_INPUTS; i++)
+        {
+            points.emplace_back(x_distribution(random_generator),
+                                y_distribution(random_generator));
+        }
+        return points;
+    }
+
+    // An octagon around a robot, which is what most obstacles look like
+    const Polygon OCTAGON({Point(0.5, 0.2), Point(0.2, 0.5), Point(-0.2, 0.5),
+                           Point(-0.5, 0.2), Point(-0.5, -0.2), Point(-0.2, -0.5),
+                           Point(0.2, -0.5), Point(0.5, -0.2)});
+    const Segment SEGMENT(Point(-3, -2), Point(2, 1.5));
+
+    /**
+     * Gets the implementation given as the benchmark argument, skipping the benchmark if
+     * it can't run on this CPU
+     *
+     * @param state The benchmark state
+     *
+     * @return the implementation, or std::nullopt if it can't run on this CPU
+     */
+    std::optional<BatchGeometryImplementation> getImplementation(benchmark::State& state)
+    {
+        auto implementation = static_cast<BatchGeometryImplementation>(state.range(0));
+        if (!isBatchGeometryImplementationSupported(implementation))
+        {
+            state.SkipWithError("Implementation is not supported by this CPU");
+            return std::nullopt;
+        }
+        state.SetLabel(allStringValuesBatchGeometryImplementation().at(
+            static_cast<std::size_t>(state.range(0))));
+        return implementation;
+    }
+
+    void benchmarkScalarContains(benchmark::State& state)
+    {
+        const std::vector<Point> points = createRandomPoints(1);
+        std::vector<std::uint8_t> contained(points.size());
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < points.size(); i++)
+            {
+                contained[i] = contains(OCTAGON, points[i]);
+            }
+            benchmark::DoNotOptimize(contained.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_INPUTS));
+    }
+
+    void benchmarkBatchContains(benchmark::State& state)
+    {
+        auto implementation = getImplementation(state);
+        if (!implementation)
+        {
+            return;
+        }
+        const PointBuffer points(createRandomPoints(1));
+        std::vector<std::uint8_t> contained;
+        for (auto _ : state)
+        {
+            batchContains(OCTAGON, points, contained, *implementation);
+            benchmark::DoNotOptimize(contained.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_INPUTS));
+    }
+
+    void benchmarkScalarDistance(benchmark::State& state)
+    {
+        const std::vector<Point> points = createRandomPoints(1);
+        std::vector<double> distances(points.size());
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < points.size(); i++)
+            {
+                distances[i] = distance(points[i], SEGMENT);
+            }
+            benchmark::DoNotOptimize(distances.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_INPUTS));
+    }
+
+    void benchmarkBatchDistance(benchmark::State& state)
+    {
+        auto implementation = getImplementation(state);
+        if (!implementation)
+        {
+            return;
+        }
+        const PointBuffer points(createRandomPoints(1));
+        std::vector<double> distances;
+        for (auto _ : state)
+        {
+            batchDistance(points, SEGMENT, distances, *implementation);
+            benchmark::DoNotOptimize(distances.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_INPUTS));
+    }
+
+    void benchmarkScalarIntersects(benchmark::State& state)
+    {
+        const std::vector<Point> starts = createRandomPoints(1);
+        const std::vector<Point> ends   = createRandomPoints(2);
+        std::vector<Segment> segments;
+        for (std::size_t i = 0; i < starts.size(); i++)
+        {
+            segments.emplace_back(starts[i], ends[i]);
+        }
+        std::vector<std::uint8_t> segments_intersect(segments.size());
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < segments.size(); i++)
+            {
+                segments_intersect[i] = intersects(SEGMENT, segments[i]);
+            }
+            benchmark::DoNotOptimize(segments_intersect.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_INPUTS));
+    }
+
+    void benchmarkBatchIntersects(benchmark::State& state)
+    {
+        auto implementation = getImplementation(state);
+        if (!implementation)
+        {
+            return;
+        }
+        const PointBuffer starts(createRandomPoints(1));
+        const PointBuffer ends(createRandomPoints(2));
+        std::vector<std::uint8_t> segments_intersect;
+        for (auto _ : state)
+        {
+            batchIntersects(SEGMENT, starts, ends, segments_intersect, *implementation);
+            benchmark::DoNotOptimize(segments_intersect.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_INPUTS));
+    }
+}  // namespace
+
+BENCHMARK(benchmarkScalarContains);
+BENCHMARK(benchmarkBatchContains)->DenseRange(0, 2);
+BENCHMARK(benchmarkScalarDistance);
+BENCHMARK(benchmarkBatchDistance)->DenseRange(0, 2);
+BENCHMARK(benchmarkScalarIntersects);
+BENCHMARK(benchmarkBatchIntersects)->DenseRange(0, 2);
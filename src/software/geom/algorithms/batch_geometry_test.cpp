@@ -0,0 +1,278 @@
+#include "software/geom/algorithms/batch_geometry.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersects.h"
+
+// The cases below are taken from the contains, distance and intersects tests, and each
+// implementation is checked against both the expected result and the scalar function.
+// The number of inputs in each batch is not a multiple of the SIMD width, so that the
+// inputs left over at the end are checked too.
+class BatchGeometryTest : public ::testing::TestWithParam<BatchGeometryImplementation>
+{
+   protected:
+    /**
+     * Creates random points in a 10x10 square centred at the origin, with some of them
+     * snapped to a grid so that points lie exactly on polygon edges and vertices
+     *
+     * @param num_points The number of points to create
+     *
+     * @return the random points
+     */
+    std::vector<Point> createRandomPoints(std::size_t num_points)
+    {
+        std::uniform_real_distribution<double> coordinate_distribution(-5, 5);
+        std::vector<Point> points;
+        for (std::size_t i = 0; i < num_points; i++)
+        {
+            Point point(coordinate_distribution(random_generator),
+                        coordinate_distribution(random_generator));
+            if (i % 5 == 0)
+            {
+                point = Point(std::round(point.x()), std::round(point.y()));
+            }
+            points.push_back(point);
+        }
+        return points;
+    }
+
+    std::mt19937 random_generator{1};
+};
+
+TEST_P(BatchGeometryTest, polygon_contains_points)
+{
+    // Hexagon centered at origin
+    Polygon hexagon{{0.0f, 2.0f},  {2.0f, 1.0f},   {2.0f, -1.0f},
+                    {0.0f, -2.0f}, {-2.0f, -1.0f}, {-2.0f, 1.0f}};
+    std::vector<Point> points = {Point(),          Point(0, 2.01),  Point(0, -2.01),
+                                 Point(2.01, 0),   Point(-2.01, 0), Point(2.0f, 0.0f),
+                                 Point(-2, 0),     Point(-2, -1),   Point(1, -1),
+                                 Point(-1.5, 0.75)};
+    std::vector<std::uint8_t> expected = {1, 0, 0, 0, 0, 0, 1, 1, 1, 1};
+
+    std::vector<std::uint8_t> contained;
+    batchContains(hexagon, PointBuffer(points), contained, GetParam());
+
+    ASSERT_EQ(expected.size(), contained.size());
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        EXPECT_EQ(expected[i], contained[i]) << "Point " << points[i];
+        EXPECT_EQ(contains(hexagon, points[i]), contained[i]) << "Point " << points[i];
+    }
+}
+
+TEST_P(BatchGeometryTest, self_intersecting_polygon_contains_points)
+{
+    Polygon intersecting_poly{{-3.0f, 0.0f}, {-3.0f, 3.0f}, {3.0f, 3.0f},
+                              {3.0f, 0.0f},  {-2.0f, 2.0f}, {2.0f, 2.0f}};
+    std::vector<Point> points = {
+        Point(3, 2),    Point(2, 2),   Point(0, 3),   Point(0, 2),   Point(3, 0),
+        Point(-3, 0),   Point(),       Point(0, 1.9), Point(0, 1.5), Point(-2, 2),
+        Point(-2.5, 2), Point(2.5, 2), Point(-3, 2)};
+    std::vector<std::uint8_t> expected = {0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1};
+
+    std::vector<std::uint8_t> contained;
+    batchContains(intersecting_poly, PointBuffer(points), contained, GetParam());
+
+    ASSERT_EQ(expected.size(), contained.size());
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        EXPECT_EQ(expected[i], contained[i]) << "Point " << points[i];
+        EXPECT_EQ(contains(intersecting_poly, points[i]), contained[i])
+            << "Point " << points[i];
+    }
+}
+
+TEST_P(BatchGeometryTest, polygon_contains_points_on_ray_edge_cases)
+{
+    // The ray from these points passes through a vertex of the triangle or along one of
+    // its edges
+    Polygon triangle({Point(0, 0), Point(1, 0), Point(0, 1)});
+    std::vector<Point> points          = {Point(-1, 1), Point(0.5, 0), Point(-1, 0)};
+    std::vector<std::uint8_t> expected = {0, 1, 0};
+
+    std::vector<std::uint8_t> contained;
+    batchContains(triangle, PointBuffer(points), contained, GetParam());
+
+    EXPECT_EQ(expected, contained);
+}
+
+TEST_P(BatchGeometryTest, polygon_contains_random_points_same_as_scalar)
+{
+    Polygon polygon({Point(-4, -3), Point(1, -4), Point(3, 0), Point(4, 4), Point(0, 1),
+                     Point(-3, 3), Point(-1, 0)});
+    std::vector<Point> points = createRandomPoints(1003);
+
+    std::vector<std::uint8_t> contained;
+    batchContains(polygon, PointBuffer(points), contained, GetParam());
+
+    ASSERT_EQ(points.size(), contained.size());
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        EXPECT_EQ(contains(polygon, points[i]), contained[i]) << "Point " << points[i];
+    }
+}
+
+TEST_P(BatchGeometryTest, empty_polygon_contains_no_points)
+{
+    std::vector<std::uint8_t> contained;
+    batchContains(Polygon(std::vector<Point>()), PointBuffer(createRandomPoints(7)),
+                  contained, GetParam());
+
+    EXPECT_EQ(std::vector<std::uint8_t>(7, 0), contained);
+}
+
+TEST_P(BatchGeometryTest, distance_from_points_to_segment)
+{
+    Segment segment(Point(-4, 4), Point(4, 2));
+    std::vector<Point> points    = {Point(-8, 5), Point(-2, 7), Point(-4, 4), Point(0, 3),
+                                 Point(8, 1)};
+    std::vector<double> expected = {
+        std::sqrt(17), std::abs(1.0 / 4.0 * -2 + 7 + -3) / std::hypot(1.0 / 4.0, 1), 0, 0,
+        std::sqrt(17)};
+
+    std::vector<double> distances;
+    batchDistance(PointBuffer(points), segment, distances, GetParam());
+
+    ASSERT_EQ(expected.size(), distances.size());
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        EXPECT_DOUBLE_EQ(expected[i], distances[i]) << "Point " << points[i];
+        EXPECT_EQ(distance(points[i], segment), distances[i]) << "Point " << points[i];
+    }
+}
+
+TEST_P(BatchGeometryTest, distance_from_points_to_degenerate_segment)
+{
+    Segment segment(Point(-2, 2), Point(-2, 2));
+    std::vector<Point> points    = {Point(5, 3), Point(-2, 2), Point(-2, 0), Point(1, 6),
+                                 Point(-3, 2)};
+    std::vector<double> expected = {std::hypot(7, 1), 0, 2, 5, 1};
+
+    std::vector<double> distances;
+    batchDistance(PointBuffer(points), segment, distances, GetParam());
+
+    ASSERT_EQ(expected.size(), distances.size());
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        EXPECT_DOUBLE_EQ(expected[i], distances[i]) << "Point " << points[i];
+    }
+}
+
+TEST_P(BatchGeometryTest, distance_from_random_points_same_as_scalar)
+{
+    Segment segment(Point(-7, 2), Point(1, 8));
+    std::vector<Point> points = createRandomPoints(1003);
+
+    std::vector<double> distances;
+    batchDistance(PointBuffer(points), segment, distances, GetParam());
+
+    ASSERT_EQ(points.size(), distances.size());
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        EXPECT_EQ(distance(points[i], segment), distances[i]) << "Point " << points[i];
+    }
+}
+
+TEST_P(BatchGeometryTest, segment_intersects_segments)
+{
+    Segment segment({-8, 2}, {-10, 6});
+    std::vector<Segment> segments = {
+        Segment({-9, 4}, {-8.5, 3}), Segment({-10, 6}, {10, 3}),
+        Segment({-9, 6}, {-7.5, 3}), Segment({-10, 0}, {-6, 8}),
+        Segment({20000, 100000}, {40000, -20000})};
+    std::vector<std::uint8_t> expected = {1, 1, 0, 1, 0};
+
+    PointBuffer starts, ends;
+    for (const Segment& other : segments)
+    {
+        starts.push_back(other.getStart());
+        ends.push_back(other.getEnd());
+    }
+    std::vector<std::uint8_t> segments_intersect;
+    batchIntersects(segment, starts, ends, segments_intersect, GetParam());
+
+    EXPECT_EQ(expected, segments_intersect);
+}
+
+TEST_P(BatchGeometryTest, close_parallel_segments_not_intersecting)
+{
+    std::vector<std::uint8_t> segments_intersect;
+    batchIntersects(Segment({1.049, -1.049}, {1.95, -1.049}), PointBuffer({Point(2, -1)}),
+                    PointBuffer({Point(1, -1)}), segments_intersect, GetParam());
+
+    EXPECT_EQ(std::vector<std::uint8_t>({0}), segments_intersect);
+}
+
+TEST_P(BatchGeometryTest, segment_intersects_random_segments_same_as_scalar)
+{
+    std::vector<Point> starts = createRandomPoints(1003);
+    std::vector<Point> ends   = createRandomPoints(1003);
+    // Include degenerate segments and segments that share end points with the segment
+    ends[10] = starts[10];
+    Segment segment(Point(-3, -1), Point(2, 4));
+    starts[20] = segment.getStart();
+    ends[30]   = segment.getEnd();
+
+    std::vector<std::uint8_t> segments_intersect;
+    batchIntersects(segment, PointBuffer(starts), PointBuffer(ends), segments_intersect,
+                    GetParam());
+
+    ASSERT_EQ(starts.size(), segments_intersect.size());
+    for (std::size_t i = 0; i < starts.size(); i++)
+    {
+        EXPECT_EQ(intersects(segment, Segment(starts[i], ends[i])), segments_intersect[i])
+            << "Segment " << i;
+    }
+}
+
+TEST_P(BatchGeometryTest, different_number_of_segment_starts_and_ends)
+{
+    std::vector<std::uint8_t> segments_intersect;
+    EXPECT_THROW(
+        batchIntersects(Segment({0, 0}, {1, 1}), PointBuffer({Point(0, 1), Point(1, 0)}),
+                        PointBuffer({Point(1, 0)}), segments_intersect, GetParam()),
+        std::invalid_argument);
+}
+
+TEST_P(BatchGeometryTest, no_points)
+{
+    std::vector<double> distances = {1, 2, 3};
+    batchDistance(PointBuffer(), Segment({0, 0}, {1, 1}), distances, GetParam());
+    EXPECT_TRUE(distances.empty());
+}
+
+/**
+ * Returns the implementations that can run on this CPU, so that the tests are only
+ * instantiated for those
+ *
+ * @return the implementations that can run on this CPU
+ */
+std::vector<BatchGeometryImplementation> getSupportedImplementations()
+{
+    std::vector<BatchGeometryImplementation> implementations;
+    for (BatchGeometryImplementation implementation :
+         allValuesBatchGeometryImplementation())
+    {
+        if (isBatchGeometryImplementationSupported(implementation))
+        {
+            implementations.push_back(implementation);
+        }
+    }
+    return implementations;
+}
+
+INSTANTIATE_TEST_CASE_P(AllImplementations, BatchGeometryTest,
+                        ::testing::ValuesIn(getSupportedImplementations()));
+
+TEST(BatchGeometryImplementationTest, fastest_implementation_is_supported)
+{
+    EXPECT_TRUE(
+        isBatchGeometryImplementationSupported(getFastestBatchGeometryImplementation()));
+    EXPECT_TRUE(
+        isBatchGeometryImplementationSupported(BatchGeometryImplementation::PORTABLE));
+}
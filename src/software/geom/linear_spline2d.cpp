@@ -68,6 +68,11 @@ const std::vector<Point> LinearSpline2d::getKnots(void) const
     return knots;
 }
 
+const Point& LinearSpline2d::getKnot(size_t index) const
+{
+    return knots.at(index);
+}
+
 const Point LinearSpline2d::getStartPoint(void) const
 {
     return knots.front();
@@ -42,6 +42,17 @@ class LinearSpline2d : Spline2d
 
     const std::vector<Point> getKnots(void) const override;
 
+    /**
+     * Returns the knot at the given index, without copying the rest of the knots
+     *
+     * @param index The index of the knot
+     *
+     * @throws std::out_of_range if index >= getNumKnots()
+     *
+     * @return the knot at the given index
+     */
+    const Point& getKnot(size_t index) const;
+
     const Point getStartPoint(void) const override;
 
     const Point getEndPoint(void) const override;
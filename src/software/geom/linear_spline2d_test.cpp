@@ -111,6 +111,15 @@ TEST(LinearSpline2dTest, test_spline_points_vector_constructor)
     EXPECT_EQ(s.getEndPoint(), points[2]);
 }
 
+TEST(LinearSpline2dTest, test_get_knot)
+{
+    LinearSpline2d s({Point(1, 2), Point(2, 3), Point(0, -1)});
+    EXPECT_EQ(s.getKnot(0), Point(1, 2));
+    EXPECT_EQ(s.getKnot(1), Point(2, 3));
+    EXPECT_EQ(s.getKnot(2), Point(0, -1));
+    EXPECT_THROW(s.getKnot(3), std::out_of_range);
+}
+
 TEST(LinearSpline2dTest, test_get_knot_parametrization_values)
 {
     LinearSpline2d s({Point(1, 2), Point(2, 3), Point(0, -1)});
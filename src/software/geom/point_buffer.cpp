@@ -0,0 +1,53 @@
+#include "software/geom/point_buffer.h"
+
+PointBuffer::PointBuffer(const std::vector<Point>& points)
+{
+    reserve(points.size());
+    for (const Point& point : points)
+    {
+        push_back(point);
+    }
+}
+
+void PointBuffer::push_back(const Point& point)
+{
+    xs.push_back(point.x());
+    ys.push_back(point.y());
+}
+
+void PointBuffer::reserve(std::size_t size)
+{
+    xs.reserve(size);
+    ys.reserve(size);
+}
+
+void PointBuffer::clear()
+{
+    xs.clear();
+    ys.clear();
+}
+
+std::size_t PointBuffer::size() const
+{
+    return xs.size();
+}
+
+bool PointBuffer::empty() const
+{
+    return xs.empty();
+}
+
+Point PointBuffer::operator[](std::size_t index) const
+{
+    return Point(xs[index], ys[index]);
+}
+
+const double* PointBuffer::xData() const
+{
+    return xs.data();
+}
+
+const double* PointBuffer::yData() const
+{
+    return ys.data();
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+
+#include "software/geom/point.h"
+
+/**
+ * A list of points stored as an array of x coordinates and an array of y coordinates
+ * (a "structure of arrays"), rather than as an array of Points.
+ *
+ * Keeping the coordinates in separate contiguous arrays lets the batch geometry
+ * functions load several x or y coordinates at once into SIMD registers.
+ */
+class PointBuffer final
+{
+   public:
+    /**
+     * Creates an empty PointBuffer
+     */
+    PointBuffer() = default;
+
+    /**
+     * Creates a PointBuffer containing the given points
+     *
+     * @param points The points
+     */
+    explicit PointBuffer(const std::vector<Point>& points);
+
+    /**
+     * Adds a point to the end of the buffer
+     *
+     * @param point The point to add
+     */
+    void push_back(const Point& point);
+
+    /**
+     * Reserves memory for the given number of points
+     *
+     * @param size The number of points to reserve memory for
+     */
+    void reserve(std::size_t size);
+
+    /**
+     * Removes all the points from the buffer, keeping the memory allocated for them so
+     * that the buffer can be refilled without allocating
+     */
+    void clear();
+
+    /**
+     * Returns the number of points in the buffer
+     *
+     * @return the number of points in the buffer
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns whether the buffer has no points
+     *
+     * @return whether the buffer has no points
+     */
+    bool empty() const;
+
+    /**
+     * Returns the point at the given index
+     *
+     * @param index The index of the point
+     *
+     * @return the point at the given index
+     */
+    Point operator[](std::size_t index) const;
+
+    /**
+     * Returns the x and y coordinates of the points. The coordinates of point i are at
+     * index i of each array
+     *
+     * @return the x or y coordinates of the points
+     */
+    const double* xData() const;
+    const double* yData() const;
+
+   private:
+    std::vector<double> xs;
+    std::vector<double> ys;
+};
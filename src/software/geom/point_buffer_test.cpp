@@ -0,0 +1,33 @@
+#include "software/geom/point_buffer.h"
+
+#include <gtest/gtest.h>
+
+TEST(PointBufferTest, empty_buffer)
+{
+    PointBuffer buffer;
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(0, buffer.size());
+}
+
+TEST(PointBufferTest, create_from_points)
+{
+    PointBuffer buffer({Point(1, 2), Point(-3, 4), Point(5, -6)});
+
+    ASSERT_EQ(3, buffer.size());
+    EXPECT_EQ(Point(1, 2), buffer[0]);
+    EXPECT_EQ(Point(-3, 4), buffer[1]);
+    EXPECT_EQ(Point(5, -6), buffer[2]);
+    EXPECT_EQ(-3, buffer.xData()[1]);
+    EXPECT_EQ(-6, buffer.yData()[2]);
+}
+
+TEST(PointBufferTest, clear_and_refill)
+{
+    PointBuffer buffer({Point(1, 2), Point(3, 4)});
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+
+    buffer.push_back(Point(7, 8));
+    ASSERT_EQ(1, buffer.size());
+    EXPECT_EQ(Point(7, 8), buffer[0]);
+}
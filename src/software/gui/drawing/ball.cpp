@@ -5,13 +5,19 @@
 #include "software/gui/drawing/geom.h"
 #include "software/math/math_functions.h"
 
-void drawBallVelocity(QGraphicsScene *scene, const Point &position,
-                      const Vector &velocity, const QColor &slow_colour,
-                      const QColor &fast_colour)
+namespace
 {
     // A somewhat arbitrary value that we've determined looks nice in the GUI
-    static const double MAX_VELOCITY_LINE_LENGTH = 1.0;
+    const double MAX_VELOCITY_LINE_LENGTH = 1.0;
+
+    // A rough estimate of the max distance from the ground the ball will ever reach.
+    // This value sets the maximum above which no change will be visible.
+    const double BALL_MAX_DISTANCE_FROM_GROUND = 1.25;
+}  // namespace
 
+QPen createBallVelocityPen(const Point &position, const Vector &velocity,
+                           const QColor &slow_colour, const QColor &fast_colour)
+{
     QGradient gradient = QLinearGradient(
         createQPointF(position),
         createQPointF(position + velocity.normalize(MAX_VELOCITY_LINE_LENGTH)));
@@ -24,31 +30,47 @@ void drawBallVelocity(QGraphicsScene *scene, const Point &position,
     // Drawing a line of length 0 with the SquareCap style causes a large line to be drawn
     pen.setCapStyle(Qt::PenCapStyle::RoundCap);
     pen.setCosmetic(true);
+    return pen;
+}
 
+Segment createBallVelocitySegment(const Point &position, const Vector &velocity)
+{
     double speed     = velocity.length();
     auto line_length = normalizeValueToRange<double>(
         speed, 0, BALL_MAX_SPEED_METERS_PER_SECOND, 0.0, MAX_VELOCITY_LINE_LENGTH);
+    return Segment(position, position + velocity.normalize(line_length));
+}
 
-    drawSegment(scene, Segment(position, position + velocity.normalize(line_length)),
-                pen);
+void drawBallVelocity(QGraphicsScene *scene, const Point &position,
+                      const Vector &velocity, const QColor &slow_colour,
+                      const QColor &fast_colour)
+{
+    drawSegment(scene, createBallVelocitySegment(position, velocity),
+                createBallVelocityPen(position, velocity, slow_colour, fast_colour));
 }
 
-void drawBallPosition(QGraphicsScene *scene, const Point &position,
-                      const double distance_from_ground, QColor color)
+Circle createBallCircle(const Point &position, const double distance_from_ground)
 {
-    // A rough estimate of the max distance from the ground the ball will ever reach.
-    // This value sets the maximum above which no change will be visible.
-    static const double BALL_MAX_DISTANCE_FROM_GROUND = 1.25;
+    // Increase the radius of the ball the further from the ground it is.
+    double ball_radius = normalizeValueToRange<double>(
+        distance_from_ground, 0, BALL_MAX_DISTANCE_FROM_GROUND, BALL_MAX_RADIUS_METERS,
+        4 * BALL_MAX_RADIUS_METERS);
+    return Circle(position, ball_radius);
+}
 
+QColor createBallPositionColor(const double distance_from_ground, QColor color)
+{
     // Decrease the alpha value as the ball moves further from the ground
     double alpha = normalizeValueToRange<double>(distance_from_ground, 0,
                                                  BALL_MAX_DISTANCE_FROM_GROUND, 1.0, 0.4);
     color.setAlphaF(alpha);
+    return color;
+}
 
-    // Increase the radius of the ball the further from the ground it is.
-    double ball_radius = normalizeValueToRange<double>(
-        distance_from_ground, 0, BALL_MAX_DISTANCE_FROM_GROUND, BALL_MAX_RADIUS_METERS,
-        4 * BALL_MAX_RADIUS_METERS);
+void drawBallPosition(QGraphicsScene *scene, const Point &position,
+                      const double distance_from_ground, QColor color)
+{
+    color = createBallPositionColor(distance_from_ground, color);
 
     QPen pen(color);
     pen.setWidth(2);
@@ -57,7 +79,7 @@ void drawBallPosition(QGraphicsScene *scene, const Point &position,
     QBrush brush(color);
     brush.setStyle(Qt::BrushStyle::SolidPattern);
 
-    drawCircle(scene, Circle(position, ball_radius), pen, brush);
+    drawCircle(scene, createBallCircle(position, distance_from_ground), pen, brush);
 }
 
 void drawBall(QGraphicsScene *scene, const BallState &ball)
@@ -72,8 +94,7 @@ void drawBall(QGraphicsScene *scene, const BallDetection &ball)
     drawBallPosition(scene, ball.position, ball.distance_from_ground, ball_color);
 }
 
-void drawBallConeToFriendlyNet(QGraphicsScene *scene, const Point &position,
-                               const Field &field)
+QPen createBallConePen()
 {
     QColor ball_cone_color = ball_color;
     ball_cone_color.setAlpha(170);
@@ -84,6 +105,13 @@ void drawBallConeToFriendlyNet(QGraphicsScene *scene, const Point &position,
     // Drawing a line of length 0 with the SquareCap style causes a large line to be drawn
     pen.setCapStyle(Qt::PenCapStyle::RoundCap);
     pen.setCosmetic(true);
+    return pen;
+}
+
+void drawBallConeToFriendlyNet(QGraphicsScene *scene, const Point &position,
+                               const Field &field)
+{
+    QPen pen = createBallConePen();
 
     Segment pos_goalpost_segment(position, field.friendlyGoalpostPos());
     Segment neg_goalpost_segment(position, field.friendlyGoalpostNeg());
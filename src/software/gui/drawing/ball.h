@@ -2,6 +2,8 @@
 
 #include <QtWidgets/QGraphicsScene>
 
+#include "software/geom/circle.h"
+#include "software/geom/segment.h"
 #include "software/gui/drawing/colors.h"
 #include "software/sensor_fusion/filter/vision_detection.h"
 #include "software/world/ball_state.h"
@@ -12,6 +14,60 @@
  * QGraphicsScene in Qt
  */
 
+/**
+ * Creates the pen used to draw the ball velocity, which fades from the slow colour at
+ * the ball to the fast colour at the end of the line
+ *
+ * @param position The position of the ball
+ * @param velocity The velocity of the ball
+ * @param slow_colour The velocity line colour when the velocity is slow
+ * @param fast_colour The velocity line colour when the velocity is fast
+ *
+ * @return the pen used to draw the ball velocity
+ */
+QPen createBallVelocityPen(const Point &position, const Vector &velocity,
+                           const QColor &slow_colour, const QColor &fast_colour);
+
+/**
+ * Returns the line used to draw the ball velocity, which gets longer the faster the
+ * ball is moving
+ *
+ * @param position The position of the ball
+ * @param velocity The velocity of the ball
+ *
+ * @return the line used to draw the ball velocity
+ */
+Segment createBallVelocitySegment(const Point &position, const Vector &velocity);
+
+/**
+ * Returns the circle used to draw the ball, which gets larger the further the ball is
+ * off the ground
+ *
+ * @param position The position of the ball
+ * @param distance_from_ground the distance of the ball off the ground
+ *
+ * @return the circle used to draw the ball
+ */
+Circle createBallCircle(const Point &position, double distance_from_ground);
+
+/**
+ * Returns the colour used to draw the ball, which becomes more transparent the further
+ * the ball is off the ground
+ *
+ * @param distance_from_ground the distance of the ball off the ground
+ * @param color The color of the ball when it is on the ground
+ *
+ * @return the colour used to draw the ball
+ */
+QColor createBallPositionColor(double distance_from_ground, QColor color);
+
+/**
+ * Creates the pen used to draw the cone between the ball and friendly goal posts
+ *
+ * @return the pen used to draw the ball cone
+ */
+QPen createBallConePen();
+
 /**
  * Draws the ball velocity on the given scene.
  *
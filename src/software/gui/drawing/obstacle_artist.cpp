@@ -14,3 +14,15 @@ void ObstacleArtist::visit(const GeomObstacle<Polygon>& geom_obstacle)
 {
     drawPolygon(scene_, geom_obstacle.getGeom(), pen_);
 }
+
+void ObstacleArtist::visit(const TrajectoryObstacle& trajectory_obstacle)
+{
+    // Draw where the obstacle is now and where it is predicted to stop
+    Circle final_circle =
+        trajectory_obstacle.getCircleAtTime(trajectory_obstacle.getStopTime());
+    drawCircle(scene_, trajectory_obstacle.getCircle(), pen_);
+    drawCircle(scene_, final_circle, pen_);
+    drawSegment(scene_,
+                Segment(trajectory_obstacle.getCircle().origin(), final_circle.origin()),
+                pen_);
+}
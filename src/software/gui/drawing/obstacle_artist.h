@@ -4,6 +4,7 @@
 
 #include "software/ai/navigator/obstacle/obstacle.h"
 #include "software/ai/navigator/obstacle/obstacle_visitor.h"
+#include "software/ai/navigator/obstacle/trajectory_obstacle.h"
 #include "software/gui/drawing/colors.h"
 #include "software/gui/drawing/draw_functions.h"
 #include "software/gui/drawing/geom.h"
@@ -37,6 +38,7 @@ class ObstacleArtist : public ObstacleVisitor
      */
     void visit(const GeomObstacle<Circle>& geom_obstacle) override;
     void visit(const GeomObstacle<Polygon>& geom_obstacle) override;
+    void visit(const TrajectoryObstacle& trajectory_obstacle) override;
 
    private:
     QGraphicsScene* scene_;
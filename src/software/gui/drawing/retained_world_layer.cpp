@@ -0,0 +1,207 @@
+#include "software/gui/drawing/retained_world_layer.h"
+
+#include <set>
+
+#include "software/gui/drawing/ball.h"
+#include "software/gui/drawing/colors.h"
+#include "software/gui/drawing/field.h"
+#include "software/gui/drawing/robot.h"
+#include "software/gui/geometry_conversion.h"
+
+namespace
+{
+    /**
+     * Returns the colours of the friendly and enemy teams
+     *
+     * @param friendly_team_colour The colour of the friendly team
+     *
+     * @return the colours of the friendly and enemy teams, in that order
+     */
+    std::pair<QColor, QColor> getTeamColors(TeamColour friendly_team_colour)
+    {
+        switch (friendly_team_colour)
+        {
+            case TeamColour::YELLOW:
+                return {yellow_robot_color, blue_robot_color};
+            case TeamColour::BLUE:
+            default:
+                return {blue_robot_color, yellow_robot_color};
+        }
+    }
+
+    /**
+     * Creates a new QGraphicsItemGroup as a child of the given parent
+     *
+     * @param parent The parent of the new group
+     *
+     * @return the new group
+     */
+    QGraphicsItemGroup* createLayer(QGraphicsItem* parent)
+    {
+        QGraphicsItemGroup* layer = new QGraphicsItemGroup();
+        layer->setParentItem(parent);
+        return layer;
+    }
+}  // namespace
+
+RetainedWorldLayer::RetainedWorldLayer(QGraphicsScene* scene)
+    : root_item(new QGraphicsItemGroup()),
+      field_layer(createLayer(root_item)),
+      robot_layer(createLayer(root_item)),
+      ball_layer(createLayer(root_item)),
+      ball_item(new QGraphicsEllipseItem(ball_layer)),
+      ball_velocity_item(new QGraphicsLineItem(ball_layer)),
+      ball_cone_pos_goalpost_item(new QGraphicsLineItem(ball_layer)),
+      ball_cone_neg_goalpost_item(new QGraphicsLineItem(ball_layer)),
+      friendly_robot_items(),
+      enemy_robot_items(),
+      drawn_field(std::nullopt),
+      drawn_friendly_team_colour(std::nullopt)
+{
+    ball_cone_pos_goalpost_item->setPen(createBallConePen());
+    ball_cone_neg_goalpost_item->setPen(createBallConePen());
+
+    // Nothing is shown until the first World is drawn
+    root_item->setVisible(false);
+    scene->addItem(root_item);
+}
+
+void RetainedWorldLayer::draw(const World& world, TeamColour friendly_team_colour)
+{
+    if (drawn_field != world.field() ||
+        drawn_friendly_team_colour != friendly_team_colour)
+    {
+        drawField(world.field(), friendly_team_colour);
+    }
+
+    auto [friendly_team_color, enemy_team_color] = getTeamColors(friendly_team_colour);
+    drawTeam(world.friendlyTeam(), friendly_team_color, friendly_robot_items);
+    drawTeam(world.enemyTeam(), enemy_team_color, enemy_robot_items);
+    drawBall(world.ball(), world.field());
+
+    root_item->setVisible(true);
+}
+
+QGraphicsItem* RetainedWorldLayer::getRootItem() const
+{
+    return root_item;
+}
+
+void RetainedWorldLayer::drawField(const Field& field, TeamColour friendly_team_colour)
+{
+    for (QGraphicsItem* item : field_layer->childItems())
+    {
+        delete item;
+    }
+
+    auto [friendly_goal_colour, enemy_goal_colour] = getTeamColors(friendly_team_colour);
+    friendly_goal_colour.setAlpha(100);
+    enemy_goal_colour.setAlpha(100);
+
+    // The field is drawn with the same functions used to draw it on a cleared scene, so
+    // it looks the same either way. The items are drawn into a scratch scene, and then
+    // moved into the field layer in the order they are stacked
+    QGraphicsScene field_scene;
+    ::drawField(&field_scene, field);
+    drawTeamGoalText(&field_scene, field);
+    highlightGoalsByTeam(&field_scene, field, friendly_goal_colour, enemy_goal_colour);
+    for (QGraphicsItem* item : field_scene.items(Qt::AscendingOrder))
+    {
+        if (!item->parentItem())
+        {
+            item->setParentItem(field_layer);
+        }
+    }
+
+    drawn_field                = field;
+    drawn_friendly_team_colour = friendly_team_colour;
+}
+
+void RetainedWorldLayer::drawTeam(const Team& team, const QColor& color,
+                                  std::map<RobotId, RobotItems>& robot_items)
+{
+    std::set<RobotId> drawn_robot_ids;
+    for (const Robot& robot : team.getAllRobots())
+    {
+        auto iter = robot_items.find(robot.id());
+        if (iter == robot_items.end())
+        {
+            iter = robot_items.emplace(robot.id(), createRobotItems(robot.id())).first;
+        }
+        RobotItems& items = iter->second;
+
+        const RobotState robot_state = robot.currentState();
+        items.body->setPos(createQPointF(robot_state.position()));
+        items.body->setRotation(robot_state.orientation().toDegrees());
+        items.body->setBrush(QBrush(color, Qt::BrushStyle::SolidPattern));
+
+        items.velocity->setLine(createQLineF(
+            createRobotVelocitySegment(robot_state.position(), robot_state.velocity())));
+        items.velocity->setPen(createRobotVelocityPen(robot_state.position(),
+                                                      robot_state.velocity(),
+                                                      robot_speed_slow_color, color));
+
+        items.id->setPos(getRobotIdPosition(robot_state.position()));
+
+        drawn_robot_ids.insert(robot.id());
+    }
+
+    // Robots that have disappeared are hidden rather than deleted, since they will
+    // likely show up again soon
+    for (auto& [id, items] : robot_items)
+    {
+        const bool visible = drawn_robot_ids.count(id) > 0;
+        items.body->setVisible(visible);
+        items.velocity->setVisible(visible);
+        items.id->setVisible(visible);
+    }
+}
+
+RetainedWorldLayer::RobotItems RetainedWorldLayer::createRobotItems(RobotId id)
+{
+    RobotItems items;
+
+    items.body = new QGraphicsPathItem(createRobotBodyPath(), robot_layer);
+    items.body->setPen(createRobotBodyPen());
+
+    QGraphicsLineItem* front_face =
+        new QGraphicsLineItem(createQLineF(createRobotFrontFaceSegment()), items.body);
+    front_face->setPen(createRobotFrontFacePen());
+
+    items.velocity = new QGraphicsLineItem(robot_layer);
+
+    items.id = createRobotIdItem(id);
+    items.id->setParentItem(robot_layer);
+
+    return items;
+}
+
+void RetainedWorldLayer::drawBall(const Ball& ball, const Field& field)
+{
+    const BallState ball_state = ball.currentState();
+
+    QColor color = createBallPositionColor(ball_state.distanceFromGround(), ball_color);
+    QPen pen(color);
+    pen.setWidth(2);
+    pen.setCosmetic(true);
+    ball_item->setPen(pen);
+    ball_item->setBrush(QBrush(color, Qt::BrushStyle::SolidPattern));
+
+    Circle ball_circle =
+        createBallCircle(ball_state.position(), ball_state.distanceFromGround());
+    Point origin  = ball_circle.origin();
+    double radius = ball_circle.radius();
+    ball_item->setRect(QRectF(createQPointF(origin + Vector(-radius, radius)),
+                              createQPointF(origin + Vector(radius, -radius))));
+
+    ball_velocity_item->setLine(createQLineF(
+        createBallVelocitySegment(ball_state.position(), ball_state.velocity())));
+    ball_velocity_item->setPen(
+        createBallVelocityPen(ball_state.position(), ball_state.velocity(),
+                              ball_speed_slow_color, ball_speed_fast_color));
+
+    ball_cone_pos_goalpost_item->setLine(
+        createQLineF(Segment(ball_state.position(), field.friendlyGoalpostPos())));
+    ball_cone_neg_goalpost_item->setLine(
+        createQLineF(Segment(ball_state.position(), field.friendlyGoalpostNeg())));
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <QtWidgets/QGraphicsEllipseItem>
+#include <QtWidgets/QGraphicsItemGroup>
+#include <QtWidgets/QGraphicsLineItem>
+#include <QtWidgets/QGraphicsPathItem>
+#include <QtWidgets/QGraphicsScene>
+#include <QtWidgets/QGraphicsSimpleTextItem>
+#include <map>
+#include <optional>
+
+#include "software/world/team_types.h"
+#include "software/world/world.h"
+
+/**
+ * This class draws a World on a QGraphicsScene in "retained mode". Rather than clearing
+ * the scene and creating new items for everything each frame, items are created once
+ * and updated in place:
+ * - The field lines and goals are only redrawn when the field or team colours change
+ * - Each robot gets its own set of items, keyed by team and id, that are moved and
+ *   rotated to follow the robot
+ * - The ball items are moved to follow the ball
+ *
+ * This avoids allocating, indexing and destroying hundreds of QGraphicsItems every
+ * frame, which is the bulk of the cost of drawing the World.
+ *
+ * All items are children of a single root item. The root item is owned by the scene,
+ * so other items may still be added to and removed from the scene around it, but the
+ * scene must not be cleared while this layer is in use.
+ */
+class RetainedWorldLayer
+{
+   public:
+    /**
+     * Creates a new RetainedWorldLayer, and adds its root item to the given scene
+     *
+     * @param scene The scene to draw on
+     */
+    explicit RetainedWorldLayer(QGraphicsScene* scene);
+
+    RetainedWorldLayer() = delete;
+
+    // Copying is not permitted since the layer refers to the items it created in the
+    // scene
+    RetainedWorldLayer(const RetainedWorldLayer&) = delete;
+    RetainedWorldLayer& operator=(const RetainedWorldLayer&) = delete;
+
+    /**
+     * Updates the items in the scene to show the given World
+     *
+     * @param world The world to draw
+     * @param friendly_team_colour The colour of the friendly team
+     */
+    void draw(const World& world, TeamColour friendly_team_colour);
+
+    /**
+     * Returns the item that all items drawn by this layer are children of
+     *
+     * @return the root item of this layer
+     */
+    QGraphicsItem* getRootItem() const;
+
+   private:
+    /**
+     * The items used to draw a single robot
+     */
+    struct RobotItems
+    {
+        // The robot body, which is drawn at the origin facing the +x axis and moved
+        // and rotated to match the robot. The front face is a child of the body
+        QGraphicsPathItem* body;
+        QGraphicsLineItem* velocity;
+        QGraphicsSimpleTextItem* id;
+    };
+
+    /**
+     * Redraws the field lines, goals and goal text
+     *
+     * @param field The field to draw
+     * @param friendly_team_colour The colour of the friendly team
+     */
+    void drawField(const Field& field, TeamColour friendly_team_colour);
+
+    /**
+     * Updates the items of each robot on the given team, creating items for robots
+     * that have not been drawn before and hiding the items of robots that are no
+     * longer on the team
+     *
+     * @param team The team to draw
+     * @param color The colour of the robots on the team
+     * @param robot_items The items of the robots that have been drawn for this team
+     */
+    void drawTeam(const Team& team, const QColor& color,
+                  std::map<RobotId, RobotItems>& robot_items);
+
+    /**
+     * Creates the items used to draw the robot with the given id
+     *
+     * @param id The id of the robot
+     *
+     * @return the items used to draw the robot
+     */
+    RobotItems createRobotItems(RobotId id);
+
+    /**
+     * Updates the ball items, and the cone between the ball and the friendly net
+     *
+     * @param ball The ball to draw
+     * @param field The field the ball is on
+     */
+    void drawBall(const Ball& ball, const Field& field);
+
+    // The root item and each of the layers are owned by the scene once added to it.
+    // Layers are stacked in the order they are created, so the ball is drawn on top of
+    // the robots, which are drawn on top of the field
+    QGraphicsItemGroup* root_item;
+    QGraphicsItemGroup* field_layer;
+    QGraphicsItemGroup* robot_layer;
+    QGraphicsItemGroup* ball_layer;
+
+    QGraphicsEllipseItem* ball_item;
+    QGraphicsLineItem* ball_velocity_item;
+    QGraphicsLineItem* ball_cone_pos_goalpost_item;
+    QGraphicsLineItem* ball_cone_neg_goalpost_item;
+
+    std::map<RobotId, RobotItems> friendly_robot_items;
+    std::map<RobotId, RobotItems> enemy_robot_items;
+
+    // The field and team colour the field layer was last drawn for
+    std::optional<Field> drawn_field;
+    std::optional<TeamColour> drawn_friendly_team_colour;
+};
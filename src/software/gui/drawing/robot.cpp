@@ -10,16 +10,71 @@
 #include "software/gui/geometry_conversion.h"
 #include "software/math/math_functions.h"
 
-void drawRobotVelocity(QGraphicsScene* scene, const Point& position,
-                       const Vector& velocity, const QColor& slow_colour,
-                       const QColor& fast_colour)
+namespace
 {
     // A somewhat arbitrary value that we've determined looks nice in the GUI
-    const double max_velocity_line_length = 0.5;
+    const double MAX_VELOCITY_LINE_LENGTH = 0.5;
+
+    // The number of points used to approximate the arc around the back of the robot
+    // when creating the robot body path
+    const unsigned int NUM_ROBOT_BODY_ARC_POINTS = 32;
+}  // namespace
+
+QPainterPath createRobotBodyPath()
+{
+    // The front-left and right edges of the robot face (the front of the robot)
+    Vector robot_face_front_left =
+        Vector(DIST_TO_FRONT_OF_ROBOT_METERS, FRONT_OF_ROBOT_WIDTH_METERS / 2.0);
+    Vector robot_face_front_right =
+        Vector(DIST_TO_FRONT_OF_ROBOT_METERS, -FRONT_OF_ROBOT_WIDTH_METERS / 2.0);
+
+    // The body is an arc from the front-left of the robot all the way around the back to
+    // the front-right, closed by the front face
+    Angle arc_span =
+        Angle::full() - acuteAngle(robot_face_front_left, robot_face_front_right);
+
+    QPainterPath path(createQPointF(Point(robot_face_front_left)));
+    for (unsigned int i = 0; i <= NUM_ROBOT_BODY_ARC_POINTS; i++)
+    {
+        Angle angle = robot_face_front_left.orientation() +
+                      arc_span * (static_cast<double>(i) / NUM_ROBOT_BODY_ARC_POINTS);
+        path.lineTo(createQPointF(
+            Point(Vector::createFromAngle(angle).normalize(ROBOT_MAX_RADIUS_METERS))));
+    }
+    path.lineTo(createQPointF(Point(robot_face_front_right)));
+    path.closeSubpath();
+    return path;
+}
+
+Segment createRobotFrontFaceSegment()
+{
+    return Segment(
+        Point(DIST_TO_FRONT_OF_ROBOT_METERS, FRONT_OF_ROBOT_WIDTH_METERS / 2.0),
+        Point(DIST_TO_FRONT_OF_ROBOT_METERS, -FRONT_OF_ROBOT_WIDTH_METERS / 2.0));
+}
+
+QPen createRobotBodyPen()
+{
+    QPen robot_body_pen(Qt::black);
+    robot_body_pen.setWidth(1);
+    robot_body_pen.setCosmetic(true);
+    return robot_body_pen;
+}
+
+QPen createRobotFrontFacePen()
+{
+    QPen robot_front_face_pen(Qt::black);
+    robot_front_face_pen.setWidth(2);
+    robot_front_face_pen.setCosmetic(true);
+    return robot_front_face_pen;
+}
 
+QPen createRobotVelocityPen(const Point& position, const Vector& velocity,
+                            const QColor& slow_colour, const QColor& fast_colour)
+{
     QGradient gradient = QLinearGradient(
         createQPointF(position),
-        createQPointF(position + velocity.normalize(max_velocity_line_length)));
+        createQPointF(position + velocity.normalize(MAX_VELOCITY_LINE_LENGTH)));
     gradient.setColorAt(0, slow_colour);
     gradient.setColorAt(1, fast_colour);
 
@@ -29,13 +84,23 @@ void drawRobotVelocity(QGraphicsScene* scene, const Point& position,
     // Drawing a line of length 0 with the SquareCap style causes a large line to be drawn
     pen.setCapStyle(Qt::PenCapStyle::RoundCap);
     pen.setCosmetic(true);
+    return pen;
+}
 
+Segment createRobotVelocitySegment(const Point& position, const Vector& velocity)
+{
     double speed     = velocity.length();
     auto line_length = normalizeValueToRange<double>(
-        speed, 0, ROBOT_MAX_SPEED_METERS_PER_SECOND, 0.0, max_velocity_line_length);
+        speed, 0, ROBOT_MAX_SPEED_METERS_PER_SECOND, 0.0, MAX_VELOCITY_LINE_LENGTH);
+    return Segment(position, position + velocity.normalize(line_length));
+}
 
-    drawSegment(scene, Segment(position, position + velocity.normalize(line_length)),
-                pen);
+void drawRobotVelocity(QGraphicsScene* scene, const Point& position,
+                       const Vector& velocity, const QColor& slow_colour,
+                       const QColor& fast_colour)
+{
+    drawSegment(scene, createRobotVelocitySegment(position, velocity),
+                createRobotVelocityPen(position, velocity, slow_colour, fast_colour));
 }
 
 void drawRobotAtPosition(QGraphicsScene* scene, const Point& position,
@@ -66,9 +131,7 @@ void drawRobotAtPosition(QGraphicsScene* scene, const Point& position,
         position + robot_face_front_left, position - robot_face_front_right,
         position - robot_face_front_left, position + robot_face_front_right};
 
-    QPen robot_body_pen(Qt::black);
-    robot_body_pen.setWidth(1);
-    robot_body_pen.setCosmetic(true);
+    QPen robot_body_pen = createRobotBodyPen();
 
     QBrush brush(color);
     brush.setStyle(Qt::BrushStyle::SolidPattern);
@@ -90,20 +153,12 @@ void drawRobotAtPosition(QGraphicsScene* scene, const Point& position,
 
     // Draw a slightly thicker line for the front face of the robot to make
     // it more visible
-    QPen robot_front_face_pen(Qt::black);
-    robot_front_face_pen.setWidth(2);
-    robot_front_face_pen.setCosmetic(true);
-    drawSegment(scene, front_face, robot_front_face_pen);
+    drawSegment(scene, front_face, createRobotFrontFacePen());
 }
 
-void drawRobotId(QGraphicsScene* scene, const Point& position, const RobotId id)
+QGraphicsSimpleTextItem* createRobotIdItem(RobotId id)
 {
-    Point robot_bounding_box_top_left =
-        position + Vector(-ROBOT_MAX_RADIUS_METERS, ROBOT_MAX_RADIUS_METERS);
-    Point robot_bounding_box_bottom_right =
-        position + Vector(ROBOT_MAX_RADIUS_METERS, -ROBOT_MAX_RADIUS_METERS);
-    QRectF robot_bounding_box(createQPointF(robot_bounding_box_top_left),
-                              createQPointF(robot_bounding_box_bottom_right));
+    const double robot_bounding_box_width = 2 * ROBOT_MAX_RADIUS_METERS;
 
     QGraphicsSimpleTextItem* robot_id = new QGraphicsSimpleTextItem(QString::number(id));
     QFont sansFont("Helvetica [Cronyx]");
@@ -116,7 +171,7 @@ void drawRobotId(QGraphicsScene* scene, const Point& position, const RobotId id)
     // width of the robot's bounding box, and won't overflow if the text gets too long. We
     // care less about the height and just allow it to scale along with the width.
     double scaling_factor =
-        1.0 / (robot_id->boundingRect().width() / robot_bounding_box.width());
+        1.0 / (robot_id->boundingRect().width() / robot_bounding_box_width);
     // Flip the y-axis so the text shows right-side-up. When we set up the GraphicsView
     // that contains the scene we apply a transformation to the y-axis so that Qt's
     // coordinate system matches ours and we can draw things without changing our
@@ -125,9 +180,21 @@ void drawRobotId(QGraphicsScene* scene, const Point& position, const RobotId id)
     QTransform scale_and_invert_y_transform(scaling_factor, 0, 0, -scaling_factor, 0, 0);
     robot_id->setTransform(scale_and_invert_y_transform);
 
-    // Place the text right under the robot
-    robot_id->setPos(robot_bounding_box_top_left.x(),
-                     robot_bounding_box_bottom_right.y());
+    return robot_id;
+}
+
+QPointF getRobotIdPosition(const Point& position)
+{
+    // Place the text right under the robot, lined up with the left side of its bounding
+    // box
+    return createQPointF(position +
+                         Vector(-ROBOT_MAX_RADIUS_METERS, -ROBOT_MAX_RADIUS_METERS));
+}
+
+void drawRobotId(QGraphicsScene* scene, const Point& position, const RobotId id)
+{
+    QGraphicsSimpleTextItem* robot_id = createRobotIdItem(id);
+    robot_id->setPos(getRobotIdPosition(position));
     scene->addItem(robot_id);
 }
 
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <QtGui/QPainterPath>
 #include <QtWidgets/QGraphicsScene>
+#include <QtWidgets/QGraphicsSimpleTextItem>
 
+#include "software/geom/segment.h"
 #include "software/gui/drawing/colors.h"
 #include "software/sensor_fusion/filter/vision_detection.h"
 #include "software/world/robot_state.h"
@@ -11,6 +14,82 @@
  * QGraphicsScene in Qt
  */
 
+/**
+ * Returns the outline of a robot's body, for a robot at the origin facing the +x axis.
+ * Items drawn with this path can be moved and rotated to show any robot state without
+ * recreating the path.
+ *
+ * @return the outline of a robot's body
+ */
+QPainterPath createRobotBodyPath();
+
+/**
+ * Returns the front face of a robot at the origin facing the +x axis
+ *
+ * @return the front face of the robot
+ */
+Segment createRobotFrontFaceSegment();
+
+/**
+ * Creates the pen used to draw the outline of a robot's body
+ *
+ * @return the pen used to draw the outline of a robot's body
+ */
+QPen createRobotBodyPen();
+
+/**
+ * Creates the pen used to draw the front face of a robot, which is slightly thicker
+ * than the body outline to make it more visible
+ *
+ * @return the pen used to draw the front face of a robot
+ */
+QPen createRobotFrontFacePen();
+
+/**
+ * Creates the pen used to draw the robot velocity, which fades from the slow colour at
+ * the robot to the fast colour at the end of the line
+ *
+ * @param position The position of the robot
+ * @param velocity The velocity of the robot
+ * @param slow_colour The velocity line colour when the speed is slow
+ * @param fast_colour The velocity line colour when the speed is fast
+ *
+ * @return the pen used to draw the robot velocity
+ */
+QPen createRobotVelocityPen(const Point& position, const Vector& velocity,
+                            const QColor& slow_colour, const QColor& fast_colour);
+
+/**
+ * Returns the line used to draw the robot velocity, which gets longer the faster the
+ * robot is moving
+ *
+ * @param position The position of the robot
+ * @param velocity The velocity of the robot
+ *
+ * @return the line used to draw the robot velocity
+ */
+Segment createRobotVelocitySegment(const Point& position, const Vector& velocity);
+
+/**
+ * Creates a text item showing the robot's ID, scaled to fit right under the robot. The
+ * item is not added to any scene and must be positioned with getRobotIdPosition.
+ *
+ * @param id The id of the robot
+ *
+ * @return a new text item showing the robot's ID
+ */
+QGraphicsSimpleTextItem* createRobotIdItem(RobotId id);
+
+/**
+ * Returns where to place the item created by createRobotIdItem so that the ID is shown
+ * right under the robot
+ *
+ * @param position The position of the robot
+ *
+ * @return the position of the robot ID item
+ */
+QPointF getRobotIdPosition(const Point& position);
+
 /**
  * Draws the robot velocity on the given scene.
  *
@@ -0,0 +1,138 @@
+#include <benchmark/benchmark.h>
+
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
+#include <QtWidgets/QApplication>
+
+#include "software/gui/drawing/retained_world_layer.h"
+#include "software/gui/drawing/world.h"
+#include "software/test_util/test_util.h"
+
+/**
+ * Benchmarks for the cost of drawing the World in the GUI each frame, comparing clearing
+ * the scene and drawing everything from scratch (immediate mode) with updating the items
+ * of a RetainedWorldLayer (retained mode).
+ *
+ * Each benchmark is run without rendering the scene, which only measures the cost of
+ * updating the scene, and with rendering the scene to an image, which also includes the
+ * cost of painting the items.
+ *
+ * Run with: bazel run -c opt //software/gui/drawing:world_drawing_benchmark
+ */
+
+namespace
+{
+    const unsigned int NUM_ROBOTS_PER_TEAM = 11;
+    // The number of different worlds drawn in a row, so the robots and ball move
+    // between frames like they would in a game
+    const unsigned int NUM_FRAMES = 120;
+
+    /**
+     * Creates a team of robots spread across one half of the field, that have all
+     * moved along by some amount depending on the frame
+     *
+     * @param frame The frame to create the team for
+     * @param side Which side of the field the team is on, either 1 or -1
+     *
+     * @return the team for the given frame
+     */
+    Team createTeam(unsigned int frame, double side)
+    {
+        const double t = static_cast<double>(frame) / NUM_FRAMES;
+        std::vector<Robot> robots;
+        for (RobotId id = 0; id < NUM_ROBOTS_PER_TEAM; id++)
+        {
+            Point position(side * (0.5 + 0.35 * id) * std::cos(t * 2 * M_PI),
+                           -3.0 + 0.55 * id + std::sin(t * 2 * M_PI));
+            Vector velocity = Vector::createFromAngle(Angle::fromRadians(id + t * 10))
+                                  .normalize(0.2 * id);
+            robots.emplace_back(id, position, velocity, Angle::fromRadians(t * 2 * M_PI),
+                                AngularVelocity::zero(), Timestamp::fromSeconds(t));
+        }
+        Team team;
+        team.updateRobots(robots);
+        return team;
+    }
+
+    std::vector<World> createWorlds()
+    {
+        std::vector<World> worlds;
+        World world = ::TestUtil::createBlankTestingWorld();
+        for (unsigned int frame = 0; frame < NUM_FRAMES; frame++)
+        {
+            const double t = static_cast<double>(frame) / NUM_FRAMES;
+            world.updateFriendlyTeamState(createTeam(frame, -1));
+            world.updateEnemyTeamState(createTeam(frame, 1));
+            world.updateBall(Ball(Point(4 * std::sin(t * 2 * M_PI), 0), Vector(3, 1),
+                                  Timestamp::fromSeconds(t)));
+            worlds.emplace_back(world);
+        }
+        return worlds;
+    }
+
+    /**
+     * Renders the scene to an image the size of a typical GUI view, if the benchmark
+     * argument says to do so
+     *
+     * @param state The benchmark state
+     * @param scene The scene to render
+     * @param image The image to render to
+     */
+    void renderIfEnabled(benchmark::State& state, QGraphicsScene& scene, QImage& image)
+    {
+        if (state.range(0))
+        {
+            QPainter painter(&image);
+            painter.setRenderHint(QPainter::Antialiasing);
+            scene.render(&painter, QRectF(), QRectF(-5, -4, 10, 8));
+        }
+    }
+}  // namespace
+
+void benchmarkImmediateModeDrawWorld(benchmark::State& state)
+{
+    const std::vector<World> worlds = createWorlds();
+    QGraphicsScene scene;
+    QImage image(1280, 1024, QImage::Format_ARGB32_Premultiplied);
+
+    unsigned int frame = 0;
+    for (auto _ : state)
+    {
+        scene.clear();
+        drawWorld(&scene, worlds[frame++ % worlds.size()], TeamColour::YELLOW);
+        renderIfEnabled(state, scene, image);
+    }
+    state.counters["items"] = static_cast<double>(scene.items().size());
+}
+
+void benchmarkRetainedModeDrawWorld(benchmark::State& state)
+{
+    const std::vector<World> worlds = createWorlds();
+    QGraphicsScene scene;
+    scene.setItemIndexMethod(QGraphicsScene::NoIndex);
+    QImage image(1280, 1024, QImage::Format_ARGB32_Premultiplied);
+    RetainedWorldLayer retained_world_layer(&scene);
+
+    unsigned int frame = 0;
+    for (auto _ : state)
+    {
+        retained_world_layer.draw(worlds[frame++ % worlds.size()], TeamColour::YELLOW);
+        renderIfEnabled(state, scene, image);
+    }
+    state.counters["items"] = static_cast<double>(scene.items().size());
+}
+
+BENCHMARK(benchmarkImmediateModeDrawWorld)->Arg(false)->Arg(true);
+BENCHMARK(benchmarkRetainedModeDrawWorld)->Arg(false)->Arg(true);
+
+int main(int argc, char** argv)
+{
+    // QGraphicsItems (ex. text) need a QApplication to exist, but we don't need a display
+    // to draw the scene
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication application(argc, argv);
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
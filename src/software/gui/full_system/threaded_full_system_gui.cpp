@@ -4,7 +4,6 @@
 #include <QtWidgets/QApplication>
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
-#include "software/gui/drawing/world.h"
 
 ThreadedFullSystemGUI::ThreadedFullSystemGUI(
     std::shared_ptr<ThunderbotsConfig> mutable_thunderbots_config)
@@ -13,12 +12,13 @@ ThreadedFullSystemGUI::ThreadedFullSystemGUI(
       FirstInFirstOutThreadedObserver<PlayInfo>(),
       FirstInFirstOutThreadedObserver<SensorProto>(),
       termination_promise_ptr(std::make_shared<std::promise<void>>()),
-      world_draw_functions_buffer(std::make_shared<ThreadSafeBuffer<WorldDrawFunction>>(
-          WORLD_DRAW_FUNCTIONS_BUFFER_SIZE, false)),
+      world_buffer(std::make_shared<ThreadSafeBuffer<World>>(WORLD_BUFFER_SIZE, false)),
       ai_draw_functions_buffer(std::make_shared<ThreadSafeBuffer<AIDrawFunction>>(
           AI_DRAW_FUNCTIONS_BUFFER_SIZE, false)),
       play_info_buffer(
           std::make_shared<ThreadSafeBuffer<PlayInfo>>(PLAY_INFO_BUFFER_SIZE, false)),
+      ai_profile_buffer(std::make_shared<ThreadSafeBuffer<TbotsProto::AiProfile>>(
+          AI_PROFILE_BUFFER_SIZE, false)),
       sensor_msg_buffer(
           std::make_shared<ThreadSafeBuffer<SensorProto>>(SENSOR_MSG_BUFFER_SIZE)),
       view_area_buffer(
@@ -64,7 +64,7 @@ void ThreadedFullSystemGUI::createAndRunFullSystemGUI()
     QApplication::connect(application, &QApplication::aboutToQuit,
                           [&]() { application_shutting_down = true; });
     FullSystemGUI* full_system_gui = new FullSystemGUI(
-        world_draw_functions_buffer, ai_draw_functions_buffer, play_info_buffer,
+        world_buffer, ai_draw_functions_buffer, play_info_buffer, ai_profile_buffer,
         sensor_msg_buffer, view_area_buffer, worlds_received_per_second_buffer,
         primitives_sent_per_second_buffer, mutable_thunderbots_config);
     full_system_gui->show();
@@ -86,13 +86,7 @@ void ThreadedFullSystemGUI::createAndRunFullSystemGUI()
 
 void ThreadedFullSystemGUI::onValueReceived(World world)
 {
-    auto friendly_team_colour = mutable_thunderbots_config->getSensorFusionConfig()
-                                        ->getFriendlyColorYellow()
-                                        ->value()
-                                    ? TeamColour::YELLOW
-                                    : TeamColour::BLUE;
-    auto world_draw_function = getDrawWorldFunction(world, friendly_team_colour);
-    world_draw_functions_buffer->push(world_draw_function);
+    world_buffer->push(world);
 
     if (remaining_attempts_to_set_view_area > 0)
     {
@@ -125,6 +119,11 @@ void ThreadedFullSystemGUI::onValueReceived(TbotsProto::PrimitiveSet primitive_m
             TbotsProto::PrimitiveSet>::getDataReceivedPerSecond());
 }
 
+void ThreadedFullSystemGUI::onValueReceived(TbotsProto::AiProfile ai_profile)
+{
+    ai_profile_buffer->push(ai_profile);
+}
+
 std::shared_ptr<std::promise<void>> ThreadedFullSystemGUI::getTerminationPromise()
 {
     return termination_promise_ptr;
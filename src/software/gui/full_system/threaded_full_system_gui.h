@@ -13,6 +13,7 @@
 #include "software/gui/full_system/widgets/full_system_gui.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
 #include "software/multithreading/thread_safe_buffer.h"
+#include "software/proto/ai_profile_msg.pb.h"
 #include "software/proto/sensor_msg.pb.h"
 #include "software/world/world.h"
 
@@ -25,7 +26,8 @@ class ThreadedFullSystemGUI
       public FirstInFirstOutThreadedObserver<AIDrawFunction>,
       public FirstInFirstOutThreadedObserver<PlayInfo>,
       public FirstInFirstOutThreadedObserver<SensorProto>,
-      public FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>
+      public FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>,
+      public FirstInFirstOutThreadedObserver<TbotsProto::AiProfile>
 {
    public:
     explicit ThreadedFullSystemGUI(
@@ -38,6 +40,7 @@ class ThreadedFullSystemGUI
     void onValueReceived(PlayInfo play_info) override;
     void onValueReceived(SensorProto sensor_msg) override;
     void onValueReceived(TbotsProto::PrimitiveSet primitive_msg) override;
+    void onValueReceived(TbotsProto::AiProfile ai_profile) override;
 
     /**
      * Returns a shared_ptr to a promise that can be waited on, and that will
@@ -63,22 +66,23 @@ class ThreadedFullSystemGUI
 
     // Buffers that are shared with the instance of the FullSystemGUI so that data can
     // be passed safely
-    std::shared_ptr<ThreadSafeBuffer<WorldDrawFunction>> world_draw_functions_buffer;
+    std::shared_ptr<ThreadSafeBuffer<World>> world_buffer;
     std::shared_ptr<ThreadSafeBuffer<AIDrawFunction>> ai_draw_functions_buffer;
     std::shared_ptr<ThreadSafeBuffer<PlayInfo>> play_info_buffer;
+    std::shared_ptr<ThreadSafeBuffer<TbotsProto::AiProfile>> ai_profile_buffer;
     std::shared_ptr<ThreadSafeBuffer<SensorProto>> sensor_msg_buffer;
     std::shared_ptr<ThreadSafeBuffer<Rectangle>> view_area_buffer;
     std::shared_ptr<ThreadSafeBuffer<double>> worlds_received_per_second_buffer;
     std::shared_ptr<ThreadSafeBuffer<double>> primitives_sent_per_second_buffer;
 
-    // We want to show the most recent world and AI data, but also want things to look
-    // smooth if the stream of data isn't perfectly consistent, so we use a very small
-    // buffer of 2 values to be responsive while also giving a small buffer for
-    // smoothness
-    static constexpr std::size_t WORLD_DRAW_FUNCTIONS_BUFFER_SIZE = 2;
-    static constexpr std::size_t AI_DRAW_FUNCTIONS_BUFFER_SIZE    = 2;
+    // We only draw the most recent world and AI data once per frame, so anything older
+    // that arrives between frames is dropped and the buffers are of size 1
+    static constexpr std::size_t WORLD_BUFFER_SIZE             = 1;
+    static constexpr std::size_t AI_DRAW_FUNCTIONS_BUFFER_SIZE = 1;
     // We only care about the most recent PlayInfo, so the buffer is of size 1
     static constexpr std::size_t PLAY_INFO_BUFFER_SIZE = 1;
+    // We only care about the most recent AiProfile, so the buffer is of size 1
+    static constexpr std::size_t AI_PROFILE_BUFFER_SIZE = 1;
     // We don't want to miss any SensorProto updates so we make the buffer larger
     static constexpr std::size_t SENSOR_MSG_BUFFER_SIZE = 2;
     // We only care about the most recent view area that was requested, so the
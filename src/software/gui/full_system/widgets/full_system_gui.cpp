@@ -1,12 +1,16 @@
 #include "software/gui/full_system/widgets/full_system_gui.h"
 
+#include <QtGui/QGuiApplication>
+#include <QtGui/QScreen>
+
 #include "software/gui/full_system/widgets/ai_control.h"
 #include "software/gui/generic_widgets/robot_status/robot_status.h"
 
 FullSystemGUI::FullSystemGUI(
-    std::shared_ptr<ThreadSafeBuffer<WorldDrawFunction>> world_draw_functions_buffer,
+    std::shared_ptr<ThreadSafeBuffer<World>> world_buffer,
     std::shared_ptr<ThreadSafeBuffer<AIDrawFunction>> ai_draw_functions_buffer,
     std::shared_ptr<ThreadSafeBuffer<PlayInfo>> play_info_buffer,
+    std::shared_ptr<ThreadSafeBuffer<TbotsProto::AiProfile>> ai_profile_buffer,
     std::shared_ptr<ThreadSafeBuffer<SensorProto>> sensor_msg_buffer,
     std::shared_ptr<ThreadSafeBuffer<Rectangle>> view_area_buffer,
     std::shared_ptr<ThreadSafeBuffer<double>> worlds_received_per_second_buffer,
@@ -16,14 +20,15 @@ FullSystemGUI::FullSystemGUI(
       main_widget(new Ui::AutogeneratedFullSystemMainWidget()),
       update_timer(new QTimer(this)),
       data_per_second_timer(new QTimer(this)),
-      world_draw_functions_buffer(world_draw_functions_buffer),
+      world_buffer(world_buffer),
       ai_draw_functions_buffer(ai_draw_functions_buffer),
       play_info_buffer(play_info_buffer),
+      ai_profile_buffer(ai_profile_buffer),
       sensor_msg_buffer(sensor_msg_buffer),
       view_area_buffer(view_area_buffer),
       worlds_received_per_second_buffer(worlds_received_per_second_buffer),
       primitives_sent_per_second_buffer(primitives_sent_per_second_buffer),
-      most_recent_world_draw_function([](QGraphicsScene*) { return; }),
+      sensor_fusion_config(config->getSensorFusionConfig()),
       most_recent_ai_draw_function([](QGraphicsScene*) { return; })
 {
     // Create a new widget that will contain all the autogenerated
@@ -52,8 +57,8 @@ FullSystemGUI::FullSystemGUI(
     // This is a separate timer as the update timer is too fast
     connect(data_per_second_timer, &QTimer::timeout, this,
             &FullSystemGUI::updateDataPerSecondLCD);
-    update_timer->start(static_cast<int>(
-        Duration::fromSeconds(UPDATE_INTERVAL_SECONDS).toMilliseconds()));
+    update_timer->setTimerType(Qt::PreciseTimer);
+    update_timer->start(static_cast<int>(getUpdateInterval().toMilliseconds()));
     data_per_second_timer->start(static_cast<int>(
         Duration::fromSeconds(DATA_PER_SECOND_UPDATE_INTERVAL_SECONDS).toMilliseconds()));
 }
@@ -62,26 +67,43 @@ void FullSystemGUI::handleUpdate()
 {
     draw();
     updatePlayInfo();
+    updateAiProfile();
     updateSensorProto();
     updateDrawViewArea();
 }
 
+Duration FullSystemGUI::getUpdateInterval() const
+{
+    double update_rate_hz = DEFAULT_UPDATE_RATE_HZ;
+    if (QScreen* screen = QGuiApplication::primaryScreen())
+    {
+        if (screen->refreshRate() > 0)
+        {
+            update_rate_hz = screen->refreshRate();
+        }
+    }
+    return Duration::fromSeconds(1.0 / update_rate_hz);
+}
+
 void FullSystemGUI::draw()
 {
-    if (auto world_draw_function =
-            world_draw_functions_buffer->popLeastRecentlyAddedValue())
+    // The buffers only hold the most recent value, so any Worlds or AIDrawFunctions
+    // that arrived since the last frame are coalesced into a single redraw
+    if (auto world = world_buffer->popMostRecentlyAddedValue())
     {
-        most_recent_world_draw_function = world_draw_function.value();
+        auto friendly_team_colour =
+            sensor_fusion_config->getFriendlyColorYellow()->value() ? TeamColour::YELLOW
+                                                                    : TeamColour::BLUE;
+        main_widget->ai_visualization_graphics_view->drawWorld(world.value(),
+                                                               friendly_team_colour);
     }
 
-    if (auto ai_draw_function = ai_draw_functions_buffer->popLeastRecentlyAddedValue())
+    if (auto ai_draw_function = ai_draw_functions_buffer->popMostRecentlyAddedValue())
     {
         most_recent_ai_draw_function = ai_draw_function.value();
+        main_widget->ai_visualization_graphics_view->clearAndDraw(
+            {most_recent_ai_draw_function.getDrawFunction()});
     }
-
-    main_widget->ai_visualization_graphics_view->clearAndDraw(
-        {most_recent_world_draw_function.getDrawFunction(),
-         most_recent_ai_draw_function.getDrawFunction()});
 }
 
 void FullSystemGUI::updatePlayInfo()
@@ -92,6 +114,14 @@ void FullSystemGUI::updatePlayInfo()
     }
 }
 
+void FullSystemGUI::updateAiProfile()
+{
+    if (auto ai_profile = ai_profile_buffer->popLeastRecentlyAddedValue())
+    {
+        main_widget->ai_profile_widget->updateAiProfile(ai_profile.value());
+    }
+}
+
 void FullSystemGUI::updateSensorProto()
 {
     while (auto sensor_msg = sensor_msg_buffer->popLeastRecentlyAddedValue())
@@ -10,8 +10,10 @@
 #include "software/gui/drawing/draw_functions.h"
 #include "software/gui/full_system/ui/ui_main_widget.h"
 #include "software/multithreading/thread_safe_buffer.h"
+#include "software/proto/ai_profile_msg.pb.h"
 #include "software/proto/sensor_msg.pb.h"
 #include "software/time/duration.h"
+#include "software/world/world.h"
 
 /**
  * This class is the main application window for the FullSystemGUI.
@@ -19,7 +21,9 @@
  * any callbacks required for asynchronous operations.
  *
  * This class uses ThreadSafeBuffers to receive new data, and consumes this
- * data at a fixed rate by calling functions periodically with a timer.
+ * data at a fixed rate by calling functions periodically with a timer. The timer runs
+ * at the refresh rate of the display, so the field is redrawn at most once per frame
+ * the display can show, no matter how quickly new data arrives.
  */
 class FullSystemGUI : public QMainWindow
 {
@@ -29,18 +33,19 @@ class FullSystemGUI : public QMainWindow
     /**
      * Creates a new FullSystemGUI MainWindow
      *
-     * @param world_draw_functions_buffer The buffer used to receive new
-     * WorldDrawFunctions
+     * @param world_buffer The buffer used to receive new Worlds
      * @param ai_draw_functions_buffer The buffer used to receive new AIDrawFunctions
      * @param play_info_buffer The buffer used to receive new PlayInfo
+     * @param ai_profile_buffer The buffer used to receive new AiProfiles
      * @param sensor_msg_buffer The buffer used to receive new SensorProtos
      * @param view_area_buffer The buffer used to receive Rectangles that specify the area
      * of the world to display in the view
      */
     explicit FullSystemGUI(
-        std::shared_ptr<ThreadSafeBuffer<WorldDrawFunction>> world_draw_functions_buffer,
+        std::shared_ptr<ThreadSafeBuffer<World>> world_buffer,
         std::shared_ptr<ThreadSafeBuffer<AIDrawFunction>> ai_draw_functions_buffer,
         std::shared_ptr<ThreadSafeBuffer<PlayInfo>> play_info_buffer,
+        std::shared_ptr<ThreadSafeBuffer<TbotsProto::AiProfile>> ai_profile_buffer,
         std::shared_ptr<ThreadSafeBuffer<SensorProto>> sensor_msg_buffer,
         std::shared_ptr<ThreadSafeBuffer<Rectangle>> view_area_buffer,
         std::shared_ptr<ThreadSafeBuffer<double>> worlds_received_per_second_buffer,
@@ -54,10 +59,19 @@ class FullSystemGUI : public QMainWindow
      */
     void handleUpdate();
 
+    /**
+     * Returns the interval the update_timer should run at, so that updates line up
+     * with the refresh rate of the display showing the FullSystemGUI
+     *
+     * @return the interval between updates
+     */
+    Duration getUpdateInterval() const;
+
     /**
      * Draws all the AI information we want to display in the FullSystemGUI. This includes
      * visualizing the state of the world as well as drawing the AI state we want to show,
-     * like planned navigator paths.
+     * like planned navigator paths. Nothing is redrawn if no new data has arrived since
+     * the last time this was called.
      */
     void draw();
 
@@ -66,6 +80,11 @@ class FullSystemGUI : public QMainWindow
      */
     void updatePlayInfo();
 
+    /**
+     * Updates and displays the newly provided AiProfile
+     */
+    void updateAiProfile();
+
     /**
      * Updates and displays the newly provided SensorProto.
      */
@@ -88,17 +107,20 @@ class FullSystemGUI : public QMainWindow
     QTimer* update_timer;
     QTimer* data_per_second_timer;
 
-    std::shared_ptr<ThreadSafeBuffer<WorldDrawFunction>> world_draw_functions_buffer;
+    std::shared_ptr<ThreadSafeBuffer<World>> world_buffer;
     std::shared_ptr<ThreadSafeBuffer<AIDrawFunction>> ai_draw_functions_buffer;
     std::shared_ptr<ThreadSafeBuffer<PlayInfo>> play_info_buffer;
+    std::shared_ptr<ThreadSafeBuffer<TbotsProto::AiProfile>> ai_profile_buffer;
     std::shared_ptr<ThreadSafeBuffer<SensorProto>> sensor_msg_buffer;
     std::shared_ptr<ThreadSafeBuffer<Rectangle>> view_area_buffer;
     std::shared_ptr<ThreadSafeBuffer<double>> worlds_received_per_second_buffer;
     std::shared_ptr<ThreadSafeBuffer<double>> primitives_sent_per_second_buffer;
 
-    WorldDrawFunction most_recent_world_draw_function;
+    std::shared_ptr<const SensorFusionConfig> sensor_fusion_config;
+
     AIDrawFunction most_recent_ai_draw_function;
 
-    static constexpr double UPDATE_INTERVAL_SECONDS                 = 1.0 / 60.0;
+    // The update rate used if the refresh rate of the display can't be found
+    static constexpr double DEFAULT_UPDATE_RATE_HZ                  = 60.0;
     static constexpr double DATA_PER_SECOND_UPDATE_INTERVAL_SECONDS = 1.0 / 2.0;
 };
@@ -0,0 +1,110 @@
+#include "software/gui/generic_widgets/ai_profile/ai_profile_widget.h"
+
+#include <QtCore/QHash>
+#include <QtGui/QPainter>
+#include <algorithm>
+
+AIProfileWidget::AIProfileWidget(QWidget* parent)
+    : QWidget(parent), ai_profile(), thread_section_tops_pixels()
+{
+}
+
+void AIProfileWidget::updateAiProfile(const TbotsProto::AiProfile& ai_profile)
+{
+    this->ai_profile = ai_profile;
+
+    // Each thread gets a section tall enough to fit its most deeply nested scope
+    std::map<unsigned int, unsigned int> thread_num_rows;
+    for (const auto& scope : ai_profile.scopes())
+    {
+        unsigned int& num_rows = thread_num_rows[scope.thread_index()];
+        num_rows               = std::max(num_rows, scope.depth() + 1);
+    }
+
+    thread_section_tops_pixels.clear();
+    int section_top_pixels = HEADER_HEIGHT_PIXELS;
+    for (const auto& [thread_index, num_rows] : thread_num_rows)
+    {
+        thread_section_tops_pixels[thread_index] = section_top_pixels;
+        // Leave a gap of half a row between the sections
+        section_top_pixels +=
+            static_cast<int>(num_rows) * ROW_HEIGHT_PIXELS + ROW_HEIGHT_PIXELS / 2;
+    }
+    setMinimumHeight(section_top_pixels);
+
+    update();
+}
+
+void AIProfileWidget::paintEvent(QPaintEvent* event)
+{
+    QPainter painter(this);
+    painter.fillRect(rect(), palette().base());
+    painter.setPen(palette().text().color());
+
+    QString header =
+        QString("Tick Duration: %1 ms").arg(ai_profile.tick_duration_ms(), 0, 'f', 2);
+    if (ai_profile.num_dropped_scopes() > 0)
+    {
+        header.append(
+            QString(" (%1 scopes dropped)").arg(ai_profile.num_dropped_scopes()));
+    }
+    if (ai_profile.num_allocations() > 0)
+    {
+        header.append(QString("    Allocations: %1 (%2 KiB)")
+                          .arg(ai_profile.num_allocations())
+                          .arg(ai_profile.allocated_bytes() / 1024.0, 0, 'f', 1));
+        if (ai_profile.top_allocation_call_sites_size() > 0)
+        {
+            const auto& top_call_site = ai_profile.top_allocation_call_sites(0);
+            header.append(QString(", most from %1 (%2)")
+                              .arg(QString::fromStdString(top_call_site.name()))
+                              .arg(top_call_site.num_allocations()));
+        }
+    }
+    uint32_t num_evaluations =
+        ai_profile.evaluation_cache_hits() + ai_profile.evaluation_cache_misses();
+    if (num_evaluations > 0)
+    {
+        header.append(
+            QString("    Evaluation Cache: %1 hits / %2 misses (%3%)")
+                .arg(ai_profile.evaluation_cache_hits())
+                .arg(ai_profile.evaluation_cache_misses())
+                .arg(100.0 * ai_profile.evaluation_cache_hits() / num_evaluations, 0, 'f',
+                     0));
+    }
+    painter.drawText(QRect(0, 0, width(), HEADER_HEIGHT_PIXELS),
+                     Qt::AlignLeft | Qt::AlignVCenter, header);
+
+    if (ai_profile.tick_duration_ms() <= 0.0)
+    {
+        return;
+    }
+
+    const double pixels_per_ms = width() / ai_profile.tick_duration_ms();
+    for (const auto& scope : ai_profile.scopes())
+    {
+        QString name = QString::fromStdString(scope.name());
+        QRectF bar(scope.start_time_ms() * pixels_per_ms,
+                   thread_section_tops_pixels[scope.thread_index()] +
+                       static_cast<int>(scope.depth()) * ROW_HEIGHT_PIXELS,
+                   std::max(1.0, scope.duration_ms() * pixels_per_ms),
+                   ROW_HEIGHT_PIXELS - 1);
+
+        // The colour is based on the name so that each scope keeps the same colour
+        // from tick to tick, which makes changes easier to spot
+        painter.fillRect(bar,
+                         QColor::fromHsv(static_cast<int>(qHash(name) % 360), 100, 230));
+
+        if (bar.width() >= MIN_LABEL_WIDTH_PIXELS)
+        {
+            QString label =
+                QString("%1 (%2 ms)").arg(name).arg(scope.duration_ms(), 0, 'f', 2);
+            QRectF label_area = bar.adjusted(2, 0, -2, 0);
+            painter.setPen(Qt::black);
+            painter.drawText(
+                label_area, Qt::AlignLeft | Qt::AlignVCenter,
+                painter.fontMetrics().elidedText(label, Qt::ElideRight,
+                                                 static_cast<int>(label_area.width())));
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <QtWidgets/QWidget>
+#include <map>
+
+#include "software/proto/ai_profile_msg.pb.h"
+
+/**
+ * This class displays an AiProfile as a flame graph. Each scope that ran during the tick
+ * is drawn as a bar whose horizontal position and width show when it ran and how long
+ * it took, and scopes are stacked below the scopes they were nested in. Scopes that ran
+ * on different threads are drawn in separate sections.
+ */
+class AIProfileWidget : public QWidget
+{
+    Q_OBJECT
+
+   public:
+    explicit AIProfileWidget(QWidget* parent = nullptr);
+
+    /**
+     * Updates the AiProfile being displayed by this widget
+     *
+     * @param ai_profile The new AiProfile to display
+     */
+    void updateAiProfile(const TbotsProto::AiProfile& ai_profile);
+
+   protected:
+    void paintEvent(QPaintEvent* event) override;
+
+   private:
+    TbotsProto::AiProfile ai_profile;
+    // The y coordinate of the top of the section each thread's scopes are drawn in
+    std::map<unsigned int, int> thread_section_tops_pixels;
+
+    static constexpr int ROW_HEIGHT_PIXELS    = 18;
+    static constexpr int HEADER_HEIGHT_PIXELS = 20;
+    // Scopes narrower than this are too small to have their names drawn
+    static constexpr int MIN_LABEL_WIDTH_PIXELS = 20;
+};
@@ -11,6 +11,8 @@ DrawFunctionVisualizer::DrawFunctionVisualizer(QWidget *parent)
     : ZoomableQGraphicsView(parent),
       graphics_scene(new QGraphicsScene(this)),
       open_gl_widget(new QOpenGLWidget(this)),
+      retained_world_layer(graphics_scene),
+      draw_function_items(),
       // Placeholder Rectangle
       last_view_area(Rectangle(Point(1, 1), Point(0, 0)))
 
@@ -22,6 +24,9 @@ DrawFunctionVisualizer::DrawFunctionVisualizer(QWidget *parent)
     setInteractive(false);
     setCacheMode(QGraphicsView::CacheBackground);
     setViewportUpdateMode(QGraphicsView::SmartViewportUpdate);
+    // Most items in the scene either move every frame or are recreated every frame, so
+    // maintaining an index of item positions costs more than it saves
+    graphics_scene->setItemIndexMethod(QGraphicsScene::NoIndex);
     // Using an OpenGL widget with the view should help make use of the graphics card
     // rather than doing CPU drawing, which should take some load off the CPU and make
     // things faster
@@ -60,7 +65,13 @@ DrawFunctionVisualizer::DrawFunctionVisualizer(QWidget *parent)
 
 void DrawFunctionVisualizer::clearAndDraw(const std::vector<DrawFunction> &draw_functions)
 {
-    graphics_scene->clear();
+    // Deleting an item also removes it and all its children from the scene
+    for (QGraphicsItem *item : draw_function_items)
+    {
+        delete item;
+    }
+    draw_function_items.clear();
+
     for (auto draw_function : draw_functions)
     {
         if (draw_function)
@@ -72,6 +83,20 @@ void DrawFunctionVisualizer::clearAndDraw(const std::vector<DrawFunction> &draw_
             LOG(WARNING) << "Attempted to draw a non-callable DrawFunction";
         }
     }
+
+    for (QGraphicsItem *item : graphics_scene->items())
+    {
+        if (!item->parentItem() && item != retained_world_layer.getRootItem())
+        {
+            draw_function_items.emplace_back(item);
+        }
+    }
+}
+
+void DrawFunctionVisualizer::drawWorld(const World &world,
+                                       TeamColour friendly_team_colour)
+{
+    retained_world_layer.draw(world, friendly_team_colour);
 }
 
 void DrawFunctionVisualizer::setViewArea(const Rectangle &view_area)
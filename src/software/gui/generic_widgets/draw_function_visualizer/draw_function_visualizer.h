@@ -2,15 +2,21 @@
 
 #include <QtWidgets/QGraphicsScene>
 #include <QtWidgets/QOpenGLWidget>
+#include <vector>
 
 #include "software/geom/rectangle.h"
 #include "software/gui/drawing/draw_functions.h"
+#include "software/gui/drawing/retained_world_layer.h"
 #include "software/gui/generic_widgets/draw_function_visualizer/zoomable_qgraphics_view.h"
 
 /**
  * This class is a QGraphicsView widget that allows the user to zoom
  * and pan around the scene. It provides an interface for drawing arbitrary
  * shapes and information in the scene through the use of DrawFunctions.
+ *
+ * The World can also be drawn through a RetainedWorldLayer, which updates the items
+ * already in the scene rather than recreating them. Anything drawn by DrawFunctions is
+ * drawn on top of the World.
  */
 class DrawFunctionVisualizer : public ZoomableQGraphicsView
 {
@@ -20,12 +26,21 @@ class DrawFunctionVisualizer : public ZoomableQGraphicsView
     explicit DrawFunctionVisualizer(QWidget* parent = nullptr);
 
     /**
-     * Clears the scene and draws each of the provided DrawFunctions in order
+     * Clears everything drawn by the previous call to this function, and draws each of
+     * the provided DrawFunctions in order. Anything drawn with drawWorld is kept.
      *
      * @param draw_functions The DrawFunctions to draw on the scene, in order
      */
     void clearAndDraw(const std::vector<DrawFunction>& draw_functions);
 
+    /**
+     * Updates the World shown in the scene
+     *
+     * @param world The world to draw
+     * @param friendly_team_colour The colour of the friendly team
+     */
+    void drawWorld(const World& world, TeamColour friendly_team_colour);
+
     /**
      * Sets the area of the scene that's visible in the view
      *
@@ -39,6 +54,9 @@ class DrawFunctionVisualizer : public ZoomableQGraphicsView
     // it, so we don't have to
     QGraphicsScene* graphics_scene;
     QOpenGLWidget* open_gl_widget;
+    RetainedWorldLayer retained_world_layer;
+    // The top-level items drawn by the last call to clearAndDraw
+    std::vector<QGraphicsItem*> draw_function_items;
 
    protected:
     /**
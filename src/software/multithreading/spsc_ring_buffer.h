@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+/**
+ * This class represents a fixed size, lock-free ring buffer of objects that can be
+ * used to pass values from exactly one producer thread to exactly one consumer thread.
+ *
+ * Unlike the ThreadSafeBuffer, pushing and popping never block or lock a mutex, so it
+ * is cheap enough to use on hot paths (ex. recording profiling data). The cost of this
+ * is that values are dropped rather than overwritten when the buffer is full, and that
+ * only one thread may push and only one thread may pop at any given time.
+ *
+ * @tparam T The type of whatever is being buffered
+ */
+template <typename T>
+class SpscRingBuffer
+{
+   public:
+    // Force the user to specify a size
+    explicit SpscRingBuffer() = delete;
+
+    /**
+     * Creates a new SpscRingBuffer
+     *
+     * @param buffer_size The maximum number of values the buffer can hold
+     */
+    explicit SpscRingBuffer(std::size_t buffer_size);
+
+    // Copying this class is not permitted
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+
+    /**
+     * Pushes the given value onto the buffer. Must only be called from the producer
+     * thread.
+     *
+     * @param value The value to push onto the buffer
+     *
+     * @return true if the value was pushed, and false if the buffer was full and the
+     * value was dropped
+     */
+    bool push(const T& value);
+
+    /**
+     * Removes the value least recently added to the buffer and returns it. Must only be
+     * called from the consumer thread.
+     *
+     * @return The least recently added value in the buffer, or std::nullopt if the
+     * buffer is empty
+     */
+    std::optional<T> pop();
+
+    /**
+     * Returns the maximum number of values the buffer can hold
+     *
+     * @return the maximum number of values the buffer can hold
+     */
+    std::size_t capacity() const;
+
+   private:
+    // One slot is always left empty so that a full buffer can be told apart from an
+    // empty one without sharing a counter between the producer and consumer
+    std::vector<T> buffer;
+
+    // The index the producer will push to next. Only written by the producer
+    std::atomic<std::size_t> head;
+    // The index the consumer will pop from next. Only written by the consumer
+    std::atomic<std::size_t> tail;
+};
+
+#include "software/multithreading/spsc_ring_buffer.tpp"
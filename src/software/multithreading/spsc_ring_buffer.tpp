@@ -0,0 +1,46 @@
+#pragma once
+
+template <typename T>
+SpscRingBuffer<T>::SpscRingBuffer(std::size_t buffer_size)
+    : buffer(buffer_size + 1), head(0), tail(0)
+{
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::push(const T& value)
+{
+    // Only the producer writes head, so it can be read without synchronization
+    const std::size_t current_head = head.load(std::memory_order_relaxed);
+    const std::size_t next_head    = (current_head + 1) % buffer.size();
+    // Acquire so that we don't overwrite a slot the consumer has not finished reading
+    if (next_head == tail.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    buffer[current_head] = value;
+    // Release so that the consumer sees the value once it sees the new head
+    head.store(next_head, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+std::optional<T> SpscRingBuffer<T>::pop()
+{
+    // Only the consumer writes tail, so it can be read without synchronization
+    const std::size_t current_tail = tail.load(std::memory_order_relaxed);
+    if (current_tail == head.load(std::memory_order_acquire))
+    {
+        return std::nullopt;
+    }
+
+    std::optional<T> result = buffer[current_tail];
+    tail.store((current_tail + 1) % buffer.size(), std::memory_order_release);
+    return result;
+}
+
+template <typename T>
+std::size_t SpscRingBuffer<T>::capacity() const
+{
+    return buffer.size() - 1;
+}
@@ -0,0 +1,87 @@
+#include "software/multithreading/spsc_ring_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+TEST(SpscRingBufferTest, pop_from_empty_buffer)
+{
+    SpscRingBuffer<int> buffer(3);
+
+    EXPECT_EQ(std::nullopt, buffer.pop());
+}
+
+TEST(SpscRingBufferTest, pop_returns_values_in_the_order_they_were_pushed)
+{
+    SpscRingBuffer<int> buffer(3);
+
+    EXPECT_TRUE(buffer.push(7));
+    EXPECT_TRUE(buffer.push(8));
+    EXPECT_TRUE(buffer.push(9));
+
+    EXPECT_EQ(7, buffer.pop());
+    EXPECT_EQ(8, buffer.pop());
+    EXPECT_EQ(9, buffer.pop());
+    EXPECT_EQ(std::nullopt, buffer.pop());
+}
+
+TEST(SpscRingBufferTest, push_to_full_buffer_drops_the_value)
+{
+    SpscRingBuffer<int> buffer(2);
+
+    EXPECT_EQ(2, buffer.capacity());
+    EXPECT_TRUE(buffer.push(7));
+    EXPECT_TRUE(buffer.push(8));
+    EXPECT_FALSE(buffer.push(9));
+
+    EXPECT_EQ(7, buffer.pop());
+    EXPECT_EQ(8, buffer.pop());
+    EXPECT_EQ(std::nullopt, buffer.pop());
+}
+
+TEST(SpscRingBufferTest, push_and_pop_wrap_around_the_end_of_the_buffer)
+{
+    SpscRingBuffer<int> buffer(2);
+
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_TRUE(buffer.push(i));
+        EXPECT_TRUE(buffer.push(i + 100));
+        EXPECT_EQ(i, buffer.pop());
+        EXPECT_EQ(i + 100, buffer.pop());
+    }
+}
+
+TEST(SpscRingBufferTest, values_are_passed_between_threads_in_order)
+{
+    SpscRingBuffer<int> buffer(16);
+    const int num_values = 10000;
+
+    std::thread producer_thread([&]() {
+        for (int i = 0; i < num_values; i++)
+        {
+            while (!buffer.push(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected_value = 0;
+    while (expected_value < num_values)
+    {
+        std::optional<int> value = buffer.pop();
+        if (value)
+        {
+            ASSERT_EQ(expected_value, *value);
+            expected_value++;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer_thread.join();
+    EXPECT_EQ(std::nullopt, buffer.pop());
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <google/protobuf/arena.h>
+#include <sys/socket.h>
+
+#include <array>
+#include <atomic>
+#include <boost/asio.hpp>
+#include <boost/bind.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * Counters describing the packets received by a BatchedProtoUdpListener
+ */
+struct UdpListenerStats
+{
+    // The number of packets parsed and passed to the receive callback
+    unsigned long num_packets_received = 0;
+    // The number of packets the kernel dropped because the socket's receive buffer was
+    // full, i.e. because packets were not received fast enough
+    unsigned long num_packets_dropped_by_kernel = 0;
+    // The number of packets that were received but dropped because they were larger
+    // than the receive buffer or could not be parsed
+    unsigned long num_packets_dropped_malformed = 0;
+    // The number of batches of packets that have been received
+    unsigned long num_batches_received = 0;
+    // The time between the kernel receiving a packet and the packet being passed to the
+    // receive callback, averaged over all packets received
+    double mean_delivery_latency_ms = 0.0;
+    // The longest time between the kernel receiving a packet and the packet being
+    // passed to the receive callback
+    double max_delivery_latency_ms = 0.0;
+};
+
+/**
+ * A high-throughput alternative to the ProtoUdpListener, for sockets that receive
+ * bursts of packets (ex. vision data from many cameras).
+ *
+ * Rather than receiving one datagram per asynchronous receive, this listener waits for
+ * the socket to become readable and then drains it in batches of up to MAX_BATCH_SIZE
+ * datagrams per system call with recvmmsg. Each batch is parsed into a protobuf Arena
+ * that is reset once the batch has been handled, so parsing does not allocate once the
+ * arena has grown to fit a batch.
+ *
+ * NOTE: Messages passed to the receive callback are allocated on the arena, so they are
+ * only valid until the callback returns. The callback must copy anything it wants to
+ * keep.
+ *
+ * recvmmsg is Linux-specific, so this listener only works on Linux.
+ */
+template <class ReceiveProtoT>
+class BatchedProtoUdpListener
+{
+   public:
+    /**
+     * Creates a BatchedProtoUdpListener that will listen for ReceiveProtoT packets from
+     * the network on the multicast group of given address and port. For every
+     * ReceiveProtoT packet received, the receive_callback will be called to perform any
+     * operations desired by the caller
+     *
+     * @param io_service The io_service to use to service incoming ReceiveProtoT data
+     * @param ip_address The ip address of on which to listen for the given ReceiveProtoT
+     * packets (IPv4 in dotted decimal or IPv6 in hex string) example IPv4: 192.168.0.2
+     *  example IPv6: ff02::c3d0:42d2:bb8%wlp4s0 (the interface is specified after %)
+     * @param port The port on which to listen for ReceiveProtoT packets
+     * @param receive_callback The function to run for every ReceiveProtoT packet received
+     * from the network
+     * @param multicast If true, joins the multicast group of given ip_address
+     */
+    BatchedProtoUdpListener(boost::asio::io_service& io_service,
+                            const std::string& ip_address, unsigned short port,
+                            std::function<void(ReceiveProtoT&)> receive_callback,
+                            bool multicast);
+
+    /**
+     * Creates a BatchedProtoUdpListener that will listen for ReceiveProtoT packets from
+     * the network on any local address with given port. For every ReceiveProtoT packet
+     * received, the receive_callback will be called to perform any operations desired by
+     * the caller
+     *
+     * @param io_service The io_service to use to service incoming ReceiveProtoT data
+     * @param port The port on which to listen for ReceiveProtoT packets
+     * @param receive_callback The function to run for every ReceiveProtoT packet received
+     * from the network
+     */
+    BatchedProtoUdpListener(boost::asio::io_service& io_service, unsigned short port,
+                            std::function<void(ReceiveProtoT&)> receive_callback);
+
+    virtual ~BatchedProtoUdpListener();
+
+    /**
+     * Returns the counters for the packets received so far. This is safe to call from
+     * any thread.
+     *
+     * @return the counters for the packets received so far
+     */
+    UdpListenerStats getStats() const;
+
+    // The maximum number of datagrams received with a single system call
+    static constexpr unsigned int MAX_BATCH_SIZE = 64;
+
+   private:
+    /**
+     * Sets up the socket options and receive buffers shared by both constructors, and
+     * starts listening
+     */
+    void setupAndStartListen();
+
+    /**
+     * Start waiting for data to be available on the socket
+     */
+    void startListen();
+
+    /**
+     * This function is setup as the callback to run when the socket has data available
+     *
+     * @param error The error code obtained when waiting for the data
+     */
+    void handleSocketReadable(const boost::system::error_code& error);
+
+    /**
+     * Parses each of the datagrams received in the last batch, and passes them to the
+     * receive callback
+     *
+     * @param num_datagrams The number of datagrams in the batch
+     */
+    void handleBatch(unsigned int num_datagrams);
+
+    // A UDP socket that we listen on for ReceiveProtoT messages from the network
+    boost::asio::ip::udp::socket socket_;
+
+    static constexpr unsigned int MAX_BUFFER_LENGTH = 9000;
+    // Enough space for a receive timestamp and the dropped packet count
+    static constexpr std::size_t CONTROL_BUFFER_LENGTH =
+        CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(sizeof(uint32_t));
+    // We only drain this many batches each time the socket becomes readable, so that a
+    // flood of packets can't starve any other work on the io_service
+    static constexpr unsigned int MAX_BATCHES_PER_WAKEUP = 16;
+    // Requested size of the kernel receive buffer, so bursts of packets can queue while
+    // the previous batch is handled. The kernel may cap this to net.core.rmem_max
+    static constexpr int SOCKET_RECEIVE_BUFFER_SIZE = 4 * 1024 * 1024;
+    // The size of the block of memory reserved for the arena, which is reused for
+    // every batch
+    static constexpr std::size_t ARENA_INITIAL_BLOCK_SIZE = 512 * 1024;
+
+    // The datagrams, control messages, and message headers for a batch. Each header
+    // points into the buffers at the same index
+    std::vector<char> datagram_buffers;
+    std::vector<char> control_buffers;
+    std::array<struct iovec, MAX_BATCH_SIZE> iovecs;
+    std::array<struct mmsghdr, MAX_BATCH_SIZE> message_headers;
+
+    std::vector<char> arena_initial_block;
+    google::protobuf::Arena arena;
+
+    // The function to call on every received packet of ReceiveProtoT data
+    std::function<void(ReceiveProtoT&)> receive_callback;
+
+    // Counters for getStats. These are only written by the thread running the
+    // io_service, but may be read from any thread
+    std::atomic<unsigned long> num_packets_received;
+    std::atomic<unsigned long> num_packets_dropped_by_kernel;
+    std::atomic<unsigned long> num_packets_dropped_malformed;
+    std::atomic<unsigned long> num_batches_received;
+    std::atomic<double> total_delivery_latency_ms;
+    std::atomic<double> max_delivery_latency_ms;
+};
+
+#include "software/networking/batched_proto_udp_listener.tpp"
@@ -0,0 +1,303 @@
+#pragma once
+
+#include <chrono>
+#include <cstring>
+#include <optional>
+
+#include "software/logger/logger.h"
+#include "software/networking/batched_proto_udp_listener.h"
+#include "software/util/memory/protobuf_arena_options.h"
+
+template <class ReceiveProtoT>
+BatchedProtoUdpListener<ReceiveProtoT>::BatchedProtoUdpListener(
+    boost::asio::io_service& io_service, const std::string& ip_address,
+    const unsigned short port, std::function<void(ReceiveProtoT&)> receive_callback,
+    bool multicast)
+    : socket_(io_service),
+      datagram_buffers(MAX_BATCH_SIZE * MAX_BUFFER_LENGTH),
+      control_buffers(MAX_BATCH_SIZE * CONTROL_BUFFER_LENGTH),
+      iovecs(),
+      message_headers(),
+      arena_initial_block(ARENA_INITIAL_BLOCK_SIZE),
+      arena(createProtobufArenaOptions(arena_initial_block)),
+      receive_callback(receive_callback),
+      num_packets_received(0),
+      num_packets_dropped_by_kernel(0),
+      num_packets_dropped_malformed(0),
+      num_batches_received(0),
+      total_delivery_latency_ms(0.0),
+      max_delivery_latency_ms(0.0)
+{
+    boost::asio::ip::udp::endpoint listen_endpoint(
+        boost::asio::ip::make_address(ip_address), port);
+    socket_.open(listen_endpoint.protocol());
+    socket_.set_option(boost::asio::socket_base::reuse_address(true));
+    try
+    {
+        socket_.bind(listen_endpoint);
+    }
+    catch (const boost::exception& ex)
+    {
+        LOG(FATAL) << "BatchedProtoUdpListener: There was an issue binding the socket to "
+                      "the listen_endpoint when trying to connect to the "
+                      "address. This may be due to another instance of the "
+                      "UdpListener running and using the port already. "
+                      "(ip = "
+                   << ip_address << ", port = " << port << ")" << std::endl;
+    }
+
+    if (multicast)
+    {
+        // Join the multicast group.
+        socket_.set_option(boost::asio::ip::multicast::join_group(
+            boost::asio::ip::address::from_string(ip_address)));
+    }
+
+    setupAndStartListen();
+}
+
+template <class ReceiveProtoT>
+BatchedProtoUdpListener<ReceiveProtoT>::BatchedProtoUdpListener(
+    boost::asio::io_service& io_service, const unsigned short port,
+    std::function<void(ReceiveProtoT&)> receive_callback)
+    : socket_(io_service),
+      datagram_buffers(MAX_BATCH_SIZE * MAX_BUFFER_LENGTH),
+      control_buffers(MAX_BATCH_SIZE * CONTROL_BUFFER_LENGTH),
+      iovecs(),
+      message_headers(),
+      arena_initial_block(ARENA_INITIAL_BLOCK_SIZE),
+      arena(createProtobufArenaOptions(arena_initial_block)),
+      receive_callback(receive_callback),
+      num_packets_received(0),
+      num_packets_dropped_by_kernel(0),
+      num_packets_dropped_malformed(0),
+      num_batches_received(0),
+      total_delivery_latency_ms(0.0),
+      max_delivery_latency_ms(0.0)
+{
+    boost::asio::ip::udp::endpoint listen_endpoint(boost::asio::ip::udp::v6(), port);
+    socket_.open(listen_endpoint.protocol());
+    // Explicitly set the v6_only option to be false to accept both ipv4 and ipv6 packets
+    socket_.set_option(boost::asio::ip::v6_only(false));
+    try
+    {
+        socket_.bind(listen_endpoint);
+    }
+    catch (const boost::exception& ex)
+    {
+        LOG(FATAL) << "BatchedProtoUdpListener: There was an issue binding the socket to "
+                      "the listen_endpoint when trying to connect to the "
+                      "address. This may be due to another instance of the "
+                      "UdpListener running and using the port already. "
+                      "(port = "
+                   << port << ")" << std::endl;
+    }
+
+    setupAndStartListen();
+}
+
+template <class ReceiveProtoT>
+void BatchedProtoUdpListener<ReceiveProtoT>::setupAndStartListen()
+{
+    socket_.set_option(
+        boost::asio::socket_base::receive_buffer_size(SOCKET_RECEIVE_BUFFER_SIZE));
+
+    // Ask the kernel to attach the time each datagram was received, and the number of
+    // datagrams it has dropped on this socket, to every datagram we receive
+    int enable = 1;
+    if (setsockopt(socket_.native_handle(), SOL_SOCKET, SO_TIMESTAMPNS, &enable,
+                   sizeof(enable)) != 0)
+    {
+        LOG(WARNING) << "BatchedProtoUdpListener: Failed to enable receive timestamps, "
+                     << "delivery latency will not be measured";
+    }
+    if (setsockopt(socket_.native_handle(), SOL_SOCKET, SO_RXQ_OVFL, &enable,
+                   sizeof(enable)) != 0)
+    {
+        LOG(WARNING) << "BatchedProtoUdpListener: Failed to enable dropped packet "
+                     << "counts, kernel drops will not be counted";
+    }
+
+    for (unsigned int i = 0; i < MAX_BATCH_SIZE; i++)
+    {
+        iovecs[i].iov_base = datagram_buffers.data() + i * MAX_BUFFER_LENGTH;
+        iovecs[i].iov_len  = MAX_BUFFER_LENGTH;
+
+        std::memset(&message_headers[i], 0, sizeof(message_headers[i]));
+        message_headers[i].msg_hdr.msg_iov    = &iovecs[i];
+        message_headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    startListen();
+}
+
+template <class ReceiveProtoT>
+void BatchedProtoUdpListener<ReceiveProtoT>::startListen()
+{
+    // Wait for data asynchronously, and then receive it ourselves so we can receive
+    // many datagrams at once
+    socket_.async_wait(boost::asio::ip::udp::socket::wait_read,
+                       boost::bind(&BatchedProtoUdpListener::handleSocketReadable, this,
+                                   boost::asio::placeholders::error));
+}
+
+template <class ReceiveProtoT>
+void BatchedProtoUdpListener<ReceiveProtoT>::handleSocketReadable(
+    const boost::system::error_code& error)
+{
+    if (error == boost::asio::error::operation_aborted)
+    {
+        // The socket has been closed
+        return;
+    }
+    else if (error)
+    {
+        // Start listening again to receive the next data
+        startListen();
+
+        LOG(WARNING)
+            << "An unknown network error occurred when attempting to receive ReceiveProtoT Data. The boost system error code is "
+            << error << std::endl;
+        return;
+    }
+
+    for (unsigned int i = 0; i < MAX_BATCHES_PER_WAKEUP; i++)
+    {
+        // The kernel overwrites the lengths and flags, so they must be reset before
+        // every batch
+        for (unsigned int j = 0; j < MAX_BATCH_SIZE; j++)
+        {
+            message_headers[j].msg_len = 0;
+            message_headers[j].msg_hdr.msg_control =
+                control_buffers.data() + j * CONTROL_BUFFER_LENGTH;
+            message_headers[j].msg_hdr.msg_controllen = CONTROL_BUFFER_LENGTH;
+            message_headers[j].msg_hdr.msg_flags      = 0;
+        }
+
+        int num_datagrams = recvmmsg(socket_.native_handle(), message_headers.data(),
+                                     MAX_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+        if (num_datagrams < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                LOG(WARNING) << "BatchedProtoUdpListener: recvmmsg failed with error "
+                             << std::strerror(errno);
+            }
+            break;
+        }
+
+        handleBatch(static_cast<unsigned int>(num_datagrams));
+
+        if (static_cast<unsigned int>(num_datagrams) < MAX_BATCH_SIZE)
+        {
+            // The socket has been drained
+            break;
+        }
+    }
+
+    // Once we've handled the data, start listening again
+    startListen();
+}
+
+template <class ReceiveProtoT>
+void BatchedProtoUdpListener<ReceiveProtoT>::handleBatch(unsigned int num_datagrams)
+{
+    for (unsigned int i = 0; i < num_datagrams; i++)
+    {
+        struct msghdr& header = message_headers[i].msg_hdr;
+
+        std::optional<struct timespec> kernel_receive_time;
+        for (struct cmsghdr* control_message = CMSG_FIRSTHDR(&header);
+             control_message != nullptr;
+             control_message = CMSG_NXTHDR(&header, control_message))
+        {
+            if (control_message->cmsg_level != SOL_SOCKET)
+            {
+                continue;
+            }
+
+            if (control_message->cmsg_type == SCM_TIMESTAMPNS)
+            {
+                struct timespec receive_time;
+                std::memcpy(&receive_time, CMSG_DATA(control_message),
+                            sizeof(receive_time));
+                kernel_receive_time = receive_time;
+            }
+            else if (control_message->cmsg_type == SO_RXQ_OVFL)
+            {
+                // This is the total number of datagrams dropped on this socket so far
+                uint32_t num_dropped;
+                std::memcpy(&num_dropped, CMSG_DATA(control_message),
+                            sizeof(num_dropped));
+                num_packets_dropped_by_kernel = num_dropped;
+            }
+        }
+
+        if (header.msg_flags & MSG_TRUNC)
+        {
+            num_packets_dropped_malformed++;
+            LOG(WARNING)
+                << "BatchedProtoUdpListener: Received a datagram larger than MAX_BUFFER_LENGTH, "
+                << "which means that data loss has occurred. "
+                << "Consider increasing MAX_BUFFER_LENGTH";
+            continue;
+        }
+
+        ReceiveProtoT* packet_data =
+            google::protobuf::Arena::CreateMessage<ReceiveProtoT>(&arena);
+        if (!packet_data->ParseFromArray(iovecs[i].iov_base,
+                                         static_cast<int>(message_headers[i].msg_len)))
+        {
+            num_packets_dropped_malformed++;
+            continue;
+        }
+
+        if (kernel_receive_time)
+        {
+            // The kernel timestamps datagrams with the system (wall) clock
+            auto receive_time = std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::seconds(kernel_receive_time->tv_sec) +
+                    std::chrono::nanoseconds(kernel_receive_time->tv_nsec)));
+            double latency_ms = std::chrono::duration<double, std::milli>(
+                                    std::chrono::system_clock::now() - receive_time)
+                                    .count();
+            total_delivery_latency_ms = total_delivery_latency_ms + latency_ms;
+            if (latency_ms > max_delivery_latency_ms)
+            {
+                max_delivery_latency_ms = latency_ms;
+            }
+        }
+
+        num_packets_received++;
+        receive_callback(*packet_data);
+    }
+
+    // All the messages in the batch have been handled, so their memory can be reused
+    // for the next batch
+    arena.Reset();
+    num_batches_received++;
+}
+
+template <class ReceiveProtoT>
+UdpListenerStats BatchedProtoUdpListener<ReceiveProtoT>::getStats() const
+{
+    UdpListenerStats stats;
+    stats.num_packets_received          = num_packets_received;
+    stats.num_packets_dropped_by_kernel = num_packets_dropped_by_kernel;
+    stats.num_packets_dropped_malformed = num_packets_dropped_malformed;
+    stats.num_batches_received          = num_batches_received;
+    stats.max_delivery_latency_ms       = max_delivery_latency_ms;
+    if (stats.num_packets_received > 0)
+    {
+        stats.mean_delivery_latency_ms =
+            total_delivery_latency_ms / static_cast<double>(stats.num_packets_received);
+    }
+    return stats;
+}
+
+template <class ReceiveProtoT>
+BatchedProtoUdpListener<ReceiveProtoT>::~BatchedProtoUdpListener()
+{
+    socket_.close();
+}
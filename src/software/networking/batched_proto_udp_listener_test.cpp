@@ -0,0 +1,161 @@
+#include "software/networking/batched_proto_udp_listener.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "software/proto/messages_robocup_ssl_wrapper.pb.h"
+
+class BatchedProtoUdpListenerTest : public ::testing::Test
+{
+   protected:
+    BatchedProtoUdpListenerTest()
+        : listener(
+              io_service, LOOPBACK_ADDRESS, PORT,
+              [this](SSLProto::SSL_WrapperPacket& packet) {
+                  received_frame_numbers.emplace_back(packet.detection().frame_number());
+              },
+              false),
+          sender(io_service),
+          listener_endpoint(boost::asio::ip::make_address(LOOPBACK_ADDRESS), PORT)
+    {
+        sender.open(listener_endpoint.protocol());
+    }
+
+    /**
+     * Creates a vision packet with the given frame number
+     *
+     * @param frame_number The frame number of the detection frame
+     *
+     * @return a vision packet
+     */
+    static SSLProto::SSL_WrapperPacket createPacket(unsigned int frame_number)
+    {
+        SSLProto::SSL_WrapperPacket packet;
+        auto detection = packet.mutable_detection();
+        detection->set_frame_number(frame_number);
+        detection->set_t_capture(0.0);
+        detection->set_t_sent(0.0);
+        detection->set_camera_id(0);
+        auto ball = detection->add_balls();
+        ball->set_confidence(1.0f);
+        ball->set_x(100.0f);
+        ball->set_y(-200.0f);
+        ball->set_pixel_x(0.0f);
+        ball->set_pixel_y(0.0f);
+        return packet;
+    }
+
+    /**
+     * Sends the given bytes to the listener as a single datagram
+     *
+     * @param data The bytes to send
+     */
+    void sendDatagram(const std::string& data)
+    {
+        sender.send_to(boost::asio::buffer(data), listener_endpoint);
+    }
+
+    /**
+     * Runs the io_service until the listener has handled the given number of datagrams,
+     * or a timeout that is long enough that it should never be reached passes
+     *
+     * @param num_datagrams The number of datagrams, parsed or dropped, to wait for
+     */
+    void waitForDatagrams(unsigned long num_datagrams)
+    {
+        auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < timeout)
+        {
+            UdpListenerStats stats = listener.getStats();
+            if (stats.num_packets_received + stats.num_packets_dropped_malformed >=
+                num_datagrams)
+            {
+                return;
+            }
+            io_service.run_for(std::chrono::milliseconds(10));
+            io_service.restart();
+        }
+    }
+
+    static const inline std::string LOOPBACK_ADDRESS = "127.0.0.1";
+    static constexpr unsigned short PORT             = 40124;
+
+    boost::asio::io_service io_service;
+    std::vector<unsigned int> received_frame_numbers;
+    BatchedProtoUdpListener<SSLProto::SSL_WrapperPacket> listener;
+    boost::asio::ip::udp::socket sender;
+    boost::asio::ip::udp::endpoint listener_endpoint;
+};
+
+TEST_F(BatchedProtoUdpListenerTest, receives_multiple_datagrams_in_one_batch)
+{
+    // All the datagrams are queued on the socket before the io_service runs, so they
+    // should all be received by the same recvmmsg call
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        sendDatagram(createPacket(i).SerializeAsString());
+    }
+
+    waitForDatagrams(10);
+
+    EXPECT_EQ(std::vector<unsigned int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}),
+              received_frame_numbers);
+    UdpListenerStats stats = listener.getStats();
+    EXPECT_EQ(10, stats.num_packets_received);
+    EXPECT_EQ(0, stats.num_packets_dropped_malformed);
+    EXPECT_EQ(1, stats.num_batches_received);
+}
+
+TEST_F(BatchedProtoUdpListenerTest, receives_more_datagrams_than_fit_in_one_batch)
+{
+    const unsigned int num_datagrams =
+        BatchedProtoUdpListener<SSLProto::SSL_WrapperPacket>::MAX_BATCH_SIZE + 6;
+    for (unsigned int i = 0; i < num_datagrams; i++)
+    {
+        sendDatagram(createPacket(i).SerializeAsString());
+    }
+
+    waitForDatagrams(num_datagrams);
+
+    ASSERT_EQ(num_datagrams, received_frame_numbers.size());
+    for (unsigned int i = 0; i < num_datagrams; i++)
+    {
+        EXPECT_EQ(i, received_frame_numbers[i]);
+    }
+    EXPECT_EQ(2, listener.getStats().num_batches_received);
+}
+
+TEST_F(BatchedProtoUdpListenerTest, drops_truncated_packet)
+{
+    std::string data = createPacket(1).SerializeAsString();
+    sendDatagram(data.substr(0, data.size() - 1));
+    sendDatagram(createPacket(2).SerializeAsString());
+
+    waitForDatagrams(2);
+
+    EXPECT_EQ(std::vector<unsigned int>({2}), received_frame_numbers);
+    UdpListenerStats stats = listener.getStats();
+    EXPECT_EQ(1, stats.num_packets_received);
+    EXPECT_EQ(1, stats.num_packets_dropped_malformed);
+}
+
+TEST_F(BatchedProtoUdpListenerTest, drops_packet_larger_than_receive_buffer)
+{
+    // Pad the packet with an unknown field so it still parses, but is larger than the
+    // listener's receive buffer
+    SSLProto::SSL_WrapperPacket oversized_packet = createPacket(1);
+    oversized_packet.mutable_detection()->mutable_unknown_fields()->AddLengthDelimited(
+        1000, std::string(10000, 'a'));
+    sendDatagram(oversized_packet.SerializeAsString());
+    sendDatagram(createPacket(2).SerializeAsString());
+
+    waitForDatagrams(2);
+
+    EXPECT_EQ(std::vector<unsigned int>({2}), received_frame_numbers);
+    UdpListenerStats stats = listener.getStats();
+    EXPECT_EQ(1, stats.num_packets_received);
+    EXPECT_EQ(1, stats.num_packets_dropped_malformed);
+}
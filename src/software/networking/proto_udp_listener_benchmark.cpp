@@ -0,0 +1,137 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "software/networking/batched_proto_udp_listener.h"
+#include "software/networking/proto_udp_listener.h"
+#include "software/networking/proto_udp_sender.h"
+#include "software/proto/message_translation/ssl_detection.h"
+#include "software/proto/message_translation/ssl_wrapper.h"
+#include "software/test_util/test_util.h"
+
+/**
+ * Benchmarks for receiving vision packets over loopback with the ProtoUdpListener and
+ * the BatchedProtoUdpListener. Each iteration sends a burst of packets (ex. one from
+ * each camera) and waits for all of them to be delivered to the receive callback.
+ *
+ * Reports the number of packets delivered per second, the p99 latency from sending a
+ * packet to it being delivered, and the number of packets that were lost.
+ *
+ * Run with: bazel run -c opt //software/networking:proto_udp_listener_benchmark
+ */
+
+namespace
+{
+    const std::string LOOPBACK_ADDRESS = "127.0.0.1";
+    const unsigned short PORT          = 40123;
+    // How long to wait for a burst to be delivered before counting the rest of the
+    // packets as lost
+    const auto BURST_TIMEOUT = std::chrono::milliseconds(100);
+
+    double nowSeconds()
+    {
+        return std::chrono::duration<double>(
+                   std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /**
+     * Creates a vision packet with a full set of robots and a ball, like the ones
+     * sent by each SSL vision camera
+     *
+     * @return a vision packet
+     */
+    SSLProto::SSL_WrapperPacket createVisionPacket()
+    {
+        std::vector<Point> yellow_positions;
+        std::vector<Point> blue_positions;
+        for (unsigned int i = 0; i < 11; i++)
+        {
+            yellow_positions.emplace_back(Point(-0.4 * i, 0.3 * i));
+            blue_positions.emplace_back(Point(0.4 * i, -0.3 * i));
+        }
+
+        auto detection_frame = createSSLDetectionFrame(
+            0, Timestamp::fromSeconds(0), 0, {BallState(Point(0, 0), Vector(1, 1))},
+            TestUtil::createStationaryRobotStatesWithId(yellow_positions),
+            TestUtil::createStationaryRobotStatesWithId(blue_positions));
+        return *createSSLWrapperPacket(nullptr, std::move(detection_frame));
+    }
+
+    template <class UdpListenerT>
+    void benchmarkLoopbackReceive(benchmark::State& state)
+    {
+        const unsigned int burst_size = static_cast<unsigned int>(state.range(0));
+
+        std::mutex mutex;
+        std::condition_variable packet_received;
+        unsigned long num_packets_received = 0;
+        std::vector<double> latencies_ms;
+
+        boost::asio::io_service listener_io_service;
+        UdpListenerT listener(
+            listener_io_service, LOOPBACK_ADDRESS, PORT,
+            [&](SSLProto::SSL_WrapperPacket& packet) {
+                double latency_ms = (nowSeconds() - packet.detection().t_sent()) * 1000;
+                std::scoped_lock<std::mutex> lock(mutex);
+                latencies_ms.emplace_back(latency_ms);
+                num_packets_received++;
+                packet_received.notify_one();
+            },
+            false);
+        std::thread listener_thread([&]() { listener_io_service.run(); });
+
+        boost::asio::io_service sender_io_service;
+        ProtoUdpSender<SSLProto::SSL_WrapperPacket> sender(sender_io_service,
+                                                           LOOPBACK_ADDRESS, PORT, false);
+
+        SSLProto::SSL_WrapperPacket packet = createVisionPacket();
+        unsigned long num_packets_sent     = 0;
+        for (auto _ : state)
+        {
+            for (unsigned int i = 0; i < burst_size; i++)
+            {
+                packet.mutable_detection()->set_camera_id(i);
+                packet.mutable_detection()->set_t_sent(nowSeconds());
+                sender.sendProto(packet);
+            }
+            num_packets_sent += burst_size;
+
+            std::unique_lock<std::mutex> lock(mutex);
+            packet_received.wait_for(lock, BURST_TIMEOUT, [&]() {
+                return num_packets_received >= num_packets_sent;
+            });
+        }
+
+        listener_io_service.stop();
+        listener_thread.join();
+
+        std::sort(latencies_ms.begin(), latencies_ms.end());
+        state.counters["packets"] = benchmark::Counter(
+            static_cast<double>(num_packets_received), benchmark::Counter::kIsRate);
+        state.counters["lost"] =
+            static_cast<double>(num_packets_sent - num_packets_received);
+        if (!latencies_ms.empty())
+        {
+            state.counters["p99_latency_ms"] =
+                latencies_ms[static_cast<std::size_t>(0.99 * (latencies_ms.size() - 1))];
+        }
+    }
+}  // namespace
+
+BENCHMARK_TEMPLATE(benchmarkLoopbackReceive,
+                   ProtoUdpListener<SSLProto::SSL_WrapperPacket>)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(64)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmarkLoopbackReceive,
+                   BatchedProtoUdpListener<SSLProto::SSL_WrapperPacket>)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(64)
+    ->UseRealTime();
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <boost/bind.hpp>
+#include <string>
+
+/**
+ * The server side of the request/response pattern used by the ProtoUdpClient. For every
+ * ReceiveProtoT request received, the request handler is called and the SendProtoT it
+ * returns is sent back to the address the request came from.
+ *
+ * Requests are handled one at a time on the thread running the io_service, in the order
+ * they are received.
+ */
+template <class ReceiveProtoT, class SendProtoT>
+class ProtoUdpServer
+{
+   public:
+    /**
+     * Creates a ProtoUdpServer that will listen for ReceiveProtoT requests on the given
+     * address and port, and respond to each with the SendProtoT returned by the
+     * request_handler
+     *
+     * @param io_service The io_service to use to service incoming ReceiveProtoT data
+     * @param ip_address The ip address on which to listen for requests
+     * (IPv4 in dotted decimal or IPv6 in hex string) example IPv4: 127.0.0.1
+     * @param port The port on which to listen for requests
+     * @param request_handler The function to run for every request received, which
+     * returns the response to send back
+     */
+    ProtoUdpServer(boost::asio::io_service& io_service, const std::string& ip_address,
+                   unsigned short port,
+                   std::function<SendProtoT(const ReceiveProtoT&)> request_handler);
+
+    virtual ~ProtoUdpServer();
+
+   private:
+    /**
+     * This function is setup as the callback to handle requests received over the
+     * network.
+     *
+     * @param error The error code obtained when receiving the incoming data
+     * @param num_bytes_received How many bytes of data were received
+     */
+    void handleRequest(const boost::system::error_code& error, size_t num_bytes_received);
+
+    /**
+     * Start listening for requests
+     */
+    void startListen();
+
+    // A UDP socket that we listen for requests and send responses on
+    boost::asio::ip::udp::socket socket_;
+    // The endpoint of the client that sent the last request
+    boost::asio::ip::udp::endpoint client_endpoint_;
+
+    static constexpr unsigned int MAX_BUFFER_LENGTH = 9000;
+    std::array<char, MAX_BUFFER_LENGTH> raw_received_data_;
+
+    // Buffer to hold the serialized response
+    std::string response_buffer;
+
+    // The function to call on every request to create the response
+    std::function<SendProtoT(const ReceiveProtoT&)> request_handler;
+};
+
+#include "software/networking/proto_udp_server.tpp"
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "software/logger/logger.h"
+#include "software/networking/proto_udp_server.h"
+
+template <class ReceiveProtoT, class SendProtoT>
+ProtoUdpServer<ReceiveProtoT, SendProtoT>::ProtoUdpServer(
+    boost::asio::io_service& io_service, const std::string& ip_address,
+    const unsigned short port,
+    std::function<SendProtoT(const ReceiveProtoT&)> request_handler)
+    : socket_(io_service), request_handler(request_handler)
+{
+    boost::asio::ip::udp::endpoint listen_endpoint(
+        boost::asio::ip::make_address(ip_address), port);
+    socket_.open(listen_endpoint.protocol());
+    try
+    {
+        socket_.bind(listen_endpoint);
+    }
+    catch (const boost::exception& ex)
+    {
+        LOG(FATAL) << "ProtoUdpServer: There was an issue binding the socket to "
+                      "the listen_endpoint when trying to connect to the "
+                      "address. This may be due to another instance of the "
+                      "ProtoUdpServer running and using the port already. "
+                      "(ip = "
+                   << ip_address << ", port = " << port << ")" << std::endl;
+    }
+
+    startListen();
+}
+
+template <class ReceiveProtoT, class SendProtoT>
+void ProtoUdpServer<ReceiveProtoT, SendProtoT>::startListen()
+{
+    socket_.async_receive_from(boost::asio::buffer(raw_received_data_, MAX_BUFFER_LENGTH),
+                               client_endpoint_,
+                               boost::bind(&ProtoUdpServer::handleRequest, this,
+                                           boost::asio::placeholders::error,
+                                           boost::asio::placeholders::bytes_transferred));
+}
+
+template <class ReceiveProtoT, class SendProtoT>
+void ProtoUdpServer<ReceiveProtoT, SendProtoT>::handleRequest(
+    const boost::system::error_code& error, size_t num_bytes_received)
+{
+    if (error == boost::asio::error::operation_aborted)
+    {
+        // The socket has been closed
+        return;
+    }
+    else if (error)
+    {
+        // Start listening again to receive the next request
+        startListen();
+
+        LOG(WARNING)
+            << "An unknown network error occurred when attempting to receive ReceiveProtoT Data. The boost system error code is "
+            << error << std::endl;
+        return;
+    }
+
+    auto request = ReceiveProtoT();
+    if (request.ParseFromArray(raw_received_data_.data(),
+                               static_cast<int>(num_bytes_received)))
+    {
+        request_handler(request).SerializeToString(&response_buffer);
+
+        boost::system::error_code send_error;
+        socket_.send_to(boost::asio::buffer(response_buffer), client_endpoint_, 0,
+                        send_error);
+        if (send_error)
+        {
+            LOG(WARNING) << "ProtoUdpServer: Failed to send the response. The boost "
+                         << "system error code is " << send_error << std::endl;
+        }
+    }
+    else
+    {
+        LOG(WARNING) << "ProtoUdpServer: Dropped a request that could not be parsed";
+    }
+
+    // Once we've responded, start listening again
+    startListen();
+}
+
+template <class ReceiveProtoT, class SendProtoT>
+ProtoUdpServer<ReceiveProtoT, SendProtoT>::~ProtoUdpServer()
+{
+    socket_.close();
+}
@@ -1,11 +1,17 @@
 #pragma once
 
+#include "software/networking/batched_proto_udp_listener.h"
 #include "software/networking/proto_udp_listener.h"
 
 /**
  * A threaded listener that receives serialized ReceiveProtoT Proto's over the network
+ *
+ * @tparam ReceiveProtoT The type of proto to receive
+ * @tparam UdpListenerT The listener used to receive the protos, either a
+ * ProtoUdpListener, or a BatchedProtoUdpListener for sockets that receive bursts of
+ * packets
  */
-template <class ReceiveProtoT>
+template <class ReceiveProtoT, class UdpListenerT = ProtoUdpListener<ReceiveProtoT>>
 class ThreadedProtoUdpListener
 {
    public:
@@ -42,6 +48,14 @@ class ThreadedProtoUdpListener
 
     ~ThreadedProtoUdpListener();
 
+    /**
+     * Returns the counters for the packets received so far. This is only available when
+     * the UdpListenerT keeps counters, ex. the BatchedProtoUdpListener
+     *
+     * @return the counters for the packets received so far
+     */
+    UdpListenerStats getStats() const;
+
    private:
     // The io_service that will be used to service all network requests
     boost::asio::io_service io_service;
@@ -49,7 +63,15 @@ class ThreadedProtoUdpListener
     // entire lifetime of the class
     std::thread io_service_thread;
     std::function<void(ReceiveProtoT)> receive_callback_;
-    ProtoUdpListener<ReceiveProtoT> udp_listener;
+    UdpListenerT udp_listener;
 };
 
+/**
+ * A ThreadedProtoUdpListener that receives packets in batches, see
+ * BatchedProtoUdpListener
+ */
+template <class ReceiveProtoT>
+using ThreadedBatchedProtoUdpListener =
+    ThreadedProtoUdpListener<ReceiveProtoT, BatchedProtoUdpListener<ReceiveProtoT>>;
+
 #include "software/networking/threaded_proto_udp_listener.tpp"
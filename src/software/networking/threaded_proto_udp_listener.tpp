@@ -1,7 +1,7 @@
 #pragma once
 
-template <class ReceiveProtoT>
-ThreadedProtoUdpListener<ReceiveProtoT>::ThreadedProtoUdpListener(
+template <class ReceiveProtoT, class UdpListenerT>
+ThreadedProtoUdpListener<ReceiveProtoT, UdpListenerT>::ThreadedProtoUdpListener(
     const std::string& ip_address, const unsigned short port,
     std::function<void(ReceiveProtoT)> receive_callback, bool multicast)
     : io_service(),
@@ -11,8 +11,8 @@ ThreadedProtoUdpListener<ReceiveProtoT>::ThreadedProtoUdpListener(
     io_service_thread = std::thread([this]() { io_service.run(); });
 }
 
-template <class ReceiveProtoT>
-ThreadedProtoUdpListener<ReceiveProtoT>::ThreadedProtoUdpListener(
+template <class ReceiveProtoT, class UdpListenerT>
+ThreadedProtoUdpListener<ReceiveProtoT, UdpListenerT>::ThreadedProtoUdpListener(
     const unsigned short port, std::function<void(ReceiveProtoT)> receive_callback)
     : io_service(), udp_listener(io_service, port, receive_callback)
 {
@@ -20,8 +20,8 @@ ThreadedProtoUdpListener<ReceiveProtoT>::ThreadedProtoUdpListener(
     io_service_thread = std::thread([this]() { io_service.run(); });
 }
 
-template <class ReceiveProtoT>
-ThreadedProtoUdpListener<ReceiveProtoT>::~ThreadedProtoUdpListener()
+template <class ReceiveProtoT, class UdpListenerT>
+ThreadedProtoUdpListener<ReceiveProtoT, UdpListenerT>::~ThreadedProtoUdpListener()
 {
     // Stop the io_service. This is safe to call from another thread.
     // https://stackoverflow.com/questions/4808848/boost-asio-stopping-io-service
@@ -35,3 +35,9 @@ ThreadedProtoUdpListener<ReceiveProtoT>::~ThreadedProtoUdpListener()
     // `std::terminate` when we deallocate the thread object and kill our whole program
     io_service_thread.join();
 }
+
+template <class ReceiveProtoT, class UdpListenerT>
+UdpListenerStats ThreadedProtoUdpListener<ReceiveProtoT, UdpListenerT>::getStats() const
+{
+    return udp_listener.getStats();
+}
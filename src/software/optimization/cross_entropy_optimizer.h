@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>
+#include <random>
+#include <vector>
+
+/**
+ * This class implements the Cross-Entropy Method (CEM), a sampling based global
+ * optimizer. It provides functionality for both maximizing and minimizing arbitrary
+ * functions under a fixed budget of function evaluations. For example usage, please see
+ * the tests.
+ *
+ * As this class is templated, it is header-only. To split up definition and
+ * implementation of functions has been moved to a `.tpp` file that is included at
+ * the end of this file.
+ *
+ * Each optimization starts by evaluating a set of given starting points (multi-start).
+ * CEM then keeps a normal distribution over the params, centred on the best start, and
+ * for each generation:
+ *   1. Samples a population of params from the distribution
+ *   2. Evaluates the whole population with a single call to the objective function
+ *   3. Refits the distribution to the best ("elite") params of the generation
+ * until the evaluation budget is used up, returning the best params evaluated.
+ *
+ * Unlike gradient descent, CEM doesn't need the objective function to have a useful
+ * gradient, so it isn't stuck by plateaus or small local optima. Because every
+ * generation is evaluated at once, the objective can share work between the params it
+ * evaluates.
+ *
+ * https://en.wikipedia.org/wiki/Cross-entropy_method
+ * https://people.smp.uq.edu.au/DirkKroese/ps/aortut.pdf
+ *
+ * @tparam NUM_PARAMS The number of parameters that a given instance of this class
+ *                    will optimize over.
+ */
+template <size_t NUM_PARAMS>
+class CrossEntropyOptimizer
+{
+   public:
+    using ParamArray = std::array<double, NUM_PARAMS>;
+
+    // Good values for most problems, taken from the tutorial linked above
+    static constexpr unsigned int DEFAULT_POPULATION_SIZE = 8;
+    static constexpr double DEFAULT_ELITE_FRACTION        = 0.25;
+    static constexpr double DEFAULT_SMOOTHING_FACTOR      = 0.7;
+
+    /**
+     * Creates a CrossEntropyOptimizer
+     *
+     * @param initial_std_devs The standard deviation of the sampling distribution in
+     *                         each dimension at the start of every optimization. This
+     *                         plays the same role as the param weights of
+     *                         GradientDescentOptimizer, and should be roughly the size
+     *                         of the region the optimum is expected to be in
+     * @param population_size The number of params to sample and evaluate in each
+     *                        generation
+     * @param elite_fraction The fraction of the population used to refit the sampling
+     *                       distribution, in (0, 1]
+     * @param smoothing_factor How much of the refit distribution to use each
+     *                         generation, in (0, 1]. The rest is kept from the previous
+     *                         distribution, which stops the distribution collapsing
+     *                         before it has found the optimum
+     * @param seed The seed for the random number generator used for sampling
+     */
+    explicit CrossEntropyOptimizer(ParamArray initial_std_devs,
+                                   unsigned int population_size = DEFAULT_POPULATION_SIZE,
+                                   double elite_fraction        = DEFAULT_ELITE_FRACTION,
+                                   double smoothing_factor = DEFAULT_SMOOTHING_FACTOR,
+                                   unsigned int seed       = 0);
+
+    /**
+     * Attempts to maximize the given objective function
+     *
+     * @param batch_objective_function The function to maximize. This can be any callable
+     *                                 taking a const std::vector<ParamArray>& and
+     *                                 returning a std::vector<double> with the value of
+     *                                 the function for each of the given params
+     * @param starting_points The params to start the search from. These are evaluated
+     *                        first, and the search is centred on the best of them. Must
+     *                        not be empty
+     * @param evaluation_budget The number of params to evaluate, including the starting
+     *                          points
+     *
+     * @throws std::invalid_argument if there are no starting points
+     *
+     * @return The parameters corresponding to the maximum value of the objective
+     *         found
+     */
+    template <typename BatchObjectiveFunction>
+    ParamArray maximize(BatchObjectiveFunction&& batch_objective_function,
+                        const std::vector<ParamArray>& starting_points,
+                        unsigned int evaluation_budget);
+
+    /**
+     * Attempts to minimize the given objective function
+     *
+     * @param batch_objective_function The function to minimize. This can be any callable
+     *                                 taking a const std::vector<ParamArray>& and
+     *                                 returning a std::vector<double> with the value of
+     *                                 the function for each of the given params
+     * @param starting_points The params to start the search from. These are evaluated
+     *                        first, and the search is centred on the best of them. Must
+     *                        not be empty
+     * @param evaluation_budget The number of params to evaluate, including the starting
+     *                          points
+     *
+     * @throws std::invalid_argument if there are no starting points
+     *
+     * @return The parameters corresponding to the minimum value of the objective
+     *         found
+     */
+    template <typename BatchObjectiveFunction>
+    ParamArray minimize(BatchObjectiveFunction&& batch_objective_function,
+                        const std::vector<ParamArray>& starting_points,
+                        unsigned int evaluation_budget);
+
+   private:
+    /**
+     * Runs the search, maximizing the objective function multiplied by the given sign
+     *
+     * @param batch_objective_function The function to optimize
+     * @param starting_points The params to start the search from
+     * @param evaluation_budget The number of params to evaluate
+     * @param sign 1 to maximize the function, or -1 to minimize it
+     *
+     * @return The parameters corresponding to the best value of the objective found
+     */
+    template <typename BatchObjectiveFunction>
+    ParamArray optimize(BatchObjectiveFunction& batch_objective_function,
+                        const std::vector<ParamArray>& starting_points,
+                        unsigned int evaluation_budget, double sign);
+
+    // A set of params, and the value of the objective function for them (multiplied by
+    // the sign, so that higher is always better)
+    struct Sample
+    {
+        ParamArray params;
+        double value;
+    };
+
+    // Parameters of the search. See the constructor javadoc comment for details
+    ParamArray initial_std_devs;
+    unsigned int population_size;
+    double elite_fraction;
+    double smoothing_factor;
+
+    // Used to sample params from the distribution
+    std::mt19937 random_num_gen;
+    std::normal_distribution<double> standard_normal;
+};
+
+#include "software/optimization/cross_entropy_optimizer.tpp"
@@ -0,0 +1,140 @@
+/**
+ * NOTE: We do not use `using namespace ...` here, because this is still a header file,
+ *       and as such anything that includes `cross_entropy_optimizer.h` (which includes
+ *       this file), would get any namespaces we use here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "software/optimization/cross_entropy_optimizer.h"
+
+template <size_t NUM_PARAMS>
+CrossEntropyOptimizer<NUM_PARAMS>::CrossEntropyOptimizer(
+    std::array<double, NUM_PARAMS> initial_std_devs, unsigned int population_size,
+    double elite_fraction, double smoothing_factor, unsigned int seed)
+    : initial_std_devs(initial_std_devs),
+      population_size(std::max(population_size, 1u)),
+      elite_fraction(elite_fraction),
+      smoothing_factor(smoothing_factor),
+      random_num_gen(seed)
+{
+}
+
+template <size_t NUM_PARAMS>
+template <typename BatchObjectiveFunction>
+std::array<double, NUM_PARAMS> CrossEntropyOptimizer<NUM_PARAMS>::maximize(
+    BatchObjectiveFunction&& batch_objective_function,
+    const std::vector<std::array<double, NUM_PARAMS>>& starting_points,
+    unsigned int evaluation_budget)
+{
+    return optimize(batch_objective_function, starting_points, evaluation_budget, 1);
+}
+
+template <size_t NUM_PARAMS>
+template <typename BatchObjectiveFunction>
+std::array<double, NUM_PARAMS> CrossEntropyOptimizer<NUM_PARAMS>::minimize(
+    BatchObjectiveFunction&& batch_objective_function,
+    const std::vector<std::array<double, NUM_PARAMS>>& starting_points,
+    unsigned int evaluation_budget)
+{
+    return optimize(batch_objective_function, starting_points, evaluation_budget, -1);
+}
+
+template <size_t NUM_PARAMS>
+template <typename BatchObjectiveFunction>
+std::array<double, NUM_PARAMS> CrossEntropyOptimizer<NUM_PARAMS>::optimize(
+    BatchObjectiveFunction& batch_objective_function,
+    const std::vector<std::array<double, NUM_PARAMS>>& starting_points,
+    unsigned int evaluation_budget, double sign)
+{
+    if (starting_points.empty())
+    {
+        throw std::invalid_argument(
+            "CrossEntropyOptimizer needs at least one starting point");
+    }
+
+    const size_t num_elites = std::max<size_t>(
+        1, static_cast<size_t>(std::lround(elite_fraction * population_size)));
+
+    // The best params evaluated so far
+    Sample best{starting_points.front(), -std::numeric_limits<double>::infinity()};
+
+    // Evaluates the given params, returning them sorted from best to worst
+    auto evaluate = [&](const std::vector<ParamArray>& population) {
+        std::vector<double> values = batch_objective_function(population);
+        std::vector<Sample> samples;
+        samples.reserve(population.size());
+        for (size_t i = 0; i < population.size(); i++)
+        {
+            samples.push_back(Sample{population[i], sign * values[i]});
+        }
+        std::stable_sort(
+            samples.begin(), samples.end(),
+            [](const Sample& a, const Sample& b) { return a.value > b.value; });
+        if (samples.front().value > best.value)
+        {
+            best = samples.front();
+        }
+        return samples;
+    };
+
+    size_t num_starting_points =
+        std::min(starting_points.size(), static_cast<size_t>(evaluation_budget));
+    if (num_starting_points == 0)
+    {
+        return starting_points.front();
+    }
+    evaluate(std::vector<ParamArray>(starting_points.begin(),
+                                     starting_points.begin() + num_starting_points));
+    unsigned int remaining_evaluations =
+        evaluation_budget - static_cast<unsigned int>(num_starting_points);
+
+    ParamArray mean     = best.params;
+    ParamArray std_devs = initial_std_devs;
+
+    std::vector<ParamArray> population;
+    while (remaining_evaluations > 0)
+    {
+        // Sample the next generation
+        population.resize(std::min(population_size, remaining_evaluations));
+        for (ParamArray& params : population)
+        {
+            for (size_t i = 0; i < NUM_PARAMS; i++)
+            {
+                params[i] = mean[i] + std_devs[i] * standard_normal(random_num_gen);
+            }
+        }
+        std::vector<Sample> samples = evaluate(population);
+        remaining_evaluations -= static_cast<unsigned int>(population.size());
+
+        // Refit the distribution to the elites of this generation. The spread of the
+        // elites is measured around the previous mean rather than their own mean, so
+        // that the distribution stays wide while it is still moving towards the
+        // optimum and only narrows once the elites are clustered around it (as in
+        // CMA-ES)
+        const size_t generation_num_elites = std::min(num_elites, samples.size());
+        for (size_t i = 0; i < NUM_PARAMS; i++)
+        {
+            double elite_mean     = 0;
+            double elite_variance = 0;
+            for (size_t j = 0; j < generation_num_elites; j++)
+            {
+                elite_mean += samples[j].params[i];
+                elite_variance += std::pow(samples[j].params[i] - mean[i], 2);
+            }
+            elite_mean /= static_cast<double>(generation_num_elites);
+            elite_variance /= static_cast<double>(generation_num_elites);
+
+            mean[i] = smoothing_factor * elite_mean + (1 - smoothing_factor) * mean[i];
+            std_devs[i] = smoothing_factor * std::sqrt(elite_variance) +
+                          (1 - smoothing_factor) * std_devs[i];
+        }
+    }
+
+    return best.params;
+}
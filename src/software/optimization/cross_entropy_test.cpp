@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "software/optimization/cross_entropy_optimizer.h"
+
+/**
+ * Wraps a function of a single set of params so that it can be used as a batch
+ * objective function, counting the number of params evaluated
+ *
+ * @param function The function to wrap
+ * @param num_evaluations Incremented for every set of params evaluated
+ *
+ * @return the batch objective function
+ */
+template <size_t NUM_PARAMS, typename Function>
+auto makeBatchObjective(Function function, unsigned int& num_evaluations)
+{
+    return [function, &num_evaluations](
+               const std::vector<std::array<double, NUM_PARAMS>>& population) {
+        std::vector<double> values;
+        for (const auto& params : population)
+        {
+            values.push_back(function(params));
+            num_evaluations++;
+        }
+        return values;
+    };
+}
+
+TEST(CrossEntropyOptimizerTest, minimize_multi_valued_function)
+{
+    CrossEntropyOptimizer<2> optimizer({1, 1});
+    unsigned int num_evaluations = 0;
+
+    // f = (x - 1)^2 + 2*(y + 2)^2 + 20
+    auto f = makeBatchObjective<2>(
+        [](std::array<double, 2> x) {
+            return std::pow(x.at(0) - 1, 2) + 2 * std::pow(x.at(1) + 2, 2) + 20;
+        },
+        num_evaluations);
+
+    auto min = optimizer.minimize(f, {{0, 0}}, 200);
+
+    EXPECT_NEAR(min.at(0), 1, 0.05);
+    EXPECT_NEAR(min.at(1), -2, 0.05);
+}
+
+TEST(CrossEntropyOptimizerTest, maximize_multi_valued_function)
+{
+    CrossEntropyOptimizer<2> optimizer({1, 1});
+    unsigned int num_evaluations = 0;
+
+    // f = -(x - 1)^2 - 2*(y + 2)^2
+    auto f = makeBatchObjective<2>(
+        [](std::array<double, 2> x) {
+            return -std::pow(x.at(0) - 1, 2) - 2 * std::pow(x.at(1) + 2, 2);
+        },
+        num_evaluations);
+
+    auto max = optimizer.maximize(f, {{0, 0}}, 200);
+
+    EXPECT_NEAR(max.at(0), 1, 0.05);
+    EXPECT_NEAR(max.at(1), -2, 0.05);
+}
+
+TEST(CrossEntropyOptimizerTest, maximize_function_with_plateau)
+{
+    // Gradient descent started on the plateau never moves, since the gradient there
+    // is 0, but sampling finds the peak
+    CrossEntropyOptimizer<1> optimizer({2});
+    unsigned int num_evaluations = 0;
+
+    // f = 2 - |x - 3| inside [1, 5], and 0 everywhere else
+    auto f = makeBatchObjective<1>(
+        [](std::array<double, 1> x) { return std::max(0.0, 2 - std::abs(x.at(0) - 3)); },
+        num_evaluations);
+
+    auto max = optimizer.maximize(f, {{0}}, 200);
+
+    EXPECT_NEAR(max.at(0), 3, 0.05);
+}
+
+TEST(CrossEntropyOptimizerTest, search_starts_from_best_starting_point)
+{
+    // With a small spread, only the start near the global maximum can reach it
+    CrossEntropyOptimizer<1> optimizer({0.3});
+    unsigned int num_evaluations = 0;
+
+    // Local maximum at x = -2, global maximum at x = 2
+    auto f = makeBatchObjective<1>(
+        [](std::array<double, 1> x) {
+            return std::exp(-std::pow(x.at(0) + 2, 2)) +
+                   2 * std::exp(-std::pow(x.at(0) - 2, 2));
+        },
+        num_evaluations);
+
+    auto max = optimizer.maximize(f, {{-2.1}, {1.5}, {-1.5}}, 100);
+
+    EXPECT_NEAR(max.at(0), 2, 0.05);
+}
+
+TEST(CrossEntropyOptimizerTest, evaluates_exactly_the_budget)
+{
+    CrossEntropyOptimizer<2> optimizer({1, 1}, 8);
+    unsigned int num_evaluations = 0;
+    auto f                       = makeBatchObjective<2>(
+        [](std::array<double, 2> x) { return x.at(0) + x.at(1); }, num_evaluations);
+
+    // The budget isn't a multiple of the population size, so the last generation is
+    // smaller
+    optimizer.maximize(f, {{0, 0}, {1, 1}}, 21);
+
+    EXPECT_EQ(21, num_evaluations);
+}
+
+TEST(CrossEntropyOptimizerTest, budget_smaller_than_number_of_starting_points)
+{
+    CrossEntropyOptimizer<1> optimizer({1});
+    unsigned int num_evaluations = 0;
+    auto f = makeBatchObjective<1>([](std::array<double, 1> x) { return x.at(0); },
+                                   num_evaluations);
+
+    // Only the first two starting points fit in the budget
+    auto max = optimizer.maximize(f, {{1}, {2}, {3}}, 2);
+
+    EXPECT_EQ(2, num_evaluations);
+    EXPECT_EQ(2, max.at(0));
+}
+
+TEST(CrossEntropyOptimizerTest, never_returns_worse_than_best_starting_point)
+{
+    CrossEntropyOptimizer<1> optimizer({10});
+    unsigned int num_evaluations = 0;
+
+    // A very narrow peak that random samples are unlikely to land closer to
+    auto f = makeBatchObjective<1>(
+        [](std::array<double, 1> x) { return -std::abs(x.at(0) - 0.5); },
+        num_evaluations);
+
+    auto max = optimizer.maximize(f, {{0.5}}, 10);
+
+    EXPECT_EQ(0.5, max.at(0));
+}
+
+TEST(CrossEntropyOptimizerTest, no_starting_points)
+{
+    CrossEntropyOptimizer<1> optimizer({1});
+    unsigned int num_evaluations = 0;
+    auto f = makeBatchObjective<1>([](std::array<double, 1> x) { return x.at(0); },
+                                   num_evaluations);
+
+    EXPECT_THROW(optimizer.maximize(f, {}, 10), std::invalid_argument);
+}
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+/**
+ * A dual number, used to compute the gradient of a function with forward-mode automatic
+ * differentiation.
+ *
+ * A DualNumber holds a value and the derivatives of that value with respect to each of
+ * NUM_DERIVATIVES input variables. Arithmetic on DualNumbers applies the chain rule to
+ * the derivatives, so evaluating a function on DualNumbers created with
+ * DualNumber::variable gives both the value of the function and its gradient in a
+ * single call, exactly (up to floating point error) rather than by finite differences.
+ *
+ * To differentiate a function, write it as a template (or generic lambda) over the
+ * scalar type, so that it can be called with both doubles and DualNumbers. Math
+ * functions must be called unqualified after a using declaration so that the
+ * DualNumber overloads below are found, ex.
+ *
+ *     auto f = [](const auto& x) {
+ *         using std::sqrt;
+ *         return sqrt(x[0] * x[0] + 2 * x[1]);
+ *     };
+ *
+ * @tparam NUM_DERIVATIVES The number of variables to track derivatives with respect to
+ */
+template <std::size_t NUM_DERIVATIVES>
+class DualNumber
+{
+   public:
+    using DerivativeArray = std::array<double, NUM_DERIVATIVES>;
+
+    /**
+     * Creates a constant DualNumber, with all derivatives zero
+     *
+     * @param value The value
+     */
+    DualNumber(double value = 0) : value_(value), derivatives_{} {}
+
+    /**
+     * Creates a DualNumber with the given value and derivatives
+     *
+     * @param value The value
+     * @param derivatives The derivatives with respect to each variable
+     */
+    DualNumber(double value, const DerivativeArray& derivatives)
+        : value_(value), derivatives_(derivatives)
+    {
+    }
+
+    /**
+     * Creates the DualNumber for an input variable, which has a derivative of 1 with
+     * respect to itself and 0 with respect to every other variable
+     *
+     * @param value The value of the variable
+     * @param index The index of the variable
+     *
+     * @return the DualNumber for the variable
+     */
+    static DualNumber variable(double value, std::size_t index)
+    {
+        DualNumber variable(value);
+        variable.derivatives_[index] = 1;
+        return variable;
+    }
+
+    /**
+     * Returns the value of this DualNumber
+     *
+     * @return the value of this DualNumber
+     */
+    double value() const
+    {
+        return value_;
+    }
+
+    /**
+     * Returns the derivatives of this DualNumber with respect to each variable
+     *
+     * @return the derivatives of this DualNumber with respect to each variable
+     */
+    const DerivativeArray& derivatives() const
+    {
+        return derivatives_;
+    }
+
+    DualNumber operator-() const
+    {
+        return scale(-value_, -1);
+    }
+
+    DualNumber& operator+=(const DualNumber& other)
+    {
+        value_ += other.value_;
+        for (std::size_t i = 0; i < NUM_DERIVATIVES; i++)
+        {
+            derivatives_[i] += other.derivatives_[i];
+        }
+        return *this;
+    }
+
+    DualNumber& operator-=(const DualNumber& other)
+    {
+        value_ -= other.value_;
+        for (std::size_t i = 0; i < NUM_DERIVATIVES; i++)
+        {
+            derivatives_[i] -= other.derivatives_[i];
+        }
+        return *this;
+    }
+
+    DualNumber& operator*=(const DualNumber& other)
+    {
+        // (uv)' = u'v + uv'
+        for (std::size_t i = 0; i < NUM_DERIVATIVES; i++)
+        {
+            derivatives_[i] =
+                derivatives_[i] * other.value_ + value_ * other.derivatives_[i];
+        }
+        value_ *= other.value_;
+        return *this;
+    }
+
+    DualNumber& operator/=(const DualNumber& other)
+    {
+        // (u/v)' = (u'v - uv') / v^2 = (u' - (u/v)v') / v
+        value_ /= other.value_;
+        for (std::size_t i = 0; i < NUM_DERIVATIVES; i++)
+        {
+            derivatives_[i] =
+                (derivatives_[i] - value_ * other.derivatives_[i]) / other.value_;
+        }
+        return *this;
+    }
+
+    /**
+     * Applies a function to this DualNumber, given the value of the function and its
+     * derivative at this DualNumber's value
+     *
+     * @param value The value of the function
+     * @param derivative The derivative of the function
+     *
+     * @return the result of the function, with derivatives given by the chain rule
+     */
+    DualNumber scale(double value, double derivative) const
+    {
+        DualNumber result(value);
+        for (std::size_t i = 0; i < NUM_DERIVATIVES; i++)
+        {
+            result.derivatives_[i] = derivative * derivatives_[i];
+        }
+        return result;
+    }
+
+   private:
+    double value_;
+    DerivativeArray derivatives_;
+};
+
+template <std::size_t N>
+DualNumber<N> operator+(DualNumber<N> lhs, const DualNumber<N>& rhs)
+{
+    return lhs += rhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator-(DualNumber<N> lhs, const DualNumber<N>& rhs)
+{
+    return lhs -= rhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator*(DualNumber<N> lhs, const DualNumber<N>& rhs)
+{
+    return lhs *= rhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator/(DualNumber<N> lhs, const DualNumber<N>& rhs)
+{
+    return lhs /= rhs;
+}
+
+// Arithmetic with doubles is written out, rather than relying on the implicit
+// conversion from double, so that the derivatives of the constant aren't computed
+template <std::size_t N>
+DualNumber<N> operator+(const DualNumber<N>& lhs, double rhs)
+{
+    return DualNumber<N>(lhs.value() + rhs, lhs.derivatives());
+}
+
+template <std::size_t N>
+DualNumber<N> operator+(double lhs, const DualNumber<N>& rhs)
+{
+    return rhs + lhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator-(const DualNumber<N>& lhs, double rhs)
+{
+    return DualNumber<N>(lhs.value() - rhs, lhs.derivatives());
+}
+
+template <std::size_t N>
+DualNumber<N> operator-(double lhs, const DualNumber<N>& rhs)
+{
+    return rhs.scale(lhs - rhs.value(), -1);
+}
+
+template <std::size_t N>
+DualNumber<N> operator*(const DualNumber<N>& lhs, double rhs)
+{
+    return lhs.scale(lhs.value() * rhs, rhs);
+}
+
+template <std::size_t N>
+DualNumber<N> operator*(double lhs, const DualNumber<N>& rhs)
+{
+    return rhs * lhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator/(const DualNumber<N>& lhs, double rhs)
+{
+    return lhs.scale(lhs.value() / rhs, 1 / rhs);
+}
+
+template <std::size_t N>
+DualNumber<N> operator/(double lhs, const DualNumber<N>& rhs)
+{
+    // (c/v)' = -c v' / v^2
+    const double value = lhs / rhs.value();
+    return rhs.scale(value, -value / rhs.value());
+}
+
+// Comparisons only compare the values, so that functions with branches can be
+// differentiated (the derivative is taken along the branch that was followed)
+template <std::size_t N>
+bool operator<(const DualNumber<N>& lhs, const DualNumber<N>& rhs)
+{
+    return lhs.value() < rhs.value();
+}
+
+template <std::size_t N>
+bool operator<(const DualNumber<N>& lhs, double rhs)
+{
+    return lhs.value() < rhs;
+}
+
+template <std::size_t N>
+bool operator<(double lhs, const DualNumber<N>& rhs)
+{
+    return lhs < rhs.value();
+}
+
+template <std::size_t N>
+bool operator>(const DualNumber<N>& lhs, const DualNumber<N>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <std::size_t N>
+bool operator>(const DualNumber<N>& lhs, double rhs)
+{
+    return rhs < lhs;
+}
+
+template <std::size_t N>
+bool operator>(double lhs, const DualNumber<N>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <std::size_t N>
+DualNumber<N> sqrt(const DualNumber<N>& x)
+{
+    const double value = std::sqrt(x.value());
+    return x.scale(value, 0.5 / value);
+}
+
+template <std::size_t N>
+DualNumber<N> exp(const DualNumber<N>& x)
+{
+    const double value = std::exp(x.value());
+    return x.scale(value, value);
+}
+
+template <std::size_t N>
+DualNumber<N> log(const DualNumber<N>& x)
+{
+    return x.scale(std::log(x.value()), 1 / x.value());
+}
+
+template <std::size_t N>
+DualNumber<N> pow(const DualNumber<N>& x, double exponent)
+{
+    return x.scale(std::pow(x.value(), exponent),
+                   exponent * std::pow(x.value(), exponent - 1));
+}
+
+template <std::size_t N>
+DualNumber<N> abs(const DualNumber<N>& x)
+{
+    return x.value() < 0 ? -x : x;
+}
+
+template <std::size_t N>
+DualNumber<N> sin(const DualNumber<N>& x)
+{
+    return x.scale(std::sin(x.value()), std::cos(x.value()));
+}
+
+template <std::size_t N>
+DualNumber<N> cos(const DualNumber<N>& x)
+{
+    return x.scale(std::cos(x.value()), -std::sin(x.value()));
+}
+
+template <std::size_t N>
+DualNumber<N> atan2(const DualNumber<N>& y, const DualNumber<N>& x)
+{
+    // d(atan2(y, x)) = (x dy - y dx) / (x^2 + y^2)
+    const double squared_norm = x.value() * x.value() + y.value() * y.value();
+    typename DualNumber<N>::DerivativeArray derivatives;
+    for (std::size_t i = 0; i < N; i++)
+    {
+        derivatives[i] =
+            (x.value() * y.derivatives()[i] - y.value() * x.derivatives()[i]) /
+            squared_norm;
+    }
+    return DualNumber<N>(std::atan2(y.value(), x.value()), derivatives);
+}
+
+/**
+ * Computes the value and gradient of a function using forward-mode automatic
+ * differentiation
+ *
+ * @param function The function to differentiate. It must accept a
+ * std::array<DualNumber<NUM_PARAMS>, NUM_PARAMS> (see the DualNumber documentation)
+ * @param params The point to compute the gradient at
+ *
+ * @return the value of the function at the given point, as a DualNumber whose
+ * derivatives are the gradient
+ */
+template <std::size_t NUM_PARAMS, typename Function>
+DualNumber<NUM_PARAMS> differentiate(Function&& function,
+                                     const std::array<double, NUM_PARAMS>& params)
+{
+    std::array<DualNumber<NUM_PARAMS>, NUM_PARAMS> dual_params;
+    for (std::size_t i = 0; i < NUM_PARAMS; i++)
+    {
+        dual_params[i] = DualNumber<NUM_PARAMS>::variable(params[i], i);
+    }
+    return function(dual_params);
+}
@@ -0,0 +1,83 @@
+#include "software/optimization/dual_number.h"
+
+#include <gtest/gtest.h>
+
+TEST(DualNumberTest, constant_has_zero_derivatives)
+{
+    DualNumber<2> constant(3);
+    EXPECT_EQ(3, constant.value());
+    EXPECT_EQ(0, constant.derivatives()[0]);
+    EXPECT_EQ(0, constant.derivatives()[1]);
+}
+
+TEST(DualNumberTest, variable_has_unit_derivative_with_respect_to_itself)
+{
+    DualNumber<2> variable = DualNumber<2>::variable(3, 1);
+    EXPECT_EQ(3, variable.value());
+    EXPECT_EQ(0, variable.derivatives()[0]);
+    EXPECT_EQ(1, variable.derivatives()[1]);
+}
+
+TEST(DualNumberTest, arithmetic)
+{
+    // f = (x * y + 3) / (x - y) - 2 / x, at (2, 5)
+    auto f = [](const auto& p) { return (p[0] * p[1] + 3) / (p[0] - p[1]) - 2 / p[0]; };
+
+    DualNumber<2> result = differentiate(f, std::array<double, 2>{2, 5});
+
+    // df/dx = (y(x - y) - (xy + 3)) / (x - y)^2 + 2 / x^2
+    // df/dy = (x(x - y) + (xy + 3)) / (x - y)^2
+    EXPECT_DOUBLE_EQ(13.0 / -3.0 - 1, result.value());
+    EXPECT_DOUBLE_EQ((5.0 * -3 - 13) / 9 + 0.5, result.derivatives()[0]);
+    EXPECT_DOUBLE_EQ((2.0 * -3 + 13) / 9, result.derivatives()[1]);
+}
+
+TEST(DualNumberTest, math_functions)
+{
+    // f = sqrt(x) + exp(y) * log(x) + pow(y, 3) + sin(x) * cos(y)
+    auto f = [](const auto& p) {
+        using std::cos;
+        using std::exp;
+        using std::log;
+        using std::pow;
+        using std::sin;
+        using std::sqrt;
+        return sqrt(p[0]) + exp(p[1]) * log(p[0]) + pow(p[1], 3) + sin(p[0]) * cos(p[1]);
+    };
+
+    const double x       = 2;
+    const double y       = 0.5;
+    DualNumber<2> result = differentiate(f, std::array<double, 2>{x, y});
+
+    EXPECT_DOUBLE_EQ(f(std::array<double, 2>{x, y}), result.value());
+    EXPECT_NEAR(0.5 / std::sqrt(x) + std::exp(y) / x + std::cos(x) * std::cos(y),
+                result.derivatives()[0], 1e-12);
+    EXPECT_NEAR(std::exp(y) * std::log(x) + 3 * y * y - std::sin(x) * std::sin(y),
+                result.derivatives()[1], 1e-12);
+}
+
+TEST(DualNumberTest, atan2)
+{
+    auto f = [](const auto& p) {
+        using std::atan2;
+        return atan2(p[1], p[0]);
+    };
+
+    DualNumber<2> result = differentiate(f, std::array<double, 2>{3, 4});
+
+    EXPECT_DOUBLE_EQ(std::atan2(4, 3), result.value());
+    EXPECT_DOUBLE_EQ(-4.0 / 25, result.derivatives()[0]);
+    EXPECT_DOUBLE_EQ(3.0 / 25, result.derivatives()[1]);
+}
+
+TEST(DualNumberTest, derivative_follows_branch_taken)
+{
+    auto f = [](const auto& p) {
+        using std::abs;
+        return p[0] > 1 ? abs(p[0] - 3) : -p[0] * 2;
+    };
+
+    EXPECT_DOUBLE_EQ(-1, differentiate(f, std::array<double, 1>{2}).derivatives()[0]);
+    EXPECT_DOUBLE_EQ(1, differentiate(f, std::array<double, 1>{4}).derivatives()[0]);
+    EXPECT_DOUBLE_EQ(-2, differentiate(f, std::array<double, 1>{0}).derivatives()[0]);
+}
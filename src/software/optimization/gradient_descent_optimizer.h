@@ -2,7 +2,8 @@
 
 #include <algorithm>
 #include <array>
-#include <functional>
+
+#include "software/optimization/dual_number.h"
 
 /**
  * This class implements a version of Stochastic Gradient Descent (SGD), namely Adam
@@ -24,6 +25,11 @@
  * http://ruder.io/optimizing-gradient-descent/index.html#adam
  * https://en.wikipedia.org/wiki/Moment_(mathematics)
  *
+ * The gradient can be approximated numerically from the objective function, given
+ * analytically, or computed exactly with forward-mode automatic differentiation using
+ * DualNumbers. Objective and gradient functions are taken as template parameters rather
+ * than std::functions, so that they can be inlined into the optimization loop.
+ *
  * NOTE: CLion complains about "Redefinition of GradientDescentOptimizer", but it's
  *       incorrect, this class compiles just fine.
  *
@@ -70,67 +76,169 @@ class GradientDescentOptimizer
      * Attempts to maximize the given objective function
      *
      * Runs gradient descent, starting from the given initial_value and running for
-     * num_iters
+     * num_iters, approximating the gradient numerically
      *
-     * @param objective_function The function to maximize
+     * @param objective_function The function to maximize. This can be any callable
+     *                           taking a ParamArray and returning a double, and is
+     *                           taken as a template parameter so that it can be inlined
      * @param initial_value The value to start from
-     * @param num_iters The number of iterations to run for
+     * @param num_iters The maximum number of iterations to run for
+     * @param convergence_threshold Stop early once the magnitude of every component of
+     *                              the weighted gradient is below this. The default of
+     *                              0 always runs for num_iters
      *
      * @return The parameters corresponding to the maximum value of the objective
      *         found
      */
-    ParamArray maximize(std::function<double(ParamArray)> objective_function,
-                        ParamArray initial_value, unsigned int num_iters);
+    template <typename ObjectiveFunction>
+    ParamArray maximize(ObjectiveFunction&& objective_function, ParamArray initial_value,
+                        unsigned int num_iters, double convergence_threshold = 0);
 
     /**
      * Attempts to minimize the given objective function
      *
      * Runs gradient descent, starting from the given initial_value and running for
-     * num_iters
+     * num_iters, approximating the gradient numerically
      *
-     * @param objective_function The function to minimize
+     * @param objective_function The function to minimize. This can be any callable
+     *                           taking a ParamArray and returning a double, and is
+     *                           taken as a template parameter so that it can be inlined
      * @param initial_value The value to start from
-     * @param num_iters The number of iterations to run for
+     * @param num_iters The maximum number of iterations to run for
+     * @param convergence_threshold Stop early once the magnitude of every component of
+     *                              the weighted gradient is below this. The default of
+     *                              0 always runs for num_iters
      *
      * @return The parameters corresponding to the minimum value of the objective
      *         found
      */
-    ParamArray minimize(std::function<double(ParamArray)> objective_function,
-                        ParamArray initial_value, unsigned int num_iters);
+    template <typename ObjectiveFunction>
+    ParamArray minimize(ObjectiveFunction&& objective_function, ParamArray initial_value,
+                        unsigned int num_iters, double convergence_threshold = 0);
+
+    /**
+     * Attempts to maximize a function, given a function that computes its gradient
+     *
+     * This avoids the NUM_PARAMS + 1 calls to the objective function needed to
+     * approximate the gradient numerically at each iteration.
+     *
+     * @param gradient_function A function that takes a ParamArray and returns the
+     *                          gradient of the function to maximize at that point, as
+     *                          a ParamArray of the partial derivatives with respect to
+     *                          each param
+     * @param initial_value The value to start from
+     * @param num_iters The maximum number of iterations to run for
+     * @param convergence_threshold Stop early once the magnitude of every component of
+     *                              the weighted gradient is below this
+     *
+     * @return The parameters corresponding to the maximum value of the objective
+     *         found
+     */
+    template <typename GradientFunction>
+    ParamArray maximizeWithGradient(GradientFunction&& gradient_function,
+                                    ParamArray initial_value, unsigned int num_iters,
+                                    double convergence_threshold = 0);
 
+    /**
+     * Attempts to minimize a function, given a function that computes its gradient
+     *
+     * This avoids the NUM_PARAMS + 1 calls to the objective function needed to
+     * approximate the gradient numerically at each iteration.
+     *
+     * @param gradient_function A function that takes a ParamArray and returns the
+     *                          gradient of the function to minimize at that point, as
+     *                          a ParamArray of the partial derivatives with respect to
+     *                          each param
+     * @param initial_value The value to start from
+     * @param num_iters The maximum number of iterations to run for
+     * @param convergence_threshold Stop early once the magnitude of every component of
+     *                              the weighted gradient is below this
+     *
+     * @return The parameters corresponding to the minimum value of the objective
+     *         found
+     */
+    template <typename GradientFunction>
+    ParamArray minimizeWithGradient(GradientFunction&& gradient_function,
+                                    ParamArray initial_value, unsigned int num_iters,
+                                    double convergence_threshold = 0);
+
+    /**
+     * Attempts to maximize the given objective function, computing its exact gradient
+     * with automatic differentiation (see DualNumber)
+     *
+     * @param objective_function The function to maximize. It must be callable with a
+     *                           std::array<DualNumber<NUM_PARAMS>, NUM_PARAMS>, ex. a
+     *                           generic lambda
+     * @param initial_value The value to start from
+     * @param num_iters The maximum number of iterations to run for
+     * @param convergence_threshold Stop early once the magnitude of every component of
+     *                              the weighted gradient is below this
+     *
+     * @return The parameters corresponding to the maximum value of the objective
+     *         found
+     */
+    template <typename ObjectiveFunction>
+    ParamArray maximizeWithAutomaticDifferentiation(
+        ObjectiveFunction&& objective_function, ParamArray initial_value,
+        unsigned int num_iters, double convergence_threshold = 0);
+
+    /**
+     * Attempts to minimize the given objective function, computing its exact gradient
+     * with automatic differentiation (see DualNumber)
+     *
+     * @param objective_function The function to minimize. It must be callable with a
+     *                           std::array<DualNumber<NUM_PARAMS>, NUM_PARAMS>, ex. a
+     *                           generic lambda
+     * @param initial_value The value to start from
+     * @param num_iters The maximum number of iterations to run for
+     * @param convergence_threshold Stop early once the magnitude of every component of
+     *                              the weighted gradient is below this
+     *
+     * @return The parameters corresponding to the minimum value of the objective
+     *         found
+     */
+    template <typename ObjectiveFunction>
+    ParamArray minimizeWithAutomaticDifferentiation(
+        ObjectiveFunction&& objective_function, ParamArray initial_value,
+        unsigned int num_iters, double convergence_threshold = 0);
 
    private:
     /**
-     * Attempts to minimize or maximize the given objective function
+     * Attempts to minimize or maximize a function given its gradient
      *
      * Runs gradient descent, starting from the given initial_value and running for
-     * num_iters
+     * num_iters, or until the gradient is below the convergence threshold
      *
-     * @param objective_function The function to minimize
+     * @param weighted_gradient_function A function returning the gradient at the
+     *                                   given params, with each component multiplied
+     *                                   by the weight of that param
      * @param initial_value The value to start from
-     * @param num_iters The number of iterations to run for
-     * @param gradient_movement_func The function to use on each step along the
-     *                               gradient, either "-" to minimize the given
-     *                               function, or "+" to maximize it
+     * @param num_iters The maximum number of iterations to run for
+     * @param convergence_threshold Stop once the magnitude of every component of
+     *                              the weighted gradient is below this
+     * @param direction 1 to step along the gradient and maximize the function, or -1
+     *                  to step against it and minimize the function
      *
      * @return The parameters corresponding to the minimum or maximum value of the
-     *         objective found, depending on what gradient_movement_func was given
+     *         objective found, depending on the direction
      */
-    ParamArray followGradient(
-        std::function<double(ParamArray)> objective_function, ParamArray initial_value,
-        unsigned int num_iters,
-        std::function<double(double, double)> gradient_movement_func);
+    template <typename GradientFunction>
+    ParamArray followGradient(GradientFunction&& weighted_gradient_function,
+                              ParamArray initial_value, unsigned int num_iters,
+                              double convergence_threshold, double direction);
 
     /**
-     * Approximate the gradient of the objective function around a given point
+     * Approximate the gradient of the objective function around a given point, with
+     * each component multiplied by the weight of that param
      *
      * @param params The params around which we want to approximate the gradient
      * @param objective_function The function to approximate the gradient over
      * @return A ParamArray, where each "param" is the derivative with respect to the
-     *         corresponding input param.
+     *         corresponding input param, multiplied by the weight of the param
      */
-    ParamArray approximateGradient(ParamArray params,
-                                   std::function<double(ParamArray)> objective_function);
+    template <typename ObjectiveFunction>
+    ParamArray approximateGradient(const ParamArray& params,
+                                   ObjectiveFunction& objective_function) const;
 
     // This constant is used to prevent division by 0 in our implementation of Adam
     // (gradient descent)
@@ -26,30 +26,101 @@ GradientDescentOptimizer<NUM_PARAMS>::GradientDescentOptimizer(
 }
 
 template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
 std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::maximize(
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function,
-    std::array<double, NUM_PARAMS> initial_value, unsigned int num_iters)
+    ObjectiveFunction&& objective_function, std::array<double, NUM_PARAMS> initial_value,
+    unsigned int num_iters, double convergence_threshold)
 {
     return followGradient(
-        objective_function, initial_value, num_iters,
-        [](double curr_value, double step) { return curr_value + step; });
+        [this, &objective_function](const ParamArray& params) {
+            return approximateGradient(params, objective_function);
+        },
+        initial_value, num_iters, convergence_threshold, 1);
 }
 
 template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
 std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::minimize(
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function,
-    std::array<double, NUM_PARAMS> initial_value, unsigned int num_iters)
+    ObjectiveFunction&& objective_function, std::array<double, NUM_PARAMS> initial_value,
+    unsigned int num_iters, double convergence_threshold)
 {
     return followGradient(
-        objective_function, initial_value, num_iters,
-        [](double curr_value, double step) { return curr_value - step; });
+        [this, &objective_function](const ParamArray& params) {
+            return approximateGradient(params, objective_function);
+        },
+        initial_value, num_iters, convergence_threshold, -1);
 }
 
 template <size_t NUM_PARAMS>
+template <typename GradientFunction>
+std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::maximizeWithGradient(
+    GradientFunction&& gradient_function, std::array<double, NUM_PARAMS> initial_value,
+    unsigned int num_iters, double convergence_threshold)
+{
+    return followGradient(
+        [this, &gradient_function](const ParamArray& params) {
+            ParamArray gradient = gradient_function(params);
+            for (unsigned int i = 0; i < NUM_PARAMS; i++)
+            {
+                gradient[i] *= param_weights[i];
+            }
+            return gradient;
+        },
+        initial_value, num_iters, convergence_threshold, 1);
+}
+
+template <size_t NUM_PARAMS>
+template <typename GradientFunction>
+std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::minimizeWithGradient(
+    GradientFunction&& gradient_function, std::array<double, NUM_PARAMS> initial_value,
+    unsigned int num_iters, double convergence_threshold)
+{
+    return followGradient(
+        [this, &gradient_function](const ParamArray& params) {
+            ParamArray gradient = gradient_function(params);
+            for (unsigned int i = 0; i < NUM_PARAMS; i++)
+            {
+                gradient[i] *= param_weights[i];
+            }
+            return gradient;
+        },
+        initial_value, num_iters, convergence_threshold, -1);
+}
+
+template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
+std::array<double, NUM_PARAMS>
+GradientDescentOptimizer<NUM_PARAMS>::maximizeWithAutomaticDifferentiation(
+    ObjectiveFunction&& objective_function, std::array<double, NUM_PARAMS> initial_value,
+    unsigned int num_iters, double convergence_threshold)
+{
+    return maximizeWithGradient(
+        [&objective_function](const ParamArray& params) {
+            return differentiate(objective_function, params).derivatives();
+        },
+        initial_value, num_iters, convergence_threshold);
+}
+
+template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
+std::array<double, NUM_PARAMS>
+GradientDescentOptimizer<NUM_PARAMS>::minimizeWithAutomaticDifferentiation(
+    ObjectiveFunction&& objective_function, std::array<double, NUM_PARAMS> initial_value,
+    unsigned int num_iters, double convergence_threshold)
+{
+    return minimizeWithGradient(
+        [&objective_function](const ParamArray& params) {
+            return differentiate(objective_function, params).derivatives();
+        },
+        initial_value, num_iters, convergence_threshold);
+}
+
+template <size_t NUM_PARAMS>
+template <typename GradientFunction>
 std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::followGradient(
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function,
+    GradientFunction&& weighted_gradient_function,
     std::array<double, NUM_PARAMS> initial_value, unsigned int num_iters,
-    std::function<double(double, double)> gradient_movement_func)
+    double convergence_threshold, double direction)
 {
     // Implementation of the "Adam" algorithm. See Javadoc class comment for this
     // class (in the header) for details
@@ -63,24 +134,34 @@ std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::followGradi
 
     for (unsigned iter = 0; iter < num_iters; iter++)
     {
-        ParamArray gradient = approximateGradient(params, objective_function);
+        ParamArray gradient = weighted_gradient_function(params);
+
+        // Stop once we're close enough to a minimum or maximum that the gradient is
+        // flat, since any more steps would barely change the params
+        if (std::all_of(gradient.begin(), gradient.end(),
+                        [convergence_threshold](double partial_derivative) {
+                            return std::abs(partial_derivative) < convergence_threshold;
+                        }))
+        {
+            break;
+        }
 
         // Get the squared gradient
         ParamArray squared_gradient = {0};
         for (unsigned int i = 0; i < NUM_PARAMS; i++)
         {
-            squared_gradient.at(i) = std::pow(gradient.at(i), 2);
+            squared_gradient[i] = gradient[i] * gradient[i];
         }
 
         // Update past gradient and gradient squared averages
         for (unsigned int i = 0; i < NUM_PARAMS; i++)
         {
-            past_gradient_averages.at(i) =
-                past_gradient_decay_rate * past_gradient_averages.at(i) +
-                (1 - past_gradient_decay_rate) * gradient.at(i);
-            past_squared_gradient_averages.at(i) =
-                past_squared_gradient_decay_rate * past_squared_gradient_averages.at(i) +
-                (1 - past_squared_gradient_decay_rate) * squared_gradient.at(i);
+            past_gradient_averages[i] =
+                past_gradient_decay_rate * past_gradient_averages[i] +
+                (1 - past_gradient_decay_rate) * gradient[i];
+            past_squared_gradient_averages[i] =
+                past_squared_gradient_decay_rate * past_squared_gradient_averages[i] +
+                (1 - past_squared_gradient_decay_rate) * squared_gradient[i];
         }
 
         // Create the bias corrected gradient and gradient square averages
@@ -88,23 +169,19 @@ std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::followGradi
         ParamArray bias_corrected_past_squared_gradient_averages = {0};
         for (unsigned int i = 0; i < NUM_PARAMS; i++)
         {
-            bias_corrected_past_gradient_averages.at(i) =
-                past_gradient_averages.at(i) /
-                (1 - std::pow(past_gradient_decay_rate, 2));
-            bias_corrected_past_squared_gradient_averages.at(i) =
-                past_squared_gradient_averages.at(i) /
+            bias_corrected_past_gradient_averages[i] =
+                past_gradient_averages[i] / (1 - std::pow(past_gradient_decay_rate, 2));
+            bias_corrected_past_squared_gradient_averages[i] =
+                past_squared_gradient_averages[i] /
                 (1 - std::pow(past_squared_gradient_decay_rate, 2));
         }
 
-        // Step each param in the direction of the gradient using the operator
-        // given to this function
+        // Step each param along the gradient to maximize, or against it to minimize
         for (unsigned int i = 0; i < NUM_PARAMS; i++)
         {
-            params.at(i) = gradient_movement_func(
-                params.at(i),
-                param_weights.at(i) * bias_corrected_past_gradient_averages.at(i) /
-                    (std::sqrt(bias_corrected_past_squared_gradient_averages.at(i)) +
-                     eps));
+            params[i] +=
+                direction * param_weights[i] * bias_corrected_past_gradient_averages[i] /
+                (std::sqrt(bias_corrected_past_squared_gradient_averages[i]) + eps);
         }
     }
 
@@ -112,9 +189,10 @@ std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::followGradi
 }
 
 template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
 std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::approximateGradient(
-    std::array<double, NUM_PARAMS> params,
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function)
+    const std::array<double, NUM_PARAMS>& params,
+    ObjectiveFunction& objective_function) const
 {
     ParamArray gradient        = {0};
     double curr_function_value = objective_function(params);
@@ -122,9 +200,9 @@ std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::approximate
     for (unsigned i = 0; i < NUM_PARAMS; i++)
     {
         auto test_params = params;
-        test_params.at(i) += gradient_approx_step_size * param_weights.at(i);
+        test_params[i] += gradient_approx_step_size * param_weights[i];
         double new_function_value = objective_function(test_params);
-        gradient.at(i) =
+        gradient[i] =
             (new_function_value - curr_function_value) / gradient_approx_step_size;
     }
 
@@ -98,3 +98,103 @@ TEST(GradientDescentOptimizer, maximize_sigmoid_performance_test)
     // the "S" in the sigmoid within the given number of iterations
     EXPECT_GE(min.at(0), 3);
 }
+
+TEST(GradientDescentOptimizerTest, runs_every_iteration_without_convergence_threshold)
+{
+    GradientDescentOptimizer<2> gradientDescentOptimizer({0.1, 0.1});
+
+    unsigned int num_calls = 0;
+    auto f                 = [&num_calls](const std::array<double, 2>& x) {
+        num_calls++;
+        return x[0] * x[0] + x[1] * x[1];
+    };
+
+    gradientDescentOptimizer.minimize(f, {1, 1}, 100);
+
+    // Each iteration evaluates the function at the current params, and once more for
+    // each param to approximate the gradient
+    EXPECT_EQ(100 * 3, num_calls);
+}
+
+TEST(GradientDescentOptimizerTest, stops_early_once_converged)
+{
+    GradientDescentOptimizer<1> gradientDescentOptimizer({0.1});
+
+    unsigned int num_calls = 0;
+    auto f                 = [&num_calls](const std::array<double, 1>& x) {
+        num_calls++;
+        return std::pow(x[0] - 2, 2);
+    };
+
+    auto min = gradientDescentOptimizer.minimize(f, {0}, 1000, 1e-3);
+
+    EXPECT_NEAR(min[0], 2, 0.01);
+    EXPECT_LT(num_calls, 1000 * 2);
+}
+
+TEST(GradientDescentOptimizerTest, does_not_move_from_flat_region_once_converged)
+{
+    GradientDescentOptimizer<1> gradientDescentOptimizer({0.1});
+
+    auto f = [](const std::array<double, 1>&) { return 5.0; };
+
+    auto max = gradientDescentOptimizer.maximize(f, {3}, 100, 1e-6);
+
+    EXPECT_EQ(3, max[0]);
+}
+
+TEST(GradientDescentOptimizerTest, minimize_multi_valued_function_with_analytic_gradient)
+{
+    GradientDescentOptimizer<2> gradientDescentOptimizer({0.1, 0.05});
+
+    // f = (x+5)^2 + 2*(y-4)^2 + 20
+    auto gradient = [](const std::array<double, 2>& x) {
+        return std::array<double, 2>{2 * (x[0] + 5), 4 * (x[1] - 4)};
+    };
+
+    auto min = gradientDescentOptimizer.minimizeWithGradient(gradient, {0, 0}, 150);
+
+    EXPECT_NEAR(min[0], -5, 0.1);
+    EXPECT_NEAR(min[1], 4, 0.1);
+}
+
+TEST(GradientDescentOptimizerTest,
+     minimize_multi_valued_function_with_automatic_differentiation)
+{
+    GradientDescentOptimizer<2> gradientDescentOptimizer({0.1, 0.05});
+
+    // f = (x+5)^2 + 2*(y-4)^2 + 20
+    auto f = [](const auto& x) {
+        return (x[0] + 5) * (x[0] + 5) + 2 * (x[1] - 4) * (x[1] - 4) + 20;
+    };
+    auto gradient = [](const std::array<double, 2>& x) {
+        return std::array<double, 2>{2 * (x[0] + 5), 4 * (x[1] - 4)};
+    };
+
+    auto min =
+        gradientDescentOptimizer.minimizeWithAutomaticDifferentiation(f, {0, 0}, 150);
+
+    EXPECT_NEAR(min[0], -5, 0.1);
+    EXPECT_NEAR(min[1], 4, 0.1);
+
+    // The gradient is exact, so we take the same steps as with the analytic gradient
+    auto analytic_min =
+        gradientDescentOptimizer.minimizeWithGradient(gradient, {0, 0}, 150);
+    EXPECT_DOUBLE_EQ(analytic_min[0], min[0]);
+    EXPECT_DOUBLE_EQ(analytic_min[1], min[1]);
+}
+
+TEST(GradientDescentOptimizerTest, maximize_sigmoid_with_automatic_differentiation)
+{
+    GradientDescentOptimizer<1> gradientDescentOptimizer({0.1});
+
+    // f = 1 / (1 + exp(2-2x))
+    auto f = [](const auto& x) {
+        using std::exp;
+        return 1 / (1 + exp(2 - 2 * x[0]));
+    };
+
+    auto max = gradientDescentOptimizer.maximizeWithAutomaticDifferentiation(f, {0}, 100);
+
+    EXPECT_GE(max[0], 3);
+}
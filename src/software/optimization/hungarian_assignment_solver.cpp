@@ -0,0 +1,225 @@
+#include "software/optimization/hungarian_assignment_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+HungarianAssignmentSolver::HungarianAssignmentSolver(size_t size)
+    : num_rows_and_cols(size),
+      has_solution(false),
+      costs(size * size, 0.0),
+      solved_costs(size * size, 0.0),
+      row_potentials(size + 1, 0.0),
+      col_potentials(size + 1, 0.0),
+      col_assignments(size + 1, 0),
+      row_assignments(size, 0),
+      min_reduced_costs(size + 1, 0.0),
+      path(size + 1, 0),
+      visited(size + 1, false)
+{
+}
+
+void HungarianAssignmentSolver::resize(size_t size)
+{
+    if (size == num_rows_and_cols)
+    {
+        return;
+    }
+
+    num_rows_and_cols = size;
+    costs.assign(size * size, 0.0);
+    solved_costs.assign(size * size, 0.0);
+    row_potentials.assign(size + 1, 0.0);
+    col_potentials.assign(size + 1, 0.0);
+    col_assignments.assign(size + 1, 0);
+    row_assignments.assign(size, 0);
+    min_reduced_costs.assign(size + 1, 0.0);
+    path.assign(size + 1, 0);
+    visited.assign(size + 1, false);
+    has_solution = false;
+}
+
+size_t HungarianAssignmentSolver::size() const
+{
+    return num_rows_and_cols;
+}
+
+void HungarianAssignmentSolver::setCost(size_t row, size_t col, double cost)
+{
+    costs.at(row * num_rows_and_cols + col) = cost;
+}
+
+double HungarianAssignmentSolver::getCost(size_t row, size_t col) const
+{
+    return costs.at(row * num_rows_and_cols + col);
+}
+
+bool HungarianAssignmentSolver::solve(double skip_threshold)
+{
+    if (num_rows_and_cols == 0)
+    {
+        return false;
+    }
+
+    if (has_solution)
+    {
+        bool costs_changed = false;
+        for (size_t i = 0; i < costs.size(); i++)
+        {
+            if (std::abs(costs[i] - solved_costs[i]) > skip_threshold)
+            {
+                costs_changed = true;
+                break;
+            }
+        }
+        if (!costs_changed)
+        {
+            return false;
+        }
+
+        // Warm start: keep the column potentials, and lower each row potential until
+        // none of the reduced costs in the row are negative. The potentials are then
+        // feasible for the new costs, and every previous pairing whose reduced cost is
+        // still 0 can be kept, since it is part of some optimal assignment given these
+        // potentials
+        for (size_t row = 1; row <= num_rows_and_cols; row++)
+        {
+            double min_cost = std::numeric_limits<double>::infinity();
+            for (size_t col = 1; col <= num_rows_and_cols; col++)
+            {
+                min_cost =
+                    std::min(min_cost, costs[(row - 1) * num_rows_and_cols + (col - 1)] -
+                                           col_potentials[col]);
+            }
+            row_potentials[row] = min_cost;
+        }
+        for (size_t col = 1; col <= num_rows_and_cols; col++)
+        {
+            if (col_assignments[col] != 0 && reducedCost(col_assignments[col], col) > 0.0)
+            {
+                col_assignments[col] = 0;
+            }
+        }
+    }
+    else
+    {
+        std::fill(row_potentials.begin(), row_potentials.end(), 0.0);
+        std::fill(col_potentials.begin(), col_potentials.end(), 0.0);
+        std::fill(col_assignments.begin(), col_assignments.end(), 0);
+    }
+
+    // Find which rows are still assigned from the warm start, and assign the rest.
+    // Unassigned rows are marked with an out of range column
+    std::fill(row_assignments.begin(), row_assignments.end(), num_rows_and_cols);
+    for (size_t col = 1; col <= num_rows_and_cols; col++)
+    {
+        if (col_assignments[col] != 0)
+        {
+            row_assignments[col_assignments[col] - 1] = col - 1;
+        }
+    }
+    for (size_t row = 1; row <= num_rows_and_cols; row++)
+    {
+        if (row_assignments[row - 1] == num_rows_and_cols)
+        {
+            augment(row);
+        }
+    }
+
+    for (size_t col = 1; col <= num_rows_and_cols; col++)
+    {
+        row_assignments[col_assignments[col] - 1] = col - 1;
+    }
+    std::copy(costs.begin(), costs.end(), solved_costs.begin());
+    has_solution = true;
+
+    return true;
+}
+
+size_t HungarianAssignmentSolver::getAssignedColumn(size_t row) const
+{
+    return row_assignments.at(row);
+}
+
+double HungarianAssignmentSolver::getTotalCost() const
+{
+    double total_cost = 0.0;
+    for (size_t row = 0; row < num_rows_and_cols; row++)
+    {
+        total_cost += getCost(row, row_assignments[row]);
+    }
+    return total_cost;
+}
+
+void HungarianAssignmentSolver::invalidateWarmStart()
+{
+    has_solution = false;
+}
+
+double HungarianAssignmentSolver::reducedCost(size_t row, size_t col) const
+{
+    return costs[(row - 1) * num_rows_and_cols + (col - 1)] - col_potentials[col] -
+           row_potentials[row];
+}
+
+void HungarianAssignmentSolver::augment(size_t row)
+{
+    // Column 0 is a virtual column that the new row is assigned to, so the search
+    // starts from it
+    col_assignments[0] = row;
+    size_t current_col = 0;
+    std::fill(min_reduced_costs.begin(), min_reduced_costs.end(),
+              std::numeric_limits<double>::infinity());
+    std::fill(visited.begin(), visited.end(), false);
+
+    // Grow a tree of alternating paths from the new row until we reach an unassigned
+    // column, adjusting the potentials so that the path to it only uses edges with a
+    // reduced cost of 0
+    do
+    {
+        visited[current_col] = true;
+        size_t current_row   = col_assignments[current_col];
+        double delta         = std::numeric_limits<double>::infinity();
+        size_t next_col      = 0;
+        for (size_t col = 1; col <= num_rows_and_cols; col++)
+        {
+            if (visited[col])
+            {
+                continue;
+            }
+            double reduced_cost = reducedCost(current_row, col);
+            if (reduced_cost < min_reduced_costs[col])
+            {
+                min_reduced_costs[col] = reduced_cost;
+                path[col]              = current_col;
+            }
+            if (min_reduced_costs[col] < delta)
+            {
+                delta    = min_reduced_costs[col];
+                next_col = col;
+            }
+        }
+
+        for (size_t col = 0; col <= num_rows_and_cols; col++)
+        {
+            if (visited[col])
+            {
+                row_potentials[col_assignments[col]] += delta;
+                col_potentials[col] -= delta;
+            }
+            else
+            {
+                min_reduced_costs[col] -= delta;
+            }
+        }
+        current_col = next_col;
+    } while (col_assignments[current_col] != 0);
+
+    // Flip the assignments along the path back to the new row
+    do
+    {
+        size_t previous_col          = path[current_col];
+        col_assignments[current_col] = col_assignments[previous_col];
+        current_col                  = previous_col;
+    } while (current_col != 0);
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * This class solves the square linear assignment problem: given an NxN matrix of
+ * costs, where each row is a "worker" and each column is a "job", find the one-to-one
+ * pairing of rows to columns that minimizes the total cost.
+ *
+ * It uses the O(N^3) shortest augmenting path formulation of the Hungarian algorithm
+ * that maintains dual variables (potentials) for every row and column:
+ * https://en.wikipedia.org/wiki/Hungarian_algorithm
+ * https://cp-algorithms.com/graph/hungarian-algorithm.html
+ *
+ * The solver is meant to be kept around and re-solved every tick with slowly changing
+ * costs, and is optimized for that case:
+ * - All storage is allocated when the size of the problem changes, so re-solving a
+ *   problem of the same size does not allocate
+ * - The column potentials from the previous solve are reused as a warm start. The row
+ *   potentials are recomputed so that they are feasible for the new costs, and any
+ *   previous pairing that is still optimal with respect to the potentials is kept, so
+ *   only the rows whose pairing has changed need to be re-assigned
+ * - If no cost has changed by more than a given threshold since the last solve, the
+ *   previous assignment is kept without solving at all. The kept assignment is at
+ *   most 2 * N * threshold worse than the optimal assignment
+ */
+class HungarianAssignmentSolver
+{
+   public:
+    /**
+     * Creates a new HungarianAssignmentSolver for a problem of the given size
+     *
+     * @param size The number of rows and columns of the cost matrix
+     */
+    explicit HungarianAssignmentSolver(size_t size = 0);
+
+    /**
+     * Changes the size of the problem. If the size is different from the current size,
+     * all costs are reset to 0 and the warm start is discarded.
+     *
+     * @param size The number of rows and columns of the cost matrix
+     */
+    void resize(size_t size);
+
+    /**
+     * Returns the number of rows and columns of the cost matrix
+     *
+     * @return the number of rows and columns of the cost matrix
+     */
+    size_t size() const;
+
+    /**
+     * Sets the cost of assigning the given row to the given column
+     *
+     * @param row The row
+     * @param col The column
+     * @param cost The cost of assigning the row to the column
+     */
+    void setCost(size_t row, size_t col, double cost);
+
+    /**
+     * Gets the cost of assigning the given row to the given column
+     *
+     * @param row The row
+     * @param col The column
+     *
+     * @return the cost of assigning the row to the column
+     */
+    double getCost(size_t row, size_t col) const;
+
+    /**
+     * Finds the assignment that minimizes the total cost
+     *
+     * @param skip_threshold If a previous assignment exists and no cost has changed by
+     * more than this amount since it was solved, the previous assignment is kept
+     *
+     * @return true if the problem was re-solved, false if the previous assignment was
+     * kept
+     */
+    bool solve(double skip_threshold = 0.0);
+
+    /**
+     * Returns the column the given row is assigned to by the last call to solve()
+     *
+     * @param row The row
+     *
+     * @return the column the given row is assigned to
+     */
+    size_t getAssignedColumn(size_t row) const;
+
+    /**
+     * Returns the total cost of the current assignment, using the current costs
+     *
+     * @return the total cost of the current assignment
+     */
+    double getTotalCost() const;
+
+    /**
+     * Discards the assignment and potentials from previous solves, so that the next
+     * call to solve() starts from scratch
+     */
+    void invalidateWarmStart();
+
+   private:
+    /**
+     * Returns the reduced cost of assigning the given row to the given column, which
+     * is the cost minus the row and column potentials. Rows and columns are 1-indexed
+     *
+     * @param row The row, 1-indexed
+     * @param col The column, 1-indexed
+     *
+     * @return the reduced cost of assigning the given row to the given column
+     */
+    double reducedCost(size_t row, size_t col) const;
+
+    /**
+     * Assigns the given unassigned row by finding the shortest augmenting path from it
+     * to an unassigned column, updating the potentials along the way
+     *
+     * @param row The row to assign, 1-indexed
+     */
+    void augment(size_t row);
+
+    size_t num_rows_and_cols;
+    bool has_solution;
+
+    // The costs, stored in row-major order
+    std::vector<double> costs;
+    // The costs at the time of the last solve, used to decide if we can skip solving
+    std::vector<double> solved_costs;
+
+    // The row and column potentials. These are 1-indexed, index 0 is a sentinel used
+    // by the augmenting path search
+    std::vector<double> row_potentials;
+    std::vector<double> col_potentials;
+    // The row assigned to each column, 1-indexed, with 0 meaning unassigned
+    std::vector<size_t> col_assignments;
+    // The column assigned to each row, 0-indexed
+    std::vector<size_t> row_assignments;
+
+    // Scratch space for the augmenting path search, kept to avoid re-allocating
+    std::vector<double> min_reduced_costs;
+    std::vector<size_t> path;
+    std::vector<bool> visited;
+};
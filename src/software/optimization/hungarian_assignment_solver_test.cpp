@@ -0,0 +1,186 @@
+#include "software/optimization/hungarian_assignment_solver.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+class HungarianAssignmentSolverTest : public ::testing::Test
+{
+   protected:
+    static void setCosts(HungarianAssignmentSolver &solver,
+                         const std::vector<std::vector<double>> &costs)
+    {
+        solver.resize(costs.size());
+        for (size_t row = 0; row < costs.size(); row++)
+        {
+            for (size_t col = 0; col < costs[row].size(); col++)
+            {
+                solver.setCost(row, col, costs[row][col]);
+            }
+        }
+    }
+
+    /**
+     * Finds the minimum total cost of the solver's cost matrix by trying every
+     * possible assignment
+     */
+    static double bruteForceMinimumCost(const HungarianAssignmentSolver &solver)
+    {
+        std::vector<size_t> cols(solver.size());
+        std::iota(cols.begin(), cols.end(), 0);
+        double min_cost = std::numeric_limits<double>::infinity();
+        do
+        {
+            double cost = 0.0;
+            for (size_t row = 0; row < cols.size(); row++)
+            {
+                cost += solver.getCost(row, cols[row]);
+            }
+            min_cost = std::min(min_cost, cost);
+        } while (std::next_permutation(cols.begin(), cols.end()));
+        return min_cost;
+    }
+
+    static void expectValidAssignment(const HungarianAssignmentSolver &solver)
+    {
+        std::vector<bool> col_assigned(solver.size(), false);
+        for (size_t row = 0; row < solver.size(); row++)
+        {
+            size_t col = solver.getAssignedColumn(row);
+            ASSERT_LT(col, solver.size());
+            EXPECT_FALSE(col_assigned[col]);
+            col_assigned[col] = true;
+        }
+    }
+
+    std::mt19937 random_number_generator = std::mt19937(0);
+    std::uniform_real_distribution<double> cost_distribution =
+        std::uniform_real_distribution<double>(-1.0, 10.0);
+};
+
+TEST_F(HungarianAssignmentSolverTest, empty_problem)
+{
+    HungarianAssignmentSolver solver;
+
+    EXPECT_FALSE(solver.solve());
+    EXPECT_DOUBLE_EQ(0.0, solver.getTotalCost());
+}
+
+TEST_F(HungarianAssignmentSolverTest, solve_1x1)
+{
+    HungarianAssignmentSolver solver;
+    setCosts(solver, {{4.2}});
+
+    EXPECT_TRUE(solver.solve());
+    EXPECT_EQ(0, solver.getAssignedColumn(0));
+    EXPECT_DOUBLE_EQ(4.2, solver.getTotalCost());
+}
+
+TEST_F(HungarianAssignmentSolverTest, solve_3x3)
+{
+    HungarianAssignmentSolver solver;
+    setCosts(solver, {{4, 1, 3}, {2, 0, 5}, {3, 2, 2}});
+
+    EXPECT_TRUE(solver.solve());
+    EXPECT_EQ(1, solver.getAssignedColumn(0));
+    EXPECT_EQ(0, solver.getAssignedColumn(1));
+    EXPECT_EQ(2, solver.getAssignedColumn(2));
+    EXPECT_DOUBLE_EQ(5.0, solver.getTotalCost());
+}
+
+TEST_F(HungarianAssignmentSolverTest, solve_random_problems_optimally)
+{
+    HungarianAssignmentSolver solver;
+    for (size_t size = 1; size <= 7; size++)
+    {
+        solver.resize(size);
+        for (unsigned int trial = 0; trial < 20; trial++)
+        {
+            for (size_t row = 0; row < size; row++)
+            {
+                for (size_t col = 0; col < size; col++)
+                {
+                    solver.setCost(row, col, cost_distribution(random_number_generator));
+                }
+            }
+            solver.invalidateWarmStart();
+            solver.solve();
+
+            expectValidAssignment(solver);
+            EXPECT_NEAR(bruteForceMinimumCost(solver), solver.getTotalCost(), 1e-9);
+        }
+    }
+}
+
+TEST_F(HungarianAssignmentSolverTest, warm_start_solves_perturbed_problems_optimally)
+{
+    std::uniform_real_distribution<double> perturbation_distribution(-0.5, 0.5);
+
+    HungarianAssignmentSolver solver;
+    for (size_t size = 1; size <= 7; size++)
+    {
+        solver.resize(size);
+        for (size_t row = 0; row < size; row++)
+        {
+            for (size_t col = 0; col < size; col++)
+            {
+                solver.setCost(row, col, cost_distribution(random_number_generator));
+            }
+        }
+        solver.solve();
+
+        // Small changes to every cost, like what happens as robots move between ticks
+        for (unsigned int tick = 0; tick < 50; tick++)
+        {
+            for (size_t row = 0; row < size; row++)
+            {
+                for (size_t col = 0; col < size; col++)
+                {
+                    solver.setCost(
+                        row, col,
+                        solver.getCost(row, col) +
+                            perturbation_distribution(random_number_generator));
+                }
+            }
+            EXPECT_TRUE(solver.solve());
+
+            expectValidAssignment(solver);
+            EXPECT_NEAR(bruteForceMinimumCost(solver), solver.getTotalCost(), 1e-9);
+        }
+    }
+}
+
+TEST_F(HungarianAssignmentSolverTest, small_cost_changes_skip_solving)
+{
+    HungarianAssignmentSolver solver;
+    setCosts(solver, {{1.0, 1.1}, {1.1, 1.05}});
+    EXPECT_TRUE(solver.solve(0.2));
+
+    // The optimal assignment is now to swap, but the costs are within the threshold
+    setCosts(solver, {{1.05, 1.0}, {1.0, 1.1}});
+    EXPECT_FALSE(solver.solve(0.2));
+    EXPECT_EQ(0, solver.getAssignedColumn(0));
+    EXPECT_EQ(1, solver.getAssignedColumn(1));
+    EXPECT_DOUBLE_EQ(2.15, solver.getTotalCost());
+
+    // Changes are measured from the last solve, not the last call to solve
+    setCosts(solver, {{1.3, 1.0}, {1.0, 1.3}});
+    EXPECT_TRUE(solver.solve(0.2));
+    EXPECT_EQ(1, solver.getAssignedColumn(0));
+    EXPECT_EQ(0, solver.getAssignedColumn(1));
+}
+
+TEST_F(HungarianAssignmentSolverTest, resize_discards_previous_solution)
+{
+    HungarianAssignmentSolver solver;
+    setCosts(solver, {{1, 2}, {2, 1}});
+    EXPECT_TRUE(solver.solve(1.0));
+
+    setCosts(solver, {{3, 1, 2}, {1, 2, 3}, {2, 3, 1}});
+    EXPECT_TRUE(solver.solve(1.0));
+    EXPECT_EQ(1, solver.getAssignedColumn(0));
+    EXPECT_EQ(0, solver.getAssignedColumn(1));
+    EXPECT_EQ(2, solver.getAssignedColumn(2));
+}
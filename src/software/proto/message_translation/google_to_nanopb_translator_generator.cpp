@@ -0,0 +1,526 @@
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/descriptor_database.h>
+
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Generates C++ functions that translate google protobuf messages directly into the
+ * equivalent NanoPb structs, by copying each field from one to the other. This avoids
+ * serializing the google message to a buffer and then decoding the buffer with NanoPb.
+ *
+ * The functions are generated from the descriptors of the proto files, so they stay in
+ * sync with the proto definitions. They follow the layout of the structs generated by
+ * NanoPb 0.3.9:
+ *  - Singular fields of proto3 messages (including submessages) have no has_ field
+ *  - Oneofs are stored as a which_<oneof> tag and a union named after the oneof
+ *  - Repeated fields and maps are stored as a <field>_count and a fixed size array, so
+ *    they must have a max_count set in the NanoPb options
+ *
+ * Strings and bytes are not supported, since NanoPb stores them differently depending
+ * on their options.
+ *
+ * Usage:
+ *  google_to_nanopb_translator_generator <descriptor set> <output header>
+ *      <output source> <header include path> <message> [<message>...]
+ *
+ * where each message is the full name of a message to generate translation functions
+ * for, ex. TbotsProto.Primitive. Functions are also generated for every message these
+ * messages contain.
+ */
+
+namespace
+{
+    using google::protobuf::Descriptor;
+    using google::protobuf::FieldDescriptor;
+    using google::protobuf::FileDescriptor;
+    using google::protobuf::OneofDescriptor;
+
+    /**
+     * Converts a name in snake_case to CamelCase the same way the protobuf compiler
+     * does, capitalizing the first letter and every letter that follows an underscore
+     * or a digit
+     *
+     * @param name The name to convert
+     *
+     * @return the name in CamelCase
+     */
+    std::string underscoresToCamelCase(const std::string& name)
+    {
+        std::string result;
+        bool capitalize_next = true;
+        for (char c : name)
+        {
+            if ('a' <= c && c <= 'z')
+            {
+                result += capitalize_next ? static_cast<char>(c - 'a' + 'A') : c;
+                capitalize_next = false;
+            }
+            else if ('A' <= c && c <= 'Z')
+            {
+                result += c;
+                capitalize_next = false;
+            }
+            else if ('0' <= c && c <= '9')
+            {
+                result += c;
+                capitalize_next = true;
+            }
+            else
+            {
+                capitalize_next = true;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Replaces every occurrence of one character in a string with another string
+     *
+     * @param str The string to replace characters in
+     * @param from The character to replace
+     * @param to What to replace the character with
+     *
+     * @return the string with the characters replaced
+     */
+    std::string replaceAll(const std::string& str, char from, const std::string& to)
+    {
+        std::string result;
+        for (char c : str)
+        {
+            if (c == from)
+            {
+                result += to;
+            }
+            else
+            {
+                result += c;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Returns the name of the C++ class generated by the protobuf compiler for the
+     * given message or enum, ex. TbotsProto::MovePrimitive_AutoChipOrKick
+     *
+     * @param full_name The full name of the message or enum
+     * @param package The package the message or enum is in
+     *
+     * @return the name of the generated C++ class
+     */
+    std::string googleTypeName(const std::string& full_name, const std::string& package)
+    {
+        std::string name_in_package = full_name.substr(package.size() + 1);
+        return replaceAll(package, '.', "::") +
+               "::" + replaceAll(name_in_package, '.', "_");
+    }
+
+    /**
+     * Returns the name of the struct or enum generated by NanoPb for the given message
+     * or enum, ex. TbotsProto_MovePrimitive_AutoChipOrKick
+     *
+     * @param full_name The full name of the message or enum
+     *
+     * @return the name of the generated NanoPb type
+     */
+    std::string nanopbTypeName(const std::string& full_name)
+    {
+        return replaceAll(full_name, '.', "_");
+    }
+
+    class TranslatorGenerator
+    {
+       public:
+        /**
+         * Generates translation functions for the given message and all the messages
+         * it contains, if they haven't been generated already
+         *
+         * @param message The message to generate translation functions for
+         */
+        void generate(const Descriptor* message)
+        {
+            if (generated_messages.count(message->full_name()) > 0)
+            {
+                return;
+            }
+            generated_messages.insert(message->full_name());
+
+            for (int i = 0; i < message->field_count(); i++)
+            {
+                const FieldDescriptor* field = message->field(i);
+                if (field->is_map())
+                {
+                    const FieldDescriptor* value_field =
+                        field->message_type()->FindFieldByName("value");
+                    if (value_field->type() == FieldDescriptor::TYPE_MESSAGE)
+                    {
+                        generate(value_field->message_type());
+                    }
+                }
+                else if (field->type() == FieldDescriptor::TYPE_MESSAGE)
+                {
+                    generate(field->message_type());
+                }
+            }
+
+            const std::string package = message->file()->package();
+            const std::string signature =
+                "void translateToNanoPb(const " +
+                googleTypeName(message->full_name(), package) + "& google_msg, " +
+                nanopbTypeName(message->full_name()) + "& nanopb_msg)";
+
+            declarations << "/**\n"
+                         << " * Copies the fields of the given google " << message->name()
+                         << " proto into the given NanoPb message\n"
+                         << " *\n"
+                         << " * @param google_msg The google proto to copy from\n"
+                         << " * @param nanopb_msg The NanoPb message to copy to\n"
+                         << " */\n"
+                         << signature << ";\n\n";
+
+            definitions << signature << "\n{\n";
+            if (message->field_count() == 0)
+            {
+                definitions << "    // This message has no fields to copy\n"
+                            << "    (void)google_msg;\n"
+                            << "    (void)nanopb_msg;\n";
+            }
+
+            std::set<const OneofDescriptor*> generated_oneofs;
+            for (int i = 0; i < message->field_count(); i++)
+            {
+                const FieldDescriptor* field = message->field(i);
+                const OneofDescriptor* oneof = field->containing_oneof();
+                if (oneof)
+                {
+                    if (generated_oneofs.count(oneof) == 0)
+                    {
+                        generateOneof(message, oneof);
+                        generated_oneofs.insert(oneof);
+                    }
+                }
+                else if (field->is_map())
+                {
+                    generateMap(field);
+                }
+                else if (field->is_repeated())
+                {
+                    generateRepeated(field);
+                }
+                else
+                {
+                    generateSingular(message, field);
+                }
+            }
+            definitions << "}\n\n";
+        }
+
+        /**
+         * Returns the declarations of all the generated functions
+         *
+         * @return the declarations of all the generated functions
+         */
+        std::string getDeclarations() const
+        {
+            return declarations.str();
+        }
+
+        /**
+         * Returns the definitions of all the generated functions
+         *
+         * @return the definitions of all the generated functions
+         */
+        std::string getDefinitions() const
+        {
+            return definitions.str();
+        }
+
+       private:
+        /**
+         * Returns a statement that copies a single value from the google message to the
+         * NanoPb message
+         *
+         * @param field The field the value belongs to
+         * @param google_value An expression for the value in the google message
+         * @param nanopb_value An expression for the value in the NanoPb message
+         *
+         * @return the statement to copy the value
+         */
+        std::string copyValue(const FieldDescriptor* field,
+                              const std::string& google_value,
+                              const std::string& nanopb_value)
+        {
+            switch (field->type())
+            {
+                case FieldDescriptor::TYPE_MESSAGE:
+                    return "translateToNanoPb(" + google_value + ", " + nanopb_value +
+                           ");";
+                case FieldDescriptor::TYPE_ENUM:
+                    return nanopb_value + " = static_cast<" +
+                           nanopbTypeName(field->enum_type()->full_name()) + ">(" +
+                           google_value + ");";
+                case FieldDescriptor::TYPE_STRING:
+                case FieldDescriptor::TYPE_BYTES:
+                    throw std::runtime_error("Strings and bytes are not supported, but " +
+                                             field->full_name() + " is a " +
+                                             field->type_name());
+                default:
+                    return nanopb_value + " = " + google_value + ";";
+            }
+        }
+
+        /**
+         * Generates the code to copy a field that is not repeated or in a oneof
+         *
+         * @param message The message containing the field
+         * @param field The field to copy
+         */
+        void generateSingular(const Descriptor* message, const FieldDescriptor* field)
+        {
+            const std::string google_value = "google_msg." + field->name() + "()";
+            const std::string nanopb_value = "nanopb_msg." + field->name();
+
+            if (message->file()->syntax() == FileDescriptor::SYNTAX_PROTO3)
+            {
+                definitions << "    " << copyValue(field, google_value, nanopb_value)
+                            << "\n";
+            }
+            else
+            {
+                // proto2 optional fields have a has_ field in NanoPb
+                definitions << "    nanopb_msg.has_" << field->name()
+                            << " = google_msg.has_" << field->name() << "();\n"
+                            << "    if (nanopb_msg.has_" << field->name() << ")\n"
+                            << "    {\n"
+                            << "        " << copyValue(field, google_value, nanopb_value)
+                            << "\n"
+                            << "    }\n";
+            }
+        }
+
+        /**
+         * Generates the code to copy whichever field of a oneof is set
+         *
+         * @param message The message containing the oneof
+         * @param oneof The oneof to copy
+         */
+        void generateOneof(const Descriptor* message, const OneofDescriptor* oneof)
+        {
+            const std::string google_type =
+                googleTypeName(message->full_name(), message->file()->package());
+
+            definitions << "    switch (google_msg." << oneof->name() << "_case())\n"
+                        << "    {\n";
+            for (int i = 0; i < oneof->field_count(); i++)
+            {
+                const FieldDescriptor* field = oneof->field(i);
+                definitions << "        case " << google_type << "::k"
+                            << underscoresToCamelCase(field->name()) << ":\n"
+                            << "            nanopb_msg.which_" << oneof->name() << " = "
+                            << nanopbTypeName(message->full_name()) << "_"
+                            << field->name() << "_tag;\n"
+                            << "            "
+                            << copyValue(
+                                   field, "google_msg." + field->name() + "()",
+                                   "nanopb_msg." + oneof->name() + "." + field->name())
+                            << "\n"
+                            << "            break;\n";
+            }
+            std::string not_set_case = oneof->name();
+            for (char& c : not_set_case)
+            {
+                c = static_cast<char>(std::toupper(c));
+            }
+            definitions << "        case " << google_type << "::" << not_set_case
+                        << "_NOT_SET:\n"
+                        << "            nanopb_msg.which_" << oneof->name() << " = 0;\n"
+                        << "            break;\n"
+                        << "    }\n";
+        }
+
+        /**
+         * Generates a check that the given number of values fit in the fixed size
+         * array NanoPb uses to store a repeated field
+         *
+         * @param field The repeated field
+         * @param google_size An expression for the number of values in the google
+         * message
+         */
+        void generateCapacityCheck(const FieldDescriptor* field,
+                                   const std::string& google_size)
+        {
+            definitions << "    if (" << google_size << " > std::size(nanopb_msg."
+                        << field->name() << "))\n"
+                        << "    {\n"
+                        << "        throw std::runtime_error(\"" << field->full_name()
+                        << " has more values than fit in the NanoPb message\");\n"
+                        << "    }\n";
+        }
+
+        /**
+         * Generates the code to copy a repeated field
+         *
+         * @param field The field to copy
+         */
+        void generateRepeated(const FieldDescriptor* field)
+        {
+            const std::string google_size =
+                "static_cast<std::size_t>(google_msg." + field->name() + "_size())";
+            generateCapacityCheck(field, google_size);
+            definitions << "    nanopb_msg." << field->name()
+                        << "_count = static_cast<pb_size_t>(google_msg." << field->name()
+                        << "_size());\n"
+                        << "    for (int i = 0; i < google_msg." << field->name()
+                        << "_size(); i++)\n"
+                        << "    {\n"
+                        << "        "
+                        << copyValue(field, "google_msg." + field->name() + "(i)",
+                                     "nanopb_msg." + field->name() + "[i]")
+                        << "\n"
+                        << "    }\n";
+        }
+
+        /**
+         * Generates the code to copy a map, which NanoPb stores as a repeated field of
+         * key-value entries
+         *
+         * @param field The field to copy
+         */
+        void generateMap(const FieldDescriptor* field)
+        {
+            const FieldDescriptor* key_field =
+                field->message_type()->FindFieldByName("key");
+            const FieldDescriptor* value_field =
+                field->message_type()->FindFieldByName("value");
+
+            generateCapacityCheck(field, "google_msg." + field->name() + "().size()");
+            definitions << "    nanopb_msg." << field->name() << "_count = 0;\n"
+                        << "    for (const auto& [key, value] : google_msg."
+                        << field->name() << "())\n"
+                        << "    {\n"
+                        << "        auto& entry = nanopb_msg." << field->name()
+                        << "[nanopb_msg." << field->name() << "_count++];\n"
+                        << "        " << copyValue(key_field, "key", "entry.key") << "\n"
+                        << "        " << copyValue(value_field, "value", "entry.value")
+                        << "\n"
+                        << "    }\n";
+        }
+
+        std::set<std::string> generated_messages;
+        std::stringstream declarations;
+        std::stringstream definitions;
+    };
+
+    /**
+     * Returns the name of the header generated by the given compiler for the given
+     * proto file, ex. shared/proto/primitive.pb.h
+     *
+     * @param file The proto file
+     * @param extension The extension of the generated header
+     *
+     * @return the name of the generated header
+     */
+    std::string generatedHeaderName(const FileDescriptor* file,
+                                    const std::string& extension)
+    {
+        const std::string& name = file->name();
+        return name.substr(0, name.size() - std::string(".proto").size()) + extension;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 6)
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " <descriptor set> <output header> <output source>"
+                  << " <header include path> <message> [<message>...]" << std::endl;
+        return 1;
+    }
+    const std::string descriptor_set_path = argv[1];
+    const std::string header_path         = argv[2];
+    const std::string source_path         = argv[3];
+    const std::string header_include_path = argv[4];
+
+    std::ifstream descriptor_set_file(descriptor_set_path, std::ios::binary);
+    google::protobuf::FileDescriptorSet descriptor_set;
+    if (!descriptor_set.ParseFromIstream(&descriptor_set_file))
+    {
+        std::cerr << "Failed to parse the descriptor set " << descriptor_set_path
+                  << std::endl;
+        return 1;
+    }
+
+    // The descriptor set only has the files we compile. The files they import from
+    // other libraries (ex. the NanoPb options) are only needed for custom options,
+    // which we don't use, so they are allowed to be missing
+    google::protobuf::SimpleDescriptorDatabase descriptor_database;
+    for (const auto& file : descriptor_set.file())
+    {
+        descriptor_database.Add(file);
+    }
+    google::protobuf::DescriptorPool pool(&descriptor_database);
+    pool.AllowUnknownDependencies();
+
+    TranslatorGenerator generator;
+    std::set<std::string> google_headers;
+    std::set<std::string> nanopb_headers;
+    try
+    {
+        for (int i = 5; i < argc; i++)
+        {
+            const Descriptor* message = pool.FindMessageTypeByName(argv[i]);
+            if (!message)
+            {
+                std::cerr << "Could not find the message " << argv[i]
+                          << " in the descriptor set " << descriptor_set_path
+                          << std::endl;
+                return 1;
+            }
+            google_headers.insert(generatedHeaderName(message->file(), ".pb.h"));
+            nanopb_headers.insert(generatedHeaderName(message->file(), ".nanopb.h"));
+            generator.generate(message);
+        }
+    }
+    catch (const std::runtime_error& error)
+    {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+
+    std::ofstream header(header_path);
+    header << "// Generated by google_to_nanopb_translator_generator, do not edit\n"
+           << "#pragma once\n\n";
+    for (const auto& google_header : google_headers)
+    {
+        header << "#include \"" << google_header << "\"\n";
+    }
+    header << "\nextern \"C\"\n{\n";
+    for (const auto& nanopb_header : nanopb_headers)
+    {
+        header << "#include \"" << nanopb_header << "\"\n";
+    }
+    header << "}\n\n" << generator.getDeclarations();
+
+    std::ofstream source(source_path);
+    source << "// Generated by google_to_nanopb_translator_generator, do not edit\n"
+           << "#include \"" << header_include_path << "\"\n\n"
+           << "#include <iterator>\n"
+           << "#include <stdexcept>\n\n"
+           << generator.getDefinitions();
+
+    if (!header || !source)
+    {
+        std::cerr << "Failed to write the generated files" << std::endl;
+        return 1;
+    }
+    return 0;
+}
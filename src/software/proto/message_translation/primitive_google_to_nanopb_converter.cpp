@@ -3,6 +3,22 @@
 #include <pb_decode.h>
 
 TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_primitive)
+{
+    TbotsProto_Primitive nanopb_primitive = TbotsProto_Primitive_init_zero;
+    translateToNanoPb(google_primitive, nanopb_primitive);
+    return nanopb_primitive;
+}
+
+TbotsProto_PrimitiveSet createNanoPbPrimitiveSet(
+    const TbotsProto::PrimitiveSet& google_primitive_set)
+{
+    TbotsProto_PrimitiveSet nanopb_primitive_set = TbotsProto_PrimitiveSet_init_zero;
+    translateToNanoPb(google_primitive_set, nanopb_primitive_set);
+    return nanopb_primitive_set;
+}
+
+TbotsProto_Primitive createNanoPbPrimitiveBySerialization(
+    const TbotsProto::Primitive& google_primitive)
 {
     // Serialize the message to an array of raw values
     std::vector<uint8_t> serialized_proto(google_primitive.ByteSizeLong());
@@ -23,7 +39,7 @@ TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_p
     return nanopb_primitive;
 }
 
-TbotsProto_PrimitiveSet createNanoPbPrimitiveSet(
+TbotsProto_PrimitiveSet createNanoPbPrimitiveSetBySerialization(
     const TbotsProto::PrimitiveSet& google_primitive_set)
 {
     // Serialize the message to an array of raw values
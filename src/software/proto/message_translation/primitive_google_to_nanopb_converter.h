@@ -1,17 +1,14 @@
 #pragma once
 
-#include "shared/proto/primitive.pb.h"
-#include "shared/proto/tbots_software_msgs.pb.h"
-
-extern "C"
-{
-#include "shared/proto/primitive.nanopb.h"
-#include "shared/proto/tbots_software_msgs.nanopb.h"
-}
+#include "software/proto/message_translation/primitive_google_to_nanopb_translator.h"
 
 /**
  * Convert the given google primitive proto to a NanoPb message
  *
+ * The fields are copied directly from the google proto to the NanoPb message with
+ * functions generated from the proto definitions, rather than serializing the google
+ * proto and decoding it with NanoPb
+ *
  * @param google_primitive The google primitive proto to convert to a NanoPb message
  *
  * @return The NanoPb message representing the given primitive
@@ -21,10 +18,46 @@ TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_p
 /**
  * Convert the given google primitive set proto to a NanoPb message
  *
+ * The fields are copied directly from the google proto to the NanoPb message with
+ * functions generated from the proto definitions, rather than serializing the google
+ * proto and decoding it with NanoPb
+ *
  * @param google_primitive_set The google primitive set proto to convert to a NanoPb
  * message
  *
- * @return The NanoPb message representing the given primitive
+ * @throws std::runtime_error if there are more primitives than fit in the NanoPb message
+ *
+ * @return The NanoPb message representing the given primitive set
  */
 TbotsProto_PrimitiveSet createNanoPbPrimitiveSet(
     const TbotsProto::PrimitiveSet& google_primitive_set);
+
+/**
+ * Convert the given google primitive proto to a NanoPb message by serializing it and
+ * decoding the serialized proto with NanoPb. This is slower than createNanoPbPrimitive,
+ * and is kept as a reference to check the direct translation against.
+ *
+ * @param google_primitive The google primitive proto to convert to a NanoPb message
+ *
+ * @throws std::runtime_error if the serialized proto could not be decoded
+ *
+ * @return The NanoPb message representing the given primitive
+ */
+TbotsProto_Primitive createNanoPbPrimitiveBySerialization(
+    const TbotsProto::Primitive& google_primitive);
+
+/**
+ * Convert the given google primitive set proto to a NanoPb message by serializing it and
+ * decoding the serialized proto with NanoPb. This is slower than
+ * createNanoPbPrimitiveSet, and is kept as a reference to check the direct translation
+ * against.
+ *
+ * @param google_primitive_set The google primitive set proto to convert to a NanoPb
+ * message
+ *
+ * @throws std::runtime_error if the serialized proto could not be decoded
+ *
+ * @return The NanoPb message representing the given primitive set
+ */
+TbotsProto_PrimitiveSet createNanoPbPrimitiveSetBySerialization(
+    const TbotsProto::PrimitiveSet& google_primitive_set);
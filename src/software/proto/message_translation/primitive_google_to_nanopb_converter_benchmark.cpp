@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include "software/proto/message_translation/primitive_google_to_nanopb_converter.h"
+#include "software/proto/primitive/primitive_msg_factory.h"
+
+/**
+ * Benchmarks for converting a PrimitiveSet for a full team of robots to NanoPb, comparing
+ * copying the fields directly with the generated translation functions against
+ * serializing the google proto and decoding it with NanoPb.
+ *
+ * Run with: bazel run -c opt
+ * //software/proto/message_translation:primitive_google_to_nanopb_converter_benchmark
+ */
+
+namespace
+{
+    /**
+     * Creates a PrimitiveSet with a move primitive for each robot on a team, like the
+     * ones sent to the robots every tick
+     *
+     * @return a PrimitiveSet for a full team
+     */
+    TbotsProto::PrimitiveSet createPrimitiveSet()
+    {
+        TbotsProto::PrimitiveSet primitive_set;
+        primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(1234.5);
+        auto& robot_primitives = *primitive_set.mutable_robot_primitives();
+        for (uint32_t id = 0; id < 11; id++)
+        {
+            robot_primitives[id] = *createMovePrimitive(
+                Point(0.3 * id, -0.2 * id), 1.5, Angle::fromRadians(id),
+                DribblerMode::MAX_FORCE, {AutoChipOrKickMode::AUTOKICK, 4.5},
+                MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0);
+        }
+        return primitive_set;
+    }
+}  // namespace
+
+void benchmarkConvertPrimitiveSetDirectly(benchmark::State& state)
+{
+    const TbotsProto::PrimitiveSet primitive_set = createPrimitiveSet();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(createNanoPbPrimitiveSet(primitive_set));
+    }
+    state.counters["primitive_sets"] = benchmark::Counter(
+        static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+void benchmarkConvertPrimitiveSetBySerialization(benchmark::State& state)
+{
+    const TbotsProto::PrimitiveSet primitive_set = createPrimitiveSet();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(createNanoPbPrimitiveSetBySerialization(primitive_set));
+    }
+    state.counters["primitive_sets"] = benchmark::Counter(
+        static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(benchmarkConvertPrimitiveSetDirectly);
+BENCHMARK(benchmarkConvertPrimitiveSetBySerialization);
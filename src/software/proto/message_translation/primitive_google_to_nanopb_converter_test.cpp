@@ -3,6 +3,10 @@
 #include <google/protobuf/util/message_differencer.h>
 #include <gtest/gtest.h>
 #include <math.h>
+#include <pb_encode.h>
+
+#include <algorithm>
+#include <random>
 
 #include "software/proto/primitive/primitive_msg_factory.h"
 
@@ -11,8 +15,182 @@
  * we have a single simple integration test to ensure the primitive is being converted
  * at all, as all the code to actually perform the conversion is not here (it's generated
  * from the proto, or defined in other visitors)
+ *
+ * The generated translation is instead checked against converting by serializing the
+ * google proto and decoding it with NanoPb, for many randomly generated primitives
  */
 
+namespace
+{
+    const unsigned int NUM_RANDOM_PRIMITIVES     = 2000;
+    const unsigned int NUM_RANDOM_PRIMITIVE_SETS = 200;
+
+    /**
+     * Generates random field values for primitives. Values are sometimes exactly zero,
+     * since zero values are not serialized in proto3 and are an easy case to get wrong.
+     */
+    class RandomPrimitiveGenerator
+    {
+       public:
+        explicit RandomPrimitiveGenerator(unsigned int seed) : random_engine(seed) {}
+
+        float randomFloat()
+        {
+            if (std::uniform_int_distribution<int>(0, 4)(random_engine) == 0)
+            {
+                return 0.0f;
+            }
+            return std::uniform_real_distribution<float>(-1000.0f,
+                                                         1000.0f)(random_engine);
+        }
+
+        int randomInt(int min, int max)
+        {
+            return std::uniform_int_distribution<int>(min, max)(random_engine);
+        }
+
+        TbotsProto::Primitive randomPrimitive()
+        {
+            TbotsProto::Primitive primitive;
+            // Case 0 leaves the primitive unset
+            switch (randomInt(0, 4))
+            {
+                case 1:
+                    primitive.mutable_estop();
+                    break;
+                case 2:
+                    *primitive.mutable_move() = randomMovePrimitive();
+                    break;
+                case 3:
+                    primitive.mutable_stop()->set_stop_type(
+                        static_cast<TbotsProto::StopPrimitive::StopType>(
+                            randomInt(0, 1)));
+                    break;
+                case 4:
+                    *primitive.mutable_direct_control() = randomDirectControlPrimitive();
+                    break;
+            }
+            return primitive;
+        }
+
+        TbotsProto::MovePrimitive randomMovePrimitive()
+        {
+            TbotsProto::MovePrimitive move;
+            // Submessages are sometimes left unset
+            if (randomInt(0, 3) > 0)
+            {
+                move.mutable_destination()->set_x_meters(randomFloat());
+                move.mutable_destination()->set_y_meters(randomFloat());
+            }
+            move.set_final_speed_m_per_s(randomFloat());
+            if (randomInt(0, 3) > 0)
+            {
+                move.mutable_final_angle()->set_radians(randomFloat());
+            }
+            move.set_dribbler_speed_rpm(randomFloat());
+            move.set_max_speed_m_per_s(randomFloat());
+            switch (randomInt(0, 2))
+            {
+                case 1:
+                    move.mutable_auto_chip_or_kick()->set_autokick_speed_m_per_s(
+                        randomFloat());
+                    break;
+                case 2:
+                    move.mutable_auto_chip_or_kick()->set_autochip_distance_meters(
+                        randomFloat());
+                    break;
+            }
+            move.set_target_spin_rev_per_s(randomFloat());
+            return move;
+        }
+
+        TbotsProto::DirectControlPrimitive randomDirectControlPrimitive()
+        {
+            TbotsProto::DirectControlPrimitive direct_control;
+            switch (randomInt(0, 2))
+            {
+                case 1:
+                {
+                    auto wheel_control =
+                        direct_control.mutable_direct_per_wheel_control();
+                    wheel_control->set_front_left_wheel_rpm(randomFloat());
+                    wheel_control->set_back_left_wheel_rpm(randomFloat());
+                    wheel_control->set_front_right_wheel_rpm(randomFloat());
+                    wheel_control->set_back_right_wheel_rpm(randomFloat());
+                    break;
+                }
+                case 2:
+                {
+                    auto velocity_control =
+                        direct_control.mutable_direct_velocity_control();
+                    velocity_control->mutable_velocity()->set_x_component_meters(
+                        randomFloat());
+                    velocity_control->mutable_velocity()->set_y_component_meters(
+                        randomFloat());
+                    velocity_control->mutable_angular_velocity()->set_radians_per_second(
+                        randomFloat());
+                    break;
+                }
+            }
+            direct_control.set_charge_mode(
+                static_cast<TbotsProto::DirectControlPrimitive::ChargeMode>(
+                    randomInt(0, 2)));
+            switch (randomInt(0, 4))
+            {
+                case 1:
+                    direct_control.set_kick_speed_m_per_s(randomFloat());
+                    break;
+                case 2:
+                    direct_control.set_chip_distance_meters(randomFloat());
+                    break;
+                case 3:
+                    direct_control.set_autokick_speed_m_per_s(randomFloat());
+                    break;
+                case 4:
+                    direct_control.set_autochip_distance_meters(randomFloat());
+                    break;
+            }
+            direct_control.set_dribbler_speed_rpm(randomFloat());
+            return direct_control;
+        }
+
+        TbotsProto::PrimitiveSet randomPrimitiveSet()
+        {
+            TbotsProto::PrimitiveSet primitive_set;
+            primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(randomFloat());
+            auto& robot_primitives = *primitive_set.mutable_robot_primitives();
+            int num_primitives     = randomInt(0, 11);
+            for (int i = 0; i < num_primitives; i++)
+            {
+                robot_primitives[static_cast<uint32_t>(randomInt(0, 15))] =
+                    randomPrimitive();
+            }
+            return primitive_set;
+        }
+
+       private:
+        std::mt19937 random_engine;
+    };
+
+    /**
+     * Encodes the given NanoPb message, so two NanoPb messages can be compared
+     *
+     * @param fields The NanoPb fields of the message
+     * @param nanopb_msg The message to encode
+     *
+     * @return the encoded message
+     */
+    std::vector<uint8_t> encodeNanoPb(const pb_field_t fields[], const void* nanopb_msg)
+    {
+        size_t encoded_size = 0;
+        EXPECT_TRUE(pb_get_encoded_size(&encoded_size, fields, nanopb_msg));
+        std::vector<uint8_t> encoded(encoded_size);
+        pb_ostream_t stream = pb_ostream_from_buffer(encoded.data(), encoded.size());
+        EXPECT_TRUE(pb_encode(&stream, fields, nanopb_msg));
+        return encoded;
+    }
+}  // namespace
+
 TEST(PrimitiveGoogleToNanoPbConverterTest, convert_move_primitive)
 {
     TbotsProto::Primitive google_primitive = *createMovePrimitive(
@@ -83,3 +261,69 @@ TEST(PrimitiveGoogleToNanoPbConverterTest, convert_primitive_set)
         }
     }
 }
+
+TEST(PrimitiveGoogleToNanoPbConverterTest,
+     random_primitives_match_conversion_by_serialization)
+{
+    RandomPrimitiveGenerator generator(0);
+    for (unsigned int i = 0; i < NUM_RANDOM_PRIMITIVES; i++)
+    {
+        TbotsProto::Primitive google_primitive = generator.randomPrimitive();
+
+        TbotsProto_Primitive nanopb_primitive = createNanoPbPrimitive(google_primitive);
+        TbotsProto_Primitive expected_nanopb_primitive =
+            createNanoPbPrimitiveBySerialization(google_primitive);
+
+        EXPECT_EQ(encodeNanoPb(TbotsProto_Primitive_fields, &expected_nanopb_primitive),
+                  encodeNanoPb(TbotsProto_Primitive_fields, &nanopb_primitive))
+            << "Primitive did not match: " << google_primitive.DebugString();
+    }
+}
+
+TEST(PrimitiveGoogleToNanoPbConverterTest,
+     random_primitive_sets_match_conversion_by_serialization)
+{
+    RandomPrimitiveGenerator generator(1);
+    for (unsigned int i = 0; i < NUM_RANDOM_PRIMITIVE_SETS; i++)
+    {
+        TbotsProto::PrimitiveSet google_primitive_set = generator.randomPrimitiveSet();
+
+        TbotsProto_PrimitiveSet nanopb_primitive_set =
+            createNanoPbPrimitiveSet(google_primitive_set);
+        TbotsProto_PrimitiveSet expected_nanopb_primitive_set =
+            createNanoPbPrimitiveSetBySerialization(google_primitive_set);
+
+        EXPECT_EQ(expected_nanopb_primitive_set.time_sent.epoch_timestamp_seconds,
+                  nanopb_primitive_set.time_sent.epoch_timestamp_seconds);
+
+        // The order of the map entries is not defined, so we match entries by key
+        ASSERT_EQ(expected_nanopb_primitive_set.robot_primitives_count,
+                  nanopb_primitive_set.robot_primitives_count);
+        for (pb_size_t j = 0; j < nanopb_primitive_set.robot_primitives_count; j++)
+        {
+            const auto& entry         = nanopb_primitive_set.robot_primitives[j];
+            const auto expected_entry = std::find_if(
+                std::begin(expected_nanopb_primitive_set.robot_primitives),
+                std::begin(expected_nanopb_primitive_set.robot_primitives) +
+                    expected_nanopb_primitive_set.robot_primitives_count,
+                [&](const auto& expected) { return expected.key == entry.key; });
+            ASSERT_NE(std::begin(expected_nanopb_primitive_set.robot_primitives) +
+                          expected_nanopb_primitive_set.robot_primitives_count,
+                      expected_entry);
+            EXPECT_EQ(encodeNanoPb(TbotsProto_Primitive_fields, &expected_entry->value),
+                      encodeNanoPb(TbotsProto_Primitive_fields, &entry.value));
+        }
+    }
+}
+
+TEST(PrimitiveGoogleToNanoPbConverterTest, convert_primitive_set_with_too_many_primitives)
+{
+    TbotsProto::PrimitiveSet google_primitive_set;
+    auto& robot_primitives_map = *google_primitive_set.mutable_robot_primitives();
+    for (uint32_t id = 0; id < 100; id++)
+    {
+        robot_primitives_map[id] = *createEstopPrimitive();
+    }
+
+    EXPECT_THROW(createNanoPbPrimitiveSet(google_primitive_set), std::runtime_error);
+}
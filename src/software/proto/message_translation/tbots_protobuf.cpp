@@ -58,7 +58,13 @@ std::unique_ptr<TbotsProto::BallState> createBallState(const Ball& ball)
 
 std::unique_ptr<TbotsProto::Timestamp> createCurrentTimestamp()
 {
-    auto timestamp_msg    = std::make_unique<TbotsProto::Timestamp>();
+    auto timestamp_msg = std::make_unique<TbotsProto::Timestamp>();
+    setCurrentTimestamp(*timestamp_msg);
+    return timestamp_msg;
+}
+
+void setCurrentTimestamp(TbotsProto::Timestamp& timestamp)
+{
     const auto clock_time = std::chrono::system_clock::now();
     double time_in_seconds =
         static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
@@ -66,6 +72,5 @@ std::unique_ptr<TbotsProto::Timestamp> createCurrentTimestamp()
                                 .count()) /
         MICROSECONDS_PER_SECOND;
 
-    timestamp_msg->set_epoch_timestamp_seconds(time_in_seconds);
-    return timestamp_msg;
+    timestamp.set_epoch_timestamp_seconds(time_in_seconds);
 }
@@ -31,3 +31,10 @@ std::unique_ptr<TbotsProto::BallState> createBallState(const Ball& ball);
  * @return The unique_ptr to a TbotsProto::Timestamp with the current UTC time
  */
 std::unique_ptr<TbotsProto::Timestamp> createCurrentTimestamp();
+
+/**
+ * Sets the given timestamp msg to the time that this function was called
+ *
+ * @param timestamp The timestamp msg to set to the current UTC time
+ */
+void setCurrentTimestamp(TbotsProto::Timestamp& timestamp);
@@ -9,63 +9,78 @@ std::unique_ptr<TbotsProto::Primitive> createMovePrimitive(
     MaxAllowedSpeedMode max_allowed_speed_mode, double target_spin_rev_per_s)
 {
     auto move_primitive_msg = std::make_unique<TbotsProto::Primitive>();
+    setMovePrimitive(*move_primitive_msg, dest, final_speed_m_per_s, final_angle,
+                     dribbler_mode, auto_chip_or_kick, max_allowed_speed_mode,
+                     target_spin_rev_per_s);
+    return move_primitive_msg;
+}
+
+std::unique_ptr<TbotsProto::Primitive> createStopPrimitive(bool coast)
+{
+    auto stop_primitive_msg = std::make_unique<TbotsProto::Primitive>();
+    setStopPrimitive(*stop_primitive_msg, coast);
+    return stop_primitive_msg;
+}
+
+std::unique_ptr<TbotsProto::Primitive> createEstopPrimitive()
+{
+    auto estop_primitive_msg = std::make_unique<TbotsProto::Primitive>();
+    setEstopPrimitive(*estop_primitive_msg);
+    return estop_primitive_msg;
+}
+
+void setMovePrimitive(TbotsProto::Primitive &primitive, const Point &dest,
+                      double final_speed_m_per_s, const Angle &final_angle,
+                      DribblerMode dribbler_mode, AutoChipOrKick auto_chip_or_kick,
+                      MaxAllowedSpeedMode max_allowed_speed_mode,
+                      double target_spin_rev_per_s)
+{
+    auto move_primitive_msg = primitive.mutable_move();
 
-    auto dest_msg        = createPointProto(Point(dest.x(), dest.y()));
-    auto final_angle_msg = createAngleProto(final_angle);
-    *(move_primitive_msg->mutable_move()->mutable_final_angle()) = *final_angle_msg;
-    *(move_primitive_msg->mutable_move()->mutable_destination()) = *dest_msg;
-    move_primitive_msg->mutable_move()->set_final_speed_m_per_s(
-        static_cast<float>(final_speed_m_per_s));
-    move_primitive_msg->mutable_move()->set_max_speed_m_per_s(static_cast<float>(
+    move_primitive_msg->mutable_destination()->set_x_meters(static_cast<float>(dest.x()));
+    move_primitive_msg->mutable_destination()->set_y_meters(static_cast<float>(dest.y()));
+    move_primitive_msg->mutable_final_angle()->set_radians(
+        static_cast<float>(final_angle.toRadians()));
+    move_primitive_msg->set_final_speed_m_per_s(static_cast<float>(final_speed_m_per_s));
+    move_primitive_msg->set_max_speed_m_per_s(static_cast<float>(
         convertMaxAllowedSpeedModeToMaxAllowedSpeed(max_allowed_speed_mode)));
 
-    move_primitive_msg->mutable_move()->set_dribbler_speed_rpm(
+    move_primitive_msg->set_dribbler_speed_rpm(
         static_cast<float>(convertDribblerModeToDribblerSpeed(dribbler_mode)));
 
     if (auto_chip_or_kick.auto_chip_kick_mode == AutoChipOrKickMode::AUTOCHIP)
     {
-        move_primitive_msg->mutable_move()
-            ->mutable_auto_chip_or_kick()
-            ->set_autochip_distance_meters(
-                static_cast<float>(auto_chip_or_kick.autochip_distance_m));
+        move_primitive_msg->mutable_auto_chip_or_kick()->set_autochip_distance_meters(
+            static_cast<float>(auto_chip_or_kick.autochip_distance_m));
     }
     else if (auto_chip_or_kick.auto_chip_kick_mode == AutoChipOrKickMode::AUTOKICK)
     {
-        move_primitive_msg->mutable_move()
-            ->mutable_auto_chip_or_kick()
-            ->set_autokick_speed_m_per_s(
-                static_cast<float>(auto_chip_or_kick.autokick_speed_m_per_s));
+        move_primitive_msg->mutable_auto_chip_or_kick()->set_autokick_speed_m_per_s(
+            static_cast<float>(auto_chip_or_kick.autokick_speed_m_per_s));
+    }
+    else
+    {
+        move_primitive_msg->clear_auto_chip_or_kick();
     }
-    move_primitive_msg->mutable_move()->set_target_spin_rev_per_s(
+    move_primitive_msg->set_target_spin_rev_per_s(
         static_cast<float>(target_spin_rev_per_s));
-    return move_primitive_msg;
 }
 
-std::unique_ptr<TbotsProto::Primitive> createStopPrimitive(bool coast)
+void setStopPrimitive(TbotsProto::Primitive &primitive, bool coast)
 {
-    auto stop_primitive_msg = std::make_unique<TbotsProto::Primitive>();
-
     if (coast)
     {
-        stop_primitive_msg->mutable_stop()->set_stop_type(
-            TbotsProto::StopPrimitive::COAST);
+        primitive.mutable_stop()->set_stop_type(TbotsProto::StopPrimitive::COAST);
     }
     else
     {
-        stop_primitive_msg->mutable_stop()->set_stop_type(
-            TbotsProto::StopPrimitive::BRAKE);
+        primitive.mutable_stop()->set_stop_type(TbotsProto::StopPrimitive::BRAKE);
     }
-
-    return stop_primitive_msg;
 }
 
-std::unique_ptr<TbotsProto::Primitive> createEstopPrimitive()
+void setEstopPrimitive(TbotsProto::Primitive &primitive)
 {
-    auto estop_primitive_msg = std::make_unique<TbotsProto::Primitive>();
-
-    estop_primitive_msg->mutable_estop();
-
-    return estop_primitive_msg;
+    primitive.mutable_estop();
 }
 
 double convertDribblerModeToDribblerSpeed(DribblerMode dribbler_mode)
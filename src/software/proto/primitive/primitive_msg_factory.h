@@ -90,6 +90,42 @@ std::unique_ptr<TbotsProto::Primitive> createStopPrimitive(bool coast);
  */
 std::unique_ptr<TbotsProto::Primitive> createEstopPrimitive();
 
+/**
+ * Sets the given Primitive Message to a Move Primitive, building it in place so no
+ * separate Primitive Message has to be allocated and copied. If the Primitive is
+ * already a Move Primitive, its messages are reused.
+ *
+ * @param primitive The Primitive Message to set
+ * @param dest The final destination of the movement
+ * @param final_speed_m_per_s The speed at final destination
+ * @param final_angle The final orientation the robot should have at the end
+ * of the movement
+ * @param dribbler_mode The dribbler mode
+ * @param auto_chip_or_kick The command to autochip or autokick
+ * @param max_allowed_speed_mode The mode of maximum speed allowed
+ * @param target_spin_rev_per_s The target spin while moving in revolutions per second
+ */
+void setMovePrimitive(TbotsProto::Primitive &primitive, const Point &dest,
+                      double final_speed_m_per_s, const Angle &final_angle,
+                      DribblerMode dribbler_mode, AutoChipOrKick auto_chip_or_kick,
+                      MaxAllowedSpeedMode max_allowed_speed_mode,
+                      double target_spin_rev_per_s);
+
+/**
+ * Sets the given Primitive Message to a Stop Primitive in place
+ *
+ * @param primitive The Primitive Message to set
+ * @param coast Indicate to brake or coast to a stop
+ */
+void setStopPrimitive(TbotsProto::Primitive &primitive, bool coast);
+
+/**
+ * Sets the given Primitive Message to an Estop Primitive in place
+ *
+ * @param primitive The Primitive Message to set
+ */
+void setEstopPrimitive(TbotsProto::Primitive &primitive);
+
 /**
  * Convert dribbler mode to dribbler speed
  *
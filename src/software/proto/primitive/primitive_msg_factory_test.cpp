@@ -98,3 +98,47 @@ TEST(PrimitiveFactoryTest, test_create_estop_primitive)
 
     ASSERT_TRUE(Estop_primitive->has_estop());
 }
+
+TEST(PrimitiveFactoryTest, test_set_move_primitive_replaces_existing_primitive)
+{
+    auto primitive = createStopPrimitive(true);
+
+    setMovePrimitive(*primitive, Point(2, -1), 1.0, Angle::half(), DribblerMode::OFF,
+                     {AutoChipOrKickMode::AUTOKICK, 3.5},
+                     MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0);
+
+    ASSERT_TRUE(primitive->has_move());
+    EXPECT_FALSE(primitive->has_stop());
+    EXPECT_EQ(primitive->move().destination().x_meters(), 2);
+    EXPECT_EQ(primitive->move().destination().y_meters(), -1);
+    EXPECT_EQ(primitive->move().auto_chip_or_kick().autokick_speed_m_per_s(), 3.5);
+}
+
+TEST(PrimitiveFactoryTest, test_set_move_primitive_overwrites_every_field_when_reused)
+{
+    auto primitive = createMovePrimitive(
+        Point(-5, 1), 3.0, Angle::threeQuarter(), DribblerMode::INDEFINITE,
+        {AutoChipOrKickMode::AUTOCHIP, 2.5}, MaxAllowedSpeedMode::STOP_COMMAND, 5.0);
+
+    setMovePrimitive(*primitive, Point(1, 2), 0.5, Angle::zero(), DribblerMode::OFF,
+                     {AutoChipOrKickMode::OFF, 0}, MaxAllowedSpeedMode::PHYSICAL_LIMIT,
+                     0.0);
+
+    auto expected_primitive = createMovePrimitive(
+        Point(1, 2), 0.5, Angle::zero(), DribblerMode::OFF, {AutoChipOrKickMode::OFF, 0},
+        MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0);
+    EXPECT_EQ(expected_primitive->SerializeAsString(), primitive->SerializeAsString());
+}
+
+TEST(PrimitiveFactoryTest, test_set_stop_and_estop_primitive)
+{
+    TbotsProto::Primitive primitive;
+
+    setStopPrimitive(primitive, true);
+    ASSERT_TRUE(primitive.has_stop());
+    EXPECT_EQ(primitive.stop().stop_type(), TbotsProto::StopPrimitive::COAST);
+
+    setEstopPrimitive(primitive);
+    EXPECT_TRUE(primitive.has_estop());
+    EXPECT_FALSE(primitive.has_stop());
+}
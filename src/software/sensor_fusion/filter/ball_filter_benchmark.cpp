@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "software/sensor_fusion/filter/ball_filter.h"
+#include "software/sensor_fusion/filter/kalman_ball_filter.h"
+#include "software/sensor_fusion/filter/multi_hypothesis_ball_filter.h"
+#include "software/world/field.h"
+
+/**
+ * Benchmarks for the cost of updating the BallFilter and the KalmanBallFilter with a
+ * new ball detection each vision frame, for a ball rolling across the field with noise
+ * in its detections.
+ *
+ * Reports the time per detection, and the mean error of the estimated ball position and
+ * velocity compared to the real ball.
+ *
+ * Run with: bazel run -c opt //software/sensor_fusion/filter:ball_filter_benchmark
+ */
+
+namespace
+{
+    // The number of detections of the rolling ball, which are reused between iterations
+    const unsigned int NUM_FRAMES           = 600;
+    const double FRAME_PERIOD_SECONDS       = 1.0 / 60.0;
+    const double BALL_POSITION_NOISE_STDDEV = 0.002;
+    const double BALL_ROLLING_DECELERATION  = 1.0;
+    const double BALL_INITIAL_SPEED         = 4.0;
+
+    struct RollingBallFrame
+    {
+        BallDetection detection;
+        Point real_position;
+        Vector real_velocity;
+    };
+
+    /**
+     * Creates detections of a ball kicked from one corner of the field towards the
+     * other, which rolls to a stop and then stays still
+     *
+     * @param field The field the ball is on
+     *
+     * @return the frames of the ball rolling
+     */
+    std::vector<RollingBallFrame> createRollingBallFrames(const Field& field)
+    {
+        std::mt19937 random_generator(1);
+        std::normal_distribution<double> position_noise(0, BALL_POSITION_NOISE_STDDEV);
+
+        const Point start      = field.friendlyCornerNeg();
+        const Vector direction = (field.enemyCornerPos() - start).normalize();
+        const double stop_time = BALL_INITIAL_SPEED / BALL_ROLLING_DECELERATION;
+        std::vector<RollingBallFrame> frames;
+        for (unsigned int i = 0; i < NUM_FRAMES; i++)
+        {
+            double t             = std::min(i * FRAME_PERIOD_SECONDS, stop_time);
+            double speed         = BALL_INITIAL_SPEED - BALL_ROLLING_DECELERATION * t;
+            Point position       = start + direction * (BALL_INITIAL_SPEED * t -
+                                                  BALL_ROLLING_DECELERATION * t * t / 2);
+            Point noisy_position = position + Vector(position_noise(random_generator),
+                                                     position_noise(random_generator));
+            frames.push_back(RollingBallFrame{
+                BallDetection{noisy_position, 0.0,
+                              Timestamp::fromSeconds(i * FRAME_PERIOD_SECONDS), 0.9},
+                position, direction * speed});
+        }
+        return frames;
+    }
+
+    template <class BallFilterT>
+    void benchmarkEstimateBallState(benchmark::State& state)
+    {
+        const Field field                          = Field::createSSLDivisionBField();
+        const std::vector<RollingBallFrame> frames = createRollingBallFrames(field);
+        // The detections are given to the filter the same way sensor fusion does, with
+        // a new vector for each vision frame
+        std::vector<std::vector<BallDetection>> detections;
+        for (const auto& frame : frames)
+        {
+            detections.push_back({frame.detection});
+        }
+
+        double total_position_error = 0;
+        double total_velocity_error = 0;
+        unsigned long num_estimates = 0;
+        for (auto _ : state)
+        {
+            // Each iteration filters the whole roll with a new filter, since the
+            // timestamps can't go backwards
+            BallFilterT ball_filter;
+            for (unsigned int i = 0; i < frames.size(); i++)
+            {
+                std::optional<Ball> ball =
+                    ball_filter.estimateBallState(detections[i], field.fieldBoundary());
+                if (ball)
+                {
+                    total_position_error +=
+                        (ball->position() - frames[i].real_position).length();
+                    total_velocity_error +=
+                        (ball->velocity() - frames[i].real_velocity).length();
+                    num_estimates++;
+                }
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * frames.size()));
+        if (num_estimates > 0)
+        {
+            state.counters["mean_position_error_m"] =
+                total_position_error / num_estimates;
+            state.counters["mean_velocity_error_m_per_s"] =
+                total_velocity_error / num_estimates;
+        }
+    }
+}  // namespace
+
+BENCHMARK_TEMPLATE(benchmarkEstimateBallState, BallFilter);
+BENCHMARK_TEMPLATE(benchmarkEstimateBallState, KalmanBallFilter);
+BENCHMARK_TEMPLATE(benchmarkEstimateBallState, MultiHypothesisBallFilter);
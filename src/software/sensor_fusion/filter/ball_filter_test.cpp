@@ -10,8 +10,11 @@
 #include "software/geom/algorithms/distance.h"
 #include "software/geom/ray.h"
 #include "software/geom/segment.h"
+#include "software/sensor_fusion/filter/kalman_ball_filter.h"
+#include "software/sensor_fusion/filter/multi_hypothesis_ball_filter.h"
 #include "software/world/field.h"
 
+template <typename FilterType>
 class BallFilterTest : public ::testing::Test
 {
    protected:
@@ -237,7 +240,7 @@ class BallFilterTest : public ::testing::Test
     }
 
     Field field;
-    BallFilter ball_filter;
+    FilterType ball_filter;
     Timestamp current_timestamp;
     Duration time_step;
     std::mt19937 random_generator;
@@ -246,7 +249,12 @@ class BallFilterTest : public ::testing::Test
     static constexpr double BALL_DISTANCE_FROM_GROUND = 0.0;
 };
 
-TEST_F(BallFilterTest, ball_sitting_still_with_low_noise)
+// All the ball filters are held to the same accuracy
+using BallFilterTypes =
+    ::testing::Types<BallFilter, KalmanBallFilter, MultiHypothesisBallFilter>;
+TYPED_TEST_SUITE(BallFilterTest, BallFilterTypes);
+
+TYPED_TEST(BallFilterTest, ball_sitting_still_with_low_noise)
 {
     Ray ball_trajectory                = Ray(Point(0, 0), Vector(0, 0));
     double ball_velocity_magnitude     = 0;
@@ -260,16 +268,16 @@ TEST_F(BallFilterTest, ball_sitting_still_with_low_noise)
     double expected_velocity_magnitude_tolerance = 0.075;
     int num_simulation_steps                     = 200;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongBallTrajectory(
+    this->testFilterAlongBallTrajectory(
         start_time, ball_trajectory, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_simulation_steps, num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest, ball_sitting_still_with_moderate_noise)
+TYPED_TEST(BallFilterTest, ball_sitting_still_with_moderate_noise)
 {
     Ray ball_trajectory                = Ray(Point(0, 0), Vector(0, 0));
     double ball_velocity_magnitude     = 0;
@@ -283,18 +291,19 @@ TEST_F(BallFilterTest, ball_sitting_still_with_moderate_noise)
     double expected_velocity_magnitude_tolerance = 1.0;
     int num_simulation_steps                     = 10;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongBallTrajectory(
+    this->testFilterAlongBallTrajectory(
         start_time, ball_trajectory, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_simulation_steps, num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest, ball_moving_slow_in_a_straight_line_with_no_noise_in_data)
+TYPED_TEST(BallFilterTest, ball_moving_slow_in_a_straight_line_with_no_noise_in_data)
 {
-    Segment ball_path = Segment(field.friendlyCornerNeg(), field.enemyCornerPos());
+    Segment ball_path =
+        Segment(this->field.friendlyCornerNeg(), this->field.enemyCornerPos());
     double ball_velocity_magnitude               = 0.31;
     double ball_position_variance                = 0;
     double time_step_variance                    = 0;
@@ -302,18 +311,19 @@ TEST_F(BallFilterTest, ball_moving_slow_in_a_straight_line_with_no_noise_in_data
     Angle expected_velocity_angle_tolernace      = Angle::fromDegrees(0.01);
     double expected_velocity_magnitude_tolerance = 0.01;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest, ball_moving_slow_in_a_straight_line_with_small_noise_in_data)
+TYPED_TEST(BallFilterTest, ball_moving_slow_in_a_straight_line_with_small_noise_in_data)
 {
-    Segment ball_path = Segment(field.friendlyCornerNeg(), field.enemyCornerPos());
+    Segment ball_path =
+        Segment(this->field.friendlyCornerNeg(), this->field.enemyCornerPos());
     double ball_velocity_magnitude               = 0.3;
     double ball_position_variance                = 0.001;
     double time_step_variance                    = 0.001;
@@ -321,18 +331,19 @@ TEST_F(BallFilterTest, ball_moving_slow_in_a_straight_line_with_small_noise_in_d
     Angle expected_velocity_angle_tolernace      = Angle::fromDegrees(5.5);
     double expected_velocity_magnitude_tolerance = 0.04;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest, ball_moving_slow_in_a_straight_line_with_medium_noise_in_data)
+TYPED_TEST(BallFilterTest, ball_moving_slow_in_a_straight_line_with_medium_noise_in_data)
 {
-    Segment ball_path = Segment(field.friendlyCornerNeg(), field.enemyCornerPos());
+    Segment ball_path =
+        Segment(this->field.friendlyCornerNeg(), this->field.enemyCornerPos());
     double ball_velocity_magnitude               = 0.3;
     double ball_position_variance                = 0.003;
     double time_step_variance                    = 0.001;
@@ -340,18 +351,19 @@ TEST_F(BallFilterTest, ball_moving_slow_in_a_straight_line_with_medium_noise_in_
     Angle expected_velocity_angle_tolernace      = Angle::fromDegrees(16);
     double expected_velocity_magnitude_tolerance = 0.11;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest, ball_moving_fast_in_a_straight_line_with_no_noise_in_data)
+TYPED_TEST(BallFilterTest, ball_moving_fast_in_a_straight_line_with_no_noise_in_data)
 {
-    Segment ball_path = Segment(field.friendlyCornerNeg(), field.enemyCornerPos());
+    Segment ball_path =
+        Segment(this->field.friendlyCornerNeg(), this->field.enemyCornerPos());
     double ball_velocity_magnitude               = 6.2;
     double ball_position_variance                = 0;
     double time_step_variance                    = 0;
@@ -359,18 +371,19 @@ TEST_F(BallFilterTest, ball_moving_fast_in_a_straight_line_with_no_noise_in_data
     Angle expected_velocity_angle_tolernace      = Angle::fromDegrees(0.01);
     double expected_velocity_magnitude_tolerance = 0.01;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest, ball_moving_fast_in_a_straight_line_with_small_noise_in_data)
+TYPED_TEST(BallFilterTest, ball_moving_fast_in_a_straight_line_with_small_noise_in_data)
 {
-    Segment ball_path = Segment(field.friendlyCornerNeg(), field.enemyCornerPos());
+    Segment ball_path =
+        Segment(this->field.friendlyCornerNeg(), this->field.enemyCornerPos());
     double ball_velocity_magnitude               = 5.72;
     double ball_position_variance                = 0.001;
     double time_step_variance                    = 0.001;
@@ -378,18 +391,19 @@ TEST_F(BallFilterTest, ball_moving_fast_in_a_straight_line_with_small_noise_in_d
     Angle expected_velocity_angle_tolernace      = Angle::fromDegrees(0.9);
     double expected_velocity_magnitude_tolerance = 0.07;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest, ball_moving_fast_in_a_straight_line_with_medium_noise_in_data)
+TYPED_TEST(BallFilterTest, ball_moving_fast_in_a_straight_line_with_medium_noise_in_data)
 {
-    Segment ball_path = Segment(field.friendlyCornerNeg(), field.enemyCornerPos());
+    Segment ball_path =
+        Segment(this->field.friendlyCornerNeg(), this->field.enemyCornerPos());
     double ball_velocity_magnitude               = 5.04;
     double ball_position_variance                = 0.003;
     double time_step_variance                    = 0.001;
@@ -397,19 +411,20 @@ TEST_F(BallFilterTest, ball_moving_fast_in_a_straight_line_with_medium_noise_in_
     Angle expected_velocity_angle_tolerance      = Angle::fromDegrees(3.0);
     double expected_velocity_magnitude_tolerance = 0.21;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolerance, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest,
-       ball_moving_fast_in_a_straight_line_and_then_bouncing_with_no_noise_in_data)
+TYPED_TEST(BallFilterTest,
+           ball_moving_fast_in_a_straight_line_and_then_bouncing_with_no_noise_in_data)
 {
-    Segment ball_path = Segment(field.friendlyCornerNeg(), field.enemyCornerPos());
+    Segment ball_path =
+        Segment(this->field.friendlyCornerNeg(), this->field.enemyCornerPos());
     double ball_velocity_magnitude               = 5.04;
     double ball_position_variance                = 0;
     double time_step_variance                    = 0;
@@ -417,66 +432,67 @@ TEST_F(BallFilterTest,
     Angle expected_velocity_angle_tolernace      = Angle::fromDegrees(0.01);
     double expected_velocity_magnitude_tolerance = 0.01;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 
-    ball_path                   = Segment(field.enemyCornerPos(), field.enemyCornerNeg());
-    ball_velocity_magnitude     = 4.8;
-    expected_position_tolerance = 0.0001;
+    ball_path = Segment(this->field.enemyCornerPos(), this->field.enemyCornerNeg());
+    ball_velocity_magnitude               = 4.8;
+    expected_position_tolerance           = 0.0001;
     expected_velocity_angle_tolernace     = Angle::fromDegrees(0.01);
     expected_velocity_magnitude_tolerance = 0.01;
     num_steps_to_ignore                   = 5;
-    start_time                            = current_timestamp;
+    start_time                            = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest,
-       ball_moving_fast_in_a_straight_line_and_then_bouncing_with_no_noise_in_data_2)
+TYPED_TEST(BallFilterTest,
+           ball_moving_fast_in_a_straight_line_and_then_bouncing_with_no_noise_in_data_2)
 {
-    Segment ball_path =
-        Segment(field.friendlyCornerNeg(), field.friendlyHalf().posXPosYCorner());
-    double ball_velocity_magnitude               = 5.04;
-    double ball_position_variance                = 0;
-    double time_step_variance                    = 0;
-    double expected_position_tolerance           = 0.0001;
-    Angle expected_velocity_angle_tolernace      = Angle::fromDegrees(0.1);
+    Segment ball_path                       = Segment(this->field.friendlyCornerNeg(),
+                                this->field.friendlyHalf().posXPosYCorner());
+    double ball_velocity_magnitude          = 5.04;
+    double ball_position_variance           = 0;
+    double time_step_variance               = 0;
+    double expected_position_tolerance      = 0.0001;
+    Angle expected_velocity_angle_tolernace = Angle::fromDegrees(0.1);
     double expected_velocity_magnitude_tolerance = 0.1;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 
-    ball_path = Segment(field.friendlyHalf().posXPosYCorner(), field.enemyCornerNeg());
-    ball_velocity_magnitude               = 4.8;
-    expected_position_tolerance           = 0.0001;
+    ball_path                   = Segment(this->field.friendlyHalf().posXPosYCorner(),
+                        this->field.enemyCornerNeg());
+    ball_velocity_magnitude     = 4.8;
+    expected_position_tolerance = 0.0001;
     expected_velocity_angle_tolernace     = Angle::fromDegrees(0.1);
     expected_velocity_magnitude_tolerance = 0.1;
     num_steps_to_ignore                   = 5;
-    start_time                            = current_timestamp;
+    start_time                            = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest,
-       ball_moving_fast_in_a_straight_line_and_then_bouncing_with_no_noise_in_data_3)
+TYPED_TEST(BallFilterTest,
+           ball_moving_fast_in_a_straight_line_and_then_bouncing_with_no_noise_in_data_3)
 {
     Segment ball_path                            = Segment(Point(-3, -1), Point(0, 0));
     double ball_velocity_magnitude               = 5.04;
@@ -486,9 +502,9 @@ TEST_F(BallFilterTest,
     Angle expected_velocity_angle_tolernace      = Angle::fromDegrees(0.1);
     double expected_velocity_magnitude_tolerance = 0.1;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
@@ -500,18 +516,19 @@ TEST_F(BallFilterTest,
     expected_velocity_angle_tolernace     = Angle::fromDegrees(0.1);
     expected_velocity_magnitude_tolerance = 0.1;
     num_steps_to_ignore                   = 5;
-    start_time                            = current_timestamp;
+    start_time                            = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest, ball_moving_along_x_axis)
+TYPED_TEST(BallFilterTest, ball_moving_along_x_axis)
 {
-    Segment ball_path = Segment(field.friendlyGoalCenter(), field.enemyGoalCenter());
+    Segment ball_path =
+        Segment(this->field.friendlyGoalCenter(), this->field.enemyGoalCenter());
     double ball_velocity_magnitude               = 5;
     double ball_position_variance                = 0;
     double time_step_variance                    = 0;
@@ -519,18 +536,18 @@ TEST_F(BallFilterTest, ball_moving_along_x_axis)
     Angle expected_velocity_angle_tolernace      = Angle::fromDegrees(0.01);
     double expected_velocity_magnitude_tolerance = 0.01;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
         num_steps_to_ignore);
 }
 
-TEST_F(BallFilterTest, ball_moving_along_y_axis)
+TYPED_TEST(BallFilterTest, ball_moving_along_y_axis)
 {
-    Segment ball_path                            = field.halfwayLine();
+    Segment ball_path                            = this->field.halfwayLine();
     double ball_velocity_magnitude               = 5;
     double ball_position_variance                = 0;
     double time_step_variance                    = 0;
@@ -538,9 +555,9 @@ TEST_F(BallFilterTest, ball_moving_along_y_axis)
     Angle expected_velocity_angle_tolernace      = Angle::fromDegrees(0.01);
     double expected_velocity_magnitude_tolerance = 0.01;
     int num_steps_to_ignore                      = 5;
-    Timestamp start_time                         = current_timestamp;
+    Timestamp start_time                         = this->current_timestamp;
 
-    testFilterAlongLineSegment(
+    this->testFilterAlongLineSegment(
         start_time, ball_path, ball_velocity_magnitude, ball_position_variance,
         time_step_variance, expected_position_tolerance,
         expected_velocity_angle_tolernace, expected_velocity_magnitude_tolerance,
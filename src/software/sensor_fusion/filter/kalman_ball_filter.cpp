@@ -0,0 +1,203 @@
+#include "software/sensor_fusion/filter/kalman_ball_filter.h"
+
+#include <algorithm>
+
+#include "shared/constants.h"
+#include "software/geom/algorithms/contains.h"
+
+namespace
+{
+    // The covariance of the noise in the position of ball detections
+    const Eigen::Matrix2d DETECTION_COVARIANCE =
+        Eigen::Matrix2d::Identity() *
+        std::pow(KalmanBallFilter::DETECTION_POSITION_STDDEV_METERS, 2);
+}  // namespace
+
+KalmanBallFilter::KalmanBallFilter()
+    : state(StateVector::Zero()),
+      state_covariance(StateCovariance::Zero()),
+      latest_detection(std::nullopt),
+      num_consecutive_rejected_detections(0)
+{
+}
+
+std::optional<Ball> KalmanBallFilter::estimateBallState(
+    const std::vector<BallDetection> &new_ball_detections, const Rectangle &filter_area)
+{
+    // Update the filter with the detections from oldest to newest
+    forEachDetectionInTimestampOrder(
+        new_ball_detections, [this, &filter_area](const BallDetection &detection) {
+            // Ignore any detections outside the filter area
+            if (contains(filter_area, detection.position))
+            {
+                update(detection);
+            }
+        });
+
+    return getBall();
+}
+
+std::optional<Ball> KalmanBallFilter::getBall() const
+{
+    if (!latest_detection)
+    {
+        return std::nullopt;
+    }
+
+    BallState ball_state(Point(state(0), state(1)), Vector(state(2), state(3)),
+                         latest_detection->distance_from_ground);
+    return Ball(ball_state, latest_detection->timestamp);
+}
+
+std::optional<Eigen::Matrix2d> KalmanBallFilter::getVelocityCovariance() const
+{
+    if (!latest_detection)
+    {
+        return std::nullopt;
+    }
+    return state_covariance.bottomRightCorner<2, 2>();
+}
+
+std::optional<double> KalmanBallFilter::getNormalizedInnovationSquared(
+    const BallDetection &detection) const
+{
+    if (!latest_detection)
+    {
+        return std::nullopt;
+    }
+
+    // Detections that aren't newer than the latest detection are compared to where the
+    // ball is now
+    double time_step =
+        std::max(0.0, (detection.timestamp - latest_detection->timestamp).toSeconds());
+    Prediction prediction = predict(time_step, detection);
+    const Eigen::Vector2d innovation =
+        Eigen::Vector2d(detection.position.x(), detection.position.y()) -
+        prediction.state.head<2>();
+    const Eigen::Matrix2d innovation_covariance =
+        prediction.covariance.topLeftCorner<2, 2>() + DETECTION_COVARIANCE;
+    return innovation.transpose() * innovation_covariance.inverse() * innovation;
+}
+
+bool KalmanBallFilter::update(const BallDetection &detection)
+{
+    if (!latest_detection)
+    {
+        reset(detection);
+        return true;
+    }
+
+    double time_step = (detection.timestamp - latest_detection->timestamp).toSeconds();
+    // Ignore any data from the past, and any data that is as old as the latest data
+    // since it provides no additional value
+    if (time_step <= 0)
+    {
+        return false;
+    }
+
+    // We determine if the detection is noise based on how fast the ball must have moved
+    // to reach it from the latest detection. Make the maximum acceptable speed a bit
+    // larger than the strict limits according to the game rules to account for
+    // measurement error, and to be a bit on the safe side. If we keep getting detections
+    // that are too far away, the ball has probably been moved (ex. during ball
+    // placement), so we start tracking it again from the new detections
+    double detection_speed =
+        (detection.position - latest_detection->position).length() / time_step;
+    if (detection_speed >
+        BALL_MAX_SPEED_METERS_PER_SECOND + MAX_ACCEPTABLE_BALL_SPEED_BUFFER)
+    {
+        num_consecutive_rejected_detections++;
+        if (num_consecutive_rejected_detections >= MAX_CONSECUTIVE_REJECTED_DETECTIONS)
+        {
+            reset(detection);
+            return true;
+        }
+        return false;
+    }
+    num_consecutive_rejected_detections = 0;
+
+    const Eigen::Vector2d previous_position   = state.head<2>();
+    const Eigen::Matrix2d previous_covariance = state_covariance.topLeftCorner<2, 2>();
+    const Eigen::Vector2d measured_position(detection.position.x(),
+                                            detection.position.y());
+    Prediction prediction = predict(time_step, detection);
+    state                 = prediction.state;
+    state_covariance      = prediction.covariance;
+
+    // We only measure the position of the ball
+    const Eigen::Vector2d innovation = measured_position - state.head<2>();
+    const Eigen::Matrix2d innovation_covariance =
+        state_covariance.topLeftCorner<2, 2>() + DETECTION_COVARIANCE;
+    const Eigen::Matrix2d innovation_covariance_inverse = innovation_covariance.inverse();
+    double normalized_innovation_squared =
+        innovation.transpose() * innovation_covariance_inverse * innovation;
+
+    if (normalized_innovation_squared > MAX_NORMALIZED_INNOVATION_SQUARED)
+    {
+        // The ball isn't where we expected, so it has probably changed direction (ex.
+        // bounced off a robot or been kicked). Its old velocity tells us nothing about
+        // its new one, so we estimate the new velocity from the last position and this
+        // detection
+        state.head<2>() = measured_position;
+        state.tail<2>() = (measured_position - previous_position) / time_step;
+        state_covariance.topLeftCorner<2, 2>()    = DETECTION_COVARIANCE;
+        state_covariance.topRightCorner<2, 2>()   = DETECTION_COVARIANCE / time_step;
+        state_covariance.bottomLeftCorner<2, 2>() = DETECTION_COVARIANCE / time_step;
+        state_covariance.bottomRightCorner<2, 2>() =
+            (DETECTION_COVARIANCE + previous_covariance) / (time_step * time_step);
+    }
+    else
+    {
+        const Eigen::Matrix<double, 4, 2> kalman_gain =
+            state_covariance.leftCols<2>() * innovation_covariance_inverse;
+        state += kalman_gain * innovation;
+
+        // We use the Joseph form of the covariance update since it keeps the covariance
+        // symmetric and positive definite despite rounding errors
+        StateCovariance covariance_reduction = StateCovariance::Identity();
+        covariance_reduction.leftCols<2>() -= kalman_gain;
+        state_covariance =
+            covariance_reduction * state_covariance * covariance_reduction.transpose() +
+            kalman_gain * DETECTION_COVARIANCE * kalman_gain.transpose();
+    }
+
+    latest_detection = detection;
+    return true;
+}
+
+void KalmanBallFilter::reset(const BallDetection &detection)
+{
+    state << detection.position.x(), detection.position.y(), 0, 0;
+    state_covariance                       = StateCovariance::Zero();
+    state_covariance.topLeftCorner<2, 2>() = DETECTION_COVARIANCE;
+    state_covariance.bottomRightCorner<2, 2>() =
+        Eigen::Matrix2d::Identity() * std::pow(UNKNOWN_VELOCITY_STDDEV, 2);
+    latest_detection                    = detection;
+    num_consecutive_rejected_detections = 0;
+}
+
+KalmanBallFilter::Prediction KalmanBallFilter::predict(
+    double time_step, const BallDetection &detection) const
+{
+    StateCovariance transition        = StateCovariance::Identity();
+    transition.topRightCorner<2, 2>() = Eigen::Matrix2d::Identity() * time_step;
+
+    // The ball is accelerated by random noise that is constant over the time step, which
+    // moves it by a * t^2 / 2 and changes its velocity by a * t
+    const bool ball_is_chipped =
+        detection.distance_from_ground > CHIPPED_BALL_MIN_HEIGHT_METERS;
+    double acceleration_variance = std::pow(
+        ball_is_chipped ? CHIPPED_ACCELERATION_STDDEV : ROLLING_ACCELERATION_STDDEV, 2);
+    StateCovariance process_noise = StateCovariance::Zero();
+    process_noise.topLeftCorner<2, 2>() =
+        Eigen::Matrix2d::Identity() * std::pow(time_step, 4) / 4 * acceleration_variance;
+    process_noise.topRightCorner<2, 2>() =
+        Eigen::Matrix2d::Identity() * std::pow(time_step, 3) / 2 * acceleration_variance;
+    process_noise.bottomLeftCorner<2, 2>() = process_noise.topRightCorner<2, 2>();
+    process_noise.bottomRightCorner<2, 2>() =
+        Eigen::Matrix2d::Identity() * std::pow(time_step, 2) * acceleration_variance;
+
+    return Prediction{
+        transition * state,
+        transition * state_covariance * transition.transpose() + process_noise};
+}
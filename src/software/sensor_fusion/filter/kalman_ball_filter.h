@@ -0,0 +1,149 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <optional>
+
+#include "software/geom/rectangle.h"
+#include "software/sensor_fusion/filter/vision_detection.h"
+#include "software/time/timestamp.h"
+#include "software/world/ball.h"
+
+/**
+ * Given ball data from SSL Vision, filters and returns the position/velocity of the
+ * "real" ball.
+ *
+ * This ball filter is a Kalman filter that tracks the position and velocity of the ball.
+ * Unlike the BallFilter, which fits a line through a buffer of detections every frame,
+ * each detection is folded into a fixed-size state, so updating the filter takes constant
+ * time and doesn't allocate any memory.
+ *
+ * The ball is modelled as moving at a constant velocity, and any acceleration (ex.
+ * friction) is treated as process noise. The amount of process noise depends on whether
+ * the ball is rolling on the ground or has been chipped, since vision can't track a ball
+ * in the air as well. When a detection is too far from where the filter predicts the
+ * ball to be (ex. the ball bounced off a robot or was kicked), the velocity of the ball
+ * is considered unknown and is re-estimated from the new detections.
+ *
+ * Along with the ball, the filter provides the covariance of its velocity estimate so
+ * that callers can tell how much to trust it.
+ */
+class KalmanBallFilter
+{
+   public:
+    // The extra amount beyond the ball's max speed that we treat ball detections as valid
+    static constexpr double MAX_ACCEPTABLE_BALL_SPEED_BUFFER = 2.0;
+    // The standard deviation of the noise in the position of ball detections, in metres
+    static constexpr double DETECTION_POSITION_STDDEV_METERS = 0.003;
+    // The standard deviation of the acceleration of the ball that isn't modelled, in
+    // metres per second squared, when it is rolling and when it is in the air
+    static constexpr double ROLLING_ACCELERATION_STDDEV = 1.0;
+    static constexpr double CHIPPED_ACCELERATION_STDDEV = 10.0;
+    // Detections higher than this off the ground are from a chipped ball
+    static constexpr double CHIPPED_BALL_MIN_HEIGHT_METERS = 0.05;
+    // If the squared Mahalanobis distance of a detection from the predicted ball position
+    // is larger than this, the ball is considered to have changed direction. This is the
+    // 99.99% quantile of the chi-squared distribution with 2 degrees of freedom
+    static constexpr double MAX_NORMALIZED_INNOVATION_SQUARED = 18.42;
+    // The standard deviation of the velocity of the ball when it is unknown, in metres
+    // per second
+    static constexpr double UNKNOWN_VELOCITY_STDDEV = 5.0;
+    // If this many detections in a row are too far from the ball to be real, the ball
+    // has probably been moved so we start tracking it from the new detections
+    static constexpr unsigned int MAX_CONSECUTIVE_REJECTED_DETECTIONS = 5;
+
+    /**
+     * Creates a new Kalman Ball Filter
+     */
+    explicit KalmanBallFilter();
+
+    /**
+     * Update the filter with the new ball detection data, and returns the new
+     * estimated state of the ball given the new data
+     *
+     * @param new_ball_detections A list of new Ball detections
+     * @param filter_area The area within which the ball filter will work. Any detections
+     * outside of this area will be ignored.
+     *
+     * @return The new ball based on the estimated state of the ball given the new data.
+     * If a filtered result cannot be calculated, returns std::nullopt
+     */
+    std::optional<Ball> estimateBallState(
+        const std::vector<BallDetection>& new_ball_detections,
+        const Rectangle& filter_area);
+
+    /**
+     * Returns the covariance of the estimated velocity of the ball, in (m/s)^2, as of the
+     * last detection the filter was updated with. The first row and column are for the x
+     * component of the velocity, and the second are for the y component.
+     *
+     * @return The covariance of the estimated ball velocity, or std::nullopt if the
+     * filter hasn't received any detections
+     */
+    std::optional<Eigen::Matrix2d> getVelocityCovariance() const;
+
+    /**
+     * Returns the ball as of the latest detection the filter was updated with
+     *
+     * @return The estimated state of the ball, or std::nullopt if the filter hasn't
+     * received any detections
+     */
+    std::optional<Ball> getBall() const;
+
+    /**
+     * Returns the squared Mahalanobis distance of the given detection from where the
+     * filter predicts the ball to be at the time of the detection. Small values mean
+     * the detection is likely to be of the ball this filter is tracking.
+     *
+     * @param detection The detection to compare to the ball
+     *
+     * @return The normalized innovation squared of the detection, or std::nullopt if the
+     * filter hasn't received any detections
+     */
+    std::optional<double> getNormalizedInnovationSquared(
+        const BallDetection& detection) const;
+
+    /**
+     * Updates the filter with a single detection, ignoring it if it's older than the
+     * latest detection or too far away from the ball to be real
+     *
+     * @param detection The detection to update the filter with
+     *
+     * @return true if the filter was updated with the detection, and false if it was
+     * ignored
+     */
+    bool update(const BallDetection& detection);
+
+   private:
+    // The state is [x, y, x velocity, y velocity]
+    using StateVector     = Eigen::Matrix<double, 4, 1>;
+    using StateCovariance = Eigen::Matrix<double, 4, 4>;
+
+    struct Prediction
+    {
+        StateVector state;
+        StateCovariance covariance;
+    };
+
+    /**
+     * Resets the filter to a ball at the given detection with an unknown velocity
+     *
+     * @param detection The detection to start tracking the ball from
+     */
+    void reset(const BallDetection& detection);
+
+    /**
+     * Predicts the state of the ball after the given amount of time
+     *
+     * @param time_step The amount of time to predict forward
+     * @param detection The detection at the end of the time step, which tells us if the
+     * ball is in the air
+     *
+     * @return The predicted state of the ball and its covariance
+     */
+    Prediction predict(double time_step, const BallDetection& detection) const;
+
+    StateVector state;
+    StateCovariance state_covariance;
+    std::optional<BallDetection> latest_detection;
+    unsigned int num_consecutive_rejected_detections;
+};
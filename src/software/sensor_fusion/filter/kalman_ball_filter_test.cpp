@@ -0,0 +1,127 @@
+#include "software/sensor_fusion/filter/kalman_ball_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/world/field.h"
+
+class KalmanBallFilterTest : public ::testing::Test
+{
+   protected:
+    KalmanBallFilterTest()
+        : field(Field::createSSLDivisionBField()),
+          ball_filter(),
+          start_time(Timestamp::fromSeconds(123)),
+          time_step(Duration::fromSeconds(1.0 / 60.0))
+    {
+    }
+
+    /**
+     * Creates a detection of the ball on the ground at the given frame
+     *
+     * @param position The position of the detection
+     * @param frame The number of frames since the start time
+     *
+     * @return the ball detection
+     */
+    BallDetection createDetection(const Point& position, unsigned int frame)
+    {
+        return BallDetection{
+            position, 0.0,
+            start_time + Duration::fromSeconds(frame * time_step.toSeconds()), 0.9};
+    }
+
+    Field field;
+    KalmanBallFilter ball_filter;
+    Timestamp start_time;
+    Duration time_step;
+};
+
+TEST_F(KalmanBallFilterTest, no_detections)
+{
+    EXPECT_FALSE(ball_filter.estimateBallState({}, field.fieldBoundary()));
+    EXPECT_FALSE(ball_filter.getVelocityCovariance());
+}
+
+TEST_F(KalmanBallFilterTest, detections_outside_filter_area_are_ignored)
+{
+    auto ball = ball_filter.estimateBallState({createDetection(Point(100, 0), 0)},
+                                              field.fieldBoundary());
+
+    EXPECT_FALSE(ball);
+}
+
+TEST_F(KalmanBallFilterTest, velocity_covariance_shrinks_with_more_detections)
+{
+    std::mt19937 random_generator(1);
+    std::normal_distribution<double> position_noise(0, 0.003);
+
+    std::vector<double> velocity_variances;
+    for (unsigned int i = 0; i < 60; i++)
+    {
+        Point position(position_noise(random_generator),
+                       position_noise(random_generator));
+        ball_filter.estimateBallState({createDetection(position, i)},
+                                      field.fieldBoundary());
+        auto velocity_covariance = ball_filter.getVelocityCovariance();
+        ASSERT_TRUE(velocity_covariance);
+        velocity_variances.push_back(velocity_covariance->trace());
+    }
+
+    EXPECT_LT(velocity_variances.back(), velocity_variances[1]);
+    EXPECT_LT(velocity_variances[1], velocity_variances.front());
+}
+
+TEST_F(KalmanBallFilterTest, detections_are_used_in_timestamp_order)
+{
+    // The detections from both cameras arrive in the same frame, newest first
+    ball_filter.estimateBallState({createDetection(Point(0, 0), 0)},
+                                  field.fieldBoundary());
+    auto ball = ball_filter.estimateBallState(
+        {createDetection(Point(0.1, 0), 2), createDetection(Point(0.05, 0), 1)},
+        field.fieldBoundary());
+
+    ASSERT_TRUE(ball);
+    EXPECT_EQ(start_time + Duration::fromSeconds(2 * time_step.toSeconds()),
+              ball->timestamp());
+    EXPECT_NEAR(0.1, ball->position().x(), 0.001);
+    EXPECT_NEAR(3, ball->velocity().x(), 0.01);
+}
+
+TEST_F(KalmanBallFilterTest, single_noisy_detection_far_from_ball_is_ignored)
+{
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        ball_filter.estimateBallState({createDetection(Point(1, 1), i)},
+                                      field.fieldBoundary());
+    }
+    auto ball = ball_filter.estimateBallState({createDetection(Point(-3, -2), 10)},
+                                              field.fieldBoundary());
+
+    ASSERT_TRUE(ball);
+    EXPECT_NEAR(1, ball->position().x(), 0.001);
+    EXPECT_NEAR(1, ball->position().y(), 0.001);
+    EXPECT_LT(ball->velocity().length(), 0.01);
+}
+
+TEST_F(KalmanBallFilterTest, ball_moved_far_away_is_tracked_again)
+{
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        ball_filter.estimateBallState({createDetection(Point(1, 1), i)},
+                                      field.fieldBoundary());
+    }
+    std::optional<Ball> ball;
+    for (unsigned int i = 10;
+         i < 10 + KalmanBallFilter::MAX_CONSECUTIVE_REJECTED_DETECTIONS + 5; i++)
+    {
+        ball = ball_filter.estimateBallState({createDetection(Point(-3, -2), i)},
+                                             field.fieldBoundary());
+    }
+
+    ASSERT_TRUE(ball);
+    EXPECT_NEAR(-3, ball->position().x(), 0.001);
+    EXPECT_NEAR(-2, ball->position().y(), 0.001);
+    EXPECT_LT(ball->velocity().length(), 0.01);
+}
@@ -0,0 +1,164 @@
+#include "software/sensor_fusion/filter/multi_hypothesis_ball_filter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "software/geom/algorithms/contains.h"
+
+MultiHypothesisBallFilter::MultiHypothesisBallFilter()
+    : tracks(), selected_track_index(std::nullopt), latest_timestamp(std::nullopt)
+{
+}
+
+std::optional<Ball> MultiHypothesisBallFilter::estimateBallState(
+    const std::vector<BallDetection> &new_ball_detections, const Rectangle &filter_area)
+{
+    forEachDetectionInTimestampOrder(
+        new_ball_detections, [this, &filter_area](const BallDetection &detection) {
+            // Ignore any detections outside the filter area
+            if (contains(filter_area, detection.position))
+            {
+                addDetection(detection);
+            }
+        });
+    updateTracks();
+
+    if (!selected_track_index)
+    {
+        return std::nullopt;
+    }
+    return tracks[*selected_track_index]->filter.getBall();
+}
+
+std::vector<BallTrack> MultiHypothesisBallFilter::getTracks() const
+{
+    std::vector<BallTrack> ball_tracks;
+    for (size_t i = 0; i < tracks.size(); i++)
+    {
+        if (tracks[i])
+        {
+            ball_tracks.push_back(BallTrack{*tracks[i]->filter.getBall(),
+                                            getConfidence(*tracks[i], *latest_timestamp),
+                                            selected_track_index == i});
+        }
+    }
+    return ball_tracks;
+}
+
+void MultiHypothesisBallFilter::addDetection(const BallDetection &detection)
+{
+    // Find the track the detection is most likely to belong to
+    std::optional<size_t> closest_track_index;
+    double min_normalized_innovation_squared = MAX_TRACK_NORMALIZED_INNOVATION_SQUARED;
+    for (size_t i = 0; i < tracks.size(); i++)
+    {
+        if (!tracks[i])
+        {
+            continue;
+        }
+        std::optional<double> normalized_innovation_squared =
+            tracks[i]->filter.getNormalizedInnovationSquared(detection);
+        if (normalized_innovation_squared &&
+            *normalized_innovation_squared < min_normalized_innovation_squared)
+        {
+            closest_track_index               = i;
+            min_normalized_innovation_squared = *normalized_innovation_squared;
+        }
+    }
+
+    if (closest_track_index)
+    {
+        Track &track      = *tracks[*closest_track_index];
+        double confidence = getConfidence(track, detection.timestamp);
+        if (track.filter.update(detection))
+        {
+            track.confidence = confidence + detection.confidence;
+        }
+    }
+    else
+    {
+        // Start a new track in an empty slot. If there aren't any, replace the least
+        // confident track other than the selected one
+        std::optional<size_t> new_track_index;
+        for (size_t i = 0; i < tracks.size(); i++)
+        {
+            if (selected_track_index == i)
+            {
+                continue;
+            }
+            if (!tracks[i])
+            {
+                new_track_index = i;
+                break;
+            }
+            if (!new_track_index ||
+                getConfidence(*tracks[i], detection.timestamp) <
+                    getConfidence(*tracks[*new_track_index], detection.timestamp))
+            {
+                new_track_index = i;
+            }
+        }
+
+        tracks[*new_track_index] = Track{KalmanBallFilter(), detection.confidence};
+        tracks[*new_track_index]->filter.update(detection);
+    }
+
+    if (!latest_timestamp || *latest_timestamp < detection.timestamp)
+    {
+        latest_timestamp = detection.timestamp;
+    }
+}
+
+void MultiHypothesisBallFilter::updateTracks()
+{
+    if (!latest_timestamp)
+    {
+        return;
+    }
+
+    // We keep the selected track even if it hasn't been seen for a while (ex. the ball
+    // is hidden behind a robot), since it is still our best guess of where the ball is
+    std::optional<size_t> most_confident_track_index;
+    for (size_t i = 0; i < tracks.size(); i++)
+    {
+        if (!tracks[i])
+        {
+            continue;
+        }
+        if (selected_track_index != i &&
+            (*latest_timestamp - getLatestTimestamp(*tracks[i])).toSeconds() >
+                MAX_TRACK_UNSEEN_DURATION_SECONDS)
+        {
+            tracks[i] = std::nullopt;
+            continue;
+        }
+        if (!most_confident_track_index ||
+            getConfidence(*tracks[i], *latest_timestamp) >
+                getConfidence(*tracks[*most_confident_track_index], *latest_timestamp))
+        {
+            most_confident_track_index = i;
+        }
+    }
+
+    if (!selected_track_index ||
+        getConfidence(*tracks[*most_confident_track_index], *latest_timestamp) >
+            getConfidence(*tracks[*selected_track_index], *latest_timestamp) +
+                TRACK_SWITCH_CONFIDENCE_MARGIN)
+    {
+        selected_track_index = most_confident_track_index;
+    }
+}
+
+double MultiHypothesisBallFilter::getConfidence(const Track &track,
+                                                const Timestamp &timestamp)
+{
+    double unseen_duration =
+        std::max(0.0, (timestamp - getLatestTimestamp(track)).toSeconds());
+    return track.confidence *
+           std::exp(-unseen_duration / TRACK_CONFIDENCE_DECAY_TIME_CONSTANT_SECONDS);
+}
+
+Timestamp MultiHypothesisBallFilter::getLatestTimestamp(const Track &track)
+{
+    return track.filter.getBall()->timestamp();
+}
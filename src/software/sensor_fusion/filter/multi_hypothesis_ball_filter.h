@@ -0,0 +1,139 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "software/geom/rectangle.h"
+#include "software/sensor_fusion/filter/kalman_ball_filter.h"
+#include "software/sensor_fusion/filter/vision_detection.h"
+#include "software/world/ball.h"
+
+/**
+ * A hypothesis of where a ball is, for debugging the MultiHypothesisBallFilter
+ */
+struct BallTrack
+{
+    Ball ball;
+    // How much evidence there is for this ball being real, which grows with each
+    // detection of the ball and decays while the ball isn't seen
+    double confidence;
+    // Whether this is the track the filter currently believes is the real ball
+    bool selected;
+};
+
+/**
+ * Given ball data from SSL Vision, filters and returns the position/velocity of the
+ * "real" ball.
+ *
+ * With overlapping cameras and reflections, vision often sees balls that aren't there.
+ * Rather than throwing away detections that don't fit a single ball, this filter keeps
+ * several hypotheses (tracks) of where a ball might be, each tracked by its own
+ * KalmanBallFilter. Each detection is given to the track it is most likely to belong to,
+ * based on the Mahalanobis distance from where the track predicts its ball to be.
+ * Detections that are too far from every track start a new track, and tracks that
+ * haven't been seen for a while are removed.
+ *
+ * Each track has a confidence that grows with every detection and decays over time, and
+ * the track with the highest confidence is returned as the real ball. To avoid switching
+ * back and forth between similar tracks, another track must be noticeably more
+ * confident than the selected one to replace it.
+ *
+ * The tracks are stored in a fixed-size pool, so updating the filter doesn't allocate
+ * any memory.
+ */
+class MultiHypothesisBallFilter
+{
+   public:
+    // The maximum number of tracks that can exist at once
+    static constexpr unsigned int MAX_NUM_TRACKS = 8;
+    // A detection only belongs to a track if its normalized innovation squared is less
+    // than this. This is the 99.99% quantile of the chi-squared distribution with 2
+    // degrees of freedom
+    static constexpr double MAX_TRACK_NORMALIZED_INNOVATION_SQUARED =
+        KalmanBallFilter::MAX_NORMALIZED_INNOVATION_SQUARED;
+    // The time constant, in seconds, of the exponential decay of a track's confidence
+    // while it isn't being seen
+    static constexpr double TRACK_CONFIDENCE_DECAY_TIME_CONSTANT_SECONDS = 0.05;
+    // How much more confident than the selected track another track must be to be
+    // selected instead
+    static constexpr double TRACK_SWITCH_CONFIDENCE_MARGIN = 0.5;
+    // Tracks that haven't been seen for this long are removed, unless they are the
+    // selected track
+    static constexpr double MAX_TRACK_UNSEEN_DURATION_SECONDS = 0.3;
+
+    /**
+     * Creates a new Multi Hypothesis Ball Filter
+     */
+    explicit MultiHypothesisBallFilter();
+
+    /**
+     * Update the filter with the new ball detection data, and returns the new
+     * estimated state of the ball given the new data
+     *
+     * @param new_ball_detections A list of new Ball detections
+     * @param filter_area The area within which the ball filter will work. Any detections
+     * outside of this area will be ignored.
+     *
+     * @return The new ball based on the estimated state of the ball given the new data.
+     * If a filtered result cannot be calculated, returns std::nullopt
+     */
+    std::optional<Ball> estimateBallState(
+        const std::vector<BallDetection>& new_ball_detections,
+        const Rectangle& filter_area);
+
+    /**
+     * Returns all the tracks the filter currently has, including the selected one. This
+     * is intended for debugging.
+     *
+     * @return The tracks of the filter
+     */
+    std::vector<BallTrack> getTracks() const;
+
+   private:
+    struct Track
+    {
+        KalmanBallFilter filter;
+        // The confidence of the track as of its latest detection
+        double confidence;
+    };
+
+    /**
+     * Gives the detection to the track it most likely belongs to, or starts a new track
+     * from it if it doesn't belong to any track
+     *
+     * @param detection The detection to add
+     */
+    void addDetection(const BallDetection& detection);
+
+    /**
+     * Removes all tracks that haven't been seen for too long, and selects the track that
+     * is most likely to be the real ball
+     */
+    void updateTracks();
+
+    /**
+     * Returns the confidence of the track at the given time, taking into account how
+     * long it has been since the track was seen
+     *
+     * @param track The track
+     * @param timestamp The time to get the confidence at
+     *
+     * @return The confidence of the track at the given time
+     */
+    static double getConfidence(const Track& track, const Timestamp& timestamp);
+
+    /**
+     * Returns the timestamp of the latest detection used by the track
+     *
+     * @param track The track
+     *
+     * @return The timestamp of the latest detection used by the track
+     */
+    static Timestamp getLatestTimestamp(const Track& track);
+
+    std::array<std::optional<Track>, MAX_NUM_TRACKS> tracks;
+    std::optional<size_t> selected_track_index;
+    // The timestamp of the newest detection any track has used
+    std::optional<Timestamp> latest_timestamp;
+};
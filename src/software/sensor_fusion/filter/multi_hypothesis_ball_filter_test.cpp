@@ -0,0 +1,161 @@
+#include "software/sensor_fusion/filter/multi_hypothesis_ball_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/world/field.h"
+
+class MultiHypothesisBallFilterTest : public ::testing::Test
+{
+   protected:
+    MultiHypothesisBallFilterTest()
+        : field(Field::createSSLDivisionBField()),
+          ball_filter(),
+          start_time(Timestamp::fromSeconds(123)),
+          time_step(Duration::fromSeconds(1.0 / 60.0))
+    {
+    }
+
+    /**
+     * Creates a detection of the ball on the ground at the given frame
+     *
+     * @param position The position of the detection
+     * @param frame The number of frames since the start time
+     *
+     * @return the ball detection
+     */
+    BallDetection createDetection(const Point& position, unsigned int frame)
+    {
+        return BallDetection{
+            position, 0.0,
+            start_time + Duration::fromSeconds(frame * time_step.toSeconds()), 0.9};
+    }
+
+    Field field;
+    MultiHypothesisBallFilter ball_filter;
+    Timestamp start_time;
+    Duration time_step;
+};
+
+TEST_F(MultiHypothesisBallFilterTest, no_detections)
+{
+    EXPECT_FALSE(ball_filter.estimateBallState({}, field.fieldBoundary()));
+    EXPECT_TRUE(ball_filter.getTracks().empty());
+}
+
+TEST_F(MultiHypothesisBallFilterTest, detections_outside_filter_area_are_ignored)
+{
+    auto ball = ball_filter.estimateBallState({createDetection(Point(100, 0), 0)},
+                                              field.fieldBoundary());
+
+    EXPECT_FALSE(ball);
+    EXPECT_TRUE(ball_filter.getTracks().empty());
+}
+
+TEST_F(MultiHypothesisBallFilterTest, ghost_ball_does_not_replace_real_ball)
+{
+    // The real ball rolls along the x axis, and after a while a reflection shows up in
+    // another camera and stays there
+    std::optional<Ball> ball;
+    for (unsigned int i = 0; i < 60; i++)
+    {
+        std::vector<BallDetection> detections = {createDetection(Point(i * 0.02, 0), i)};
+        if (i >= 20)
+        {
+            detections.push_back(createDetection(Point(-2, 1.5), i));
+        }
+        ball = ball_filter.estimateBallState(detections, field.fieldBoundary());
+    }
+
+    ASSERT_TRUE(ball);
+    EXPECT_NEAR(59 * 0.02, ball->position().x(), 0.001);
+    EXPECT_NEAR(1.2, ball->velocity().x(), 0.01);
+
+    auto tracks = ball_filter.getTracks();
+    ASSERT_EQ(2, tracks.size());
+    EXPECT_EQ(1, std::count_if(tracks.begin(), tracks.end(),
+                               [](const BallTrack& track) { return track.selected; }));
+}
+
+TEST_F(MultiHypothesisBallFilterTest, switches_to_new_ball_when_old_ball_is_not_seen)
+{
+    for (unsigned int i = 0; i < 30; i++)
+    {
+        ball_filter.estimateBallState({createDetection(Point(1, 1), i)},
+                                      field.fieldBoundary());
+    }
+
+    // The old ball is kept for a few frames until there is enough evidence for the new
+    // one, and then forgotten once it hasn't been seen for a while
+    auto ball = ball_filter.estimateBallState({createDetection(Point(-2, -1), 30)},
+                                              field.fieldBoundary());
+    ASSERT_TRUE(ball);
+    EXPECT_EQ(Point(1, 1), ball->position());
+    for (unsigned int i = 31; i < 60; i++)
+    {
+        ball = ball_filter.estimateBallState({createDetection(Point(-2, -1), i)},
+                                             field.fieldBoundary());
+    }
+
+    ASSERT_TRUE(ball);
+    EXPECT_NEAR(-2, ball->position().x(), 0.001);
+    EXPECT_NEAR(-1, ball->position().y(), 0.001);
+    EXPECT_EQ(1, ball_filter.getTracks().size());
+}
+
+TEST_F(MultiHypothesisBallFilterTest, ball_bouncing_off_robot_is_tracked)
+{
+    // The ball rolls at 3 m/s in the positive x direction, and then bounces back at
+    // 2 m/s
+    std::optional<Ball> ball;
+    for (unsigned int i = 0; i < 30; i++)
+    {
+        ball = ball_filter.estimateBallState(
+            {createDetection(Point(i * 3 * time_step.toSeconds(), 0), i)},
+            field.fieldBoundary());
+    }
+    ASSERT_TRUE(ball);
+    EXPECT_NEAR(3, ball->velocity().x(), 0.01);
+
+    Point bounce_position(29 * 3 * time_step.toSeconds(), 0);
+    for (unsigned int i = 1; i <= 10; i++)
+    {
+        ball = ball_filter.estimateBallState(
+            {createDetection(bounce_position - Vector(i * 2 * time_step.toSeconds(), 0),
+                             29 + i)},
+            field.fieldBoundary());
+    }
+
+    ASSERT_TRUE(ball);
+    EXPECT_NEAR(bounce_position.x() - 20 * time_step.toSeconds(), ball->position().x(),
+                0.001);
+    EXPECT_NEAR(-2, ball->velocity().x(), 0.1);
+}
+
+TEST_F(MultiHypothesisBallFilterTest, number_of_tracks_is_limited)
+{
+    std::mt19937 random_generator(1);
+    std::uniform_real_distribution<double> x_distribution(-4, 4);
+    std::uniform_real_distribution<double> y_distribution(-2.5, 2.5);
+
+    // The real ball sits still while noise shows up all over the field
+    std::optional<Ball> ball;
+    for (unsigned int i = 0; i < 60; i++)
+    {
+        std::vector<BallDetection> detections = {createDetection(Point(0, 0), i)};
+        for (unsigned int j = 0; j < 3; j++)
+        {
+            detections.push_back(createDetection(
+                Point(x_distribution(random_generator), y_distribution(random_generator)),
+                i));
+        }
+        ball = ball_filter.estimateBallState(detections, field.fieldBoundary());
+        EXPECT_LE(ball_filter.getTracks().size(),
+                  MultiHypothesisBallFilter::MAX_NUM_TRACKS);
+    }
+
+    ASSERT_TRUE(ball);
+    EXPECT_NEAR(0, ball->position().x(), 0.001);
+    EXPECT_NEAR(0, ball->position().y(), 0.001);
+}
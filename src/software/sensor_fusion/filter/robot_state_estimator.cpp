@@ -0,0 +1,304 @@
+#include "software/sensor_fusion/filter/robot_state_estimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "shared/constants.h"
+
+RobotStateEstimator::RobotStateEstimator(const RobotDetection &detection,
+                                         Duration expiry_buffer_duration)
+    : robot_id(detection.id),
+      expiry_buffer_duration(expiry_buffer_duration),
+      latest_timestamp(detection.timestamp),
+      linear_state(detection.position.x(), detection.position.y(), 0, 0),
+      linear_covariance(LinearStateCovariance::Zero()),
+      angular_state(detection.orientation.toRadians(), 0),
+      angular_covariance(AngularStateCovariance::Zero()),
+      command(std::nullopt),
+      robot_is_receiving_primitives(true)
+{
+    linear_covariance.topLeftCorner<2, 2>() =
+        Eigen::Matrix2d::Identity() * std::pow(DETECTION_POSITION_STDDEV_METERS, 2);
+    linear_covariance.bottomRightCorner<2, 2>() =
+        Eigen::Matrix2d::Identity() * std::pow(UNKNOWN_VELOCITY_STDDEV, 2);
+    angular_covariance(0, 0) = std::pow(DETECTION_ORIENTATION_STDDEV_RADIANS, 2);
+    angular_covariance(1, 1) = std::pow(UNKNOWN_ANGULAR_VELOCITY_STDDEV, 2);
+}
+
+std::optional<Robot> RobotStateEstimator::getFilteredData(
+    const std::vector<RobotDetection> &new_robot_data)
+{
+    bool robot_detected = false;
+    std::optional<Timestamp> latest_detection_timestamp;
+    forEachDetectionInTimestampOrder(
+        new_robot_data, [this, &robot_detected,
+                         &latest_detection_timestamp](const RobotDetection &detection) {
+            if (detection.id == robot_id && detection.timestamp > latest_timestamp)
+            {
+                update(detection);
+                robot_detected = true;
+            }
+            // to get the latest timestamp of all data points in case there is no data
+            // for this robot id
+            latest_detection_timestamp = detection.timestamp;
+        });
+
+    // if there is no data the duration of expiry_buffer_duration after the latest
+    // detection of the robot, return null. Otherwise remain the same state
+    if (!robot_detected && latest_detection_timestamp &&
+        *latest_detection_timestamp > latest_timestamp + expiry_buffer_duration)
+    {
+        return std::nullopt;
+    }
+    return getRobot();
+}
+
+void RobotStateEstimator::updateCommand(const TbotsProto::Primitive &primitive)
+{
+    const Point position(linear_state(0), linear_state(1));
+    const Angle orientation = Angle::fromRadians(angular_state(0));
+
+    switch (primitive.primitive_case())
+    {
+        case TbotsProto::Primitive::kMove:
+        {
+            // The robot accelerates towards the destination until it needs to slow down
+            // to reach it at the final speed
+            const TbotsProto::MovePrimitive &move = primitive.move();
+            const Vector to_destination =
+                Point(move.destination().x_meters(), move.destination().y_meters()) -
+                position;
+            double speed =
+                std::min(static_cast<double>(move.max_speed_m_per_s()),
+                         std::sqrt(std::pow(move.final_speed_m_per_s(), 2) +
+                                   2 * ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED *
+                                       to_destination.length()));
+
+            double angle_to_final_angle =
+                (Angle::fromRadians(move.final_angle().radians()) - orientation)
+                    .clamp()
+                    .toRadians();
+            double angular_speed =
+                std::min(ROBOT_MAX_ANG_SPEED_RAD_PER_SECOND,
+                         std::sqrt(2 * ROBOT_MAX_ANG_ACCELERATION_RAD_PER_SECOND_SQUARED *
+                                   std::abs(angle_to_final_angle)));
+
+            command = Command{to_destination.normalize(speed),
+                              AngularVelocity::fromRadians(
+                                  std::copysign(angular_speed, angle_to_final_angle)),
+                              latest_timestamp};
+            break;
+        }
+        case TbotsProto::Primitive::kDirectControl:
+        {
+            if (!primitive.direct_control().has_direct_velocity_control())
+            {
+                // We can't tell how fast the robot will move from the wheel speeds
+                // without a model of the wheels
+                command = std::nullopt;
+                break;
+            }
+            // The velocity is relative to the robot
+            const auto &velocity_control =
+                primitive.direct_control().direct_velocity_control();
+            command =
+                Command{Vector(velocity_control.velocity().x_component_meters(),
+                               velocity_control.velocity().y_component_meters())
+                            .rotate(orientation),
+                        AngularVelocity::fromRadians(
+                            velocity_control.angular_velocity().radians_per_second()),
+                        latest_timestamp};
+            break;
+        }
+        case TbotsProto::Primitive::kStop:
+        {
+            if (primitive.stop().stop_type() == TbotsProto::StopPrimitive::COAST)
+            {
+                // The robot slows down by friction, which we don't model
+                command = std::nullopt;
+                break;
+            }
+            command = Command{Vector(), AngularVelocity::zero(), latest_timestamp};
+            break;
+        }
+        case TbotsProto::Primitive::kEstop:
+        {
+            command = Command{Vector(), AngularVelocity::zero(), latest_timestamp};
+            break;
+        }
+        default:
+        {
+            command = std::nullopt;
+        }
+    }
+}
+
+void RobotStateEstimator::updateRobotStatus(const TbotsProto::RobotStatus &robot_status)
+{
+    if (robot_status.has_network_status())
+    {
+        robot_is_receiving_primitives =
+            robot_status.network_status().ms_since_last_primitive_received() <=
+            MAX_COMMAND_AGE_SECONDS * MILLISECONDS_PER_SECOND;
+    }
+}
+
+RobotState RobotStateEstimator::estimateFutureState(
+    const Duration &duration_in_future) const
+{
+    Prediction prediction = predict(latest_timestamp + duration_in_future);
+    return RobotState(Point(prediction.linear_state(0), prediction.linear_state(1)),
+                      Vector(prediction.linear_state(2), prediction.linear_state(3)),
+                      Angle::fromRadians(prediction.angular_state(0)).clamp(),
+                      AngularVelocity::fromRadians(prediction.angular_state(1)));
+}
+
+unsigned int RobotStateEstimator::getRobotId() const
+{
+    return robot_id;
+}
+
+void RobotStateEstimator::update(const RobotDetection &detection)
+{
+    Prediction prediction = predict(detection.timestamp);
+
+    // We only measure the position and orientation of the robot. We use the Joseph form
+    // of the covariance updates since it keeps the covariances symmetric and positive
+    // definite despite rounding errors
+    const Eigen::Vector2d position_innovation =
+        Eigen::Vector2d(detection.position.x(), detection.position.y()) -
+        prediction.linear_state.head<2>();
+    const Eigen::Matrix2d position_measurement_covariance =
+        Eigen::Matrix2d::Identity() * std::pow(DETECTION_POSITION_STDDEV_METERS, 2);
+    const Eigen::Matrix<double, 4, 2> linear_gain =
+        prediction.linear_covariance.leftCols<2>() *
+        (prediction.linear_covariance.topLeftCorner<2, 2>() +
+         position_measurement_covariance)
+            .inverse();
+    LinearStateCovariance linear_reduction = LinearStateCovariance::Identity();
+    linear_reduction.leftCols<2>() -= linear_gain;
+    linear_state = prediction.linear_state + linear_gain * position_innovation;
+    linear_covariance =
+        linear_reduction * prediction.linear_covariance * linear_reduction.transpose() +
+        linear_gain * position_measurement_covariance * linear_gain.transpose();
+
+    // The orientation wraps around, so we use the smallest difference between the
+    // detected and predicted orientations
+    double orientation_innovation =
+        (detection.orientation - Angle::fromRadians(prediction.angular_state(0)))
+            .clamp()
+            .toRadians();
+    double orientation_measurement_variance =
+        std::pow(DETECTION_ORIENTATION_STDDEV_RADIANS, 2);
+    const Eigen::Vector2d angular_gain =
+        prediction.angular_covariance.col(0) /
+        (prediction.angular_covariance(0, 0) + orientation_measurement_variance);
+    AngularStateCovariance angular_reduction = AngularStateCovariance::Identity();
+    angular_reduction.col(0) -= angular_gain;
+    angular_state    = prediction.angular_state + angular_gain * orientation_innovation;
+    angular_state(0) = Angle::fromRadians(angular_state(0)).clamp().toRadians();
+    angular_covariance =
+        angular_reduction * prediction.angular_covariance *
+            angular_reduction.transpose() +
+        angular_gain * orientation_measurement_variance * angular_gain.transpose();
+
+    latest_timestamp = detection.timestamp;
+}
+
+RobotStateEstimator::Prediction RobotStateEstimator::predict(
+    const Timestamp &timestamp) const
+{
+    double time_step = std::max(0.0, (timestamp - latest_timestamp).toSeconds());
+    std::optional<Command> current_command = getCommand(latest_timestamp);
+
+    // Each axis is modelled the same way. If we know the robot's commanded velocity, its
+    // velocity approaches the commanded velocity exponentially, otherwise it stays
+    // constant. The robot is also accelerated by random noise that is constant over the
+    // time step, which moves it by a * t^2 / 2 and changes its velocity by a * t
+    Eigen::Matrix2d axis_transition = Eigen::Matrix2d::Identity();
+    // How much of the commanded velocity is added to the position and velocity
+    Eigen::Vector2d axis_command_gain = Eigen::Vector2d::Zero();
+    if (current_command)
+    {
+        double velocity_decay =
+            std::exp(-time_step / VELOCITY_RESPONSE_TIME_CONSTANT_SECONDS);
+        double velocity_integral =
+            VELOCITY_RESPONSE_TIME_CONSTANT_SECONDS * (1 - velocity_decay);
+        axis_transition << 1, velocity_integral, 0, velocity_decay;
+        axis_command_gain << time_step - velocity_integral, 1 - velocity_decay;
+    }
+    else
+    {
+        axis_transition << 1, time_step, 0, 1;
+    }
+    Eigen::Matrix2d axis_process_noise;
+    axis_process_noise << std::pow(time_step, 4) / 4, std::pow(time_step, 3) / 2,
+        std::pow(time_step, 3) / 2, std::pow(time_step, 2);
+
+    Prediction prediction;
+
+    LinearStateCovariance linear_transition = LinearStateCovariance::Zero();
+    LinearStateCovariance linear_process_noise;
+    double acceleration_variance = std::pow(
+        current_command ? COMMANDED_ACCELERATION_STDDEV : UNCOMMANDED_ACCELERATION_STDDEV,
+        2);
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            // The state is ordered [x, y, vx, vy], so the ith derivative of axis k is
+            // at index 2 * i + k
+            linear_transition.block<2, 2>(2 * i, 2 * j) =
+                Eigen::Matrix2d::Identity() * axis_transition(i, j);
+            linear_process_noise.block<2, 2>(2 * i, 2 * j) = Eigen::Matrix2d::Identity() *
+                                                             axis_process_noise(i, j) *
+                                                             acceleration_variance;
+        }
+    }
+    prediction.linear_state = linear_transition * linear_state;
+    prediction.linear_covariance =
+        linear_transition * linear_covariance * linear_transition.transpose() +
+        linear_process_noise;
+
+    double angular_acceleration_variance =
+        std::pow(current_command ? COMMANDED_ANGULAR_ACCELERATION_STDDEV
+                                 : UNCOMMANDED_ANGULAR_ACCELERATION_STDDEV,
+                 2);
+    prediction.angular_state = axis_transition * angular_state;
+    prediction.angular_covariance =
+        axis_transition * angular_covariance * axis_transition.transpose() +
+        axis_process_noise * angular_acceleration_variance;
+
+    if (current_command)
+    {
+        prediction.linear_state.head<2>() +=
+            axis_command_gain(0) *
+            Eigen::Vector2d(current_command->velocity.x(), current_command->velocity.y());
+        prediction.linear_state.tail<2>() +=
+            axis_command_gain(1) *
+            Eigen::Vector2d(current_command->velocity.x(), current_command->velocity.y());
+        prediction.angular_state +=
+            axis_command_gain * current_command->angular_velocity.toRadians();
+    }
+
+    return prediction;
+}
+
+std::optional<RobotStateEstimator::Command> RobotStateEstimator::getCommand(
+    const Timestamp &timestamp) const
+{
+    if (!command || !robot_is_receiving_primitives ||
+        (timestamp - command->timestamp).toSeconds() > MAX_COMMAND_AGE_SECONDS)
+    {
+        return std::nullopt;
+    }
+    return command;
+}
+
+Robot RobotStateEstimator::getRobot() const
+{
+    return Robot(robot_id, Point(linear_state(0), linear_state(1)),
+                 Vector(linear_state(2), linear_state(3)),
+                 Angle::fromRadians(angular_state(0)),
+                 AngularVelocity::fromRadians(angular_state(1)), latest_timestamp);
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <optional>
+#include <vector>
+
+#include "shared/proto/primitive.pb.h"
+#include "shared/proto/robot_status_msg.pb.h"
+#include "software/sensor_fusion/filter/vision_detection.h"
+#include "software/time/duration.h"
+#include "software/time/timestamp.h"
+#include "software/world/robot.h"
+#include "software/world/robot_state.h"
+
+/**
+ * Estimates the state of a single robot from SSL Vision detections, and predicts where
+ * the robot will be in the future.
+ *
+ * Unlike the RobotFilter, which averages the detections in each frame and takes the
+ * difference between frames as the velocity, this is a Kalman filter that tracks the
+ * position, velocity, orientation, and angular velocity of the robot. Between
+ * detections, the robot is modelled as accelerating towards the velocity it was last
+ * commanded to move at (when we know it, ex. for friendly robots), and as moving at a
+ * constant velocity otherwise.
+ *
+ * Predicting the robot forward lets the AI react to where robots will be when its
+ * primitives are actuated, rather than where they were when the camera frame was
+ * captured.
+ */
+class RobotStateEstimator
+{
+   public:
+    // The standard deviation of the noise in the position of robot detections, in metres
+    static constexpr double DETECTION_POSITION_STDDEV_METERS = 0.002;
+    // The standard deviation of the noise in the orientation of robot detections, in
+    // radians
+    static constexpr double DETECTION_ORIENTATION_STDDEV_RADIANS = 0.02;
+    // The standard deviation of the acceleration of the robot that isn't modelled, in
+    // metres per second squared, when we know what it was commanded to do and when we
+    // don't
+    static constexpr double COMMANDED_ACCELERATION_STDDEV   = 1.0;
+    static constexpr double UNCOMMANDED_ACCELERATION_STDDEV = 4.0;
+    // The standard deviation of the angular acceleration of the robot that isn't
+    // modelled, in radians per second squared, when we know what it was commanded to do
+    // and when we don't
+    static constexpr double COMMANDED_ANGULAR_ACCELERATION_STDDEV   = 5.0;
+    static constexpr double UNCOMMANDED_ANGULAR_ACCELERATION_STDDEV = 20.0;
+    // The time constant, in seconds, of the robot's velocity approaching the commanded
+    // velocity
+    static constexpr double VELOCITY_RESPONSE_TIME_CONSTANT_SECONDS = 0.1;
+    // Commands are ignored if the robot hasn't received a primitive for this long, or if
+    // it has been this long since the command was given, since the robot has probably
+    // stopped following it
+    static constexpr double MAX_COMMAND_AGE_SECONDS = 0.2;
+    // The standard deviation of the velocity of the robot when it is unknown, in metres
+    // per second and radians per second
+    static constexpr double UNKNOWN_VELOCITY_STDDEV         = 2.0;
+    static constexpr double UNKNOWN_ANGULAR_VELOCITY_STDDEV = 10.0;
+
+    /**
+     * Creates a new robot state estimator
+     *
+     * @param detection The first detection of the robot
+     * @param expiry_buffer_duration the time when the robot is determined to be removed
+     * from the field if data about the robot is not received before that time
+     */
+    explicit RobotStateEstimator(const RobotDetection& detection,
+                                 Duration expiry_buffer_duration);
+
+    /**
+     * Updates the estimator given a new set of data, and returns the most up to date
+     * estimate of the Robot.
+     *
+     * @param new_robot_data A list of SSLRobot detections containing new robot data.
+     * The data does not all have to be for a particular Robot, the estimator will only
+     * use the new Robot data that matches the robot id the estimator was constructed
+     * with.
+     *
+     * @return The estimated state of the robot, or std::nullopt if the robot hasn't
+     * been detected for longer than the expiry buffer duration
+     */
+    std::optional<Robot> getFilteredData(
+        const std::vector<RobotDetection>& new_robot_data);
+
+    /**
+     * Updates the velocity the robot is trying to move at from the primitive it was
+     * just sent. The commanded velocity is computed from the robot's current estimated
+     * state, and is used until the next primitive is sent.
+     *
+     * @param primitive The primitive the robot was sent
+     */
+    void updateCommand(const TbotsProto::Primitive& primitive);
+
+    /**
+     * Updates the estimator with the status reported by the robot. Commands are only
+     * used while the robot is receiving primitives.
+     *
+     * @param robot_status The status of the robot
+     */
+    void updateRobotStatus(const TbotsProto::RobotStatus& robot_status);
+
+    /**
+     * Predicts the state of the robot the given amount of time after its latest
+     * detection
+     *
+     * @param duration_in_future The amount of time after the latest detection to
+     * predict the state at
+     *
+     * @return The predicted state of the robot
+     */
+    RobotState estimateFutureState(const Duration& duration_in_future) const;
+
+    /**
+     * Returns the id of the Robot that this estimator is estimating the state of
+     *
+     * @return the id of the Robot that this estimator is estimating the state of
+     */
+    unsigned int getRobotId() const;
+
+   private:
+    // The linear state is [x, y, x velocity, y velocity], and the angular state is
+    // [orientation, angular velocity]
+    using LinearState            = Eigen::Matrix<double, 4, 1>;
+    using LinearStateCovariance  = Eigen::Matrix<double, 4, 4>;
+    using AngularState           = Eigen::Vector2d;
+    using AngularStateCovariance = Eigen::Matrix2d;
+
+    struct Command
+    {
+        Vector velocity;
+        AngularVelocity angular_velocity;
+        Timestamp timestamp;
+    };
+
+    struct Prediction
+    {
+        LinearState linear_state;
+        LinearStateCovariance linear_covariance;
+        AngularState angular_state;
+        AngularStateCovariance angular_covariance;
+    };
+
+    /**
+     * Updates the estimator with a single detection of the robot, ignoring it if it's
+     * not newer than the latest detection
+     *
+     * @param detection The detection of the robot
+     */
+    void update(const RobotDetection& detection);
+
+    /**
+     * Predicts the state of the robot at the given time
+     *
+     * @param timestamp The time to predict the state at
+     *
+     * @return The predicted state of the robot and its covariance
+     */
+    Prediction predict(const Timestamp& timestamp) const;
+
+    /**
+     * Returns the command the robot is following at the given time, if there is one
+     *
+     * @param timestamp The time
+     *
+     * @return The command the robot is following, or std::nullopt if we don't know what
+     * the robot is doing
+     */
+    std::optional<Command> getCommand(const Timestamp& timestamp) const;
+
+    /**
+     * Returns the current estimate of the robot
+     *
+     * @return The current estimate of the robot
+     */
+    Robot getRobot() const;
+
+    unsigned int robot_id;
+    Duration expiry_buffer_duration;
+    Timestamp latest_timestamp;
+    LinearState linear_state;
+    LinearStateCovariance linear_covariance;
+    AngularState angular_state;
+    AngularStateCovariance angular_covariance;
+    std::optional<Command> command;
+    bool robot_is_receiving_primitives;
+};
@@ -0,0 +1,202 @@
+#include "software/sensor_fusion/filter/robot_state_estimator.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+class RobotStateEstimatorTest : public ::testing::Test
+{
+   protected:
+    RobotStateEstimatorTest()
+        : start_time(Timestamp::fromSeconds(10)),
+          time_step(Duration::fromSeconds(1.0 / 60.0)),
+          expiry_buffer_duration(Duration::fromMilliseconds(200))
+    {
+    }
+
+    /**
+     * Creates a detection of robot 0 at the given frame
+     *
+     * @param position The position of the detection
+     * @param orientation The orientation of the detection
+     * @param frame The number of frames since the start time
+     *
+     * @return the robot detection
+     */
+    RobotDetection createDetection(const Point& position, const Angle& orientation,
+                                   unsigned int frame)
+    {
+        return RobotDetection{
+            0, position, orientation, 1.0,
+            start_time + Duration::fromSeconds(frame * time_step.toSeconds())};
+    }
+
+    Timestamp start_time;
+    Duration time_step;
+    Duration expiry_buffer_duration;
+};
+
+TEST_F(RobotStateEstimatorTest, stationary_robot_with_noisy_detections)
+{
+    std::mt19937 random_generator(1);
+    std::normal_distribution<double> position_noise(0, 0.002);
+    std::normal_distribution<double> orientation_noise(0, 0.02);
+
+    RobotStateEstimator estimator(createDetection(Point(1, 2), Angle::quarter(), 0),
+                                  expiry_buffer_duration);
+    std::optional<Robot> robot;
+    for (unsigned int i = 1; i < 120; i++)
+    {
+        robot = estimator.getFilteredData({createDetection(
+            Point(1 + position_noise(random_generator),
+                  2 + position_noise(random_generator)),
+            Angle::quarter() + Angle::fromRadians(orientation_noise(random_generator)),
+            i)});
+    }
+
+    ASSERT_TRUE(robot);
+    EXPECT_LT((robot->position() - Point(1, 2)).length(), 0.002);
+    // Taking the difference between frames would give velocity noise of about 0.17 m/s
+    EXPECT_LT(robot->velocity().length(), 0.1);
+    EXPECT_LT(robot->orientation().minDiff(Angle::quarter()).toRadians(), 0.01);
+    EXPECT_LT(std::abs(robot->angularVelocity().toRadians()), 0.1);
+}
+
+TEST_F(RobotStateEstimatorTest, robot_moving_at_constant_velocity)
+{
+    Vector velocity(1.5, -0.5);
+    RobotStateEstimator estimator(createDetection(Point(0, 0), Angle::zero(), 0),
+                                  expiry_buffer_duration);
+    std::optional<Robot> robot;
+    for (unsigned int i = 1; i < 60; i++)
+    {
+        robot = estimator.getFilteredData({createDetection(
+            Point(velocity * (i * time_step.toSeconds())), Angle::zero(), i)});
+    }
+
+    ASSERT_TRUE(robot);
+    EXPECT_LT((robot->velocity() - velocity).length(), 0.01);
+
+    // Without a command, the robot is predicted to keep moving at the same velocity
+    RobotState future_state = estimator.estimateFutureState(Duration::fromSeconds(0.1));
+    EXPECT_LT((future_state.position() - (robot->position() + velocity * 0.1)).length(),
+              0.002);
+}
+
+TEST_F(RobotStateEstimatorTest, orientation_wraps_around)
+{
+    // The robot spins at 2 rad/s through pi
+    RobotStateEstimator estimator(
+        createDetection(Point(0, 0), Angle::fromRadians(2.5), 0), expiry_buffer_duration);
+    std::optional<Robot> robot;
+    for (unsigned int i = 1; i < 60; i++)
+    {
+        robot = estimator.getFilteredData({createDetection(
+            Point(0, 0), Angle::fromRadians(2.5 + 2 * i * time_step.toSeconds()).clamp(),
+            i)});
+    }
+
+    ASSERT_TRUE(robot);
+    EXPECT_NEAR(2, robot->angularVelocity().toRadians(), 0.05);
+    EXPECT_LT(robot->orientation()
+                  .minDiff(Angle::fromRadians(2.5 + 2 * 59 * time_step.toSeconds()))
+                  .toRadians(),
+              0.01);
+}
+
+TEST_F(RobotStateEstimatorTest, prediction_follows_commanded_velocity)
+{
+    // The robot is facing the positive y axis, so moving forward in its own frame moves
+    // it in the positive y direction
+    RobotStateEstimator estimator(createDetection(Point(0, 0), Angle::quarter(), 0),
+                                  expiry_buffer_duration);
+    estimator.getFilteredData({createDetection(Point(0, 0), Angle::quarter(), 1)});
+
+    TbotsProto::Primitive primitive;
+    auto velocity_control =
+        primitive.mutable_direct_control()->mutable_direct_velocity_control();
+    velocity_control->mutable_velocity()->set_x_component_meters(2);
+    estimator.updateCommand(primitive);
+
+    RobotState future_state = estimator.estimateFutureState(Duration::fromSeconds(0.08));
+    EXPECT_GT(future_state.velocity().y(), 1);
+    EXPECT_NEAR(0, future_state.velocity().x(), 1e-6);
+    EXPECT_GT(future_state.position().y(), 0.04);
+    // The robot can't instantly reach the commanded velocity
+    EXPECT_LT(future_state.velocity().y(), 2);
+}
+
+TEST_F(RobotStateEstimatorTest, prediction_moves_towards_move_primitive_destination)
+{
+    RobotStateEstimator estimator(createDetection(Point(0, 0), Angle::zero(), 0),
+                                  expiry_buffer_duration);
+    estimator.getFilteredData({createDetection(Point(0, 0), Angle::zero(), 1)});
+
+    TbotsProto::Primitive primitive;
+    auto move = primitive.mutable_move();
+    move->mutable_destination()->set_x_meters(-3);
+    move->mutable_destination()->set_y_meters(0);
+    move->mutable_final_angle()->set_radians(0);
+    move->set_max_speed_m_per_s(2);
+    estimator.updateCommand(primitive);
+
+    RobotState future_state = estimator.estimateFutureState(Duration::fromSeconds(0.08));
+    EXPECT_LT(future_state.velocity().x(), -0.5);
+    EXPECT_LT(future_state.position().x(), -0.01);
+    EXPECT_NEAR(0, future_state.position().y(), 1e-6);
+}
+
+TEST_F(RobotStateEstimatorTest, command_ignored_when_robot_is_not_receiving_primitives)
+{
+    RobotStateEstimator estimator(createDetection(Point(0, 0), Angle::zero(), 0),
+                                  expiry_buffer_duration);
+    estimator.getFilteredData({createDetection(Point(0, 0), Angle::zero(), 1)});
+
+    TbotsProto::Primitive primitive;
+    primitive.mutable_direct_control()
+        ->mutable_direct_velocity_control()
+        ->mutable_velocity()
+        ->set_x_component_meters(2);
+    estimator.updateCommand(primitive);
+
+    TbotsProto::RobotStatus robot_status;
+    robot_status.mutable_network_status()->set_ms_since_last_primitive_received(1000);
+    estimator.updateRobotStatus(robot_status);
+
+    RobotState future_state = estimator.estimateFutureState(Duration::fromSeconds(0.08));
+    EXPECT_NEAR(0, future_state.position().x(), 0.001);
+}
+
+TEST_F(RobotStateEstimatorTest, command_expires_if_no_new_primitives_are_sent)
+{
+    RobotStateEstimator estimator(createDetection(Point(0, 0), Angle::zero(), 0),
+                                  expiry_buffer_duration);
+
+    TbotsProto::Primitive primitive;
+    primitive.mutable_direct_control()
+        ->mutable_direct_velocity_control()
+        ->mutable_velocity()
+        ->set_x_component_meters(2);
+    estimator.updateCommand(primitive);
+
+    // The robot isn't moving even though it was commanded to a while ago
+    for (unsigned int i = 1; i < 30; i++)
+    {
+        estimator.getFilteredData({createDetection(Point(0, 0), Angle::zero(), i)});
+    }
+
+    RobotState future_state = estimator.estimateFutureState(Duration::fromSeconds(0.08));
+    EXPECT_NEAR(0, future_state.position().x(), 0.001);
+}
+
+TEST_F(RobotStateEstimatorTest, robot_expires_when_not_detected)
+{
+    RobotStateEstimator estimator(createDetection(Point(0, 0), Angle::zero(), 0),
+                                  expiry_buffer_duration);
+    RobotDetection other_robot_detection = createDetection(Point(1, 1), Angle::zero(), 6);
+    other_robot_detection.id             = 1;
+    EXPECT_TRUE(estimator.getFilteredData({other_robot_detection}));
+
+    other_robot_detection.timestamp = start_time + Duration::fromSeconds(1);
+    EXPECT_FALSE(estimator.getFilteredData({other_robot_detection}));
+}
@@ -0,0 +1,91 @@
+#include "software/sensor_fusion/filter/robot_team_state_estimator.h"
+
+#include "software/constants.h"
+
+RobotTeamStateEstimator::RobotTeamStateEstimator() : robot_state_estimators() {}
+
+Team RobotTeamStateEstimator::getFilteredData(
+    const Team &current_team_state,
+    const std::vector<RobotDetection> &new_robot_detections)
+{
+    // Add estimators for any robot we haven't seen before
+    for (const RobotDetection &detection : new_robot_detections)
+    {
+        if (robot_state_estimators.find(detection.id) == robot_state_estimators.end())
+        {
+            robot_state_estimators.emplace(
+                detection.id, RobotStateEstimator(
+                                  detection, Duration::fromMilliseconds(
+                                                 ROBOT_DEBOUNCE_DURATION_MILLISECONDS)));
+        }
+    }
+
+    // The estimators handle robot expiry (robots disappearing after not being detected
+    // for a while), so we ignore any expired robots
+    std::vector<Robot> new_filtered_robot_data;
+    for (auto &[id, estimator] : robot_state_estimators)
+    {
+        auto data = estimator.getFilteredData(new_robot_detections);
+        if (data)
+        {
+            new_filtered_robot_data.emplace_back(*data);
+        }
+    }
+
+    Team new_team_state = current_team_state;
+    new_team_state.updateRobots(new_filtered_robot_data);
+
+    // Using the most recent timestamp for the team, remove any robots that have not
+    // been detected for a while
+    auto most_recent_team_timestamp = new_team_state.timestamp();
+    if (most_recent_team_timestamp)
+    {
+        new_team_state.removeExpiredRobots(*most_recent_team_timestamp);
+    }
+
+    return new_team_state;
+}
+
+void RobotTeamStateEstimator::updateCommands(
+    const TbotsProto::PrimitiveSet &primitive_set)
+{
+    for (const auto &[id, primitive] : primitive_set.robot_primitives())
+    {
+        auto iter = robot_state_estimators.find(id);
+        if (iter != robot_state_estimators.end())
+        {
+            iter->second.updateCommand(primitive);
+        }
+    }
+}
+
+void RobotTeamStateEstimator::updateRobotStatus(
+    const TbotsProto::RobotStatus &robot_status)
+{
+    auto iter = robot_state_estimators.find(robot_status.robot_id());
+    if (iter != robot_state_estimators.end())
+    {
+        iter->second.updateRobotStatus(robot_status);
+    }
+}
+
+Team RobotTeamStateEstimator::estimateFutureTeam(const Team &team,
+                                                 const Duration &duration_in_future) const
+{
+    std::vector<Robot> future_robots;
+    for (const Robot &robot : team.getAllRobots())
+    {
+        auto iter = robot_state_estimators.find(robot.id());
+        if (iter != robot_state_estimators.end())
+        {
+            future_robots.emplace_back(
+                robot.id(), iter->second.estimateFutureState(duration_in_future),
+                robot.timestamp() + duration_in_future);
+        }
+    }
+
+    // Updating the robots keeps their other properties, like their capabilities
+    Team future_team = team;
+    future_team.updateRobots(future_robots);
+    return future_team;
+}
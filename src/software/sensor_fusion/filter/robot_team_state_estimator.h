@@ -0,0 +1,67 @@
+#pragma once
+
+#include <map>
+
+#include "shared/proto/robot_status_msg.pb.h"
+#include "shared/proto/tbots_software_msgs.pb.h"
+#include "software/sensor_fusion/filter/robot_state_estimator.h"
+#include "software/world/team.h"
+
+/**
+ * Estimates the state of every robot on a team with a RobotStateEstimator, and predicts
+ * where the team will be in the future. This is used in place of the RobotTeamFilter when
+ * we want to compensate for latency.
+ */
+class RobotTeamStateEstimator
+{
+   public:
+    /**
+     * Creates a new Robot Team State Estimator
+     */
+    explicit RobotTeamStateEstimator();
+
+    /**
+     * Filters the new robot detection data, and returns the updated state of the team
+     * given the new data
+     *
+     * @param current_team_state The current state of the Team
+     * @param new_robot_detections A list of new SSL Robot detections
+     *
+     * @return The updated state of the team given the new data
+     */
+    Team getFilteredData(const Team& current_team_state,
+                         const std::vector<RobotDetection>& new_robot_detections);
+
+    /**
+     * Updates the velocities the robots are trying to move at from the primitives they
+     * were just sent. Robots that aren't in the PrimitiveSet keep following their
+     * previous primitive.
+     *
+     * @param primitive_set The primitives sent to the robots
+     */
+    void updateCommands(const TbotsProto::PrimitiveSet& primitive_set);
+
+    /**
+     * Updates the estimator of a robot with the status it reported
+     *
+     * @param robot_status The status of the robot
+     */
+    void updateRobotStatus(const TbotsProto::RobotStatus& robot_status);
+
+    /**
+     * Predicts the state of the given team the given amount of time after each robot was
+     * last detected
+     *
+     * @param team The team to predict, which should be the latest team returned by
+     * getFilteredData
+     * @param duration_in_future How far into the future to predict the robots
+     *
+     * @return The predicted state of the team
+     */
+    Team estimateFutureTeam(const Team& team, const Duration& duration_in_future) const;
+
+   private:
+    // A map used to store a separate estimator for each robot on this team, so each
+    // robot can be estimated and handled separately
+    std::map<unsigned int, RobotStateEstimator> robot_state_estimators;
+};
@@ -0,0 +1,53 @@
+#include "software/sensor_fusion/filter/robot_team_state_estimator.h"
+
+#include <gtest/gtest.h>
+
+TEST(RobotTeamStateEstimatorTest, detections_update_robots_on_team)
+{
+    Team old_team = Team(Duration::fromMilliseconds(1000));
+    RobotTeamStateEstimator estimator;
+
+    std::vector<RobotDetection> robot_detections;
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        robot_detections.push_back(RobotDetection{i, Point(i, 0), Angle::fromRadians(i),
+                                                  1.0, Timestamp::fromSeconds(1)});
+    }
+    Team new_team = estimator.getFilteredData(old_team, robot_detections);
+
+    EXPECT_EQ(3, new_team.numRobots());
+    for (const RobotDetection& detection : robot_detections)
+    {
+        auto robot = new_team.getRobotById(detection.id);
+        ASSERT_TRUE(robot);
+        EXPECT_EQ(detection.position, robot->position());
+        EXPECT_EQ(detection.orientation, robot->orientation());
+        EXPECT_EQ(detection.timestamp, robot->timestamp());
+    }
+}
+
+TEST(RobotTeamStateEstimatorTest, only_commanded_robots_are_predicted_to_move)
+{
+    Team old_team = Team(Duration::fromMilliseconds(1000));
+    RobotTeamStateEstimator estimator;
+    Team team = estimator.getFilteredData(
+        old_team,
+        {RobotDetection{0, Point(0, 0), Angle::zero(), 1.0, Timestamp::fromSeconds(1)},
+         RobotDetection{1, Point(1, 0), Angle::zero(), 1.0, Timestamp::fromSeconds(1)}});
+
+    TbotsProto::PrimitiveSet primitive_set;
+    TbotsProto::Primitive primitive;
+    primitive.mutable_direct_control()
+        ->mutable_direct_velocity_control()
+        ->mutable_velocity()
+        ->set_x_component_meters(2);
+    (*primitive_set.mutable_robot_primitives())[0] = primitive;
+    estimator.updateCommands(primitive_set);
+
+    Team future_team = estimator.estimateFutureTeam(team, Duration::fromSeconds(0.1));
+
+    ASSERT_EQ(2, future_team.numRobots());
+    EXPECT_GT(future_team.getRobotById(0)->position().x(), 0.05);
+    EXPECT_EQ(Timestamp::fromSeconds(1.1), future_team.getRobotById(0)->timestamp());
+    EXPECT_NEAR(1, future_team.getRobotById(1)->position().x(), 1e-6);
+}
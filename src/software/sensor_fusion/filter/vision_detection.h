@@ -1,5 +1,9 @@
 #pragma once
 
+#include <optional>
+#include <utility>
+#include <vector>
+
 #include "software/geom/angle.h"
 #include "software/geom/point.h"
 #include "software/time/timestamp.h"
@@ -46,3 +50,37 @@ struct BallDetection
         return timestamp < b.timestamp;
     }
 };
+
+/**
+ * Calls the given function with each of the detections from oldest to newest, ordering
+ * detections with the same timestamp by their index. Rather than sorting a copy of the
+ * detections, we repeatedly look for the oldest one we haven't used yet, which doesn't
+ * allocate any memory and is cheap for the few detections in each vision frame
+ *
+ * @param detections The detections to iterate over
+ * @param function The function to call with each detection
+ */
+template <typename DetectionType, typename Function>
+void forEachDetectionInTimestampOrder(const std::vector<DetectionType> &detections,
+                                      Function function)
+{
+    std::optional<std::pair<Timestamp, size_t>> last_used;
+    while (true)
+    {
+        std::optional<std::pair<Timestamp, size_t>> next;
+        for (size_t i = 0; i < detections.size(); i++)
+        {
+            auto key = std::make_pair(detections[i].timestamp, i);
+            if ((!last_used || *last_used < key) && (!next || key < *next))
+            {
+                next = key;
+            }
+        }
+        if (!next)
+        {
+            return;
+        }
+        last_used = next;
+        function(detections[next->second]);
+    }
+}
@@ -11,13 +11,18 @@ SensorFusion::SensorFusion(std::shared_ptr<const SensorFusionConfig> sensor_fusi
       game_state(),
       referee_stage(std::nullopt),
       ball_filter(),
+      kalman_ball_filter(),
+      multi_hypothesis_ball_filter(),
       friendly_team_filter(),
       enemy_team_filter(),
+      friendly_team_state_estimator(),
+      enemy_team_state_estimator(),
       team_with_possession(TeamSide::ENEMY),
       friendly_goalie_id(0),
       enemy_goalie_id(0),
       reset_time_vision_packets_detected(0),
-      last_t_capture(0)
+      last_t_capture(0),
+      pipeline_latency()
 {
     if (!sensor_fusion_config)
     {
@@ -29,7 +34,36 @@ std::optional<World> SensorFusion::getWorld() const
 {
     if (field && ball)
     {
-        World new_world(*field, *ball, friendly_team, enemy_team);
+        Ball world_ball          = *ball;
+        Team world_friendly_team = friendly_team;
+        Team world_enemy_team    = enemy_team;
+        if (sensor_fusion_config->getCompensateForLatency()->value())
+        {
+            // Predict everything forward to when the primitives computed from this
+            // World will be actuated
+            const Duration latency =
+                pipeline_latency +
+                Duration::fromMilliseconds(
+                    sensor_fusion_config->getUnmeasuredLatencyMs()->value());
+            world_ball =
+                Ball(ball->estimateFutureState(latency), ball->timestamp() + latency);
+            if (sensor_fusion_config->getUseRobotStateEstimator()->value())
+            {
+                world_friendly_team = friendly_team_state_estimator.estimateFutureTeam(
+                    friendly_team, latency);
+                world_enemy_team =
+                    enemy_team_state_estimator.estimateFutureTeam(enemy_team, latency);
+            }
+            else
+            {
+                world_friendly_team =
+                    estimateFutureTeamAtConstantVelocity(friendly_team, latency);
+                world_enemy_team =
+                    estimateFutureTeamAtConstantVelocity(enemy_team, latency);
+            }
+        }
+
+        World new_world(*field, world_ball, world_friendly_team, world_enemy_team);
         new_world.updateGameState(game_state);
         new_world.setTeamWithPossession(team_with_possession);
         if (referee_stage)
@@ -99,6 +133,16 @@ void SensorFusion::processSensorProto(const SensorProto &sensor_msg)
     }
 }
 
+void SensorFusion::processPrimitiveSet(const TbotsProto::PrimitiveSet &primitive_set)
+{
+    friendly_team_state_estimator.updateCommands(primitive_set);
+}
+
+void SensorFusion::updatePipelineLatency(const Duration &pipeline_latency)
+{
+    this->pipeline_latency = pipeline_latency;
+}
+
 void SensorFusion::updateWorld(const SSLProto::SSL_WrapperPacket &packet)
 {
     if (packet.has_geometry())
@@ -186,6 +230,7 @@ void SensorFusion::updateWorld(
             }
         }
         friendly_team.setUnavailableRobotCapabilities(robot_id, unavailableCapabilities);
+        friendly_team_state_estimator.updateRobotStatus(robot_status_msg);
     }
 }
 
@@ -281,6 +326,16 @@ std::optional<Ball> SensorFusion::createBall(
 {
     if (field)
     {
+        if (sensor_fusion_config->getUseMultiHypothesisBallFilter()->value())
+        {
+            return multi_hypothesis_ball_filter.estimateBallState(
+                ball_detections, field.value().fieldBoundary());
+        }
+        if (sensor_fusion_config->getUseKalmanBallFilter()->value())
+        {
+            return kalman_ball_filter.estimateBallState(ball_detections,
+                                                        field.value().fieldBoundary());
+        }
         std::optional<Ball> new_ball =
             ball_filter.estimateBallState(ball_detections, field.value().fieldBoundary());
         return new_ball;
@@ -290,6 +345,11 @@ std::optional<Ball> SensorFusion::createBall(
 
 Team SensorFusion::createFriendlyTeam(const std::vector<RobotDetection> &robot_detections)
 {
+    if (sensor_fusion_config->getUseRobotStateEstimator()->value())
+    {
+        return friendly_team_state_estimator.getFilteredData(friendly_team,
+                                                             robot_detections);
+    }
     Team new_friendly_team =
         friendly_team_filter.getFilteredData(friendly_team, robot_detections);
     return new_friendly_team;
@@ -297,6 +357,10 @@ Team SensorFusion::createFriendlyTeam(const std::vector<RobotDetection> &robot_d
 
 Team SensorFusion::createEnemyTeam(const std::vector<RobotDetection> &robot_detections)
 {
+    if (sensor_fusion_config->getUseRobotStateEstimator()->value())
+    {
+        return enemy_team_state_estimator.getFilteredData(enemy_team, robot_detections);
+    }
     Team new_enemy_team = enemy_team_filter.getFilteredData(enemy_team, robot_detections);
     return new_enemy_team;
 }
@@ -351,14 +415,39 @@ void SensorFusion::checkForVisionReset(double t_capture)
 
 void SensorFusion::resetWorldComponents()
 {
-    field                = std::nullopt;
-    ball                 = std::nullopt;
-    friendly_team        = Team();
-    enemy_team           = Team();
-    game_state           = GameState();
-    referee_stage        = std::nullopt;
-    ball_filter          = BallFilter();
-    friendly_team_filter = RobotTeamFilter();
-    enemy_team_filter    = RobotTeamFilter();
-    team_with_possession = TeamSide::ENEMY;
+    field                         = std::nullopt;
+    ball                          = std::nullopt;
+    friendly_team                 = Team();
+    enemy_team                    = Team();
+    game_state                    = GameState();
+    referee_stage                 = std::nullopt;
+    ball_filter                   = BallFilter();
+    kalman_ball_filter            = KalmanBallFilter();
+    multi_hypothesis_ball_filter  = MultiHypothesisBallFilter();
+    friendly_team_filter          = RobotTeamFilter();
+    enemy_team_filter             = RobotTeamFilter();
+    friendly_team_state_estimator = RobotTeamStateEstimator();
+    enemy_team_state_estimator    = RobotTeamStateEstimator();
+    team_with_possession          = TeamSide::ENEMY;
+}
+
+Team SensorFusion::estimateFutureTeamAtConstantVelocity(
+    const Team &team, const Duration &duration_in_future)
+{
+    const double seconds = duration_in_future.toSeconds();
+    std::vector<Robot> future_robots;
+    for (const Robot &robot : team.getAllRobots())
+    {
+        future_robots.emplace_back(
+            robot.id(),
+            RobotState(robot.position() + robot.velocity() * seconds, robot.velocity(),
+                       robot.orientation() + robot.angularVelocity() * seconds,
+                       robot.angularVelocity()),
+            robot.timestamp() + duration_in_future);
+    }
+
+    // Updating the robots keeps their other properties, like their capabilities
+    Team future_team = team;
+    future_team.updateRobots(future_robots);
+    return future_team;
 }
@@ -3,12 +3,16 @@
 #include <google/protobuf/repeated_field.h>
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
+#include "shared/proto/tbots_software_msgs.pb.h"
 #include "software/proto/message_translation/ssl_detection.h"
 #include "software/proto/message_translation/ssl_geometry.h"
 #include "software/proto/message_translation/ssl_referee.h"
 #include "software/proto/sensor_msg.pb.h"
 #include "software/sensor_fusion/filter/ball_filter.h"
+#include "software/sensor_fusion/filter/kalman_ball_filter.h"
+#include "software/sensor_fusion/filter/multi_hypothesis_ball_filter.h"
 #include "software/sensor_fusion/filter/robot_team_filter.h"
+#include "software/sensor_fusion/filter/robot_team_state_estimator.h"
 #include "software/sensor_fusion/filter/vision_detection.h"
 #include "software/world/ball.h"
 #include "software/world/team.h"
@@ -38,10 +42,29 @@ class SensorFusion
      */
     void processSensorProto(const SensorProto &sensor_msg);
 
+    /**
+     * Processes the primitives that were just sent to the friendly robots, which tell
+     * us how the robots are trying to move
+     *
+     * @param primitive_set The primitives sent to the friendly robots
+     */
+    void processPrimitiveSet(const TbotsProto::PrimitiveSet &primitive_set);
+
+    /**
+     * Updates the measured latency from a vision packet being received to the
+     * primitives computed from it being sent, which is used to compensate for latency
+     *
+     * @param pipeline_latency The latency of the pipeline
+     */
+    void updatePipelineLatency(const Duration &pipeline_latency);
+
     /**
      * Returns the most up-to-date world if enough data has been received
      * to create one.
      *
+     * If latency compensation is enabled, the ball and robots are predicted forward to
+     * when the primitives computed from the world are expected to be actuated.
+     *
      * @return the most up-to-date world if enough data has been received
      * to create one.
      */
@@ -125,6 +148,19 @@ class SensorFusion
      */
     static bool teamHasBall(const Team &team, const Ball &ball);
 
+    /**
+     * Predicts the state of the given team the given amount of time after each robot was
+     * last detected, assuming every robot keeps its current velocity and angular
+     * velocity
+     *
+     * @param team The team to predict
+     * @param duration_in_future How far into the future to predict the robots
+     *
+     * @return The predicted state of the team
+     */
+    static Team estimateFutureTeamAtConstantVelocity(const Team &team,
+                                                     const Duration &duration_in_future);
+
     std::shared_ptr<const SensorFusionConfig> sensor_fusion_config;
     std::optional<Field> field;
     std::optional<Ball> ball;
@@ -134,8 +170,12 @@ class SensorFusion
     std::optional<RefereeStage> referee_stage;
 
     BallFilter ball_filter;
+    KalmanBallFilter kalman_ball_filter;
+    MultiHypothesisBallFilter multi_hypothesis_ball_filter;
     RobotTeamFilter friendly_team_filter;
     RobotTeamFilter enemy_team_filter;
+    RobotTeamStateEstimator friendly_team_state_estimator;
+    RobotTeamStateEstimator enemy_team_state_estimator;
 
     TeamSide team_with_possession;
 
@@ -149,4 +189,8 @@ class SensorFusion
 
     // The timestamp, in seconds, of the most recently received vision packet
     double last_t_capture;
+
+    // The measured latency from a vision packet being received to the primitives
+    // computed from it being sent
+    Duration pipeline_latency;
 };
@@ -797,3 +797,39 @@ TEST_F(SensorFusionTest, test_sensor_fusion_reset_behaviour_ignore_bad_packets)
     result = *sensor_fusion.getWorld();
     EXPECT_EQ(initWorld(), result);
 }
+
+TEST_F(SensorFusionTest, latency_compensation_predicts_robots_without_state_estimator)
+{
+    config->getMutableCompensateForLatency()->setValue(true);
+    config->getMutableUseRobotStateEstimator()->setValue(false);
+    config->getMutableUnmeasuredLatencyMs()->setValue(30.0);
+    SensorProto sensor_msg;
+    auto ssl_wrapper_packet =
+        createSSLWrapperPacket(std::move(geom_data), initDetectionFrame());
+    *(sensor_msg.mutable_ssl_vision_msg()) = *ssl_wrapper_packet;
+    sensor_fusion.processSensorProto(sensor_msg);
+    ASSERT_TRUE(sensor_fusion.getWorld());
+    World result = *sensor_fusion.getWorld();
+
+    // The robots were only detected once so they are stationary, but they should still
+    // be predicted forward to the same time as the ball
+    const Timestamp expected_timestamp = current_time + Duration::fromMilliseconds(30);
+    EXPECT_EQ(expected_timestamp, result.ball().timestamp());
+    for (const Team &team : {result.friendlyTeam(), result.enemyTeam()})
+    {
+        ASSERT_FALSE(team.getAllRobots().empty());
+        for (const Robot &robot : team.getAllRobots())
+        {
+            EXPECT_EQ(expected_timestamp, robot.timestamp());
+        }
+    }
+    World expected_world = initWorld();
+    EXPECT_EQ(expected_world.friendlyTeam().getAllRobots().size(),
+              result.friendlyTeam().getAllRobots().size());
+    for (const Robot &robot : expected_world.friendlyTeam().getAllRobots())
+    {
+        auto predicted_robot = result.friendlyTeam().getRobotById(robot.id());
+        ASSERT_TRUE(predicted_robot);
+        EXPECT_EQ(robot.position(), predicted_robot->position());
+    }
+}
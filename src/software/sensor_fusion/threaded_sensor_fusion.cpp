@@ -1,9 +1,14 @@
 #include "software/sensor_fusion/threaded_sensor_fusion.h"
 
+#include "software/tracing/pipeline_tracer.h"
+
 ThreadedSensorFusion::ThreadedSensorFusion(
     std::shared_ptr<const SensorFusionConfig> sensor_fusion_config)
     : FirstInFirstOutThreadedObserver<SensorProto>(DIFFERENT_GRSIM_FRAMES_RECEIVED),
-      sensor_fusion(sensor_fusion_config)
+      FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>(),
+      sensor_fusion_mutex(),
+      sensor_fusion(sensor_fusion_config),
+      latest_trace_id(PipelineTracer::NO_TRACE_ID)
 {
     if (!sensor_fusion_config)
     {
@@ -14,10 +19,41 @@ ThreadedSensorFusion::ThreadedSensorFusion(
 
 void ThreadedSensorFusion::onValueReceived(SensorProto sensor_msg)
 {
-    sensor_fusion.processSensorProto(sensor_msg);
-    std::optional<World> world = sensor_fusion.getWorld();
+    PipelineTracer& tracer = PipelineTracer::getGlobalTracer();
+    if (sensor_msg.trace_id() != PipelineTracer::NO_TRACE_ID)
+    {
+        latest_trace_id = sensor_msg.trace_id();
+    }
+    tracer.startStage(sensor_msg.trace_id(), PipelineStage::SENSOR_FUSION);
+
+    std::optional<World> world;
+    {
+        std::scoped_lock<std::mutex> lock(sensor_fusion_mutex);
+        // The median is used so the latency compensation isn't thrown off by the
+        // occasional slow tick
+        std::optional<double> pipeline_latency_ms =
+            tracer.getEndToEndLatencyPercentileMs(50);
+        if (pipeline_latency_ms)
+        {
+            sensor_fusion.updatePipelineLatency(
+                Duration::fromMilliseconds(*pipeline_latency_ms));
+        }
+        sensor_fusion.processSensorProto(sensor_msg);
+        world = sensor_fusion.getWorld();
+    }
+
+    // The stage ends before the World is sent, so the time the AI takes to pick it up
+    // is counted as queueing
+    tracer.endStage(sensor_msg.trace_id(), PipelineStage::SENSOR_FUSION);
     if (world)
     {
+        world->setTraceId(latest_trace_id);
         Subject<World>::sendValueToObservers(world.value());
     }
 }
+
+void ThreadedSensorFusion::onValueReceived(TbotsProto::PrimitiveSet primitive_set)
+{
+    std::scoped_lock<std::mutex> lock(sensor_fusion_mutex);
+    sensor_fusion.processPrimitiveSet(primitive_set);
+}
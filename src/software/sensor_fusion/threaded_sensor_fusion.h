@@ -1,14 +1,19 @@
 #pragma once
 
+#include <mutex>
+
 #include "shared/parameter/cpp_dynamic_parameters.h"
+#include "shared/proto/tbots_software_msgs.pb.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
 #include "software/multithreading/subject.h"
 #include "software/proto/sensor_msg.pb.h"
 #include "software/sensor_fusion/sensor_fusion.h"
 #include "software/world/world.h"
 
-class ThreadedSensorFusion : public Subject<World>,
-                             public FirstInFirstOutThreadedObserver<SensorProto>
+class ThreadedSensorFusion
+    : public Subject<World>,
+      public FirstInFirstOutThreadedObserver<SensorProto>,
+      public FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>
 {
    public:
     explicit ThreadedSensorFusion(
@@ -17,7 +22,13 @@ class ThreadedSensorFusion : public Subject<World>,
 
    private:
     void onValueReceived(SensorProto sensor_msg) override;
+    void onValueReceived(TbotsProto::PrimitiveSet primitive_set) override;
 
+    // SensorProtos and PrimitiveSets are received on different threads
+    std::mutex sensor_fusion_mutex;
     SensorFusion sensor_fusion;
+    // The trace of the most recent vision packet, which is carried by every World
+    // until the next vision packet arrives
+    uint64_t latest_trace_id;
     static constexpr size_t DIFFERENT_GRSIM_FRAMES_RECEIVED = 4;
 };
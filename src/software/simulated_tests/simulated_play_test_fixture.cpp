@@ -65,11 +65,11 @@ void SimulatedPlayTestFixture::updatePrimitives(
 
     auto start_tick_time = std::chrono::system_clock::now();
 
-    auto primitive_set_msg = ai.getPrimitives(world_with_updated_game_state);
-    double duration_ms     = ::TestUtil::millisecondsSince(start_tick_time);
+    const auto& primitive_set_msg = ai.getPrimitives(world_with_updated_game_state);
+    double duration_ms            = ::TestUtil::millisecondsSince(start_tick_time);
     registerTickTime(duration_ms);
     simulator_to_update->setYellowRobotPrimitiveSet(
-        createNanoPbPrimitiveSet(*primitive_set_msg));
+        createNanoPbPrimitiveSet(primitive_set_msg));
 }
 
 std::optional<PlayInfo> SimulatedPlayTestFixture::getPlayInfo()
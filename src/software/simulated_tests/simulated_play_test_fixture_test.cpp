@@ -238,3 +238,23 @@ TEST_F(SimulatedPlayTestFixtureTest,
             terminating_validation_functions, non_terminating_validation_functions,
             Duration::fromSeconds(1.5));
 }
+
+TEST_F(SimulatedPlayTestFixtureTest, test_passes_if_ticks_are_within_allocation_budget)
+{
+    BallState ball_state(Point(0, 0), Vector(0, 0));
+    setMaxAllocationsPerTick(std::numeric_limits<uint64_t>::max());
+
+    runTest(field, ball_state, friendly_robots, enemy_robots, {}, {},
+            Duration::fromSeconds(0.5));
+}
+
+TEST_F(SimulatedPlayTestFixtureTest, test_fails_if_ticks_exceed_allocation_budget)
+{
+    BallState ball_state(Point(0, 0), Vector(0, 0));
+    // Every tick copies the World, so no tick can be free of allocations
+    setMaxAllocationsPerTick(0);
+
+    EXPECT_NONFATAL_FAILURE(runTest(field, ball_state, friendly_robots, enemy_robots, {},
+                                    {}, Duration::fromSeconds(0.5)),
+                            "heap allocations");
+}
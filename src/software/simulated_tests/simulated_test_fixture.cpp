@@ -2,6 +2,7 @@
 
 #include <cstdlib>
 #include <experimental/filesystem>
+#include <sstream>
 
 #include "software/logger/logger.h"
 #include "software/proto/message_translation/ssl_wrapper.h"
@@ -66,6 +67,14 @@ void SimulatedTestFixture::SetUp()
     // all tick times should be less than the max value of a double
     min_tick_duration = std::numeric_limits<double>::max();
     tick_count        = 0;
+
+    // Reset allocation trackers
+    max_allocations_per_tick = std::nullopt;
+    total_tick_allocations   = 0;
+    max_tick_allocations     = AllocationStats();
+    max_tick_allocation_call_sites.clear();
+    num_ticks_over_allocation_budget = 0;
+    allocation_tick_count            = 0;
 }
 
 void SimulatedTestFixture::enableVisualizer()
@@ -236,6 +245,35 @@ void SimulatedTestFixture::runTest(
     LOG(INFO) << "min tick duration: " << min_tick_duration << "ms" << std::endl;
     LOG(INFO) << "avg tick duration: " << avg_tick_duration << "ms" << std::endl;
 
+    if (allocation_tick_count > 0)
+    {
+        LOG(INFO) << "max tick allocations: " << max_tick_allocations.num_allocations
+                  << " (" << max_tick_allocations.allocated_bytes << " bytes)"
+                  << std::endl;
+        LOG(INFO) << "avg tick allocations: "
+                  << static_cast<double>(total_tick_allocations) / allocation_tick_count
+                  << std::endl;
+    }
+
+    if (num_ticks_over_allocation_budget > 0)
+    {
+        std::stringstream failure_message;
+        failure_message << num_ticks_over_allocation_budget << " of "
+                        << allocation_tick_count << " ticks made more than "
+                        << *max_allocations_per_tick
+                        << " heap allocations. The worst tick made "
+                        << max_tick_allocations.num_allocations << " allocations ("
+                        << max_tick_allocations.allocated_bytes
+                        << " bytes), most of them from:\n";
+        for (const auto &call_site : max_tick_allocation_call_sites)
+        {
+            failure_message << "    " << call_site.name << ": "
+                            << call_site.stats.num_allocations << " allocations ("
+                            << call_site.stats.allocated_bytes << " bytes)\n";
+        }
+        ADD_FAILURE() << failure_message.str();
+    }
+
     if (!validation_functions_done && !terminating_validation_functions.empty())
     {
         std::string failure_message =
@@ -251,6 +289,36 @@ void SimulatedTestFixture::runTest(
     }
 }
 
+void SimulatedTestFixture::setMaxAllocationsPerTick(uint64_t max_allocations)
+{
+    if (!AllocationTracker::isHookInstalled())
+    {
+        FAIL() << "Allocations can't be tracked, since the allocation tracking operator "
+                  "new is not linked into this test";
+    }
+    max_allocations_per_tick = max_allocations;
+    mutable_thunderbots_config->getMutableAiControlConfig()
+        ->getMutableTrackAiAllocations()
+        ->setValue(true);
+}
+
+void SimulatedTestFixture::registerTickAllocations(
+    const AllocationStats &tick_allocations, std::vector<AllocationCallSite> call_sites)
+{
+    total_tick_allocations += tick_allocations.num_allocations;
+    allocation_tick_count++;
+    if (tick_allocations.num_allocations > max_tick_allocations.num_allocations)
+    {
+        max_tick_allocations           = tick_allocations;
+        max_tick_allocation_call_sites = std::move(call_sites);
+    }
+    if (max_allocations_per_tick &&
+        tick_allocations.num_allocations > *max_allocations_per_tick)
+    {
+        num_ticks_over_allocation_budget++;
+    }
+}
+
 void SimulatedTestFixture::registerTickTime(double tick_time_ms)
 {
     total_tick_duration += tick_time_ms;
@@ -282,8 +350,26 @@ bool SimulatedTestFixture::tickTest(Duration simulation_time_step, Duration ai_t
             return validation_functions_done;
         }
 
+        const bool track_allocations =
+            thunderbots_config->getAiControlConfig()->getTrackAiAllocations()->value();
+        AllocationTracker::setEnabled(track_allocations);
+        const AllocationStats start_allocation_stats =
+            AllocationTracker::getThreadAllocationStats();
+        if (track_allocations)
+        {
+            AllocationTracker::startRecordingCallSites();
+        }
+
         updatePrimitives(*world_opt, simulator);
 
+        if (track_allocations)
+        {
+            registerTickAllocations(
+                AllocationTracker::getThreadAllocationStats() - start_allocation_stats,
+                AllocationTracker::stopRecordingCallSites(
+                    NUM_ALLOCATION_CALL_SITES_TO_REPORT));
+        }
+
         if (run_simulation_in_realtime)
         {
             sleep(wall_start_time, ai_time_step);
@@ -2,6 +2,7 @@
 
 #include "shared/test_util/tbots_gtest_main.h"
 #include "software/ai/hl/stp/play/halt_play.h"
+#include "software/ai/profiler/allocation_tracker.h"
 #include "software/gui/full_system/threaded_full_system_gui.h"
 #include "software/proto/logging/proto_logger.h"
 #include "software/sensor_fusion/sensor_fusion.h"
@@ -89,6 +90,15 @@ class SimulatedTestFixture : public ::testing::Test
      */
     void registerTickTime(double tick_time_ms);
 
+    /**
+     * Fails the test if any AI tick makes more than the given number of heap
+     * allocations, reporting the functions that allocated the most during the worst
+     * tick. This turns on allocation tracking for the test
+     *
+     * @param max_allocations The maximum number of heap allocations each tick can make
+     */
+    void setMaxAllocationsPerTick(uint64_t max_allocations);
+
     // The dynamic params being used in the tests
     std::shared_ptr<ThunderbotsConfig> mutable_thunderbots_config;
     std::shared_ptr<const ThunderbotsConfig> thunderbots_config;
@@ -107,6 +117,16 @@ class SimulatedTestFixture : public ::testing::Test
     bool tickTest(Duration simulation_time_step, Duration ai_time_step,
                   std::shared_ptr<World> world, std::shared_ptr<Simulator> simulator);
 
+    /**
+     * Registers the heap allocations made by a tick for calculating allocation
+     * statistics, and checks them against the allocation budget
+     *
+     * @param tick_allocations The heap allocations made by the tick
+     * @param call_sites The call sites that made the most allocations during the tick
+     */
+    void registerTickAllocations(const AllocationStats &tick_allocations,
+                                 std::vector<AllocationCallSite> call_sites);
+
     /**
      * A helper function that updates SensorFusion with the latest data from the Simulator
      *
@@ -201,6 +221,23 @@ class SimulatedTestFixture : public ::testing::Test
     // Total number of ticks registered
     unsigned int tick_count;
 
+    // These variables track the heap allocations made by each tick when allocation
+    // tracking is enabled
+    // The maximum number of heap allocations each tick can make, if there is a budget
+    std::optional<uint64_t> max_allocations_per_tick;
+    // Total number of heap allocations made by all ticks registered
+    uint64_t total_tick_allocations;
+    // The allocations made by the tick that made the most, and its top call sites
+    AllocationStats max_tick_allocations;
+    std::vector<AllocationCallSite> max_tick_allocation_call_sites;
+    // Number of ticks registered that made more allocations than the budget allows
+    unsigned int num_ticks_over_allocation_budget;
+    // Total number of ticks with allocations registered
+    unsigned int allocation_tick_count;
+
+    // The number of call sites to report for the tick that made the most allocations
+    static constexpr std::size_t NUM_ALLOCATION_CALL_SITES_TO_REPORT = 10;
+
     // The rate at which camera data will be simulated and given to SensorFusion.
     // Each sequential "camera frame" will be 1 / SIMULATED_CAMERA_FPS time step
     // ahead of the previous one
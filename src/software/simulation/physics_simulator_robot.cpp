@@ -421,6 +421,16 @@ void PhysicsSimulatorRobot::clearBallInDribblerArea()
     ball_in_dribbler_area = std::nullopt;
 }
 
+bool PhysicsSimulatorRobot::isBallInDribblerArea() const
+{
+    return ball_in_dribbler_area.has_value();
+}
+
+std::weak_ptr<PhysicsRobot> PhysicsSimulatorRobot::getPhysicsRobot() const
+{
+    return physics_robot;
+}
+
 void PhysicsSimulatorRobot::applyDribblerForce(PhysicsRobot *physics_robot,
                                                PhysicsBall *physics_ball)
 {
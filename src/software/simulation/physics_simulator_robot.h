@@ -32,6 +32,20 @@ class PhysicsSimulatorRobot : public ForceWheelSimulatorRobot
      */
     void clearBallInDribblerArea();
 
+    /**
+     * Returns true if the ball is in this robot's dribbler area
+     *
+     * @return true if the ball is in this robot's dribbler area
+     */
+    bool isBallInDribblerArea() const;
+
+    /**
+     * Returns the PhysicsRobot this robot is simulating
+     *
+     * @return the PhysicsRobot this robot is simulating
+     */
+    std::weak_ptr<PhysicsRobot> getPhysicsRobot() const;
+
    protected:
     float getPositionX() override;
 
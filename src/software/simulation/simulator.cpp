@@ -71,8 +71,32 @@ void Simulator::updateSimulatorRobots(
         simulator_robots,
     TeamColour team_colour)
 {
+    // Stop simulating robots that are no longer in the physics world
+    for (auto iter = simulator_robots.begin(); iter != simulator_robots.end();)
+    {
+        if (iter->first->getPhysicsRobot().expired())
+        {
+            iter = simulator_robots.erase(iter);
+        }
+        else
+        {
+            iter++;
+        }
+    }
+
     for (const auto& physics_robot : physics_robots)
     {
+        bool already_simulated =
+            std::any_of(simulator_robots.begin(), simulator_robots.end(),
+                        [&physics_robot](const auto& robot_world_pair) {
+                            return robot_world_pair.first->getPhysicsRobot().lock() ==
+                                   physics_robot.lock();
+                        });
+        if (already_simulated)
+        {
+            continue;
+        }
+
         auto simulator_robot = std::make_shared<PhysicsSimulatorRobot>(physics_robot);
 
         // we initialize the logger with the appropriate logging function based
@@ -327,6 +351,61 @@ void Simulator::addBlueRobot(const Point& position)
 void Simulator::removeRobot(std::weak_ptr<PhysicsRobot> robot)
 {
     physics_world.removeRobot(robot);
+    updateSimulatorRobots(physics_world.getYellowPhysicsRobots(), yellow_simulator_robots,
+                          TeamColour::YELLOW);
+    updateSimulatorRobots(physics_world.getBluePhysicsRobots(), blue_simulator_robots,
+                          TeamColour::BLUE);
+}
+
+std::weak_ptr<PhysicsRobot> Simulator::getYellowRobotWithId(RobotId id) const
+{
+    return getRobotWithId(id, physics_world.getYellowPhysicsRobots());
+}
+
+std::weak_ptr<PhysicsRobot> Simulator::getBlueRobotWithId(RobotId id) const
+{
+    return getRobotWithId(id, physics_world.getBluePhysicsRobots());
+}
+
+bool Simulator::isBallInYellowRobotDribbler(RobotId id) const
+{
+    return isBallInRobotDribbler(id, yellow_simulator_robots);
+}
+
+bool Simulator::isBallInBlueRobotDribbler(RobotId id) const
+{
+    return isBallInRobotDribbler(id, blue_simulator_robots);
+}
+
+std::weak_ptr<PhysicsRobot> Simulator::getRobotWithId(
+    RobotId id, const std::vector<std::weak_ptr<PhysicsRobot>>& physics_robots)
+{
+    for (const auto& physics_robot : physics_robots)
+    {
+        if (auto robot = physics_robot.lock())
+        {
+            if (robot->getRobotId() == id)
+            {
+                return physics_robot;
+            }
+        }
+    }
+    return std::weak_ptr<PhysicsRobot>();
+}
+
+bool Simulator::isBallInRobotDribbler(
+    RobotId id, const std::map<std::shared_ptr<PhysicsSimulatorRobot>,
+                               std::shared_ptr<FirmwareWorld_t>>& simulator_robots)
+{
+    for (const auto& robot_world_pair : simulator_robots)
+    {
+        auto physics_robot = robot_world_pair.first->getPhysicsRobot().lock();
+        if (physics_robot && physics_robot->getRobotId() == id)
+        {
+            return robot_world_pair.first->isBallInDribblerArea();
+        }
+    }
+    return false;
 }
 
 void Simulator::resetCurrentFirmwareTime()
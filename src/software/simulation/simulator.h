@@ -169,6 +169,29 @@ class Simulator
      */
     void removeRobot(std::weak_ptr<PhysicsRobot> robot);
 
+    /**
+     * Returns the PhysicsRobot with the given id on the corresponding team
+     *
+     * @param id The id of the robot to get
+     *
+     * @return a weak_ptr to the PhysicsRobot with the given id if one exists,
+     * otherwise returns an empty pointer
+     */
+    std::weak_ptr<PhysicsRobot> getYellowRobotWithId(RobotId id) const;
+    std::weak_ptr<PhysicsRobot> getBlueRobotWithId(RobotId id) const;
+
+    /**
+     * Returns true if the ball is in the dribbler area of the robot with the given id
+     * on the corresponding team
+     *
+     * @param id The id of the robot to check
+     *
+     * @return true if the robot exists and the ball is in its dribbler area, and false
+     * otherwise
+     */
+    bool isBallInYellowRobotDribbler(RobotId id) const;
+    bool isBallInBlueRobotDribbler(RobotId id) const;
+
     /**
      * Resets the current firmware time to 0
      */
@@ -187,7 +210,10 @@ class Simulator
     static float getCurrentFirmwareTimeSeconds();
 
     /**
-     * Updates the given simulator_robots to contain and control the given physics_robots
+     * Updates the given simulator_robots to contain and control the given
+     * physics_robots. Robots that are already being simulated keep their current
+     * primitive, and simulator robots for robots that have been removed from the
+     * physics world are removed.
      *
      * @param physics_robots The physics robots to add to the simulator robots
      * @param simulator_robots The simulator robots to add the physics robots to
@@ -215,6 +241,31 @@ class Simulator
         const std::shared_ptr<PhysicsSimulatorBall>& simulator_ball,
         FieldSide defending_side);
 
+    /**
+     * Returns true if the ball is in the dribbler area of the robot with the given id
+     *
+     * @param id The id of the robot to check
+     * @param simulator_robots The robots to find the robot in
+     *
+     * @return true if the robot exists and the ball is in its dribbler area, and false
+     * otherwise
+     */
+    static bool isBallInRobotDribbler(
+        RobotId id, const std::map<std::shared_ptr<PhysicsSimulatorRobot>,
+                                   std::shared_ptr<FirmwareWorld_t>>& simulator_robots);
+
+    /**
+     * Returns the PhysicsRobot with the given id
+     *
+     * @param id The id of the robot to get
+     * @param physics_robots The robots to find the robot in
+     *
+     * @return a weak_ptr to the PhysicsRobot with the given id if one exists,
+     * otherwise returns an empty pointer
+     */
+    static std::weak_ptr<PhysicsRobot> getRobotWithId(
+        RobotId id, const std::vector<std::weak_ptr<PhysicsRobot>>& physics_robots);
+
     PhysicsWorld physics_world;
     std::shared_ptr<PhysicsSimulatorBall> simulator_ball;
     std::map<std::shared_ptr<PhysicsSimulatorRobot>, std::shared_ptr<FirmwareWorld_t>>
@@ -259,6 +259,49 @@ TEST_F(SimulatorTest, add_blue_robot)
     EXPECT_TRUE(robot.lock());
 }
 
+TEST_F(SimulatorTest, get_robot_with_id)
+{
+    simulator->addYellowRobots({RobotStateWithId{
+        .id          = 3,
+        .robot_state = RobotState(Point(1, 1), Vector(0, 0), Angle::zero(),
+                                  AngularVelocity::zero())}});
+
+    auto robot = simulator->getYellowRobotWithId(3).lock();
+    ASSERT_TRUE(robot);
+    EXPECT_EQ(Point(1, 1), robot->position());
+    EXPECT_FALSE(simulator->getYellowRobotWithId(4).lock());
+    EXPECT_FALSE(simulator->getBlueRobotWithId(3).lock());
+}
+
+TEST_F(SimulatorTest, robot_can_be_added_again_after_being_removed)
+{
+    RobotStateWithId robot_state{
+        .id          = 2,
+        .robot_state = RobotState(Point(0, 0), Vector(0, 0), Angle::zero(),
+                                  AngularVelocity::zero())};
+    simulator->addBlueRobots({robot_state});
+    simulator->removeRobot(simulator->getBlueRobotWithId(2));
+    EXPECT_FALSE(simulator->getBlueRobotWithId(2).lock());
+
+    robot_state.robot_state =
+        RobotState(Point(0.5, 0), Vector(0, 0), Angle::zero(), AngularVelocity::zero());
+    simulator->addBlueRobots({robot_state});
+
+    // The new robot should follow its primitive
+    simulator->setBlueRobotPrimitive(
+        2, createNanoPbPrimitive(*createMovePrimitive(
+               Point(1.5, 0), 0.0, Angle::zero(), DribblerMode::OFF,
+               {AutoChipOrKickMode::OFF, 0}, MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0)));
+    for (unsigned int i = 0; i < 120; i++)
+    {
+        simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+    }
+
+    auto wrapper_packet = simulator->getSSLWrapperPacket();
+    ASSERT_EQ(1, wrapper_packet->detection().robots_blue_size());
+    EXPECT_GT(wrapper_packet->detection().robots_blue(0).x(), 1000.0f);
+}
+
 TEST_F(SimulatorTest, simulation_step_updates_the_ball)
 {
     // A sanity test to make sure stepping the simulation actually updates
@@ -0,0 +1,316 @@
+#include "software/simulation/synchronous_simulator.h"
+
+#include <cmath>
+
+#include "shared/constants.h"
+#include "software/proto/message_translation/primitive_google_to_nanopb_converter.h"
+#include "software/proto/message_translation/tbots_geometry.h"
+
+extern "C"
+{
+#include "firmware/shared/physics.h"
+}
+
+SynchronousSimulator::SynchronousSimulator(
+    const Field& field, std::shared_ptr<const SimulatorConfig> simulator_config,
+    TeamColour controlled_team_colour)
+    : simulator(field, simulator_config), controlled_team_colour(controlled_team_colour)
+{
+    simulator.resetCurrentFirmwareTime();
+}
+
+SSLSimulationProto::SimulationSyncResponse SynchronousSimulator::step(
+    const SSLSimulationProto::SimulationSyncRequest& request)
+{
+    SSLSimulationProto::SimulationSyncResponse response;
+    // The synchronous response has no separate field for errors from the simulator
+    // command, so all errors are reported in the robot control response
+    auto& errors = *response.mutable_robot_control_response()->mutable_errors();
+
+    if (request.has_simulator_command())
+    {
+        const auto& simulator_command = request.simulator_command();
+        if (simulator_command.has_control())
+        {
+            applySimulatorControl(simulator_command.control(), errors);
+        }
+        if (simulator_command.has_config())
+        {
+            addError(errors, UNSUPPORTED_CONFIG_ERROR,
+                     "The simulator can't be reconfigured while it is running");
+        }
+    }
+
+    for (const auto& robot_command : request.robot_control().robot_commands())
+    {
+        applyRobotCommand(robot_command, errors);
+    }
+
+    if (request.sim_step() < 0.0f || !std::isfinite(request.sim_step()))
+    {
+        addError(errors, INVALID_SIM_STEP_ERROR,
+                 "sim_step must be a finite, non-negative number of seconds");
+    }
+    else if (request.sim_step() > 0.0f)
+    {
+        simulator.stepSimulation(Duration::fromSeconds(request.sim_step()));
+    }
+
+    *response.add_detection() = simulator.getSSLWrapperPacket()->detection();
+    addRobotFeedback(*response.mutable_robot_control_response());
+
+    return response;
+}
+
+void SynchronousSimulator::applySimulatorControl(
+    const SSLSimulationProto::SimulatorControl& control,
+    google::protobuf::RepeatedPtrField<SSLSimulationProto::SimulatorError>& errors)
+{
+    if (control.has_teleport_ball())
+    {
+        teleportBall(control.teleport_ball(), errors);
+    }
+
+    for (const auto& teleport_robot : control.teleport_robot())
+    {
+        teleportRobot(teleport_robot, errors);
+    }
+
+    if (control.has_simulation_speed())
+    {
+        addError(errors, UNSUPPORTED_SIMULATION_SPEED_ERROR,
+                 "The simulation speed is set by the sim_step of each request");
+    }
+}
+
+void SynchronousSimulator::teleportBall(
+    const SSLSimulationProto::TeleportBall& teleport_ball,
+    google::protobuf::RepeatedPtrField<SSLSimulationProto::SimulatorError>& errors)
+{
+    if (teleport_ball.by_force())
+    {
+        addError(errors, UNSUPPORTED_BY_FORCE_ERROR,
+                 "The ball can only be teleported directly");
+        return;
+    }
+
+    Point current_position = simulator.getWorld().ball().position();
+    Point position(teleport_ball.has_x() ? teleport_ball.x() : current_position.x(),
+                   teleport_ball.has_y() ? teleport_ball.y() : current_position.y());
+    simulator.setBallState(
+        BallState(position, Vector(teleport_ball.vx(), teleport_ball.vy())));
+}
+
+void SynchronousSimulator::teleportRobot(
+    const SSLSimulationProto::TeleportRobot& teleport_robot,
+    google::protobuf::RepeatedPtrField<SSLSimulationProto::SimulatorError>& errors)
+{
+    const auto& robot_id = teleport_robot.id();
+    if (!robot_id.has_id() || robot_id.team() == SSLProto::Team::UNKNOWN)
+    {
+        addError(errors, INVALID_ROBOT_ID_ERROR,
+                 "TeleportRobot must set the id and team of the robot");
+        return;
+    }
+    if (teleport_robot.by_force())
+    {
+        addError(errors, UNSUPPORTED_BY_FORCE_ERROR,
+                 "Robots can only be teleported directly");
+        return;
+    }
+
+    TeamColour team_colour =
+        robot_id.team() == SSLProto::Team::YELLOW ? TeamColour::YELLOW : TeamColour::BLUE;
+    auto existing_robot = getRobot(team_colour, robot_id.id()).lock();
+
+    if (teleport_robot.has_present() && !teleport_robot.present())
+    {
+        if (existing_robot)
+        {
+            simulator.removeRobot(existing_robot);
+        }
+        return;
+    }
+
+    if (!existing_robot && !teleport_robot.present())
+    {
+        addError(errors, INVALID_ROBOT_ID_ERROR,
+                 "Robot " + std::to_string(robot_id.id()) +
+                     " does not exist. Set present to add it");
+        return;
+    }
+
+    Point current_position = existing_robot ? existing_robot->position() : Point(0, 0);
+    Angle current_orientation =
+        existing_robot ? existing_robot->orientation() : Angle::zero();
+    RobotState robot_state(
+        Point(teleport_robot.has_x() ? teleport_robot.x() : current_position.x(),
+              teleport_robot.has_y() ? teleport_robot.y() : current_position.y()),
+        Vector(teleport_robot.v_x(), teleport_robot.v_y()),
+        teleport_robot.has_orientation()
+            ? Angle::fromRadians(teleport_robot.orientation())
+            : current_orientation,
+        AngularVelocity::fromRadians(teleport_robot.v_angular()));
+
+    // Robots can only be added with a velocity, so existing robots are replaced
+    if (existing_robot)
+    {
+        simulator.removeRobot(existing_robot);
+    }
+
+    RobotStateWithId robot_state_with_id{.id = robot_id.id(), .robot_state = robot_state};
+    if (team_colour == TeamColour::YELLOW)
+    {
+        simulator.addYellowRobots({robot_state_with_id});
+    }
+    else
+    {
+        simulator.addBlueRobots({robot_state_with_id});
+    }
+}
+
+void SynchronousSimulator::applyRobotCommand(
+    const SSLSimulationProto::RobotCommand& robot_command,
+    google::protobuf::RepeatedPtrField<SSLSimulationProto::SimulatorError>& errors)
+{
+    auto robot = getRobot(controlled_team_colour, robot_command.id()).lock();
+    if (!robot)
+    {
+        addError(errors, INVALID_ROBOT_ID_ERROR,
+                 "Robot " + std::to_string(robot_command.id()) + " does not exist");
+        return;
+    }
+
+    auto primitive = createPrimitive(robot_command, robot->orientation());
+    if (!primitive)
+    {
+        addError(errors, INVALID_MOVE_COMMAND_ERROR,
+                 "The move command for robot " + std::to_string(robot_command.id()) +
+                     " does not set a command");
+        return;
+    }
+
+    if (controlled_team_colour == TeamColour::YELLOW)
+    {
+        simulator.setYellowRobotPrimitive(robot_command.id(),
+                                          createNanoPbPrimitive(primitive.value()));
+    }
+    else
+    {
+        simulator.setBlueRobotPrimitive(robot_command.id(),
+                                        createNanoPbPrimitive(primitive.value()));
+    }
+}
+
+void SynchronousSimulator::addRobotFeedback(
+    SSLSimulationProto::RobotControlResponse& robot_control_response) const
+{
+    World world = simulator.getWorld();
+    // The simulator reports the yellow team as the friendly team
+    const Team& team = controlled_team_colour == TeamColour::YELLOW ? world.friendlyTeam()
+                                                                    : world.enemyTeam();
+    for (const auto& robot : team.getAllRobots())
+    {
+        auto feedback = robot_control_response.add_feedback();
+        feedback->set_id(robot.id());
+        feedback->set_dribbler_ball_contact(
+            controlled_team_colour == TeamColour::YELLOW
+                ? simulator.isBallInYellowRobotDribbler(robot.id())
+                : simulator.isBallInBlueRobotDribbler(robot.id()));
+    }
+}
+
+std::weak_ptr<PhysicsRobot> SynchronousSimulator::getRobot(TeamColour team_colour,
+                                                           RobotId id) const
+{
+    return team_colour == TeamColour::YELLOW ? simulator.getYellowRobotWithId(id)
+                                             : simulator.getBlueRobotWithId(id);
+}
+
+std::optional<TbotsProto::Primitive> SynchronousSimulator::createPrimitive(
+    const SSLSimulationProto::RobotCommand& robot_command, const Angle& robot_orientation)
+{
+    Vector local_velocity;
+    AngularVelocity angular_velocity = AngularVelocity::zero();
+
+    const auto& move_command = robot_command.move_command();
+    switch (move_command.command_case())
+    {
+        case SSLSimulationProto::RobotMoveCommand::kLocalVelocity:
+        {
+            const auto& velocity = move_command.local_velocity();
+            local_velocity       = Vector(velocity.forward(), velocity.left());
+            angular_velocity     = AngularVelocity::fromRadians(velocity.angular());
+            break;
+        }
+        case SSLSimulationProto::RobotMoveCommand::kGlobalVelocity:
+        {
+            const auto& velocity = move_command.global_velocity();
+            local_velocity =
+                Vector(velocity.x(), velocity.y()).rotate(-robot_orientation);
+            angular_velocity = AngularVelocity::fromRadians(velocity.angular());
+            break;
+        }
+        case SSLSimulationProto::RobotMoveCommand::kWheelVelocity:
+        {
+            const auto& velocity = move_command.wheel_velocity();
+            float wheel_speeds[4]{velocity.front_left(), velocity.back_left(),
+                                  velocity.back_right(), velocity.front_right()};
+            float robot_local_speed[3]{0.0f, 0.0f, 0.0f};
+            speed4_to_speed3(wheel_speeds, robot_local_speed);
+            local_velocity = Vector(robot_local_speed[0], robot_local_speed[1]);
+            // Convert the rotational speed [m/s] to angular velocity [rad/s]
+            angular_velocity =
+                AngularVelocity::fromRadians(robot_local_speed[2] / ROBOT_RADIUS);
+            break;
+        }
+        case SSLSimulationProto::RobotMoveCommand::COMMAND_NOT_SET:
+        {
+            if (robot_command.has_move_command())
+            {
+                return std::nullopt;
+            }
+            // Robots without a move command stand still
+            break;
+        }
+    }
+
+    TbotsProto::Primitive primitive;
+    auto direct_control   = primitive.mutable_direct_control();
+    auto velocity_control = direct_control->mutable_direct_velocity_control();
+    *(velocity_control->mutable_velocity()) = *createVectorProto(local_velocity);
+    *(velocity_control->mutable_angular_velocity()) =
+        *createAngularVelocityProto(angular_velocity);
+
+    if (robot_command.kick_speed() > 0.0f)
+    {
+        Angle kick_angle = Angle::fromDegrees(robot_command.kick_angle());
+        if (kick_angle == Angle::zero())
+        {
+            direct_control->set_kick_speed_m_per_s(robot_command.kick_speed());
+        }
+        else
+        {
+            // The distance a ball kicked with the given speed and angle travels before
+            // it lands
+            double chip_distance_meters =
+                std::pow(robot_command.kick_speed(), 2) *
+                std::sin(2 * kick_angle.toRadians()) /
+                ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED;
+            direct_control->set_chip_distance_meters(
+                static_cast<float>(chip_distance_meters));
+        }
+    }
+    direct_control->set_dribbler_speed_rpm(robot_command.dribbler_speed());
+
+    return primitive;
+}
+
+void SynchronousSimulator::addError(
+    google::protobuf::RepeatedPtrField<SSLSimulationProto::SimulatorError>& errors,
+    const std::string& code, const std::string& message)
+{
+    auto error = errors.Add();
+    error->set_code(code);
+    error->set_message(message);
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "shared/parameter/cpp_dynamic_parameters.h"
+#include "shared/proto/primitive.pb.h"
+#include "software/proto/ssl_simulation_synchronous.pb.h"
+#include "software/simulation/simulator.h"
+#include "software/world/field.h"
+#include "software/world/team_types.h"
+
+/**
+ * A simulator that implements the synchronous mode of the SSL simulation protocol
+ * (https://github.com/RoboCup-SSL/ssl-simulation-protocol). Rather than running on a
+ * wall-clock loop, the simulation only advances when a client asks it to. Each
+ * SimulationSyncRequest applies its simulator and robot commands, steps the simulation
+ * by the requested amount of simulated time, and returns the resulting detection frame
+ * and robot feedback, so clients can run the simulation as fast as they can process it.
+ *
+ * The simulation starts with no robots or ball. They are added with TeleportRobot
+ * (with present set to true) and TeleportBall commands.
+ *
+ * Robot commands are run on the robots with a DirectControlPrimitive, and keep being
+ * run until a new command is sent for the robot. Features of the protocol that this
+ * simulator does not support are reported as SimulatorErrors in the response.
+ */
+class SynchronousSimulator
+{
+   public:
+    /**
+     * Creates a new SynchronousSimulator
+     *
+     * @param field The field to simulate
+     * @param simulator_config The config for the Simulator
+     * @param controlled_team_colour The colour of the team the RobotControl in each
+     * request is for
+     */
+    explicit SynchronousSimulator(const Field& field,
+                                  std::shared_ptr<const SimulatorConfig> simulator_config,
+                                  TeamColour controlled_team_colour);
+    SynchronousSimulator() = delete;
+
+    /**
+     * Applies the commands in the given request, steps the simulation by the requested
+     * time step, and returns the state of the simulation after the step
+     *
+     * @param request The request to handle
+     *
+     * @return the detection frame and robot feedback after the simulation step, and
+     * any errors that occurred while applying the commands
+     */
+    SSLSimulationProto::SimulationSyncResponse step(
+        const SSLSimulationProto::SimulationSyncRequest& request);
+
+    // The codes of the errors reported by this simulator
+    static inline const std::string UNSUPPORTED_CONFIG_ERROR = "UNSUPPORTED_CONFIG";
+    static inline const std::string UNSUPPORTED_SIMULATION_SPEED_ERROR =
+        "UNSUPPORTED_SIMULATION_SPEED";
+    static inline const std::string UNSUPPORTED_BY_FORCE_ERROR = "UNSUPPORTED_BY_FORCE";
+    static inline const std::string INVALID_ROBOT_ID_ERROR     = "INVALID_ROBOT_ID";
+    static inline const std::string INVALID_SIM_STEP_ERROR     = "INVALID_SIM_STEP";
+    static inline const std::string INVALID_MOVE_COMMAND_ERROR = "INVALID_MOVE_COMMAND";
+
+   private:
+    /**
+     * Applies the given SimulatorControl to the simulation
+     *
+     * @param control The SimulatorControl to apply
+     * @param errors The errors to add to if part of the command can't be applied
+     */
+    void applySimulatorControl(
+        const SSLSimulationProto::SimulatorControl& control,
+        google::protobuf::RepeatedPtrField<SSLSimulationProto::SimulatorError>& errors);
+
+    /**
+     * Teleports the ball. Any position fields that are not set keep the ball's
+     * current value.
+     *
+     * @param teleport_ball Where to teleport the ball
+     * @param errors The errors to add to if the teleport can't be applied
+     */
+    void teleportBall(
+        const SSLSimulationProto::TeleportBall& teleport_ball,
+        google::protobuf::RepeatedPtrField<SSLSimulationProto::SimulatorError>& errors);
+
+    /**
+     * Teleports, adds, or removes a robot. Any position fields that are not set keep the
+     * robot's current value. Teleporting a robot clears its current command.
+     *
+     * @param teleport_robot Where to teleport the robot
+     * @param errors The errors to add to if the teleport can't be applied
+     */
+    void teleportRobot(
+        const SSLSimulationProto::TeleportRobot& teleport_robot,
+        google::protobuf::RepeatedPtrField<SSLSimulationProto::SimulatorError>& errors);
+
+    /**
+     * Runs the given RobotCommand on the corresponding robot on the controlled team
+     *
+     * @param robot_command The command to run
+     * @param errors The errors to add to if the command can't be run
+     */
+    void applyRobotCommand(
+        const SSLSimulationProto::RobotCommand& robot_command,
+        google::protobuf::RepeatedPtrField<SSLSimulationProto::SimulatorError>& errors);
+
+    /**
+     * Adds the feedback for every robot on the controlled team to the given response
+     *
+     * @param robot_control_response The response to add the feedback to
+     */
+    void addRobotFeedback(
+        SSLSimulationProto::RobotControlResponse& robot_control_response) const;
+
+    /**
+     * Returns the PhysicsRobot with the given id on the given team
+     *
+     * @param team_colour The team of the robot
+     * @param id The id of the robot
+     *
+     * @return the PhysicsRobot if it exists, otherwise an empty pointer
+     */
+    std::weak_ptr<PhysicsRobot> getRobot(TeamColour team_colour, RobotId id) const;
+
+    /**
+     * Creates the DirectControlPrimitive that runs the given RobotCommand
+     *
+     * @param robot_command The command to run
+     * @param robot_orientation The current orientation of the robot, used to convert
+     * global velocities to local velocities
+     *
+     * @return the primitive to run, or std::nullopt if the command's move command is
+     * invalid
+     */
+    static std::optional<TbotsProto::Primitive> createPrimitive(
+        const SSLSimulationProto::RobotCommand& robot_command,
+        const Angle& robot_orientation);
+
+    /**
+     * Adds an error with the given code and message
+     *
+     * @param errors The errors to add to
+     * @param code The code of the error
+     * @param message A human readable description of the error
+     */
+    static void addError(
+        google::protobuf::RepeatedPtrField<SSLSimulationProto::SimulatorError>& errors,
+        const std::string& code, const std::string& message);
+
+    Simulator simulator;
+    TeamColour controlled_team_colour;
+};
@@ -0,0 +1,349 @@
+#include "software/simulation/synchronous_simulator.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+extern "C"
+{
+#include "firmware/shared/physics.h"
+}
+
+class SynchronousSimulatorTest : public ::testing::Test
+{
+   protected:
+    SynchronousSimulatorTest()
+        : simulator(Field::createSSLDivisionBField(),
+                    std::make_shared<const SimulatorConfig>(), TeamColour::YELLOW)
+    {
+    }
+
+    /**
+     * Creates a request that teleports a robot
+     *
+     * @param id The id of the robot
+     * @param team The team of the robot
+     * @param position Where to teleport the robot
+     * @param orientation The orientation to teleport the robot to
+     *
+     * @return a request that adds the robot if it does not exist, and then teleports it
+     */
+    static SSLSimulationProto::SimulationSyncRequest createTeleportRobotRequest(
+        unsigned int id, SSLProto::Team team, const Point& position,
+        const Angle& orientation)
+    {
+        SSLSimulationProto::SimulationSyncRequest request;
+        auto teleport_robot =
+            request.mutable_simulator_command()->mutable_control()->add_teleport_robot();
+        teleport_robot->mutable_id()->set_id(id);
+        teleport_robot->mutable_id()->set_team(team);
+        teleport_robot->set_x(static_cast<float>(position.x()));
+        teleport_robot->set_y(static_cast<float>(position.y()));
+        teleport_robot->set_orientation(static_cast<float>(orientation.toRadians()));
+        teleport_robot->set_present(true);
+        return request;
+    }
+
+    /**
+     * Steps the simulation with the given robot command for the given amount of time
+     *
+     * @param robot_command The command to send with every step
+     * @param duration How long to simulate for
+     *
+     * @return the response to the last step
+     */
+    SSLSimulationProto::SimulationSyncResponse stepWithRobotCommand(
+        const SSLSimulationProto::RobotCommand& robot_command, const Duration& duration)
+    {
+        SSLSimulationProto::SimulationSyncRequest request;
+        request.set_sim_step(static_cast<float>(STEP.toSeconds()));
+        *request.mutable_robot_control()->add_robot_commands() = robot_command;
+
+        SSLSimulationProto::SimulationSyncResponse response;
+        for (Duration time = Duration::fromSeconds(0); time < duration;
+             time          = time + STEP)
+        {
+            response = simulator.step(request);
+        }
+        return response;
+    }
+
+    /**
+     * Returns true if the response contains an error with the given code
+     *
+     * @param response The response to check
+     * @param code The error code to look for
+     *
+     * @return true if the response contains an error with the given code
+     */
+    static bool hasError(const SSLSimulationProto::SimulationSyncResponse& response,
+                         const std::string& code)
+    {
+        for (const auto& error : response.robot_control_response().errors())
+        {
+            if (error.code() == code)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const Duration STEP = Duration::fromSeconds(1.0 / 60.0);
+    SynchronousSimulator simulator;
+};
+
+TEST_F(SynchronousSimulatorTest, empty_request_returns_empty_detection_frame)
+{
+    auto response = simulator.step(SSLSimulationProto::SimulationSyncRequest());
+
+    ASSERT_EQ(1, response.detection_size());
+    EXPECT_EQ(0, response.detection(0).balls_size());
+    EXPECT_EQ(0, response.detection(0).robots_yellow_size());
+    EXPECT_EQ(0, response.detection(0).robots_blue_size());
+    EXPECT_EQ(0, response.robot_control_response().errors_size());
+}
+
+TEST_F(SynchronousSimulatorTest, sim_step_advances_the_simulation_time)
+{
+    SSLSimulationProto::SimulationSyncRequest request;
+    request.set_sim_step(0.5f);
+    simulator.step(request);
+    auto response = simulator.step(request);
+
+    ASSERT_EQ(1, response.detection_size());
+    EXPECT_NEAR(1.0, response.detection(0).t_capture(), 1e-6);
+}
+
+TEST_F(SynchronousSimulatorTest, negative_sim_step_is_an_error)
+{
+    SSLSimulationProto::SimulationSyncRequest request;
+    request.set_sim_step(-0.1f);
+    auto response = simulator.step(request);
+
+    EXPECT_TRUE(hasError(response, SynchronousSimulator::INVALID_SIM_STEP_ERROR));
+    EXPECT_DOUBLE_EQ(0.0, response.detection(0).t_capture());
+}
+
+TEST_F(SynchronousSimulatorTest, teleport_ball)
+{
+    SSLSimulationProto::SimulationSyncRequest request;
+    auto teleport_ball =
+        request.mutable_simulator_command()->mutable_control()->mutable_teleport_ball();
+    teleport_ball->set_x(1.0f);
+    teleport_ball->set_y(-2.0f);
+    teleport_ball->set_vx(1.5f);
+    request.set_sim_step(0.1f);
+    auto response = simulator.step(request);
+
+    ASSERT_EQ(1, response.detection(0).balls_size());
+    EXPECT_NEAR(1150.0f, response.detection(0).balls(0).x(), 20);
+    EXPECT_NEAR(-2000.0f, response.detection(0).balls(0).y(), 20);
+}
+
+TEST_F(SynchronousSimulatorTest, teleport_ball_by_force_is_unsupported)
+{
+    SSLSimulationProto::SimulationSyncRequest request;
+    auto teleport_ball =
+        request.mutable_simulator_command()->mutable_control()->mutable_teleport_ball();
+    teleport_ball->set_x(1.0f);
+    teleport_ball->set_by_force(true);
+    auto response = simulator.step(request);
+
+    EXPECT_TRUE(hasError(response, SynchronousSimulator::UNSUPPORTED_BY_FORCE_ERROR));
+    EXPECT_EQ(0, response.detection(0).balls_size());
+}
+
+TEST_F(SynchronousSimulatorTest, teleport_robot_with_present_adds_the_robot)
+{
+    auto response = simulator.step(createTeleportRobotRequest(
+        3, SSLProto::Team::YELLOW, Point(1, -1), Angle::zero()));
+
+    ASSERT_EQ(1, response.detection(0).robots_yellow_size());
+    EXPECT_EQ(3, response.detection(0).robots_yellow(0).robot_id());
+    EXPECT_FLOAT_EQ(1000.0f, response.detection(0).robots_yellow(0).x());
+    EXPECT_FLOAT_EQ(-1000.0f, response.detection(0).robots_yellow(0).y());
+
+    ASSERT_EQ(1, response.robot_control_response().feedback_size());
+    EXPECT_EQ(3, response.robot_control_response().feedback(0).id());
+    EXPECT_FALSE(response.robot_control_response().feedback(0).dribbler_ball_contact());
+}
+
+TEST_F(SynchronousSimulatorTest, teleport_existing_robot_moves_the_robot)
+{
+    simulator.step(
+        createTeleportRobotRequest(1, SSLProto::Team::BLUE, Point(0, 0), Angle::zero()));
+    auto response = simulator.step(
+        createTeleportRobotRequest(1, SSLProto::Team::BLUE, Point(2, 1), Angle::zero()));
+
+    ASSERT_EQ(1, response.detection(0).robots_blue_size());
+    EXPECT_FLOAT_EQ(2000.0f, response.detection(0).robots_blue(0).x());
+    EXPECT_FLOAT_EQ(1000.0f, response.detection(0).robots_blue(0).y());
+}
+
+TEST_F(SynchronousSimulatorTest, teleport_robot_with_present_false_removes_robot)
+{
+    simulator.step(
+        createTeleportRobotRequest(1, SSLProto::Team::BLUE, Point(0, 0), Angle::zero()));
+
+    auto request =
+        createTeleportRobotRequest(1, SSLProto::Team::BLUE, Point(0, 0), Angle::zero());
+    request.mutable_simulator_command()
+        ->mutable_control()
+        ->mutable_teleport_robot(0)
+        ->set_present(false);
+    auto response = simulator.step(request);
+
+    EXPECT_EQ(0, response.detection(0).robots_blue_size());
+}
+
+TEST_F(SynchronousSimulatorTest, teleport_robot_that_does_not_exist_is_an_error)
+{
+    auto request =
+        createTeleportRobotRequest(1, SSLProto::Team::BLUE, Point(0, 0), Angle::zero());
+    request.mutable_simulator_command()
+        ->mutable_control()
+        ->mutable_teleport_robot(0)
+        ->clear_present();
+    auto response = simulator.step(request);
+
+    EXPECT_TRUE(hasError(response, SynchronousSimulator::INVALID_ROBOT_ID_ERROR));
+    EXPECT_EQ(0, response.detection(0).robots_blue_size());
+}
+
+TEST_F(SynchronousSimulatorTest, command_for_robot_that_does_not_exist_is_an_error)
+{
+    SSLSimulationProto::SimulationSyncRequest request;
+    request.mutable_robot_control()->add_robot_commands()->set_id(4);
+    auto response = simulator.step(request);
+
+    EXPECT_TRUE(hasError(response, SynchronousSimulator::INVALID_ROBOT_ID_ERROR));
+}
+
+TEST_F(SynchronousSimulatorTest, simulation_speed_is_unsupported)
+{
+    SSLSimulationProto::SimulationSyncRequest request;
+    request.mutable_simulator_command()->mutable_control()->set_simulation_speed(2.0f);
+    auto response = simulator.step(request);
+
+    EXPECT_TRUE(
+        hasError(response, SynchronousSimulator::UNSUPPORTED_SIMULATION_SPEED_ERROR));
+}
+
+TEST_F(SynchronousSimulatorTest, local_velocity_command_moves_robot_forwards)
+{
+    // The robot faces the positive y direction, so moving forwards should move it
+    // along the y axis
+    simulator.step(createTeleportRobotRequest(0, SSLProto::Team::YELLOW, Point(0, 0),
+                                              Angle::quarter()));
+
+    SSLSimulationProto::RobotCommand robot_command;
+    robot_command.set_id(0);
+    auto local_velocity = robot_command.mutable_move_command()->mutable_local_velocity();
+    local_velocity->set_forward(1.0f);
+    local_velocity->set_left(0.0f);
+    local_velocity->set_angular(0.0f);
+    auto response = stepWithRobotCommand(robot_command, Duration::fromSeconds(1));
+
+    EXPECT_EQ(0, response.robot_control_response().errors_size());
+    ASSERT_EQ(1, response.detection(0).robots_yellow_size());
+    EXPECT_GT(response.detection(0).robots_yellow(0).y(), 500.0f);
+    EXPECT_NEAR(0.0f, response.detection(0).robots_yellow(0).x(), 100);
+}
+
+TEST_F(SynchronousSimulatorTest, global_velocity_command_moves_robot_in_field_frame)
+{
+    simulator.step(createTeleportRobotRequest(0, SSLProto::Team::YELLOW, Point(0, 0),
+                                              Angle::quarter()));
+
+    SSLSimulationProto::RobotCommand robot_command;
+    robot_command.set_id(0);
+    auto global_velocity =
+        robot_command.mutable_move_command()->mutable_global_velocity();
+    global_velocity->set_x(1.0f);
+    global_velocity->set_y(0.0f);
+    global_velocity->set_angular(0.0f);
+    auto response = stepWithRobotCommand(robot_command, Duration::fromSeconds(1));
+
+    EXPECT_EQ(0, response.robot_control_response().errors_size());
+    ASSERT_EQ(1, response.detection(0).robots_yellow_size());
+    EXPECT_GT(response.detection(0).robots_yellow(0).x(), 500.0f);
+    EXPECT_NEAR(0.0f, response.detection(0).robots_yellow(0).y(), 100);
+}
+
+TEST_F(SynchronousSimulatorTest, wheel_velocity_command_matches_equivalent_local_velocity)
+{
+    // Encode a local velocity as the wheel velocities that produce it, the same way
+    // the firmware does, and check that decoding them moves the robot exactly like the
+    // local velocity would
+    const float forward = 0.8f, left = -0.4f, angular = 1.5f;
+    float robot_local_speed[3]{forward, left, angular * ROBOT_RADIUS};
+    float wheel_speeds[4];
+    speed3_to_speed4(robot_local_speed, wheel_speeds);
+
+    // Robot 0 is driven by the wheel velocities and robot 1 by the local velocity
+    simulator.step(createTeleportRobotRequest(0, SSLProto::Team::YELLOW, Point(-1, 0),
+                                              Angle::zero()));
+    simulator.step(createTeleportRobotRequest(1, SSLProto::Team::YELLOW, Point(1, 0),
+                                              Angle::zero()));
+
+    SSLSimulationProto::SimulationSyncRequest request;
+    request.set_sim_step(static_cast<float>(STEP.toSeconds()));
+    auto wheel_velocity_command = request.mutable_robot_control()->add_robot_commands();
+    wheel_velocity_command->set_id(0);
+    auto wheel_velocity =
+        wheel_velocity_command->mutable_move_command()->mutable_wheel_velocity();
+    wheel_velocity->set_front_left(wheel_speeds[0]);
+    wheel_velocity->set_back_left(wheel_speeds[1]);
+    wheel_velocity->set_back_right(wheel_speeds[2]);
+    wheel_velocity->set_front_right(wheel_speeds[3]);
+    auto local_velocity_command = request.mutable_robot_control()->add_robot_commands();
+    local_velocity_command->set_id(1);
+    auto local_velocity =
+        local_velocity_command->mutable_move_command()->mutable_local_velocity();
+    local_velocity->set_forward(forward);
+    local_velocity->set_left(left);
+    local_velocity->set_angular(angular);
+
+    SSLSimulationProto::SimulationSyncResponse response;
+    for (Duration time = Duration::fromSeconds(0); time < Duration::fromSeconds(1);
+         time          = time + STEP)
+    {
+        response = simulator.step(request);
+    }
+
+    EXPECT_EQ(0, response.robot_control_response().errors_size());
+    ASSERT_EQ(2, response.detection(0).robots_yellow_size());
+    const auto& wheel_velocity_robot =
+        response.detection(0).robots_yellow(0).robot_id() == 0
+            ? response.detection(0).robots_yellow(0)
+            : response.detection(0).robots_yellow(1);
+    const auto& local_velocity_robot =
+        response.detection(0).robots_yellow(0).robot_id() == 1
+            ? response.detection(0).robots_yellow(0)
+            : response.detection(0).robots_yellow(1);
+    // The robots should have moved, and moved the same way relative to where they
+    // started
+    EXPECT_GT(std::hypot(wheel_velocity_robot.x() + 1000.0f, wheel_velocity_robot.y()),
+              300.0f);
+    EXPECT_NEAR(local_velocity_robot.x() - 2000.0f, wheel_velocity_robot.x(), 5.0f);
+    EXPECT_NEAR(local_velocity_robot.y(), wheel_velocity_robot.y(), 5.0f);
+    EXPECT_NEAR(local_velocity_robot.orientation(), wheel_velocity_robot.orientation(),
+                0.01f);
+}
+
+TEST_F(SynchronousSimulatorTest, commands_are_only_applied_to_the_controlled_team)
+{
+    simulator.step(
+        createTeleportRobotRequest(0, SSLProto::Team::BLUE, Point(0, 0), Angle::zero()));
+
+    SSLSimulationProto::RobotCommand robot_command;
+    robot_command.set_id(0);
+    robot_command.mutable_move_command()->mutable_local_velocity()->set_forward(1.0f);
+    auto response = stepWithRobotCommand(robot_command, Duration::fromSeconds(0.5));
+
+    // The only robot with id 0 is on the blue team, but the yellow team is controlled
+    EXPECT_TRUE(hasError(response, SynchronousSimulator::INVALID_ROBOT_ID_ERROR));
+    ASSERT_EQ(1, response.detection(0).robots_blue_size());
+    EXPECT_NEAR(0.0f, response.detection(0).robots_blue(0).x(), 10);
+}
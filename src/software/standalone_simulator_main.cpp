@@ -3,9 +3,11 @@
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/gui/standalone_simulator/threaded_standalone_simulator_gui.h"
 #include "software/logger/logger.h"
+#include "software/networking/proto_udp_server.h"
 #include "software/simulation/standalone_simulator.h"
+#include "software/simulation/synchronous_simulator.h"
 
-int main(int argc, char **argv)
+int main(int argc, char** argv)
 {
     // load command line arguments
     auto args           = std::make_shared<StandaloneSimulatorMainCommandLineArgs>();
@@ -41,6 +43,34 @@ int main(int argc, char **argv)
             ->getMutableRollingFrictionAcceleration()
             ->setValue(0.5);
 
+        if (args->getSynchronous()->value())
+        {
+            Field field = args->getSslDivision()->value() == "div_a"
+                              ? Field::createSSLDivisionAField()
+                              : Field::createSSLDivisionBField();
+            SynchronousSimulator synchronous_simulator(
+                field, mutable_thunderbots_config->getMutableSimulatorConfig(),
+                fromStringToTeamColour(args->getSynchronousTeamColour()->value()));
+
+            boost::asio::io_service io_service;
+            ProtoUdpServer<SSLSimulationProto::SimulationSyncRequest,
+                           SSLSimulationProto::SimulationSyncResponse>
+                server(io_service, "127.0.0.1",
+                       static_cast<unsigned short>(args->getSynchronousPort()->value()),
+                       [&synchronous_simulator](
+                           const SSLSimulationProto::SimulationSyncRequest& request) {
+                           return synchronous_simulator.step(request);
+                       });
+
+            LOG(INFO) << "Running the synchronous simulator on port "
+                      << args->getSynchronousPort()->value();
+
+            // Requests are handled one at a time on this thread, so the simulation
+            // is only ever stepped by one request at once. This blocks forever.
+            io_service.run();
+            return 0;
+        }
+
         std::shared_ptr<StandaloneSimulator> standalone_simulator;
 
         // Setup the field
@@ -0,0 +1,273 @@
+#include "software/tracing/pipeline_tracer.h"
+
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#include "software/proto/message_translation/tbots_protobuf.h"
+
+namespace
+{
+    double toMilliseconds(std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    /**
+     * Writes a Chrome trace event for something that took some amount of time
+     *
+     * @param output The stream to write the event to
+     * @param name The name of the event
+     * @param thread_id The id of the row the event is shown on
+     * @param start_time_us When the event started, in microseconds
+     * @param duration_us How long the event took, in microseconds
+     * @param trace_id The id of the trace the event is part of
+     */
+    void writeCompleteEvent(std::ostream& output, const std::string& name,
+                            unsigned int thread_id, double start_time_us,
+                            double duration_us, uint64_t trace_id)
+    {
+        output << ",\n{\"name\":\"" << name
+               << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread_id
+               << ",\"ts\":" << start_time_us << ",\"dur\":" << duration_us
+               << ",\"args\":{\"trace_id\":" << trace_id << "}}";
+    }
+
+    /**
+     * Writes a Chrome trace event that names a row of events
+     *
+     * @param output The stream to write the event to
+     * @param thread_id The id of the row
+     * @param name The name of the row
+     */
+    void writeThreadNameEvent(std::ostream& output, unsigned int thread_id,
+                              const std::string& name)
+    {
+        output << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+               << thread_id << ",\"args\":{\"name\":\"" << name << "\"}}";
+    }
+}  // namespace
+
+PipelineTracer::PipelineTracer(std::size_t max_in_flight_traces,
+                               std::size_t max_completed_traces)
+    : creation_time(std::chrono::steady_clock::now()),
+      max_in_flight_traces(max_in_flight_traces),
+      next_trace_id(NO_TRACE_ID + 1),
+      in_flight_traces(),
+      completed_traces(max_completed_traces),
+      num_completed_traces(0),
+      num_abandoned_traces(0),
+      end_to_end_latencies(max_completed_traces),
+      queueing_latencies(NUM_STAGES, RollingLatencyPercentiles(max_completed_traces)),
+      compute_latencies(NUM_STAGES, RollingLatencyPercentiles(max_completed_traces))
+{
+    if (max_in_flight_traces == 0)
+    {
+        throw std::invalid_argument(
+            "PipelineTracer created with a max_in_flight_traces of 0");
+    }
+}
+
+uint64_t PipelineTracer::startTrace()
+{
+    const auto received_time = std::chrono::steady_clock::now();
+
+    std::scoped_lock<std::mutex> lock(mutex);
+    const uint64_t trace_id = next_trace_id++;
+    in_flight_traces.emplace(trace_id, Trace{trace_id, received_time, {}});
+
+    if (in_flight_traces.size() > max_in_flight_traces)
+    {
+        in_flight_traces.erase(in_flight_traces.begin());
+        num_abandoned_traces++;
+    }
+
+    return trace_id;
+}
+
+void PipelineTracer::startStage(uint64_t trace_id, PipelineStage stage)
+{
+    if (trace_id == NO_TRACE_ID)
+    {
+        return;
+    }
+    const auto start_time = std::chrono::steady_clock::now();
+
+    std::scoped_lock<std::mutex> lock(mutex);
+    auto iter = in_flight_traces.find(trace_id);
+    if (iter == in_flight_traces.end())
+    {
+        return;
+    }
+
+    // A stage may see the same trace more than once (ex. sensor fusion carries the
+    // trace id of the last vision packet in every World), but only the first time
+    // counts
+    StageTimes& stage_times = iter->second.stages[static_cast<std::size_t>(stage)];
+    if (!stage_times.start_time)
+    {
+        stage_times.start_time = start_time;
+    }
+}
+
+void PipelineTracer::endStage(uint64_t trace_id, PipelineStage stage)
+{
+    if (trace_id == NO_TRACE_ID)
+    {
+        return;
+    }
+    const auto end_time = std::chrono::steady_clock::now();
+
+    std::scoped_lock<std::mutex> lock(mutex);
+    auto iter = in_flight_traces.find(trace_id);
+    if (iter == in_flight_traces.end())
+    {
+        return;
+    }
+
+    StageTimes& stage_times = iter->second.stages[static_cast<std::size_t>(stage)];
+    if (!stage_times.start_time || stage_times.end_time)
+    {
+        return;
+    }
+    stage_times.end_time = end_time;
+
+    if (static_cast<std::size_t>(stage) == NUM_STAGES - 1)
+    {
+        const Trace trace = iter->second;
+        in_flight_traces.erase(iter);
+        completeTrace(trace);
+    }
+}
+
+void PipelineTracer::completeTrace(const Trace& trace)
+{
+    for (const StageTimes& stage_times : trace.stages)
+    {
+        if (!stage_times.start_time || !stage_times.end_time)
+        {
+            // The trace skipped a stage, so its latencies are meaningless
+            num_abandoned_traces++;
+            return;
+        }
+    }
+
+    auto previous_end_time = trace.received_time;
+    for (std::size_t i = 0; i < NUM_STAGES; i++)
+    {
+        const StageTimes& stage_times = trace.stages[i];
+        queueing_latencies[i].addLatency(
+            toMilliseconds(*stage_times.start_time - previous_end_time));
+        compute_latencies[i].addLatency(
+            toMilliseconds(*stage_times.end_time - *stage_times.start_time));
+        previous_end_time = *stage_times.end_time;
+    }
+    end_to_end_latencies.addLatency(
+        toMilliseconds(previous_end_time - trace.received_time));
+    completed_traces.push_back(trace);
+    num_completed_traces++;
+
+    // Packets pass through the pipeline in order, so any older traces have been
+    // skipped by one of the stages and will never complete
+    auto first_newer_trace = in_flight_traces.upper_bound(trace.id);
+    num_abandoned_traces +=
+        static_cast<uint64_t>(std::distance(in_flight_traces.begin(), first_newer_trace));
+    in_flight_traces.erase(in_flight_traces.begin(), first_newer_trace);
+}
+
+std::unique_ptr<TbotsProto::PipelineLatency> PipelineTracer::getPipelineLatency() const
+{
+    auto pipeline_latency = std::make_unique<TbotsProto::PipelineLatency>();
+    *(pipeline_latency->mutable_time_computed()) = *createCurrentTimestamp();
+
+    std::scoped_lock<std::mutex> lock(mutex);
+    *(pipeline_latency->mutable_end_to_end()) = *end_to_end_latencies.getDistribution();
+    for (PipelineStage stage : allValuesPipelineStage())
+    {
+        const auto index                                = static_cast<std::size_t>(stage);
+        TbotsProto::PipelineStageLatency* stage_latency = pipeline_latency->add_stages();
+        stage_latency->set_stage(toString(stage));
+        *(stage_latency->mutable_queueing()) =
+            *queueing_latencies[index].getDistribution();
+        *(stage_latency->mutable_compute()) = *compute_latencies[index].getDistribution();
+    }
+    pipeline_latency->set_num_completed_traces(num_completed_traces);
+    pipeline_latency->set_num_abandoned_traces(num_abandoned_traces);
+
+    return pipeline_latency;
+}
+
+std::optional<double> PipelineTracer::getEndToEndLatencyPercentileMs(
+    double percentile) const
+{
+    std::scoped_lock<std::mutex> lock(mutex);
+    if (end_to_end_latencies.size() == 0)
+    {
+        return std::nullopt;
+    }
+    return end_to_end_latencies.getPercentile(percentile);
+}
+
+void PipelineTracer::writeChromeTrace(std::ostream& output) const
+{
+    const std::vector<PipelineStage> stages = allValuesPipelineStage();
+
+    // Timestamps are in microseconds, but are precise to nanoseconds
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+
+    // Each stage gets one row for the time spent in its queue and one row for the time
+    // spent computing, since the next packet can wait in the queue while the stage is
+    // still computing the previous one. The first row shows the whole pipeline
+    json << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+         << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":"
+         << "\"Pipeline\"}}";
+    writeThreadNameEvent(json, 0, "End to end");
+    for (std::size_t i = 0; i < stages.size(); i++)
+    {
+        writeThreadNameEvent(json, static_cast<unsigned int>(2 * i + 1),
+                             toString(stages[i]) + " queueing");
+        writeThreadNameEvent(json, static_cast<unsigned int>(2 * i + 2),
+                             toString(stages[i]));
+    }
+
+    std::scoped_lock<std::mutex> lock(mutex);
+    for (const Trace& trace : completed_traces)
+    {
+        auto previous_end_time = trace.received_time;
+        for (std::size_t i = 0; i < stages.size(); i++)
+        {
+            const StageTimes& stage_times = trace.stages[i];
+            writeCompleteEvent(
+                json, toString(stages[i]) + " queueing",
+                static_cast<unsigned int>(2 * i + 1), toTraceTimeUs(previous_end_time),
+                toTraceTimeUs(*stage_times.start_time) - toTraceTimeUs(previous_end_time),
+                trace.id);
+            writeCompleteEvent(json, toString(stages[i]),
+                               static_cast<unsigned int>(2 * i + 2),
+                               toTraceTimeUs(*stage_times.start_time),
+                               toTraceTimeUs(*stage_times.end_time) -
+                                   toTraceTimeUs(*stage_times.start_time),
+                               trace.id);
+            previous_end_time = *stage_times.end_time;
+        }
+        writeCompleteEvent(
+            json, "Vision to primitives", 0, toTraceTimeUs(trace.received_time),
+            toTraceTimeUs(previous_end_time) - toTraceTimeUs(trace.received_time),
+            trace.id);
+    }
+    json << "\n]}\n";
+    output << json.str();
+}
+
+double PipelineTracer::toTraceTimeUs(std::chrono::steady_clock::time_point time) const
+{
+    return std::chrono::duration<double, std::micro>(time - creation_time).count();
+}
+
+PipelineTracer& PipelineTracer::getGlobalTracer()
+{
+    static PipelineTracer global_tracer;
+    return global_tracer;
+}
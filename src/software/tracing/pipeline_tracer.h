@@ -0,0 +1,167 @@
+#pragma once
+
+#include <array>
+#include <boost/circular_buffer.hpp>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+#include "software/proto/pipeline_latency_msg.pb.h"
+#include "software/tracing/rolling_latency_percentiles.h"
+#include "software/util/make_enum/make_enum.h"
+
+// The stages a vision packet passes through, from being received to the primitives
+// computed from it being sent to the robots, in order
+MAKE_ENUM(PipelineStage, SENSOR_FUSION, AI, BACKEND);
+
+/**
+ * Measures the latency from a vision packet being received to the primitives computed
+ * from it being sent to the robots.
+ *
+ * Each vision packet is given a trace id when it is received, which is carried along
+ * with it through the pipeline (in the SensorProto, the World, and the PrimitiveSet).
+ * Each stage of the pipeline records when it starts and finishes processing the trace,
+ * which splits the latency of each stage into the time spent waiting in the stage's
+ * queue and the time spent computing. A trace is complete once the last stage has
+ * finished.
+ *
+ * Many traces are never completed, since stages may skip packets when newer ones are
+ * available (ex. the AI only runs on the most recent World). A trace is abandoned when a
+ * newer trace completes before it, since the pipeline processes packets in order.
+ *
+ * All functions are thread-safe. Recording a stage only takes a lock for a short time,
+ * so it's cheap enough to do for every packet.
+ */
+class PipelineTracer
+{
+   public:
+    /**
+     * Creates a new PipelineTracer
+     *
+     * @param max_in_flight_traces The maximum number of traces that can be in the
+     * pipeline at once. If more are started, the oldest trace is abandoned
+     * @param max_completed_traces How many of the most recently completed traces to
+     * keep, which are used to compute the latency percentiles and are exported as a
+     * Chrome trace
+     */
+    explicit PipelineTracer(std::size_t max_in_flight_traces = 256,
+                            std::size_t max_completed_traces = 2000);
+
+    /**
+     * Starts a new trace, for a vision packet that was just received
+     *
+     * @return the id of the new trace
+     */
+    uint64_t startTrace();
+
+    /**
+     * Records that the given stage has started processing the given trace. Does nothing
+     * if the trace is not in progress, or the stage has already started processing it
+     *
+     * @param trace_id The id of the trace
+     * @param stage The stage that started processing the trace
+     */
+    void startStage(uint64_t trace_id, PipelineStage stage);
+
+    /**
+     * Records that the given stage has finished processing the given trace. Finishing the
+     * last stage completes the trace. Does nothing if the trace is not in progress, or
+     * the stage has not started processing it
+     *
+     * @param trace_id The id of the trace
+     * @param stage The stage that finished processing the trace
+     */
+    void endStage(uint64_t trace_id, PipelineStage stage);
+
+    /**
+     * Returns the distributions of the latencies of the most recently completed traces
+     *
+     * @return the latencies of the pipeline
+     */
+    std::unique_ptr<TbotsProto::PipelineLatency> getPipelineLatency() const;
+
+    /**
+     * Returns the given percentile of the end-to-end latencies of the most recently
+     * completed traces. This is cheaper than getPipelineLatency, so it can be used by
+     * the pipeline itself (ex. to compensate for its latency)
+     *
+     * @param percentile The percentile, in the range [0, 100]
+     *
+     * @return the given percentile of the end-to-end latencies in milliseconds, or
+     * std::nullopt if no traces have been completed
+     */
+    std::optional<double> getEndToEndLatencyPercentileMs(double percentile) const;
+
+    /**
+     * Writes the most recently completed traces in the Chrome trace event format, so
+     * they can be inspected in chrome://tracing or https://ui.perfetto.dev
+     *
+     * @param output The stream to write the JSON to
+     */
+    void writeChromeTrace(std::ostream& output) const;
+
+    /**
+     * Returns the PipelineTracer shared by the whole pipeline. The stages of the
+     * pipeline are created independently of each other (ex. Backends are created by a
+     * factory), so they find the tracer through here rather than being given it
+     *
+     * @return the PipelineTracer shared by the whole pipeline
+     */
+    static PipelineTracer& getGlobalTracer();
+
+    // The id of packets that are not traced. Recording stages for this id does nothing
+    static constexpr uint64_t NO_TRACE_ID = 0;
+
+   private:
+    static constexpr std::size_t NUM_STAGES = 3;
+
+    struct StageTimes
+    {
+        std::optional<std::chrono::steady_clock::time_point> start_time;
+        std::optional<std::chrono::steady_clock::time_point> end_time;
+    };
+
+    struct Trace
+    {
+        uint64_t id;
+        std::chrono::steady_clock::time_point received_time;
+        std::array<StageTimes, NUM_STAGES> stages;
+    };
+
+    /**
+     * Records the latencies of the given trace, which has passed through every stage,
+     * and abandons every older trace
+     *
+     * @param trace The completed trace
+     */
+    void completeTrace(const Trace& trace);
+
+    /**
+     * Returns the time in microseconds from this tracer being created to the given time
+     *
+     * @param time The time
+     *
+     * @return the time in microseconds since this tracer was created
+     */
+    double toTraceTimeUs(std::chrono::steady_clock::time_point time) const;
+
+    const std::chrono::steady_clock::time_point creation_time;
+    const std::size_t max_in_flight_traces;
+
+    mutable std::mutex mutex;
+    uint64_t next_trace_id;
+    // Ordered by id, which is also the order the traces started in
+    std::map<uint64_t, Trace> in_flight_traces;
+    boost::circular_buffer<Trace> completed_traces;
+    uint64_t num_completed_traces;
+    uint64_t num_abandoned_traces;
+
+    RollingLatencyPercentiles end_to_end_latencies;
+    std::vector<RollingLatencyPercentiles> queueing_latencies;
+    std::vector<RollingLatencyPercentiles> compute_latencies;
+};
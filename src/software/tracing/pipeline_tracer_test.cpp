@@ -0,0 +1,186 @@
+#include "software/tracing/pipeline_tracer.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    /**
+     * Passes the given trace through every stage of the pipeline
+     *
+     * @param tracer The tracer to record the stages with
+     * @param trace_id The trace to pass through the pipeline
+     */
+    void passThroughPipeline(PipelineTracer& tracer, uint64_t trace_id)
+    {
+        for (PipelineStage stage : allValuesPipelineStage())
+        {
+            tracer.startStage(trace_id, stage);
+            tracer.endStage(trace_id, stage);
+        }
+    }
+}  // namespace
+
+TEST(PipelineTracerTest, no_traces)
+{
+    PipelineTracer tracer;
+    auto pipeline_latency = tracer.getPipelineLatency();
+
+    EXPECT_EQ(0, pipeline_latency->num_completed_traces());
+    EXPECT_EQ(0, pipeline_latency->num_abandoned_traces());
+    EXPECT_EQ(0, pipeline_latency->end_to_end().num_samples());
+    ASSERT_EQ(3, pipeline_latency->stages_size());
+    EXPECT_EQ("SENSOR_FUSION", pipeline_latency->stages(0).stage());
+    EXPECT_EQ("AI", pipeline_latency->stages(1).stage());
+    EXPECT_EQ("BACKEND", pipeline_latency->stages(2).stage());
+    EXPECT_FALSE(tracer.getEndToEndLatencyPercentileMs(50));
+}
+
+TEST(PipelineTracerTest, trace_ids_are_unique_and_never_the_untraced_id)
+{
+    PipelineTracer tracer;
+    uint64_t first_trace_id  = tracer.startTrace();
+    uint64_t second_trace_id = tracer.startTrace();
+
+    EXPECT_NE(PipelineTracer::NO_TRACE_ID, first_trace_id);
+    EXPECT_NE(PipelineTracer::NO_TRACE_ID, second_trace_id);
+    EXPECT_NE(first_trace_id, second_trace_id);
+}
+
+TEST(PipelineTracerTest, trace_through_whole_pipeline_is_completed)
+{
+    PipelineTracer tracer;
+    uint64_t trace_id = tracer.startTrace();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    tracer.startStage(trace_id, PipelineStage::SENSOR_FUSION);
+    tracer.endStage(trace_id, PipelineStage::SENSOR_FUSION);
+    tracer.startStage(trace_id, PipelineStage::AI);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    tracer.endStage(trace_id, PipelineStage::AI);
+    tracer.startStage(trace_id, PipelineStage::BACKEND);
+
+    EXPECT_EQ(0, tracer.getPipelineLatency()->num_completed_traces());
+
+    tracer.endStage(trace_id, PipelineStage::BACKEND);
+
+    auto pipeline_latency = tracer.getPipelineLatency();
+    EXPECT_EQ(1, pipeline_latency->num_completed_traces());
+    EXPECT_EQ(0, pipeline_latency->num_abandoned_traces());
+    EXPECT_EQ(1, pipeline_latency->end_to_end().num_samples());
+    EXPECT_GE(pipeline_latency->end_to_end().p50_ms(), 15.0);
+    EXPECT_EQ(pipeline_latency->end_to_end().p50_ms(),
+              tracer.getEndToEndLatencyPercentileMs(50));
+
+    // The sensor fusion stage waited in its queue, and the AI stage computed
+    EXPECT_GE(pipeline_latency->stages(0).queueing().p50_ms(), 5.0);
+    EXPECT_LT(pipeline_latency->stages(0).compute().p50_ms(), 5.0);
+    EXPECT_LT(pipeline_latency->stages(1).queueing().p50_ms(), 5.0);
+    EXPECT_GE(pipeline_latency->stages(1).compute().p50_ms(), 10.0);
+}
+
+TEST(PipelineTracerTest, only_the_first_time_a_stage_sees_a_trace_counts)
+{
+    PipelineTracer tracer;
+    uint64_t trace_id = tracer.startTrace();
+
+    tracer.startStage(trace_id, PipelineStage::SENSOR_FUSION);
+    tracer.endStage(trace_id, PipelineStage::SENSOR_FUSION);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    tracer.startStage(trace_id, PipelineStage::SENSOR_FUSION);
+    tracer.endStage(trace_id, PipelineStage::SENSOR_FUSION);
+    tracer.startStage(trace_id, PipelineStage::AI);
+    tracer.endStage(trace_id, PipelineStage::AI);
+    tracer.startStage(trace_id, PipelineStage::BACKEND);
+    tracer.endStage(trace_id, PipelineStage::BACKEND);
+
+    auto pipeline_latency = tracer.getPipelineLatency();
+    EXPECT_EQ(1, pipeline_latency->num_completed_traces());
+    EXPECT_LT(pipeline_latency->stages(0).compute().max_ms(), 10.0);
+    EXPECT_GE(pipeline_latency->stages(1).queueing().max_ms(), 10.0);
+}
+
+TEST(PipelineTracerTest, older_traces_are_abandoned_when_a_newer_trace_completes)
+{
+    PipelineTracer tracer;
+    uint64_t first_trace_id  = tracer.startTrace();
+    uint64_t second_trace_id = tracer.startTrace();
+    uint64_t third_trace_id  = tracer.startTrace();
+
+    // The second trace skips the AI, since the AI only runs on the latest World
+    tracer.startStage(first_trace_id, PipelineStage::SENSOR_FUSION);
+    tracer.endStage(first_trace_id, PipelineStage::SENSOR_FUSION);
+    tracer.startStage(second_trace_id, PipelineStage::SENSOR_FUSION);
+    tracer.endStage(second_trace_id, PipelineStage::SENSOR_FUSION);
+    passThroughPipeline(tracer, third_trace_id);
+
+    auto pipeline_latency = tracer.getPipelineLatency();
+    EXPECT_EQ(1, pipeline_latency->num_completed_traces());
+    EXPECT_EQ(2, pipeline_latency->num_abandoned_traces());
+
+    // Abandoned traces can no longer be completed
+    passThroughPipeline(tracer, first_trace_id);
+    EXPECT_EQ(1, tracer.getPipelineLatency()->num_completed_traces());
+}
+
+TEST(PipelineTracerTest, oldest_trace_is_abandoned_when_too_many_are_in_flight)
+{
+    PipelineTracer tracer(2, 10);
+    uint64_t first_trace_id  = tracer.startTrace();
+    uint64_t second_trace_id = tracer.startTrace();
+    tracer.startTrace();
+
+    EXPECT_EQ(1, tracer.getPipelineLatency()->num_abandoned_traces());
+
+    passThroughPipeline(tracer, first_trace_id);
+    EXPECT_EQ(0, tracer.getPipelineLatency()->num_completed_traces());
+
+    passThroughPipeline(tracer, second_trace_id);
+    EXPECT_EQ(1, tracer.getPipelineLatency()->num_completed_traces());
+}
+
+TEST(PipelineTracerTest, untraced_packets_are_ignored)
+{
+    PipelineTracer tracer;
+    passThroughPipeline(tracer, PipelineTracer::NO_TRACE_ID);
+
+    auto pipeline_latency = tracer.getPipelineLatency();
+    EXPECT_EQ(0, pipeline_latency->num_completed_traces());
+    EXPECT_EQ(0, pipeline_latency->num_abandoned_traces());
+}
+
+TEST(PipelineTracerTest, ending_a_stage_that_has_not_started_does_nothing)
+{
+    PipelineTracer tracer;
+    uint64_t trace_id = tracer.startTrace();
+
+    tracer.startStage(trace_id, PipelineStage::SENSOR_FUSION);
+    tracer.endStage(trace_id, PipelineStage::SENSOR_FUSION);
+    tracer.startStage(trace_id, PipelineStage::AI);
+    tracer.endStage(trace_id, PipelineStage::AI);
+    tracer.endStage(trace_id, PipelineStage::BACKEND);
+
+    EXPECT_EQ(0, tracer.getPipelineLatency()->num_completed_traces());
+}
+
+TEST(PipelineTracerTest, write_chrome_trace)
+{
+    PipelineTracer tracer;
+    uint64_t trace_id = tracer.startTrace();
+    passThroughPipeline(tracer, trace_id);
+
+    std::stringstream chrome_trace;
+    tracer.writeChromeTrace(chrome_trace);
+    std::string json = chrome_trace.str();
+
+    EXPECT_EQ(0, json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"Vision to primitives\""));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"SENSOR_FUSION queueing\""));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"AI\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"BACKEND\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos,
+              json.find("\"args\":{\"trace_id\":" + std::to_string(trace_id) + "}"));
+    EXPECT_EQ("]}\n", json.substr(json.size() - 3));
+}
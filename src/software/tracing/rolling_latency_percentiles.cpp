@@ -0,0 +1,77 @@
+#include "software/tracing/rolling_latency_percentiles.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    /**
+     * Returns the given percentile of sorted latencies, using the nearest rank method
+     *
+     * @param sorted_latencies_ms The latencies, sorted from smallest to largest
+     * @param percentile The percentile, in the range [0, 100]
+     *
+     * @return the given percentile of the latencies
+     */
+    double getPercentileOfSorted(const std::vector<double>& sorted_latencies_ms,
+                                 double percentile)
+    {
+        percentile = std::clamp(percentile, 0.0, 100.0);
+        auto rank  = static_cast<std::size_t>(std::ceil(
+            percentile / 100.0 * static_cast<double>(sorted_latencies_ms.size())));
+        return sorted_latencies_ms[std::max<std::size_t>(rank, 1) - 1];
+    }
+}  // namespace
+
+RollingLatencyPercentiles::RollingLatencyPercentiles(std::size_t window_size)
+    : latencies_ms(window_size)
+{
+    if (window_size == 0)
+    {
+        throw std::invalid_argument(
+            "RollingLatencyPercentiles created with a window size of 0");
+    }
+}
+
+void RollingLatencyPercentiles::addLatency(double latency_ms)
+{
+    latencies_ms.push_back(latency_ms);
+}
+
+double RollingLatencyPercentiles::getPercentile(double percentile) const
+{
+    if (latencies_ms.empty())
+    {
+        return 0.0;
+    }
+    std::vector<double> sorted_latencies_ms(latencies_ms.begin(), latencies_ms.end());
+    std::sort(sorted_latencies_ms.begin(), sorted_latencies_ms.end());
+    return getPercentileOfSorted(sorted_latencies_ms, percentile);
+}
+
+std::size_t RollingLatencyPercentiles::size() const
+{
+    return latencies_ms.size();
+}
+
+std::unique_ptr<TbotsProto::LatencyDistribution>
+RollingLatencyPercentiles::getDistribution() const
+{
+    auto distribution = std::make_unique<TbotsProto::LatencyDistribution>();
+    distribution->set_num_samples(static_cast<uint32_t>(latencies_ms.size()));
+    if (latencies_ms.empty())
+    {
+        return distribution;
+    }
+
+    // Sort once for all the percentiles
+    std::vector<double> sorted_latencies_ms(latencies_ms.begin(), latencies_ms.end());
+    std::sort(sorted_latencies_ms.begin(), sorted_latencies_ms.end());
+    distribution->set_p50_ms(getPercentileOfSorted(sorted_latencies_ms, 50));
+    distribution->set_p95_ms(getPercentileOfSorted(sorted_latencies_ms, 95));
+    distribution->set_p99_ms(getPercentileOfSorted(sorted_latencies_ms, 99));
+    distribution->set_max_ms(sorted_latencies_ms.back());
+    return distribution;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <boost/circular_buffer.hpp>
+#include <memory>
+
+#include "software/proto/pipeline_latency_msg.pb.h"
+
+/**
+ * Keeps the most recent latencies measured for something (ex. a stage of the pipeline),
+ * and computes the distribution of those latencies. Only the most recent latencies are
+ * kept so that the distribution reflects how the system is running right now, rather
+ * than being dominated by everything that has happened since it started.
+ */
+class RollingLatencyPercentiles
+{
+   public:
+    RollingLatencyPercentiles() = delete;
+
+    /**
+     * Creates a new RollingLatencyPercentiles
+     *
+     * @param window_size How many of the most recent latencies to keep
+     *
+     * @throws std::invalid_argument if the window size is 0
+     */
+    explicit RollingLatencyPercentiles(std::size_t window_size);
+
+    /**
+     * Adds a latency, replacing the oldest latency if the window is full
+     *
+     * @param latency_ms The latency in milliseconds
+     */
+    void addLatency(double latency_ms);
+
+    /**
+     * Returns the given percentile of the latencies in the window, using the nearest
+     * rank method
+     *
+     * @param percentile The percentile, in the range [0, 100]
+     *
+     * @return the given percentile of the latencies, or 0 if there are no latencies
+     */
+    double getPercentile(double percentile) const;
+
+    /**
+     * Returns the number of latencies in the window
+     *
+     * @return the number of latencies in the window
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns the distribution of the latencies in the window
+     *
+     * @return the distribution of the latencies in the window
+     */
+    std::unique_ptr<TbotsProto::LatencyDistribution> getDistribution() const;
+
+   private:
+    boost::circular_buffer<double> latencies_ms;
+};
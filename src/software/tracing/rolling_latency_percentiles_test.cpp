@@ -0,0 +1,66 @@
+#include "software/tracing/rolling_latency_percentiles.h"
+
+#include <gtest/gtest.h>
+
+TEST(RollingLatencyPercentilesTest, zero_window_size_throws)
+{
+    EXPECT_THROW(RollingLatencyPercentiles(0), std::invalid_argument);
+}
+
+TEST(RollingLatencyPercentilesTest, no_latencies)
+{
+    RollingLatencyPercentiles percentiles(10);
+
+    EXPECT_EQ(0, percentiles.size());
+    EXPECT_EQ(0.0, percentiles.getPercentile(50));
+
+    auto distribution = percentiles.getDistribution();
+    EXPECT_EQ(0, distribution->num_samples());
+    EXPECT_EQ(0.0, distribution->max_ms());
+}
+
+TEST(RollingLatencyPercentilesTest, single_latency)
+{
+    RollingLatencyPercentiles percentiles(10);
+    percentiles.addLatency(3.0);
+
+    EXPECT_EQ(3.0, percentiles.getPercentile(0));
+    EXPECT_EQ(3.0, percentiles.getPercentile(50));
+    EXPECT_EQ(3.0, percentiles.getPercentile(100));
+}
+
+TEST(RollingLatencyPercentilesTest, percentiles_of_unordered_latencies)
+{
+    RollingLatencyPercentiles percentiles(100);
+    // Add 1 to 100 out of order
+    for (int i = 0; i < 100; i++)
+    {
+        percentiles.addLatency(static_cast<double>((i * 37) % 100 + 1));
+    }
+
+    EXPECT_EQ(100, percentiles.size());
+    EXPECT_EQ(50.0, percentiles.getPercentile(50));
+    EXPECT_EQ(95.0, percentiles.getPercentile(95));
+    EXPECT_EQ(99.0, percentiles.getPercentile(99));
+    EXPECT_EQ(100.0, percentiles.getPercentile(100));
+
+    auto distribution = percentiles.getDistribution();
+    EXPECT_EQ(100, distribution->num_samples());
+    EXPECT_EQ(50.0, distribution->p50_ms());
+    EXPECT_EQ(95.0, distribution->p95_ms());
+    EXPECT_EQ(99.0, distribution->p99_ms());
+    EXPECT_EQ(100.0, distribution->max_ms());
+}
+
+TEST(RollingLatencyPercentilesTest, oldest_latencies_are_replaced_when_window_is_full)
+{
+    RollingLatencyPercentiles percentiles(3);
+    percentiles.addLatency(100.0);
+    percentiles.addLatency(1.0);
+    percentiles.addLatency(2.0);
+    percentiles.addLatency(3.0);
+
+    EXPECT_EQ(3, percentiles.size());
+    EXPECT_EQ(3.0, percentiles.getDistribution()->max_ms());
+    EXPECT_EQ(2.0, percentiles.getPercentile(50));
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "software/util/memory/monotonic_arena.h"
+
+/**
+ * An allocator for standard containers that allocates from a MonotonicArena, or from the
+ * heap if it has no arena. By default it uses the current arena of the thread that
+ * created it, so containers created while an arena is current (ex. during an AI tick)
+ * allocate from that arena without their owner having to pass it around.
+ *
+ * Like std::pmr::polymorphic_allocator, copying a container does not copy its arena, so
+ * a container that outlives the arena can be made by copying one that is allocated from
+ * it.
+ *
+ * NOTE: Containers using this allocator must be destroyed before their arena is
+ * released. Since the arena is picked up implicitly, this is easy to get wrong, so each
+ * allocator remembers the generation of its arena when it was created and asserts that
+ * it is still current whenever it allocates or frees memory (ex. when a container that
+ * outlived its arena is destroyed)
+ *
+ * @tparam T The type to allocate
+ */
+template <typename T>
+class ArenaAllocator
+{
+   public:
+    using value_type = T;
+
+    /**
+     * Creates an ArenaAllocator that allocates from the current arena of the calling
+     * thread, or from the heap if it doesn't have one
+     */
+    ArenaAllocator() noexcept : ArenaAllocator(MonotonicArena::getCurrentArena()) {}
+
+    /**
+     * Creates an ArenaAllocator that allocates from the given arena
+     *
+     * @param arena The arena to allocate from, or nullptr to allocate from the heap
+     */
+    explicit ArenaAllocator(MonotonicArena* arena) noexcept
+        : arena(arena), generation(arena ? arena->getGeneration() : 0)
+    {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+        : arena(other.getArena()), generation(other.getGeneration())
+    {
+    }
+
+    /**
+     * Allocates memory for the given number of objects
+     *
+     * @param n The number of objects to allocate memory for
+     *
+     * @return the allocated memory
+     */
+    T* allocate(std::size_t n)
+    {
+        if (arena)
+        {
+            assert(arena->getGeneration() == generation &&
+                   "ArenaAllocator used after its arena was released");
+            return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    /**
+     * Frees memory allocated by this allocator. This does nothing if the memory was
+     * allocated from an arena, since the arena frees it when it is released
+     *
+     * @param ptr The memory to free
+     * @param n The number of objects the memory was allocated for
+     */
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        if (!arena)
+        {
+            std::allocator<T>().deallocate(ptr, n);
+        }
+        else
+        {
+            assert(arena->getGeneration() == generation &&
+                   "Container outlived the release of its arena");
+        }
+    }
+
+    /**
+     * Returns the allocator a copy of a container should use, which allocates from the
+     * heap so that the copy can outlive the arena
+     *
+     * @return the allocator for the copy of a container
+     */
+    ArenaAllocator select_on_container_copy_construction() const noexcept
+    {
+        return ArenaAllocator(nullptr);
+    }
+
+    /**
+     * Returns the arena this allocator allocates from
+     *
+     * @return the arena this allocator allocates from, or nullptr if it allocates from
+     * the heap
+     */
+    MonotonicArena* getArena() const noexcept
+    {
+        return arena;
+    }
+
+    /**
+     * Returns the generation of the arena when this allocator was created
+     *
+     * @return the generation of the arena when this allocator was created, or 0 if it
+     * allocates from the heap
+     */
+    std::size_t getGeneration() const noexcept
+    {
+        return generation;
+    }
+
+   private:
+    MonotonicArena* arena;
+    std::size_t generation;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+{
+    return lhs.getArena() == rhs.getArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+// Standard containers that allocate from the current arena when they are created
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+template <typename Key, typename Compare = std::less<Key>>
+using ArenaSet = std::set<Key, Compare, ArenaAllocator<Key>>;
+
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+using ArenaMap =
+    std::map<Key, Value, Compare, ArenaAllocator<std::pair<const Key, Value>>>;
@@ -0,0 +1,118 @@
+#include "software/util/memory/arena_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(ArenaAllocatorTest, allocates_from_heap_without_current_arena)
+{
+    ArenaVector<int> vector = {1, 2, 3};
+
+    EXPECT_EQ(nullptr, vector.get_allocator().getArena());
+    EXPECT_EQ(3, vector.back());
+}
+
+TEST(ArenaAllocatorTest, allocates_from_current_arena)
+{
+    MonotonicArena arena(1024);
+    ScopedCurrentArena scoped_arena(arena);
+
+    ArenaVector<int> vector = {1, 2, 3};
+
+    EXPECT_EQ(&arena, vector.get_allocator().getArena());
+    EXPECT_GE(arena.getBytesAllocated(), 3 * sizeof(int));
+    EXPECT_EQ(3, vector.back());
+}
+
+TEST(ArenaAllocatorTest, allocates_from_given_arena)
+{
+    MonotonicArena arena(1024);
+
+    ArenaVector<int> vector{ArenaAllocator<int>(&arena)};
+    vector.push_back(1);
+
+    EXPECT_EQ(&arena, vector.get_allocator().getArena());
+    EXPECT_GE(arena.getBytesAllocated(), sizeof(int));
+}
+
+TEST(ArenaAllocatorTest, arena_is_captured_when_container_is_created)
+{
+    MonotonicArena arena(1024);
+    ArenaVector<int> heap_vector;
+
+    {
+        ScopedCurrentArena scoped_arena(arena);
+        heap_vector.push_back(1);
+    }
+
+    EXPECT_EQ(nullptr, heap_vector.get_allocator().getArena());
+    EXPECT_EQ(0, arena.getBytesAllocated());
+}
+
+TEST(ArenaAllocatorTest, node_containers_allocate_from_current_arena)
+{
+    MonotonicArena arena(1024);
+    ScopedCurrentArena scoped_arena(arena);
+
+    ArenaMap<int, std::string> map;
+    map[1]            = "one";
+    map[2]            = "two";
+    ArenaSet<int> set = {3, 1, 2};
+
+    EXPECT_GE(arena.getBytesAllocated(),
+              2 * sizeof(std::pair<const int, std::string>) + 3 * sizeof(int));
+    EXPECT_EQ("two", map.at(2));
+    EXPECT_EQ(1, *set.begin());
+}
+
+TEST(ArenaAllocatorTest, copies_allocate_from_heap)
+{
+    MonotonicArena arena(1024);
+    ArenaVector<int> copy;
+
+    {
+        ScopedCurrentArena scoped_arena(arena);
+        ArenaVector<int> vector = {1, 2, 3};
+        copy                    = ArenaVector<int>(vector);
+    }
+    arena.release();
+
+    EXPECT_EQ(nullptr, copy.get_allocator().getArena());
+    EXPECT_EQ(ArenaVector<int>({1, 2, 3}), copy);
+}
+
+TEST(ArenaAllocatorTest, allocators_are_equal_if_they_use_the_same_arena)
+{
+    MonotonicArena arena(1024);
+    MonotonicArena other_arena(1024);
+
+    EXPECT_EQ(ArenaAllocator<int>(&arena), ArenaAllocator<double>(&arena));
+    EXPECT_NE(ArenaAllocator<int>(&arena), ArenaAllocator<int>(&other_arena));
+    EXPECT_NE(ArenaAllocator<int>(&arena), ArenaAllocator<int>(nullptr));
+}
+
+TEST(ArenaAllocatorTest, allocator_remembers_generation_of_its_arena)
+{
+    MonotonicArena arena(1024);
+    arena.release();
+
+    ArenaAllocator<int> allocator(&arena);
+    arena.release();
+
+    EXPECT_EQ(1, allocator.getGeneration());
+    EXPECT_EQ(1, ArenaAllocator<double>(allocator).getGeneration());
+    EXPECT_EQ(2, ArenaAllocator<int>(&arena).getGeneration());
+}
+
+TEST(ArenaAllocatorTest, container_outliving_release_of_its_arena_asserts)
+{
+    auto destroy_vector_after_release = []() {
+        MonotonicArena arena(1024);
+        ScopedCurrentArena scoped_arena(arena);
+        ArenaVector<int> vector = {1, 2, 3};
+        arena.release();
+    };
+
+    EXPECT_DEBUG_DEATH(destroy_vector_after_release(),
+                       "Container outlived the release of its arena");
+}
@@ -0,0 +1,123 @@
+#include "software/util/memory/monotonic_arena.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+    thread_local MonotonicArena* current_arena = nullptr;
+}  // namespace
+
+MonotonicArena::MonotonicArena(std::size_t initial_block_size)
+    : block(),
+      block_size(initial_block_size),
+      block_used(0),
+      overflow_blocks(),
+      overflow_block_size(0),
+      overflow_block_used(0),
+      bytes_allocated(0),
+      generation(0)
+{
+    if (initial_block_size == 0)
+    {
+        throw std::invalid_argument("MonotonicArena initial block size must be > 0");
+    }
+    block = std::make_unique<std::byte[]>(block_size);
+}
+
+void* MonotonicArena::allocate(std::size_t size, std::size_t alignment)
+{
+    // Allocating 0 bytes must still return a unique pointer
+    size = std::max<std::size_t>(size, 1);
+
+    const std::size_t block_used_before = block_used;
+    if (void* ptr =
+            allocateFromBlock(block.get(), block_size, block_used, size, alignment))
+    {
+        bytes_allocated += block_used - block_used_before;
+        return ptr;
+    }
+
+    if (!overflow_blocks.empty())
+    {
+        const std::size_t overflow_block_used_before = overflow_block_used;
+        if (void* ptr =
+                allocateFromBlock(overflow_blocks.back().get(), overflow_block_size,
+                                  overflow_block_used, size, alignment))
+        {
+            bytes_allocated += overflow_block_used - overflow_block_used_before;
+            return ptr;
+        }
+    }
+
+    // Leave enough space to align the allocation
+    overflow_block_size = std::max(MIN_OVERFLOW_BLOCK_SIZE, size + alignment);
+    overflow_block_used = 0;
+    overflow_blocks.emplace_back(std::make_unique<std::byte[]>(overflow_block_size));
+    void* ptr = allocateFromBlock(overflow_blocks.back().get(), overflow_block_size,
+                                  overflow_block_used, size, alignment);
+    bytes_allocated += overflow_block_used;
+    return ptr;
+}
+
+void MonotonicArena::release()
+{
+    if (!overflow_blocks.empty())
+    {
+        // Everything allocated since the last release didn't fit in the block, so we
+        // grow it to fit all of it next time
+        overflow_blocks.clear();
+        block_size = std::max(block_size * 2, bytes_allocated);
+        block      = std::make_unique<std::byte[]>(block_size);
+    }
+    block_used          = 0;
+    overflow_block_size = 0;
+    overflow_block_used = 0;
+    bytes_allocated     = 0;
+    generation++;
+}
+
+std::size_t MonotonicArena::getBytesAllocated() const
+{
+    return bytes_allocated;
+}
+
+std::size_t MonotonicArena::getBlockSize() const
+{
+    return block_size;
+}
+
+std::size_t MonotonicArena::getGeneration() const
+{
+    return generation;
+}
+
+MonotonicArena* MonotonicArena::getCurrentArena()
+{
+    return current_arena;
+}
+
+void* MonotonicArena::allocateFromBlock(std::byte* block, std::size_t block_size,
+                                        std::size_t& block_used, std::size_t size,
+                                        std::size_t alignment)
+{
+    void* ptr              = block + block_used;
+    std::size_t space_left = block_size - block_used;
+    if (!std::align(alignment, size, ptr, space_left))
+    {
+        return nullptr;
+    }
+    block_used = block_size - space_left + size;
+    return ptr;
+}
+
+ScopedCurrentArena::ScopedCurrentArena(MonotonicArena& arena)
+    : previous_arena(current_arena)
+{
+    current_arena = &arena;
+}
+
+ScopedCurrentArena::~ScopedCurrentArena()
+{
+    current_arena = previous_arena;
+}
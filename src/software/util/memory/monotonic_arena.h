@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * A monotonic arena allocates memory by moving a pointer forward through a large block,
+ * and frees everything it allocated at once when it is released. Freeing individual
+ * allocations does nothing. This makes allocating very fast and avoids fragmenting the
+ * heap with many short-lived allocations, as long as everything allocated from the arena
+ * is destroyed before it is released.
+ *
+ * If the block runs out of space, extra blocks are allocated from the heap. When the
+ * arena is released, the block grows to fit everything that was allocated, so an arena
+ * that is released regularly (ex. every AI tick) stops allocating from the heap once it
+ * has seen its largest workload.
+ *
+ * Each thread can have a current arena (see ScopedCurrentArena), which ArenaAllocators
+ * created on that thread allocate from by default.
+ *
+ * NOTE: An arena must only be used by one thread at a time
+ */
+class MonotonicArena
+{
+   public:
+    MonotonicArena() = delete;
+
+    /**
+     * Creates a new MonotonicArena
+     *
+     * @param initial_block_size The size of the block to allocate from, in bytes
+     *
+     * @throws std::invalid_argument if the initial block size is 0
+     */
+    explicit MonotonicArena(std::size_t initial_block_size);
+
+    // Memory allocated from the arena points into it, so it can't be copied or moved
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    /**
+     * Allocates memory from the arena
+     *
+     * @param size The number of bytes to allocate
+     * @param alignment The alignment of the memory, which must be a power of 2
+     *
+     * @return the allocated memory
+     */
+    void* allocate(std::size_t size, std::size_t alignment);
+
+    /**
+     * Frees all the memory allocated from the arena. Everything allocated from the
+     * arena must have been destroyed before this is called
+     */
+    void release();
+
+    /**
+     * Returns the number of bytes allocated since the arena was last released,
+     * including padding for alignment
+     *
+     * @return the number of bytes allocated
+     */
+    std::size_t getBytesAllocated() const;
+
+    /**
+     * Returns the size of the block the arena allocates from before it has to allocate
+     * from the heap
+     *
+     * @return the size of the block in bytes
+     */
+    std::size_t getBlockSize() const;
+
+    /**
+     * Returns the generation of the arena, which is the number of times it has been
+     * released. Memory allocated from the arena is only valid while the generation it
+     * was allocated in is current
+     *
+     * @return the generation of the arena
+     */
+    std::size_t getGeneration() const;
+
+    /**
+     * Returns the current arena of the calling thread
+     *
+     * @return the current arena of the calling thread, or nullptr if it doesn't have one
+     */
+    static MonotonicArena* getCurrentArena();
+
+   private:
+    friend class ScopedCurrentArena;
+
+    /**
+     * Allocates from the end of the given block if there is enough space left
+     *
+     * @param block The block to allocate from
+     * @param block_size The size of the block
+     * @param block_used The number of bytes used in the block, which is updated
+     * @param size The number of bytes to allocate
+     * @param alignment The alignment of the memory
+     *
+     * @return the allocated memory, or nullptr if there isn't enough space left
+     */
+    void* allocateFromBlock(std::byte* block, std::size_t block_size,
+                            std::size_t& block_used, std::size_t size,
+                            std::size_t alignment);
+
+    // The smallest block to allocate from the heap when the block runs out of space
+    static constexpr std::size_t MIN_OVERFLOW_BLOCK_SIZE = 64 * 1024;
+
+    std::unique_ptr<std::byte[]> block;
+    std::size_t block_size;
+    std::size_t block_used;
+    // Blocks allocated from the heap when the block ran out of space, which are freed
+    // when the arena is released. Only the last one is allocated from
+    std::vector<std::unique_ptr<std::byte[]>> overflow_blocks;
+    std::size_t overflow_block_size;
+    std::size_t overflow_block_used;
+    std::size_t bytes_allocated;
+    std::size_t generation;
+};
+
+/**
+ * Makes the given arena the current arena of the calling thread for as long as this
+ * object exists, restoring the previous current arena when it is destroyed
+ */
+class ScopedCurrentArena
+{
+   public:
+    ScopedCurrentArena() = delete;
+
+    /**
+     * Makes the given arena the current arena of the calling thread
+     *
+     * @param arena The arena to make current
+     */
+    explicit ScopedCurrentArena(MonotonicArena& arena);
+
+    // Copying this class is not permitted, since the previous arena must only be
+    // restored once
+    ScopedCurrentArena(const ScopedCurrentArena&) = delete;
+    ScopedCurrentArena& operator=(const ScopedCurrentArena&) = delete;
+
+    ~ScopedCurrentArena();
+
+   private:
+    MonotonicArena* previous_arena;
+};
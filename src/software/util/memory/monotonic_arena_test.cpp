@@ -0,0 +1,132 @@
+#include "software/util/memory/monotonic_arena.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+TEST(MonotonicArenaTest, construct_with_zero_block_size)
+{
+    EXPECT_THROW(MonotonicArena(0), std::invalid_argument);
+}
+
+TEST(MonotonicArenaTest, allocations_are_aligned_and_do_not_overlap)
+{
+    MonotonicArena arena(1024);
+
+    auto* a = static_cast<char*>(arena.allocate(3, 1));
+    auto* b = static_cast<char*>(arena.allocate(8, 8));
+    auto* c = static_cast<char*>(arena.allocate(64, 64));
+
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(b) % 8);
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(c) % 64);
+    EXPECT_LE(a + 3, b);
+    EXPECT_LE(b + 8, c);
+
+    std::memset(a, 1, 3);
+    std::memset(b, 2, 8);
+    std::memset(c, 3, 64);
+    EXPECT_EQ(1, a[2]);
+    EXPECT_EQ(2, b[7]);
+    EXPECT_EQ(3, c[63]);
+}
+
+TEST(MonotonicArenaTest, bytes_allocated_includes_padding)
+{
+    MonotonicArena arena(1024);
+
+    arena.allocate(1, 1);
+    arena.allocate(8, 8);
+
+    // The first allocation is padded so the second one is aligned
+    EXPECT_GE(arena.getBytesAllocated(), 9);
+    EXPECT_LE(arena.getBytesAllocated(), 16);
+}
+
+TEST(MonotonicArenaTest, release_reuses_the_block)
+{
+    MonotonicArena arena(1024);
+
+    void* first = arena.allocate(100, 8);
+    arena.release();
+    EXPECT_EQ(0, arena.getBytesAllocated());
+
+    void* second = arena.allocate(100, 8);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1024, arena.getBlockSize());
+}
+
+TEST(MonotonicArenaTest, release_starts_a_new_generation)
+{
+    MonotonicArena arena(1024);
+    EXPECT_EQ(0, arena.getGeneration());
+
+    arena.allocate(16, 8);
+    EXPECT_EQ(0, arena.getGeneration());
+
+    arena.release();
+    arena.release();
+    EXPECT_EQ(2, arena.getGeneration());
+}
+
+TEST(MonotonicArenaTest, allocations_larger_than_the_block_succeed)
+{
+    MonotonicArena arena(64);
+
+    auto* large = static_cast<char*>(arena.allocate(1000, 16));
+    auto* small = static_cast<char*>(arena.allocate(16, 16));
+
+    ASSERT_NE(nullptr, large);
+    ASSERT_NE(nullptr, small);
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(large) % 16);
+    std::memset(large, 1, 1000);
+    std::memset(small, 2, 16);
+    EXPECT_EQ(1, large[999]);
+    EXPECT_GE(arena.getBytesAllocated(), 1016);
+}
+
+TEST(MonotonicArenaTest, block_grows_to_fit_everything_after_overflowing)
+{
+    MonotonicArena arena(64);
+
+    for (int i = 0; i < 10; i++)
+    {
+        arena.allocate(100, 8);
+    }
+    std::size_t bytes_allocated = arena.getBytesAllocated();
+    arena.release();
+
+    EXPECT_GE(arena.getBlockSize(), bytes_allocated);
+
+    // The same allocations fit in the block now, so they are contiguous. Each one is
+    // padded to 104 bytes so that the next one is aligned
+    auto* first = static_cast<char*>(arena.allocate(100, 8));
+    for (int i = 1; i < 10; i++)
+    {
+        auto* next = static_cast<char*>(arena.allocate(100, 8));
+        EXPECT_EQ(first + 104 * i, next);
+    }
+}
+
+TEST(MonotonicArenaTest, no_current_arena_by_default)
+{
+    EXPECT_EQ(nullptr, MonotonicArena::getCurrentArena());
+}
+
+TEST(MonotonicArenaTest, scoped_current_arena_restores_previous_arena)
+{
+    MonotonicArena outer_arena(64);
+    MonotonicArena inner_arena(64);
+
+    {
+        ScopedCurrentArena outer_scope(outer_arena);
+        EXPECT_EQ(&outer_arena, MonotonicArena::getCurrentArena());
+        {
+            ScopedCurrentArena inner_scope(inner_arena);
+            EXPECT_EQ(&inner_arena, MonotonicArena::getCurrentArena());
+        }
+        EXPECT_EQ(&outer_arena, MonotonicArena::getCurrentArena());
+    }
+    EXPECT_EQ(nullptr, MonotonicArena::getCurrentArena());
+}
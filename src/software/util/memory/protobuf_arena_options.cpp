@@ -0,0 +1,10 @@
+#include "software/util/memory/protobuf_arena_options.h"
+
+google::protobuf::ArenaOptions createProtobufArenaOptions(
+    std::vector<char>& initial_block)
+{
+    google::protobuf::ArenaOptions options;
+    options.initial_block      = initial_block.data();
+    options.initial_block_size = initial_block.size();
+    return options;
+}
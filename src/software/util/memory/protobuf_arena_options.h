@@ -0,0 +1,17 @@
+#pragma once
+
+#include <google/protobuf/arena.h>
+
+#include <vector>
+
+/**
+ * Creates the options for a protobuf Arena that starts out using the given block of
+ * memory, so messages can be built on the arena without allocating until the block is
+ * full. The block must outlive the arena.
+ *
+ * @param initial_block The block of memory for the arena to use
+ *
+ * @return the arena options
+ */
+google::protobuf::ArenaOptions createProtobufArenaOptions(
+    std::vector<char>& initial_block);
@@ -14,7 +14,8 @@ World::World(const Field &field, const Ball &ball, const Team &friendly_team,
       // Store a small buffer of previous referee commands so we can filter out noise
       referee_command_history_(REFEREE_COMMAND_BUFFER_SIZE),
       referee_stage_history_(REFEREE_COMMAND_BUFFER_SIZE),
-      team_with_possesion_(TeamSide::ENEMY)
+      team_with_possesion_(TeamSide::ENEMY),
+      trace_id_(0)
 {
     updateTimestamp(getMostRecentTimestampFromMembers());
 }
@@ -167,3 +168,13 @@ TeamSide World::getTeamWithPossession() const
 {
     return team_with_possesion_;
 }
+
+void World::setTraceId(uint64_t trace_id)
+{
+    trace_id_ = trace_id;
+}
+
+uint64_t World::getTraceId() const
+{
+    return trace_id_;
+}
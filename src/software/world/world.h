@@ -167,10 +167,26 @@ class World final
      */
     TeamSide getTeamWithPossession() const;
 
+    /**
+     * Sets the id of the trace of the most recent vision packet this World was updated
+     * with, so the latency of the pipeline can be measured. See PipelineTracer
+     *
+     * @param trace_id The id of the trace
+     */
+    void setTraceId(uint64_t trace_id);
+
+    /**
+     * Gets the id of the trace of the most recent vision packet this World was updated
+     * with
+     *
+     * @return the id of the trace, or 0 if this World is not traced
+     */
+    uint64_t getTraceId() const;
+
     /**
      * Defines the equality operator for a World. Worlds are equal if their field, ball
      * friendly_team, enemy_team and game_state are equal. The last update
-     * timestamp and histories are not part of the equality.
+     * timestamp, trace id and histories are not part of the equality.
      *
      * @param other The world to compare against for equality
      * @return True if the other robot is equal to this world, and false otherwise
@@ -208,4 +224,6 @@ class World final
     boost::circular_buffer<RefereeStage> referee_stage_history_;
     // which team has possession of the ball
     TeamSide team_with_possesion_;
+    // the trace of the most recent vision packet, for measuring the pipeline latency
+    uint64_t trace_id_;
 };